@@ -83,6 +83,9 @@ function(open3d_set_global_properties target)
             target_compile_definitions(${target} PRIVATE BUILD_CACHED_CUDA_MANAGER)
         endif()
     endif()
+    if (BUILD_POOLED_CPU_MANAGER)
+        target_compile_definitions(${target} PRIVATE BUILD_POOLED_CPU_MANAGER)
+    endif()
     if (BUILD_ISPC_MODULE)
         target_compile_definitions(${target} PRIVATE BUILD_ISPC_MODULE)
     endif()
@@ -525,15 +525,35 @@ void HashReserveInt3(benchmark::State& state,
     ENUM_BM_CAPACITY(FN, 32, DEVICE, BACKEND)
 
 #ifdef BUILD_CUDA_MODULE
-#define ENUM_BM_BACKEND(FN)                                     \
-    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashBackendType::TBB)   \
-    ENUM_BM_FACTOR(FN, Device("CUDA:0"), HashBackendType::Slab) \
+#define ENUM_BM_BACKEND(FN)                                              \
+    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashBackendType::TBB)            \
+    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashBackendType::OpenAddressing) \
+    ENUM_BM_FACTOR(FN, Device("CUDA:0"), HashBackendType::Slab)          \
     ENUM_BM_FACTOR(FN, Device("CUDA:0"), HashBackendType::StdGPU)
 #else
-#define ENUM_BM_BACKEND(FN) \
-    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashBackendType::TBB)
+#define ENUM_BM_BACKEND(FN)                                   \
+    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashBackendType::TBB) \
+    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashBackendType::OpenAddressing)
 #endif
 
+// Large scale insert/find throughput of the CPU backends, 10M and 100M keys.
+// The 100M int3 case needs a few GB of memory.
+#define ENUM_BM_LARGE_CAPACITY(FN, FACTOR, BACKEND)                        \
+    BENCHMARK_CAPTURE(FN, BACKEND##_10000000_##FACTOR, 10000000, FACTOR,   \
+                      Device("CPU:0"), BACKEND)                            \
+            ->Unit(benchmark::kMillisecond)                                \
+            ->Iterations(3);                                               \
+    BENCHMARK_CAPTURE(FN, BACKEND##_100000000_##FACTOR, 100000000, FACTOR, \
+                      Device("CPU:0"), BACKEND)                            \
+            ->Unit(benchmark::kMillisecond)                                \
+            ->Iterations(1);
+
+#define ENUM_BM_LARGE_BACKEND(FN)                                  \
+    ENUM_BM_LARGE_CAPACITY(FN, 1, HashBackendType::TBB)            \
+    ENUM_BM_LARGE_CAPACITY(FN, 8, HashBackendType::TBB)            \
+    ENUM_BM_LARGE_CAPACITY(FN, 1, HashBackendType::OpenAddressing) \
+    ENUM_BM_LARGE_CAPACITY(FN, 8, HashBackendType::OpenAddressing)
+
 ENUM_BM_BACKEND(HashInsertInt)
 ENUM_BM_BACKEND(HashInsertInt3)
 ENUM_BM_BACKEND(HashEraseInt)
@@ -545,5 +565,10 @@ ENUM_BM_BACKEND(HashClearInt3)
 ENUM_BM_BACKEND(HashReserveInt)
 ENUM_BM_BACKEND(HashReserveInt3)
 
+ENUM_BM_LARGE_BACKEND(HashInsertInt)
+ENUM_BM_LARGE_BACKEND(HashInsertInt3)
+ENUM_BM_LARGE_BACKEND(HashFindInt)
+ENUM_BM_LARGE_BACKEND(HashFindInt3)
+
 }  // namespace core
 }  // namespace open3d
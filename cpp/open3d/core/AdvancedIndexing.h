@@ -212,6 +212,39 @@ public:
 
     int64_t NumWorkloads() const { return indexer_.NumWorkloads(); }
 
+    /// Calls `func(char* input_ptr, char* output_ptr)` for each workload in
+    /// [\p start, \p end). Equivalent to calling \p func with GetInputPtr() and
+    /// GetOutputPtr(), but offsets are advanced incrementally along the
+    /// innermost dimension, see Indexer::ForEachInnerLoop. Host only.
+    template <typename func_t>
+    void ForEachWorkload(int64_t start,
+                         int64_t end,
+                         const func_t& func) const {
+        const int64_t output_arg = indexer_.NumInputs();
+        const bool is_get = mode_ == AdvancedIndexerMode::GET;
+        indexer_.ForEachInnerLoop(
+                start, end,
+                [&](char* const* ptrs, const int64_t* byte_strides,
+                    int64_t n) {
+                    for (int64_t i = 0; i < n; ++i) {
+                        int64_t offset = 0;
+                        for (int64_t k = 0; k < num_indices_; ++k) {
+                            int64_t index = *reinterpret_cast<int64_t*>(
+                                    ptrs[k + 1] + i * byte_strides[k + 1]);
+                            OPEN3D_ASSERT(index >= -indexed_shape_[k] &&
+                                          index < indexed_shape_[k] &&
+                                          "Index out of bounds.");
+                            index += indexed_shape_[k] * (index < 0);
+                            offset += index * indexed_strides_[k];
+                        }
+                        offset *= element_byte_size_;
+                        func(ptrs[0] + i * byte_strides[0] + offset * is_get,
+                             ptrs[output_arg] + i * byte_strides[output_arg] +
+                                     offset * !is_get);
+                    }
+                });
+    }
+
 protected:
     Indexer indexer_;
     AdvancedIndexerMode mode_;
@@ -27,6 +27,7 @@
 #pragma once
 
 #include "open3d/core/Dtype.h"
+#include "open3d/core/Float16.h"
 #include "open3d/utility/Logging.h"
 
 /// Call a numerical templated function based on Dtype. Wrap the function to
@@ -105,3 +106,39 @@
             utility::LogError("Unsupported data type."); \
         }                                                \
     }()
+
+/// Dispatches Float16 and BFloat16 to float16_t and bfloat16_t. These types
+/// only provide storage and conversion to float, so the templated function must
+/// not rely on std::is_arithmetic or std::numeric_limits of scalar_t.
+#define DISPATCH_HALF_DTYPE_TO_TEMPLATE(DTYPE, ...)      \
+    [&] {                                                \
+        if (DTYPE == open3d::core::Float16) {            \
+            using scalar_t = open3d::core::float16_t;    \
+            return __VA_ARGS__();                        \
+        } else if (DTYPE == open3d::core::BFloat16) {    \
+            using scalar_t = open3d::core::bfloat16_t;   \
+            return __VA_ARGS__();                        \
+        } else {                                         \
+            utility::LogError("Unsupported data type."); \
+        }                                                \
+    }()
+
+#define DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(DTYPE, ...)                \
+    [&] {                                                               \
+        if (DTYPE == open3d::core::Float16 ||                           \
+            DTYPE == open3d::core::BFloat16) {                          \
+            return DISPATCH_HALF_DTYPE_TO_TEMPLATE(DTYPE, __VA_ARGS__); \
+        } else {                                                        \
+            return DISPATCH_DTYPE_TO_TEMPLATE(DTYPE, __VA_ARGS__);      \
+        }                                                               \
+    }()
+
+#define DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(DTYPE, ...)            \
+    [&] {                                                                    \
+        if (DTYPE == open3d::core::Float16 ||                                \
+            DTYPE == open3d::core::BFloat16) {                               \
+            return DISPATCH_HALF_DTYPE_TO_TEMPLATE(DTYPE, __VA_ARGS__);      \
+        } else {                                                             \
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(DTYPE, __VA_ARGS__);        \
+        }                                                                    \
+    }()
@@ -30,6 +30,8 @@ namespace open3d {
 namespace core {
 
 // clang-format off
+static_assert(sizeof(float16_t ) == 2, "Unsupported platform: float16_t must be 2 bytes." );
+static_assert(sizeof(bfloat16_t) == 2, "Unsupported platform: bfloat16_t must be 2 bytes.");
 static_assert(sizeof(float   ) == 4, "Unsupported platform: float must be 4 bytes."   );
 static_assert(sizeof(double  ) == 8, "Unsupported platform: double must be 8 bytes."  );
 static_assert(sizeof(int     ) == 4, "Unsupported platform: int must be 4 bytes."     );
@@ -44,6 +46,8 @@ static_assert(sizeof(uint64_t) == 8, "Unsupported platform: uint64_t must be 8 b
 static_assert(sizeof(bool    ) == 1, "Unsupported platform: bool must be 1 byte."     );
 
 const Dtype Dtype::Undefined(Dtype::DtypeCode::Undefined, 1, "Undefined");
+const Dtype Dtype::Float16  (Dtype::DtypeCode::Float,     2, "Float16"  );
+const Dtype Dtype::BFloat16 (Dtype::DtypeCode::Float,     2, "BFloat16" );
 const Dtype Dtype::Float32  (Dtype::DtypeCode::Float,     4, "Float32"  );
 const Dtype Dtype::Float64  (Dtype::DtypeCode::Float,     8, "Float64"  );
 const Dtype Dtype::Int8     (Dtype::DtypeCode::Int,       1, "Int8"     );
@@ -58,6 +62,8 @@ const Dtype Dtype::Bool     (Dtype::DtypeCode::Bool,      1, "Bool"     );
 // clang-format on
 
 const Dtype Undefined = Dtype::Undefined;
+const Dtype Float16 = Dtype::Float16;
+const Dtype BFloat16 = Dtype::BFloat16;
 const Dtype Float32 = Dtype::Float32;
 const Dtype Float64 = Dtype::Float64;
 const Dtype Int8 = Dtype::Int8;
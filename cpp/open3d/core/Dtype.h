@@ -31,6 +31,7 @@
 
 #include "open3d/Macro.h"
 #include "open3d/core/Dispatch.h"
+#include "open3d/core/Float16.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -39,6 +40,8 @@ namespace core {
 class OPEN3D_API Dtype {
 public:
     static const Dtype Undefined;
+    static const Dtype Float16;
+    static const Dtype BFloat16;
     static const Dtype Float32;
     static const Dtype Float64;
     static const Dtype Int8;
@@ -94,6 +97,8 @@ private:
 };
 
 OPEN3D_API extern const Dtype Undefined;
+OPEN3D_API extern const Dtype Float16;
+OPEN3D_API extern const Dtype BFloat16;
 OPEN3D_API extern const Dtype Float32;
 OPEN3D_API extern const Dtype Float64;
 OPEN3D_API extern const Dtype Int8;
@@ -106,6 +111,16 @@ OPEN3D_API extern const Dtype UInt32;
 OPEN3D_API extern const Dtype UInt64;
 OPEN3D_API extern const Dtype Bool;
 
+template <>
+inline const Dtype Dtype::FromType<float16_t>() {
+    return Dtype::Float16;
+}
+
+template <>
+inline const Dtype Dtype::FromType<bfloat16_t>() {
+    return Dtype::BFloat16;
+}
+
 template <>
 inline const Dtype Dtype::FromType<float>() {
     return Dtype::Float32;
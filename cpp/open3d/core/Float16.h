@@ -0,0 +1,154 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include "open3d/core/CUDAUtils.h"
+
+namespace open3d {
+namespace core {
+
+/// \brief IEEE 754 half-precision storage type.
+///
+/// float16_t only provides storage and conversions from/to float. Arithmetic
+/// is performed in float after the implicit conversion, so kernels operating on
+/// float16_t compute in single precision and round the result when storing.
+struct float16_t {
+    uint16_t bits_;
+
+    float16_t() = default;
+
+    OPEN3D_HOST_DEVICE float16_t(float value) : bits_(FromFloat(value)) {}
+
+    OPEN3D_HOST_DEVICE operator float() const { return ToFloat(bits_); }
+
+    /// Constructs from raw bits without conversion.
+    OPEN3D_HOST_DEVICE static float16_t FromBits(uint16_t bits) {
+        float16_t h;
+        h.bits_ = bits;
+        return h;
+    }
+
+private:
+    OPEN3D_HOST_DEVICE static uint32_t FloatToBits(float value) {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    OPEN3D_HOST_DEVICE static float BitsToFloat(uint32_t bits) {
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    /// Round-to-nearest-even conversion, handles subnormals, Inf and NaN.
+    OPEN3D_HOST_DEVICE static uint16_t FromFloat(float value) {
+        const uint32_t f = FloatToBits(value);
+        const uint16_t sign = static_cast<uint16_t>((f >> 16) & 0x8000u);
+        const uint32_t abs = f & 0x7fffffffu;
+        if (abs >= 0x7f800000u) {
+            // Inf or NaN, keep NaN quiet.
+            return sign | (abs > 0x7f800000u ? 0x7e00u : 0x7c00u);
+        }
+        if (abs >= 0x477ff000u) {
+            // Rounds to a value larger than the max half (65504).
+            return sign | 0x7c00u;
+        }
+        if (abs < 0x38800000u) {
+            // Subnormal half or zero. Adding 0.5 shifts the mantissa bits
+            // into place and the float addition rounds to nearest even.
+            const float shifted = BitsToFloat(abs) + 0.5f;
+            return sign | static_cast<uint16_t>(FloatToBits(shifted) -
+                                                0x3f000000u);
+        }
+        const uint32_t odd = (abs >> 13) & 1u;
+        const uint32_t rounded = abs + 0xc8000fffu + odd;
+        return sign | static_cast<uint16_t>(rounded >> 13);
+    }
+
+    OPEN3D_HOST_DEVICE static float ToFloat(uint16_t h) {
+        const uint32_t sign = static_cast<uint32_t>(h & 0x8000u) << 16;
+        const uint32_t exp = (h >> 10) & 0x1fu;
+        const uint32_t mant = h & 0x3ffu;
+        if (exp == 0x1fu) {
+            return BitsToFloat(sign | 0x7f800000u | (mant << 13));
+        }
+        if (exp == 0) {
+            // Zero or subnormal: mant * 2^-24.
+            const float magnitude = static_cast<float>(mant) * 5.9604645e-8f;
+            return BitsToFloat(sign | FloatToBits(magnitude));
+        }
+        return BitsToFloat(sign | ((exp + 112u) << 23) | (mant << 13));
+    }
+};
+
+/// \brief Brain floating point (bfloat16) storage type.
+///
+/// bfloat16_t keeps the 8-bit exponent of float and truncates the mantissa to
+/// 7 bits, so it shares the dynamic range of float at reduced precision.
+struct bfloat16_t {
+    uint16_t bits_;
+
+    bfloat16_t() = default;
+
+    OPEN3D_HOST_DEVICE bfloat16_t(float value) : bits_(FromFloat(value)) {}
+
+    OPEN3D_HOST_DEVICE operator float() const {
+        const uint32_t bits = static_cast<uint32_t>(bits_) << 16;
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    /// Constructs from raw bits without conversion.
+    OPEN3D_HOST_DEVICE static bfloat16_t FromBits(uint16_t bits) {
+        bfloat16_t b;
+        b.bits_ = bits;
+        return b;
+    }
+
+private:
+    /// Round-to-nearest-even conversion, keeps NaN quiet.
+    OPEN3D_HOST_DEVICE static uint16_t FromFloat(float value) {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        if ((bits & 0x7fffffffu) > 0x7f800000u) {
+            return static_cast<uint16_t>((bits >> 16) | 0x0040u);
+        }
+        const uint32_t odd = (bits >> 16) & 1u;
+        return static_cast<uint16_t>((bits + 0x7fffu + odd) >> 16);
+    }
+};
+
+static_assert(sizeof(float16_t) == 2, "float16_t must be 2 bytes.");
+static_assert(sizeof(bfloat16_t) == 2, "bfloat16_t must be 2 bytes.");
+
+}  // namespace core
+}  // namespace open3d
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <sstream>
 
 #include "open3d/core/CUDAUtils.h"
@@ -496,6 +497,125 @@ public:
                                      workload_idx);
     }
 
+    /// Iterates the workloads in [\p start, \p end) in runs along the innermost
+    /// dimension of the master shape. For each run,
+    /// `loop(char* const* ptrs, const int64_t* byte_strides, int64_t n)` is
+    /// called, where \p ptrs holds the data pointers of all inputs followed by
+    /// all outputs for the first workload of the run, and \p byte_strides
+    /// holds their constant byte strides between consecutive workloads in the
+    /// run. E.g. for a (N, 3) + (1, 3) broadcast, the rhs byte stride is the
+    /// element size and runs have length 3, while a contiguous (N, 3) + (N, 3)
+    /// op is iterated as a single run.
+    ///
+    /// Offsets are only computed with div/mod at the beginning of \p start and
+    /// whenever the second innermost dimension wraps around. Otherwise,
+    /// pointers are advanced incrementally from run to run.
+    ///
+    /// Host only. The caller handles parallelism, e.g. by calling this on
+    /// disjoint ranges from ParallelForRange.
+    template <typename func_t>
+    void ForEachInnerLoop(int64_t start,
+                          int64_t end,
+                          const func_t& loop) const {
+        if (start >= end) {
+            return;
+        }
+        const int64_t num_args = num_inputs_ + num_outputs_;
+        const TensorRef* refs[MAX_INPUTS + MAX_OUTPUTS];
+        bool contiguous[MAX_INPUTS + MAX_OUTPUTS];
+        for (int64_t k = 0; k < num_inputs_; ++k) {
+            refs[k] = &inputs_[k];
+            contiguous[k] = inputs_contiguous_[k];
+        }
+        for (int64_t k = 0; k < num_outputs_; ++k) {
+            refs[num_inputs_ + k] = &outputs_[k];
+            contiguous[num_inputs_ + k] = outputs_contiguous_[k];
+        }
+
+        char* ptrs[MAX_INPUTS + MAX_OUTPUTS];
+        int64_t inner_strides[MAX_INPUTS + MAX_OUTPUTS];
+        if (ndims_ == 0) {
+            for (int64_t k = 0; k < num_args; ++k) {
+                ptrs[k] = static_cast<char*>(refs[k]->data_ptr_);
+                inner_strides[k] = 0;
+            }
+            loop(ptrs, inner_strides, end - start);
+            return;
+        }
+
+        // Merge trailing dimensions into one run as long as every operand
+        // keeps a constant byte stride across them.
+        int64_t inner_dim = ndims_ - 1;
+        int64_t inner_size = master_shape_[inner_dim];
+        for (int64_t k = 0; k < num_args; ++k) {
+            inner_strides[k] = refs[k]->byte_strides_[inner_dim];
+        }
+        while (inner_dim > 0) {
+            const int64_t dim = inner_dim - 1;
+            bool mergeable = true;
+            if (master_shape_[dim] != 1 && inner_size != 1) {
+                for (int64_t k = 0; k < num_args; ++k) {
+                    if (refs[k]->byte_strides_[dim] !=
+                        inner_size * inner_strides[k]) {
+                        mergeable = false;
+                        break;
+                    }
+                }
+            }
+            if (!mergeable) {
+                break;
+            }
+            if (inner_size == 1) {
+                for (int64_t k = 0; k < num_args; ++k) {
+                    inner_strides[k] = refs[k]->byte_strides_[dim];
+                }
+            }
+            inner_size *= master_shape_[dim];
+            inner_dim = dim;
+        }
+
+        const int64_t outer_size =
+                inner_dim > 0 ? master_shape_[inner_dim - 1] : 1;
+        int64_t outer_strides[MAX_INPUTS + MAX_OUTPUTS];
+        for (int64_t k = 0; k < num_args; ++k) {
+            outer_strides[k] =
+                    inner_dim > 0 ? refs[k]->byte_strides_[inner_dim - 1] : 0;
+        }
+
+        // Pointers to the first workload of the current row.
+        char* row_ptrs[MAX_INPUTS + MAX_OUTPUTS];
+        int64_t col = start % inner_size;
+        int64_t row = start / inner_size;
+        for (int64_t k = 0; k < num_args; ++k) {
+            row_ptrs[k] = GetWorkloadDataPtr(*refs[k], contiguous[k],
+                                             start - col);
+        }
+        for (int64_t workload_idx = start; workload_idx < end;) {
+            const int64_t n = std::min(inner_size - col, end - workload_idx);
+            for (int64_t k = 0; k < num_args; ++k) {
+                ptrs[k] = row_ptrs[k] + col * inner_strides[k];
+            }
+            loop(ptrs, inner_strides, n);
+
+            workload_idx += n;
+            col = 0;
+            ++row;
+            if (workload_idx >= end) {
+                break;
+            }
+            if (row % outer_size != 0) {
+                for (int64_t k = 0; k < num_args; ++k) {
+                    row_ptrs[k] += outer_strides[k];
+                }
+            } else {
+                for (int64_t k = 0; k < num_args; ++k) {
+                    row_ptrs[k] = GetWorkloadDataPtr(*refs[k], contiguous[k],
+                                                     workload_idx);
+                }
+            }
+        }
+    }
+
 #ifdef BUILD_ISPC_MODULE
     /// Converts this object to an corresponsing ISPC-compatible object.
     ispc::Indexer ToISPC() const;
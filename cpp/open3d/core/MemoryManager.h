@@ -45,7 +45,9 @@ class DeviceMemoryManager;
 ///
 /// The memory managers are dispatched as follows:
 ///
-/// DeviceType = CPU : CPUMemoryManager
+/// DeviceType = CPU :
+///   BUILD_POOLED_CPU_MANAGER = ON : PooledCPUMemoryManager
+///   Otherwise :                     CPUMemoryManager
 /// DeviceType = CUDA :
 ///   BUILD_CACHED_CUDA_MANAGER = ON : CachedMemoryManager w/ CUDAMemoryManager
 ///   Otherwise :                      CUDAMemoryManager
@@ -175,6 +177,87 @@ public:
                 size_t num_bytes) override;
 };
 
+/// Pooled memory manager for the CPU. Allocations are rounded up to size
+/// classes and aligned to 64 bytes for SIMD loads. Freed blocks are reused by
+/// later allocations of the same size class, which avoids repeated calls to
+/// \p std::malloc for short-lived temporaries.
+///
+/// - Freed blocks first go to a cache of the calling thread, whose lock is
+/// uncontended unless the caches are released. If the thread cache is full,
+/// they go to a pool shared by all threads. If the pool is full as well, they
+/// are freed directly.
+///
+/// - Allocations larger than the largest size class are not pooled.
+///
+/// - Cached blocks are released either manually by calling \p ReleaseCache or
+/// automatically if a direct allocation fails. Thread caches are returned to
+/// the shared pool when their thread exits.
+///
+/// Cached memory is not returned to the system on its own, so the manager is
+/// only used if Open3D is built with BUILD_POOLED_CPU_MANAGER=ON (OFF by
+/// default). Cache hits and misses are recorded in MemoryManagerStatistic if
+/// enabled with MemoryManagerStatistic::SetCountCacheAccesses.
+class PooledCPUMemoryManager : public DeviceMemoryManager {
+public:
+    /// Allocates memory of \p byte_size bytes on device \p device and returns a
+    /// pointer to the beginning of the allocated memory block.
+    void* Malloc(size_t byte_size, const Device& device) override;
+
+    /// Frees previously allocated memory at address \p ptr on device \p device.
+    void Free(void* ptr, const Device& device) override;
+
+    /// Copies \p num_bytes bytes of memory at address \p src_ptr on device
+    /// \p src_device to address \p dst_ptr on device \p dst_device.
+    void Memcpy(void* dst_ptr,
+                const Device& dst_device,
+                const void* src_ptr,
+                const Device& src_device,
+                size_t num_bytes) override;
+
+public:
+    /// Frees all blocks in the shared pool and in the caches of all threads.
+    static void ReleaseCache();
+
+    /// Returns the number of bytes cached in the shared pool and in the caches
+    /// of all threads.
+    static size_t GetCachedByteSize();
+};
+
+/// Direct memory manager for page-locked (pinned) host memory. Copies between
+/// pinned memory and CUDA devices do not need to be staged through an internal
+/// buffer and can overlap with other work.
+///
+/// - With BUILD_CUDA_MODULE = ON, memory is allocated via \p cudaHostAlloc.
+///
+/// - Otherwise, page-aligned memory is locked via \p mlock (\p VirtualLock on
+/// Windows). Locking is best-effort since the amount of lockable memory may be
+/// limited by the operating system.
+///
+/// Pinned memory is not returned by MemoryManager::Malloc, use
+/// Tensor::PinMemory instead.
+class PinnedCPUMemoryManager : public DeviceMemoryManager {
+public:
+    /// Allocates memory of \p byte_size bytes on device \p device and returns a
+    /// pointer to the beginning of the allocated memory block.
+    void* Malloc(size_t byte_size, const Device& device) override;
+
+    /// Frees previously allocated memory at address \p ptr on device \p device.
+    void Free(void* ptr, const Device& device) override;
+
+    /// Copies \p num_bytes bytes of memory at address \p src_ptr on device
+    /// \p src_device to address \p dst_ptr on device \p dst_device.
+    void Memcpy(void* dst_ptr,
+                const Device& dst_device,
+                const void* src_ptr,
+                const Device& src_device,
+                size_t num_bytes) override;
+
+public:
+    /// Returns true if \p ptr points into a block allocated by any
+    /// PinnedCPUMemoryManager.
+    static bool IsPinned(const void* ptr);
+};
+
 #ifdef BUILD_CUDA_MODULE
 /// Direct memory manager which performs allocations and deallocations on CUDA
 /// devices via \p cudaMalloc and \p cudaFree.
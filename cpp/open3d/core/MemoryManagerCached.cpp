@@ -34,6 +34,7 @@
 #include <vector>
 
 #include "open3d/core/MemoryManager.h"
+#include "open3d/core/MemoryManagerStatistic.h"
 #include "open3d/utility/Logging.h"
 
 #ifdef BUILD_CUDA_MODULE
@@ -405,8 +406,10 @@ public:
         // Malloc from cache.
         void* ptr = device_caches_.at(device).Malloc(internal_byte_size);
         if (ptr != nullptr) {
+            MemoryManagerStatistic::GetInstance().CountCacheHit(device);
             return ptr;
         }
+        MemoryManagerStatistic::GetInstance().CountCacheMiss(device);
 
         // Malloc from real memory manager.
         try {
@@ -0,0 +1,170 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+
+#ifdef _WIN32
+#include <malloc.h>
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/MemoryManager.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+/// Registry of the blocks allocated by PinnedCPUMemoryManager, mapping the
+/// beginning of each block to its byte size.
+class PinnedBlockRegistry {
+public:
+    static PinnedBlockRegistry& GetInstance() {
+        static PinnedBlockRegistry instance;
+        return instance;
+    }
+
+    void Insert(const void* ptr, size_t byte_size) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        blocks_[reinterpret_cast<uintptr_t>(ptr)] = byte_size;
+    }
+
+    /// Returns the byte size of the block and removes it from the registry.
+    size_t Erase(const void* ptr) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = blocks_.find(reinterpret_cast<uintptr_t>(ptr));
+        if (it == blocks_.end()) {
+            utility::LogError("Pointer {} was not allocated as pinned memory.",
+                              fmt::ptr(ptr));
+        }
+        size_t byte_size = it->second;
+        blocks_.erase(it);
+        return byte_size;
+    }
+
+    bool Contains(const void* ptr) {
+        const uintptr_t address = reinterpret_cast<uintptr_t>(ptr);
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = blocks_.upper_bound(address);
+        if (it == blocks_.begin()) {
+            return false;
+        }
+        --it;
+        return address < it->first + it->second;
+    }
+
+private:
+    PinnedBlockRegistry() = default;
+
+    std::mutex mutex_;
+    std::map<uintptr_t, size_t> blocks_;
+};
+
+#ifndef BUILD_CUDA_MODULE
+static size_t GetPageSize() {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return static_cast<size_t>(info.dwPageSize);
+#else
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+#endif
+
+void* PinnedCPUMemoryManager::Malloc(size_t byte_size, const Device& device) {
+    // Zero-sized allocations still return a unique pointer.
+    const size_t alloc_byte_size = byte_size == 0 ? 1 : byte_size;
+    void* ptr = nullptr;
+#ifdef BUILD_CUDA_MODULE
+    OPEN3D_CUDA_CHECK(
+            cudaHostAlloc(&ptr, alloc_byte_size, cudaHostAllocPortable));
+#else
+    const size_t page_size = GetPageSize();
+#ifdef _WIN32
+    ptr = _aligned_malloc(alloc_byte_size, page_size);
+#else
+    if (posix_memalign(&ptr, page_size, alloc_byte_size) != 0) {
+        ptr = nullptr;
+    }
+#endif
+    if (ptr == nullptr) {
+        utility::LogError("CPU pinned malloc failed");
+    }
+#ifdef _WIN32
+    const bool locked = VirtualLock(ptr, alloc_byte_size) != 0;
+#else
+    const bool locked = mlock(ptr, alloc_byte_size) == 0;
+#endif
+    if (!locked) {
+        utility::LogDebug(
+                "Failed to lock {} bytes of host memory, the memory is "
+                "allocated but may be paged out.",
+                alloc_byte_size);
+    }
+#endif
+    PinnedBlockRegistry::GetInstance().Insert(ptr, alloc_byte_size);
+    return ptr;
+}
+
+void PinnedCPUMemoryManager::Free(void* ptr, const Device& device) {
+    if (!ptr) {
+        return;
+    }
+    const size_t byte_size = PinnedBlockRegistry::GetInstance().Erase(ptr);
+#ifdef BUILD_CUDA_MODULE
+    (void)byte_size;
+    OPEN3D_CUDA_CHECK(cudaFreeHost(ptr));
+#elif defined(_WIN32)
+    VirtualUnlock(ptr, byte_size);
+    _aligned_free(ptr);
+#else
+    munlock(ptr, byte_size);
+    std::free(ptr);
+#endif
+}
+
+void PinnedCPUMemoryManager::Memcpy(void* dst_ptr,
+                                    const Device& dst_device,
+                                    const void* src_ptr,
+                                    const Device& src_device,
+                                    size_t num_bytes) {
+    std::memcpy(dst_ptr, src_ptr, num_bytes);
+}
+
+bool PinnedCPUMemoryManager::IsPinned(const void* ptr) {
+    return ptr != nullptr && PinnedBlockRegistry::GetInstance().Contains(ptr);
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,371 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+#include "open3d/core/MemoryManager.h"
+#include "open3d/core/MemoryManagerStatistic.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+/// Alignment of all pooled allocations, enough for 512-bit SIMD loads.
+static constexpr size_t POOLED_CPU_ALIGNMENT = 64;
+
+/// Smallest size class in bytes.
+static constexpr size_t POOLED_CPU_MIN_BLOCK_SIZE = 64;
+
+/// Largest size class in bytes. Larger allocations bypass the pool.
+static constexpr size_t POOLED_CPU_MAX_BLOCK_SIZE = 16 << 20;
+
+/// Number of size classes between two powers of two. Bounds the internal
+/// fragmentation to 25%.
+static constexpr size_t POOLED_CPU_CLASSES_PER_DOUBLING = 4;
+
+/// Maximum number of bytes kept in the cache of each thread.
+static constexpr size_t POOLED_CPU_THREAD_CACHE_SIZE = 16 << 20;
+
+/// Maximum number of bytes kept in the pool shared by all threads.
+static constexpr size_t POOLED_CPU_SHARED_POOL_SIZE = 256 << 20;
+
+/// Size class of blocks which are allocated and freed directly.
+static constexpr size_t POOLED_CPU_NOT_POOLED =
+        std::numeric_limits<size_t>::max();
+
+/// Header in front of each block. Its size equals the alignment, so the
+/// returned pointer is aligned as well.
+struct alignas(POOLED_CPU_ALIGNMENT) PooledBlockHeader {
+    size_t size_class_;
+};
+static_assert(sizeof(PooledBlockHeader) == POOLED_CPU_ALIGNMENT,
+              "PooledBlockHeader must be padded to the alignment.");
+
+static void* AlignedMalloc(size_t byte_size) {
+#ifdef _WIN32
+    return _aligned_malloc(byte_size, POOLED_CPU_ALIGNMENT);
+#else
+    void* ptr = nullptr;
+    if (posix_memalign(&ptr, POOLED_CPU_ALIGNMENT, byte_size) != 0) {
+        return nullptr;
+    }
+    return ptr;
+#endif
+}
+
+static void AlignedFree(void* ptr) {
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+/// Returns the payload byte sizes of all size classes in increasing order.
+static const std::vector<size_t>& GetSizeClasses() {
+    static const std::vector<size_t> size_classes = []() {
+        std::vector<size_t> sizes;
+        for (size_t base = POOLED_CPU_MIN_BLOCK_SIZE;
+             base < POOLED_CPU_MAX_BLOCK_SIZE; base *= 2) {
+            for (size_t i = 0; i < POOLED_CPU_CLASSES_PER_DOUBLING; ++i) {
+                sizes.push_back(base +
+                                base / POOLED_CPU_CLASSES_PER_DOUBLING * i);
+            }
+        }
+        sizes.push_back(POOLED_CPU_MAX_BLOCK_SIZE);
+        return sizes;
+    }();
+    return size_classes;
+}
+
+/// Free blocks of each size class, as raw pointers to their headers.
+class BlockLists {
+public:
+    BlockLists() : blocks_(GetSizeClasses().size()) {}
+
+    void* Pop(size_t size_class) {
+        std::vector<void*>& blocks = blocks_[size_class];
+        if (blocks.empty()) {
+            return nullptr;
+        }
+        void* block = blocks.back();
+        blocks.pop_back();
+        byte_size_ -= GetSizeClasses()[size_class];
+        return block;
+    }
+
+    /// Adds \p block unless this exceeds \p max_byte_size. Returns true if the
+    /// block was added.
+    bool Push(size_t size_class, void* block, size_t max_byte_size) {
+        const size_t block_size = GetSizeClasses()[size_class];
+        if (byte_size_ + block_size > max_byte_size) {
+            return false;
+        }
+        blocks_[size_class].push_back(block);
+        byte_size_ += block_size;
+        return true;
+    }
+
+    /// Removes all blocks and returns them.
+    std::vector<void*> Clear() {
+        std::vector<void*> all_blocks;
+        for (std::vector<void*>& blocks : blocks_) {
+            all_blocks.insert(all_blocks.end(), blocks.begin(), blocks.end());
+            blocks.clear();
+        }
+        byte_size_ = 0;
+        return all_blocks;
+    }
+
+    size_t ByteSize() const { return byte_size_; }
+
+private:
+    std::vector<std::vector<void*>> blocks_;
+    size_t byte_size_ = 0;
+};
+
+/// Pool of free blocks shared by all threads.
+class SharedPool {
+public:
+    static SharedPool& GetInstance() {
+        // Never destroyed, so that thread caches can return their blocks at
+        // any time during shutdown.
+        static SharedPool* instance = new SharedPool();
+        return *instance;
+    }
+
+    void* Pop(size_t size_class) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return blocks_.Pop(size_class);
+    }
+
+    bool Push(size_t size_class, void* block) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return blocks_.Push(size_class, block, POOLED_CPU_SHARED_POOL_SIZE);
+    }
+
+    void Release() {
+        std::vector<void*> blocks;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            blocks = blocks_.Clear();
+        }
+        for (void* block : blocks) {
+            AlignedFree(block);
+        }
+    }
+
+    size_t ByteSize() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return blocks_.ByteSize();
+    }
+
+private:
+    SharedPool() = default;
+
+    BlockLists blocks_;
+    std::mutex mutex_;
+};
+
+class ThreadCache;
+
+/// Caches of all running threads, so that their blocks can be released from
+/// any thread.
+class ThreadCacheRegistry {
+public:
+    static ThreadCacheRegistry& GetInstance() {
+        // Never destroyed, like the SharedPool.
+        static ThreadCacheRegistry* instance = new ThreadCacheRegistry();
+        return *instance;
+    }
+
+    void Add(ThreadCache* cache) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        caches_.insert(cache);
+    }
+
+    void Remove(ThreadCache* cache) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        caches_.erase(cache);
+    }
+
+    /// Calls \p func on each registered cache while no cache can be added or
+    /// removed.
+    template <typename func_t>
+    void ForEach(func_t func) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (ThreadCache* cache : caches_) {
+            func(*cache);
+        }
+    }
+
+private:
+    ThreadCacheRegistry() = default;
+
+    std::unordered_set<ThreadCache*> caches_;
+    std::mutex mutex_;
+};
+
+/// Cache of free blocks owned by a single thread. Its mutex is only contended
+/// while another thread releases or measures the caches, so locking it is
+/// cheap compared to the shared pool.
+class ThreadCache {
+public:
+    static ThreadCache& GetInstance() {
+        thread_local ThreadCache instance;
+        return instance;
+    }
+
+    ~ThreadCache() {
+        ThreadCacheRegistry::GetInstance().Remove(this);
+        for (void* block : blocks_.Clear()) {
+            const size_t size_class =
+                    static_cast<PooledBlockHeader*>(block)->size_class_;
+            if (!SharedPool::GetInstance().Push(size_class, block)) {
+                AlignedFree(block);
+            }
+        }
+    }
+
+    void* Pop(size_t size_class) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return blocks_.Pop(size_class);
+    }
+
+    bool Push(size_t size_class, void* block) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return blocks_.Push(size_class, block, POOLED_CPU_THREAD_CACHE_SIZE);
+    }
+
+    void Release() {
+        std::vector<void*> blocks;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            blocks = blocks_.Clear();
+        }
+        for (void* block : blocks) {
+            AlignedFree(block);
+        }
+    }
+
+    size_t ByteSize() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return blocks_.ByteSize();
+    }
+
+private:
+    ThreadCache() { ThreadCacheRegistry::GetInstance().Add(this); }
+
+    BlockLists blocks_;
+    std::mutex mutex_;
+};
+
+void* PooledCPUMemoryManager::Malloc(size_t byte_size, const Device& device) {
+    // Like std::malloc, empty allocations return a valid unique pointer from
+    // the smallest size class.
+    const std::vector<size_t>& size_classes = GetSizeClasses();
+    auto it = std::lower_bound(size_classes.begin(), size_classes.end(),
+                               byte_size);
+    size_t size_class = POOLED_CPU_NOT_POOLED;
+    size_t block_size = byte_size;
+    void* block = nullptr;
+    if (it != size_classes.end()) {
+        size_class = it - size_classes.begin();
+        block_size = *it;
+        block = ThreadCache::GetInstance().Pop(size_class);
+        if (block == nullptr) {
+            block = SharedPool::GetInstance().Pop(size_class);
+        }
+    }
+
+    if (block != nullptr) {
+        MemoryManagerStatistic::GetInstance().CountCacheHit(device);
+    } else {
+        MemoryManagerStatistic::GetInstance().CountCacheMiss(device);
+        const size_t raw_byte_size = sizeof(PooledBlockHeader) + block_size;
+        block = AlignedMalloc(raw_byte_size);
+        if (block == nullptr) {
+            // Free cached memory and try again.
+            ReleaseCache();
+            block = AlignedMalloc(raw_byte_size);
+        }
+        if (block == nullptr) {
+            utility::LogError("CPU malloc failed");
+        }
+        static_cast<PooledBlockHeader*>(block)->size_class_ = size_class;
+    }
+    return static_cast<char*>(block) + sizeof(PooledBlockHeader);
+}
+
+void PooledCPUMemoryManager::Free(void* ptr, const Device& device) {
+    if (ptr == nullptr) {
+        return;
+    }
+
+    void* block = static_cast<char*>(ptr) - sizeof(PooledBlockHeader);
+    const size_t size_class =
+            static_cast<PooledBlockHeader*>(block)->size_class_;
+    if (size_class == POOLED_CPU_NOT_POOLED ||
+        (!ThreadCache::GetInstance().Push(size_class, block) &&
+         !SharedPool::GetInstance().Push(size_class, block))) {
+        AlignedFree(block);
+    }
+}
+
+void PooledCPUMemoryManager::Memcpy(void* dst_ptr,
+                                    const Device& dst_device,
+                                    const void* src_ptr,
+                                    const Device& src_device,
+                                    size_t num_bytes) {
+    std::memcpy(dst_ptr, src_ptr, num_bytes);
+}
+
+void PooledCPUMemoryManager::ReleaseCache() {
+    ThreadCacheRegistry::GetInstance().ForEach(
+            [](ThreadCache& cache) { cache.Release(); });
+    SharedPool::GetInstance().Release();
+}
+
+size_t PooledCPUMemoryManager::GetCachedByteSize() {
+    size_t byte_size = 0;
+    ThreadCacheRegistry::GetInstance().ForEach(
+            [&byte_size](ThreadCache& cache) {
+                byte_size += cache.ByteSize();
+            });
+    return byte_size + SharedPool::GetInstance().ByteSize();
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -29,6 +29,8 @@
 #include <algorithm>
 #include <cstdlib>
 #include <numeric>
+#include <utility>
+#include <vector>
 
 #include "open3d/utility/Logging.h"
 
@@ -72,6 +74,10 @@ void MemoryManagerStatistic::SetPrintAtMallocFree(bool print) {
     print_at_malloc_free_ = print;
 }
 
+void MemoryManagerStatistic::SetCountCacheAccesses(bool count) {
+    count_cache_accesses_ = count;
+}
+
 void MemoryManagerStatistic::Print() const {
     if (level_ == PrintLevel::None) {
         return;
@@ -120,6 +126,16 @@ void MemoryManagerStatistic::Print() const {
             utility::LogInfo("{}: {} {}", device.ToString(),
                              statistics.count_malloc_, statistics.count_free_);
         }
+
+        auto it = cache_statistics_.find(device);
+        if (it != cache_statistics_.end()) {
+            const int64_t count_hit = it->second->count_hit_.load();
+            const int64_t count_miss = it->second->count_miss_.load();
+            if (count_hit + count_miss > 0) {
+                utility::LogInfo("    Cache: {} hits, {} misses", count_hit,
+                                 count_miss);
+            }
+        }
     }
     utility::LogInfo("---------------------------------------------");
 
@@ -188,9 +204,45 @@ void MemoryManagerStatistic::CountFree(void* ptr, const Device& device) {
     }
 }
 
+MemoryManagerStatistic::CacheStatistics&
+MemoryManagerStatistic::GetCacheStatistics(const Device& device) {
+    thread_local std::vector<std::pair<Device, CacheStatistics*>>
+            thread_cache_statistics;
+    for (const auto& device_statistics : thread_cache_statistics) {
+        if (device_statistics.first == device) {
+            return *device_statistics.second;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    std::unique_ptr<CacheStatistics>& statistics = cache_statistics_[device];
+    if (!statistics) {
+        statistics = std::make_unique<CacheStatistics>();
+    }
+    thread_cache_statistics.emplace_back(device, statistics.get());
+    return *statistics;
+}
+
+int64_t MemoryManagerStatistic::GetCacheHits(const Device& device) const {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    auto it = cache_statistics_.find(device);
+    return it == cache_statistics_.end() ? 0 : it->second->count_hit_.load();
+}
+
+int64_t MemoryManagerStatistic::GetCacheMisses(const Device& device) const {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    auto it = cache_statistics_.find(device);
+    return it == cache_statistics_.end() ? 0 : it->second->count_miss_.load();
+}
+
 void MemoryManagerStatistic::Reset() {
     std::lock_guard<std::mutex> lock(statistics_mutex_);
     statistics_.clear();
+    // Threads keep pointers to the cache counters, so only zero them.
+    for (auto& device_statistics : cache_statistics_) {
+        device_statistics.second->count_hit_ = 0;
+        device_statistics.second->count_miss_ = 0;
+    }
 }
 
 bool MemoryManagerStatistic::MemoryStatistics::IsBalanced() const {
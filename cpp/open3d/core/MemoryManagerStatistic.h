@@ -26,8 +26,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <unordered_map>
 
@@ -66,6 +68,10 @@ public:
     /// Enables or disables printing at each malloc and free.
     void SetPrintAtMallocFree(bool print);
 
+    /// Enables or disables counting cache hits and misses of the caching
+    /// memory managers.
+    void SetCountCacheAccesses(bool count);
+
     /// Prints statistics for all recorded devices depending on the print level.
     void Print() const;
 
@@ -81,6 +87,33 @@ public:
     /// consistency.
     void CountFree(void* ptr, const Device& device);
 
+    /// Adds an allocation served from a memory cache to the statistics, if
+    /// counting cache accesses is enabled. Does not lock after the first call
+    /// for \p device on each thread.
+    void CountCacheHit(const Device& device) {
+        if (count_cache_accesses_.load(std::memory_order_relaxed)) {
+            GetCacheStatistics(device).count_hit_.fetch_add(
+                    1, std::memory_order_relaxed);
+        }
+    }
+
+    /// Adds an allocation that could not be served from a memory cache to the
+    /// statistics, if counting cache accesses is enabled.
+    void CountCacheMiss(const Device& device) {
+        if (count_cache_accesses_.load(std::memory_order_relaxed)) {
+            GetCacheStatistics(device).count_miss_.fetch_add(
+                    1, std::memory_order_relaxed);
+        }
+    }
+
+    /// Returns the number of allocations on \p device served from a memory
+    /// cache since the last reset.
+    int64_t GetCacheHits(const Device& device) const;
+
+    /// Returns the number of allocations on \p device that could not be served
+    /// from a memory cache since the last reset.
+    int64_t GetCacheMisses(const Device& device) const;
+
     /// Resets the statistics.
     void Reset();
 
@@ -95,6 +128,16 @@ private:
         std::unordered_map<void*, size_t> active_allocations_;
     };
 
+    struct CacheStatistics {
+        std::atomic<int64_t> count_hit_{0};
+        std::atomic<int64_t> count_miss_{0};
+    };
+
+    /// Returns the cache counters of \p device. Counters are never destroyed,
+    /// so each thread remembers their addresses and only locks on the first
+    /// access to a device.
+    CacheStatistics& GetCacheStatistics(const Device& device);
+
     /// Only print unbalanced statistics by default.
     PrintLevel level_ = PrintLevel::Unbalanced;
 
@@ -105,8 +148,12 @@ private:
     /// Print at each malloc and free, disabled by default.
     bool print_at_malloc_free_ = false;
 
-    std::mutex statistics_mutex_;
+    /// Count cache hits and misses, disabled by default.
+    std::atomic<bool> count_cache_accesses_{false};
+
+    mutable std::mutex statistics_mutex_;
     std::map<Device, MemoryStatistics> statistics_;
+    std::map<Device, std::unique_ptr<CacheStatistics>> cache_statistics_;
 };
 
 }  // namespace core
@@ -26,10 +26,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <type_traits>
 
 #include "open3d/core/Device.h"
+#include "open3d/core/Float16.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/Overload.h"
 #include "open3d/utility/Parallel.h"
@@ -87,9 +89,13 @@ void ParallelForCUDA_(const Device& device, int64_t n, const func_t& func) {
 
 #else
 
-/// Run a function in parallel on CPU.
+/// Run a function in parallel on CPU. Each thread or task processes at least
+/// \p grain_size consecutive workloads, unless \p n is smaller.
 template <typename func_t>
-void ParallelForCPU_(const Device& device, int64_t n, const func_t& func) {
+void ParallelForCPU_(const Device& device,
+                     int64_t n,
+                     const func_t& func,
+                     int64_t grain_size = 1) {
     if (device.GetType() != Device::DeviceType::CPU) {
         utility::LogError("ParallelFor for CPU cannot run on device {}.",
                           device.ToString());
@@ -97,13 +103,66 @@ void ParallelForCPU_(const Device& device, int64_t n, const func_t& func) {
     if (n == 0) {
         return;
     }
+    grain_size = std::max<int64_t>(grain_size, 1);
 
-#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    if (utility::GetParallelBackend() == utility::ParallelBackend::TBB) {
+        utility::ParallelForTBB(n, grain_size,
+                                [&func](int64_t start, int64_t end) {
+                                    for (int64_t i = start; i < end; ++i) {
+                                        func(i);
+                                    }
+                                });
+        return;
+    }
+
+    const int64_t num_threads = std::min<int64_t>(
+            utility::EstimateMaxThreads(), (n + grain_size - 1) / grain_size);
+#pragma omp parallel for num_threads(num_threads)
     for (int64_t i = 0; i < n; ++i) {
         func(i);
     }
 }
 
+/// Run a function in parallel on CPU over disjoint ranges of consecutive
+/// workloads. Unlike ParallelFor, \p func is called once per range as
+/// `void func(int64_t start, int64_t end)`, so that it can hoist per-range
+/// work such as offset computations out of its inner loop.
+///
+/// \param device The device for the parallel for loop to run on. Must be CPU.
+/// \param n The number of workloads.
+/// \param grain_size The minimum number of workloads per range, unless \p n is
+/// smaller.
+/// \param func The function to be executed in parallel.
+template <typename func_t>
+void ParallelForRange(const Device& device,
+                      int64_t n,
+                      int64_t grain_size,
+                      const func_t& func) {
+    if (device.GetType() != Device::DeviceType::CPU) {
+        utility::LogError("ParallelForRange cannot run on device {}.",
+                          device.ToString());
+    }
+    if (n == 0) {
+        return;
+    }
+    grain_size = std::max<int64_t>(grain_size, 1);
+
+    if (utility::GetParallelBackend() == utility::ParallelBackend::TBB) {
+        utility::ParallelForTBB(n, grain_size, func);
+        return;
+    }
+
+    const int64_t num_ranges = std::min<int64_t>(
+            utility::EstimateMaxThreads(), (n + grain_size - 1) / grain_size);
+    if (num_ranges <= 1) {
+        func(0, n);
+        return;
+    }
+    ParallelForCPU_(device, num_ranges, [&](int64_t i) {
+        func(n * i / num_ranges, n * (i + 1) / num_ranges);
+    });
+}
+
 #endif
 
 /// Run a function in parallel on CPU or CUDA.
@@ -127,6 +186,32 @@ void ParallelFor(const Device& device, int64_t n, const func_t& func) {
 #endif
 }
 
+/// Run a function in parallel on CPU or CUDA, with at least \p grain_size
+/// workloads per CPU thread or task.
+///
+/// \param device The device for the parallel for loop to run on.
+/// \param n The number of workloads.
+/// \param grain_size The minimum number of workloads per CPU thread (OpenMP
+/// backend) or task (TBB backend). Use larger values for cheap workloads to
+/// reduce scheduling overhead. Ignored on CUDA.
+/// \param func The function to be executed in parallel. The function should
+/// take an int64_t workload index and returns void, i.e., `void func(int64_t)`.
+///
+/// \note With the TBB backend (see utility::SetParallelBackend), work items
+/// are distributed with work stealing and nested calls share the threads of
+/// the enclosing task arena.
+template <typename func_t>
+void ParallelForWithGrainSize(const Device& device,
+                              int64_t n,
+                              int64_t grain_size,
+                              const func_t& func) {
+#ifdef __CUDACC__
+    ParallelForCUDA_(device, n, func);
+#else
+    ParallelForCPU_(device, n, func, grain_size);
+#endif
+}
+
 /// Run a potentially vectorized function in parallel on CPU or CUDA.
 ///
 /// \param device The device for the parallel for loop to run on.
@@ -249,6 +334,10 @@ void ParallelFor(const Device& device,
 /// - unsigned + signed {8,16,32,64} bit integers,
 /// - float, double
 ///
+/// float16_t and bfloat16_t are accepted so that kernels can be dispatched
+/// uniformly, but there are no vectorized kernels for them. Callers must use
+/// the scalar function for these types.
+///
 /// Use the OPEN3D_EXPORT_TEMPLATE_VECTORIZED macro to define the
 /// kernel in the ISPC source file.
 ///
@@ -256,8 +345,11 @@ void ParallelFor(const Device& device,
 /// enabled via BUILD_ISPC_MODULE=ON.
 #define OPEN3D_TEMPLATE_VECTORIZED(T, ISPCKernel, ...)                        \
     [&](int64_t start, int64_t end) {                                         \
-        static_assert(std::is_arithmetic<T>::value,                           \
-                      "Data type is not an arithmetic type");                 \
+        static_assert(                                                        \
+                std::is_arithmetic<T>::value ||                               \
+                        std::is_same<T, open3d::core::float16_t>::value ||    \
+                        std::is_same<T, open3d::core::bfloat16_t>::value,     \
+                "Data type is not an arithmetic type");                       \
         utility::Overload(                                                    \
                 OPEN3D_OVERLOADED_LAMBDA_(bool, ISPCKernel, __VA_ARGS__),     \
                 OPEN3D_OVERLOADED_LAMBDA_(uint8_t, ISPCKernel, __VA_ARGS__),  \
@@ -43,6 +43,14 @@ class Scalar {
 public:
     enum class ScalarType { Double, Int64, Bool };
 
+    Scalar(float16_t v) {
+        scalar_type_ = ScalarType::Double;
+        value_.d = static_cast<double>(static_cast<float>(v));
+    }
+    Scalar(bfloat16_t v) {
+        scalar_type_ = ScalarType::Double;
+        value_.d = static_cast<double>(static_cast<float>(v));
+    }
     Scalar(float v) {
         scalar_type_ = ScalarType::Double;
         value_.d = static_cast<double>(v);
@@ -0,0 +1,160 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/Stream.h"
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+struct Event::State {
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool done_ = false;
+};
+
+Event::Event() : state_(std::make_shared<State>()) { state_->done_ = true; }
+
+Event::Event(const std::shared_ptr<State>& state) : state_(state) {}
+
+bool Event::IsDone() const {
+    std::lock_guard<std::mutex> lock(state_->mutex_);
+    return state_->done_;
+}
+
+void Event::Synchronize() const {
+    std::unique_lock<std::mutex> lock(state_->mutex_);
+    state_->cv_.wait(lock, [this]() { return state_->done_; });
+}
+
+/// Current stream of each thread, nullptr for the default stream.
+static thread_local Stream* current_stream = nullptr;
+
+Stream::Stream() {
+    worker_ = std::thread(&Stream::Run, this);
+}
+
+Stream::~Stream() {
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        idle_cv_.wait(lock, [this]() { return num_pending_ == 0; });
+        stop_ = true;
+    }
+    task_cv_.notify_one();
+    worker_.join();
+    if (error_) {
+        utility::LogWarning("Stream destroyed with unhandled task error.");
+    }
+}
+
+void Stream::Enqueue(const std::function<void()>& task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push_back(task);
+        ++num_pending_;
+    }
+    task_cv_.notify_one();
+}
+
+Event Stream::Record() {
+    auto state = std::make_shared<Event::State>();
+    Enqueue([state]() {
+        {
+            std::lock_guard<std::mutex> lock(state->mutex_);
+            state->done_ = true;
+        }
+        state->cv_.notify_all();
+    });
+    return Event(state);
+}
+
+void Stream::WaitEvent(const Event& event) {
+    Enqueue([event]() { event.Synchronize(); });
+}
+
+void Stream::Synchronize() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_cv_.wait(lock, [this]() { return num_pending_ == 0; });
+    if (error_) {
+        std::exception_ptr error = error_;
+        error_ = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+Stream& Stream::GetCurrent() {
+    return current_stream ? *current_stream : GetDefault();
+}
+
+Stream& Stream::GetDefault() {
+    // Never destroyed, so that work can still be enqueued from destructors of
+    // other static objects.
+    static Stream* default_stream = new Stream();
+    return *default_stream;
+}
+
+void Stream::Run() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            task_cv_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+            if (tasks_.empty()) {
+                return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+
+        std::exception_ptr error;
+        try {
+            task();
+        } catch (...) {
+            error = std::current_exception();
+        }
+        // Release captured resources before reporting the task as finished.
+        task = nullptr;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (error && !error_) {
+                error_ = error;
+            }
+            --num_pending_;
+        }
+        idle_cv_.notify_all();
+    }
+}
+
+ScopedStream::ScopedStream(Stream& stream) : prev_stream_(current_stream) {
+    current_stream = &stream;
+}
+
+ScopedStream::~ScopedStream() { current_stream = prev_stream_; }
+
+}  // namespace core
+}  // namespace open3d
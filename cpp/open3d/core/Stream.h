@@ -0,0 +1,159 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace open3d {
+namespace core {
+
+/// \class Event
+///
+/// Marks a point in the work queue of a Stream. The event completes once all
+/// work enqueued on the stream before the event was recorded has finished.
+///
+/// Events are cheap to copy, copies refer to the same point in the queue. A
+/// default-constructed event is already completed.
+class Event {
+public:
+    Event();
+
+    /// Returns true if the event has completed.
+    bool IsDone() const;
+
+    /// Blocks the calling thread until the event has completed.
+    void Synchronize() const;
+
+private:
+    struct State;
+    explicit Event(const std::shared_ptr<State>& state);
+
+    std::shared_ptr<State> state_;
+
+    friend class Stream;
+};
+
+/// \class Stream
+///
+/// An ordered queue of work. Work enqueued on a stream runs in submission
+/// order on a worker thread owned by the stream, so the calling thread can
+/// continue with other work, e.g. decoding the next frame while the current
+/// one is being copied. Work on different streams may run concurrently.
+///
+/// Tensor::To(device, copy, non_blocking) enqueues its copy on the current
+/// stream of the calling thread, which can be changed with ScopedStream.
+/// Tensors captured by enqueued work are kept alive until the work has run.
+/// It is up to the caller not to modify them in the meantime and to wait for
+/// the results via Record() and Event::Synchronize() or Synchronize().
+///
+/// Example:
+/// \code{.cpp}
+/// core::Stream stream;
+/// core::Tensor frame_cuda;
+/// {
+///     core::ScopedStream scoped_stream(stream);
+///     frame_cuda = frame.PinMemory().To(core::Device("CUDA:0"),
+///                                       /*copy=*/false,
+///                                       /*non_blocking=*/true);
+/// }
+/// core::Event copied = stream.Record();
+/// // ... Decode the next frame ...
+/// copied.Synchronize();
+/// \endcode
+class Stream {
+public:
+    /// Creates a stream and starts its worker thread. A stream is not tied to
+    /// a device. Its work may copy between any devices.
+    Stream();
+
+    /// Waits for all enqueued work and stops the worker thread.
+    ~Stream();
+
+    Stream(const Stream&) = delete;
+    Stream& operator=(const Stream&) = delete;
+
+    /// Enqueues \p task to run after all previously enqueued work.
+    void Enqueue(const std::function<void()>& task);
+
+    /// Returns an event which completes once all currently enqueued work has
+    /// finished.
+    Event Record();
+
+    /// Makes all work enqueued after this call wait until \p event has
+    /// completed. \p event may come from another stream.
+    void WaitEvent(const Event& event);
+
+    /// Blocks the calling thread until all enqueued work has finished. If any
+    /// work threw an exception since the last call, the first exception is
+    /// rethrown.
+    void Synchronize();
+
+    /// Returns the current stream of the calling thread. This is the stream
+    /// set by the innermost ScopedStream, or the default stream otherwise.
+    static Stream& GetCurrent();
+
+    /// Returns the default stream shared by all threads.
+    static Stream& GetDefault();
+
+private:
+    void Run();
+
+    std::mutex mutex_;
+    std::condition_variable task_cv_;
+    std::condition_variable idle_cv_;
+    std::deque<std::function<void()>> tasks_;
+    /// Number of tasks enqueued or running.
+    size_t num_pending_ = 0;
+    bool stop_ = false;
+    std::exception_ptr error_;
+    std::thread worker_;
+};
+
+/// \class ScopedStream
+///
+/// Sets the current stream of the calling thread for the lifetime of the
+/// object and restores the previous one on destruction.
+class ScopedStream {
+public:
+    explicit ScopedStream(Stream& stream);
+    ~ScopedStream();
+
+    ScopedStream(const ScopedStream&) = delete;
+    ScopedStream& operator=(const ScopedStream&) = delete;
+
+private:
+    Stream* prev_stream_;
+};
+
+}  // namespace core
+}  // namespace open3d
@@ -28,6 +28,7 @@
 
 #include <numeric>
 #include <sstream>
+#include <type_traits>
 
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/Blob.h"
@@ -35,8 +36,10 @@
 #include "open3d/core/Device.h"
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
+#include "open3d/core/MemoryManager.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/SizeVector.h"
+#include "open3d/core/Stream.h"
 #include "open3d/core/TensorCheck.h"
 #include "open3d/core/TensorFunction.h"
 #include "open3d/core/TensorKey.h"
@@ -57,6 +60,8 @@ namespace open3d {
 namespace core {
 
 static DLDataTypeCode DtypeToDLDataTypeCode(const Dtype& dtype) {
+    if (dtype == core::Float16) return DLDataTypeCode::kDLFloat;
+    if (dtype == core::BFloat16) return DLDataTypeCode::kDLBfloat;
     if (dtype == core::Float32) return DLDataTypeCode::kDLFloat;
     if (dtype == core::Float64) return DLDataTypeCode::kDLFloat;
     if (dtype == core::Int8) return DLDataTypeCode::kDLInt;
@@ -109,6 +114,8 @@ static Dtype DLDataTypeToDtype(const DLDataType& dltype) {
             break;
         case DLDataTypeCode::kDLFloat:
             switch (dltype.bits) {
+                case 16:
+                    return core::Float16;
                 case 32:
                     return core::Float32;
                 case 64:
@@ -118,6 +125,12 @@ static Dtype DLDataTypeToDtype(const DLDataType& dltype) {
                                       dltype.bits);
             }
             break;
+        case DLDataTypeCode::kDLBfloat:
+            if (dltype.bits != 16) {
+                utility::LogError("Unsupported kDLBfloat bits {}",
+                                  dltype.bits);
+            }
+            return core::BFloat16;
         default:
             utility::LogError("Unsupported dtype code {}", dltype.code);
     }
@@ -724,12 +737,22 @@ Tensor Tensor::To(Dtype dtype, bool copy /*= false*/) const {
     return dst_tensor;
 }
 
-Tensor Tensor::To(const Device& device, bool copy /*= false*/) const {
+Tensor Tensor::To(const Device& device,
+                  bool copy /*= false*/,
+                  bool non_blocking /*= false*/) const {
     if (!copy && GetDevice() == device) {
         return *this;
     }
     Tensor dst_tensor(shape_, dtype_, device);
-    kernel::Copy(*this, dst_tensor);
+    if (non_blocking) {
+        // The tensors are captured by value to keep their blobs alive.
+        const Tensor src_tensor = *this;
+        Stream::GetCurrent().Enqueue([src_tensor, dst_tensor]() mutable {
+            kernel::Copy(src_tensor, dst_tensor);
+        });
+    } else {
+        kernel::Copy(*this, dst_tensor);
+    }
     return dst_tensor;
 }
 
@@ -751,6 +774,34 @@ Tensor Tensor::Contiguous() const {
     }
 }
 
+Tensor Tensor::PinMemory() const {
+    if (GetDevice().GetType() != Device::DeviceType::CPU) {
+        utility::LogError("Only CPU tensors can be pinned, but got {}.",
+                          GetDevice().ToString());
+    }
+    if (IsPinned()) {
+        return *this;
+    }
+    const Device device = GetDevice();
+    auto pinned_mm = std::make_shared<PinnedCPUMemoryManager>();
+    void* data_ptr =
+            pinned_mm->Malloc(NumElements() * dtype_.ByteSize(), device);
+    auto blob = std::make_shared<Blob>(
+            device, data_ptr,
+            [pinned_mm, data_ptr, device](void*) {
+                pinned_mm->Free(data_ptr, device);
+            });
+    Tensor dst_tensor(shape_, shape_util::DefaultStrides(shape_), data_ptr,
+                      dtype_, blob);
+    kernel::Copy(*this, dst_tensor);
+    return dst_tensor;
+}
+
+bool Tensor::IsPinned() const {
+    return GetDevice().GetType() == Device::DeviceType::CPU &&
+           PinnedCPUMemoryManager::IsPinned(data_ptr_);
+}
+
 std::string Tensor::ToString(bool with_suffix,
                              const std::string& indent) const {
     std::ostringstream rc;
@@ -803,8 +854,12 @@ std::string Tensor::ScalarPtrToString(const void* ptr) const {
     } else if (dtype_.IsObject()) {
         str = fmt::format("{}", fmt::ptr(ptr));
     } else {
-        DISPATCH_DTYPE_TO_TEMPLATE(dtype_, [&]() {
-            str = fmt::format("{}", *static_cast<const scalar_t*>(ptr));
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(dtype_, [&]() {
+            // Half types are printed through their float value.
+            using print_t = std::conditional<
+                    std::is_arithmetic<scalar_t>::value, scalar_t, float>::type;
+            print_t value = *static_cast<const scalar_t*>(ptr);
+            str = fmt::format("{}", value);
         });
     }
     return str;
@@ -948,9 +1003,9 @@ void Tensor::IndexSet(const std::vector<Tensor>& index_tensors,
                     src_tensor.NumElements());
         }
         if (index_tensors[0].IsNonZero()) {
-            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_tensor.GetDtype(), [&]() {
-                AsRvalue() = src_tensor.Item<scalar_t>();
-            });
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(
+                    src_tensor.GetDtype(),
+                    [&]() { AsRvalue() = src_tensor.Item<scalar_t>(); });
         }
         return;
     }
@@ -1043,7 +1098,7 @@ Tensor Tensor::Add(const Tensor& value) const {
 
 Tensor Tensor::Add(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = Add(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1059,7 +1114,7 @@ Tensor Tensor::Add_(const Tensor& value) {
 }
 
 Tensor Tensor::Add_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Add_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1077,7 +1132,7 @@ Tensor Tensor::Sub(const Tensor& value) const {
 
 Tensor Tensor::Sub(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = Sub(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1093,7 +1148,7 @@ Tensor Tensor::Sub_(const Tensor& value) {
 }
 
 Tensor Tensor::Sub_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Sub_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1111,7 +1166,7 @@ Tensor Tensor::Mul(const Tensor& value) const {
 
 Tensor Tensor::Mul(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = Mul(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1127,7 +1182,7 @@ Tensor Tensor::Mul_(const Tensor& value) {
 }
 
 Tensor Tensor::Mul_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Mul_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1145,7 +1200,7 @@ Tensor Tensor::Div(const Tensor& value) const {
 
 Tensor Tensor::Div(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = Div(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1161,7 +1216,7 @@ Tensor Tensor::Div_(const Tensor& value) {
 }
 
 Tensor Tensor::Div_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Div_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1175,7 +1230,7 @@ Tensor Tensor::Sum(const SizeVector& dims, bool keepdim) const {
 }
 
 Tensor Tensor::Mean(const SizeVector& dims, bool keepdim) const {
-    AssertTensorDtypes(*this, {Float32, Float64});
+    AssertTensorDtypes(*this, {Float32, Float64, Float16, BFloat16});
 
     // Following Numpy's semantics, reduction on 0-sized Tensor will result in
     // NaNs and a warning. A straightforward method is used now. Later it can be
@@ -1183,6 +1238,15 @@ Tensor Tensor::Mean(const SizeVector& dims, bool keepdim) const {
     if (NumElements() == 0) {
         utility::LogWarning("Computing mean of 0-sized Tensor.");
     }
+    if (dtype_ == core::Float16 || dtype_ == core::BFloat16) {
+        // Keep the sum in Float32, it may overflow the half-precision range.
+        Tensor sum(shape_util::ReductionShape(shape_, dims, keepdim),
+                   core::Float32, GetDevice());
+        kernel::Reduction(*this, sum, dims, keepdim,
+                          kernel::ReductionOpCode::Sum);
+        double factor = static_cast<double>(sum.NumElements()) / NumElements();
+        return (sum * factor).To(dtype_);
+    }
     Tensor sum = Sum(dims, keepdim);
     double factor = static_cast<double>(sum.NumElements()) / NumElements();
     return sum * factor;
@@ -1223,6 +1287,24 @@ Tensor Tensor::ArgMax(const SizeVector& dims) const {
     return dst;
 }
 
+Tensor Tensor::CumSum(int64_t dim) const {
+    Tensor dst(shape_, dtype_, GetDevice());
+    kernel::Scan(*this, dst, dim, kernel::ScanOpCode::Sum);
+    return dst;
+}
+
+Tensor Tensor::CumProd(int64_t dim) const {
+    Tensor dst(shape_, dtype_, GetDevice());
+    kernel::Scan(*this, dst, dim, kernel::ScanOpCode::Prod);
+    return dst;
+}
+
+Tensor Tensor::CumMax(int64_t dim) const {
+    Tensor dst(shape_, dtype_, GetDevice());
+    kernel::Scan(*this, dst, dim, kernel::ScanOpCode::Max);
+    return dst;
+}
+
 Tensor Tensor::Sqrt() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Sqrt);
@@ -1290,7 +1372,8 @@ Tensor Tensor::Abs_() {
 }
 
 Tensor Tensor::IsNan() const {
-    if (dtype_ == core::Float32 || dtype_ == core::Float64) {
+    if (dtype_ == core::Float32 || dtype_ == core::Float64 ||
+        dtype_ == core::Float16 || dtype_ == core::BFloat16) {
         Tensor dst_tensor(shape_, core::Bool, GetDevice());
         kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::IsNan);
         return dst_tensor;
@@ -1300,7 +1383,8 @@ Tensor Tensor::IsNan() const {
 }
 
 Tensor Tensor::IsInf() const {
-    if (dtype_ == core::Float32 || dtype_ == core::Float64) {
+    if (dtype_ == core::Float32 || dtype_ == core::Float64 ||
+        dtype_ == core::Float16 || dtype_ == core::BFloat16) {
         Tensor dst_tensor(shape_, core::Bool, GetDevice());
         kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::IsInf);
         return dst_tensor;
@@ -1310,7 +1394,8 @@ Tensor Tensor::IsInf() const {
 }
 
 Tensor Tensor::IsFinite() const {
-    if (dtype_ == core::Float32 || dtype_ == core::Float64) {
+    if (dtype_ == core::Float32 || dtype_ == core::Float64 ||
+        dtype_ == core::Float16 || dtype_ == core::BFloat16) {
         Tensor dst_tensor(shape_, core::Bool, GetDevice());
         kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::IsFinite);
         return dst_tensor;
@@ -1326,7 +1411,7 @@ Tensor Tensor::Clip(Scalar min_val, Scalar max_val) const {
 
 // TODO: Implement with kernel.
 Tensor Tensor::Clip_(Scalar min_val, Scalar max_val) {
-    DISPATCH_DTYPE_TO_TEMPLATE(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(dtype_, [&]() {
         scalar_t min_val_casted = min_val.To<scalar_t>();
         this->SetItem(TensorKey::IndexTensor(this->Lt(min_val_casted)),
                       Full({}, min_val_casted, dtype_, GetDevice()));
@@ -1392,7 +1477,7 @@ Tensor Tensor::LogicalAnd(const Tensor& value) const {
 
 Tensor Tensor::LogicalAnd(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = LogicalAnd(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1407,7 +1492,7 @@ Tensor Tensor::LogicalAnd_(const Tensor& value) {
 }
 
 Tensor Tensor::LogicalAnd_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         LogicalAnd_(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1426,7 +1511,7 @@ Tensor Tensor::LogicalOr(const Tensor& value) const {
 
 Tensor Tensor::LogicalOr(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = LogicalOr(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1441,7 +1526,7 @@ Tensor Tensor::LogicalOr_(const Tensor& value) {
 }
 
 Tensor Tensor::LogicalOr_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         LogicalOr_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1459,7 +1544,7 @@ Tensor Tensor::LogicalXor(const Tensor& value) const {
 
 Tensor Tensor::LogicalXor(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = LogicalXor(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1474,7 +1559,7 @@ Tensor Tensor::LogicalXor_(const Tensor& value) {
 }
 
 Tensor Tensor::LogicalXor_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         LogicalXor_(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1492,7 +1577,7 @@ Tensor Tensor::Gt(const Tensor& value) const {
 
 Tensor Tensor::Gt(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor =
                 Gt(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1507,7 +1592,7 @@ Tensor Tensor::Gt_(const Tensor& value) {
 }
 
 Tensor Tensor::Gt_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Gt_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1524,7 +1609,7 @@ Tensor Tensor::Lt(const Tensor& value) const {
 
 Tensor Tensor::Lt(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor =
                 Lt(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1539,7 +1624,7 @@ Tensor Tensor::Lt_(const Tensor& value) {
 }
 
 Tensor Tensor::Lt_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Lt_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1556,7 +1641,7 @@ Tensor Tensor::Ge(const Tensor& value) const {
 
 Tensor Tensor::Ge(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor =
                 Ge(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1571,7 +1656,7 @@ Tensor Tensor::Ge_(const Tensor& value) {
 }
 
 Tensor Tensor::Ge_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Ge_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1588,7 +1673,7 @@ Tensor Tensor::Le(const Tensor& value) const {
 
 Tensor Tensor::Le(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor =
                 Le(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1603,7 +1688,7 @@ Tensor Tensor::Le_(const Tensor& value) {
 }
 
 Tensor Tensor::Le_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Le_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1620,7 +1705,7 @@ Tensor Tensor::Eq(const Tensor& value) const {
 
 Tensor Tensor::Eq(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor =
                 Eq(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1635,7 +1720,7 @@ Tensor Tensor::Eq_(const Tensor& value) {
 }
 
 Tensor Tensor::Eq_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Eq_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1652,7 +1737,7 @@ Tensor Tensor::Ne(const Tensor& value) const {
 
 Tensor Tensor::Ne(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor =
                 Ne(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1667,7 +1752,7 @@ Tensor Tensor::Ne_(const Tensor& value) {
 }
 
 Tensor Tensor::Ne_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Ne_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1684,6 +1769,38 @@ std::vector<Tensor> Tensor::NonZeroNumpy() const {
 
 Tensor Tensor::NonZero() const { return kernel::NonZero(*this); }
 
+Tensor Tensor::Sort(int64_t dim, bool descending) const {
+    Tensor values, indices;
+    kernel::Sort(*this, dim, descending, values, indices);
+    return values;
+}
+
+Tensor Tensor::ArgSort(int64_t dim, bool descending) const {
+    Tensor values, indices;
+    kernel::Sort(*this, dim, descending, values, indices);
+    return indices;
+}
+
+std::tuple<Tensor, Tensor> Tensor::TopK(int64_t k,
+                                        int64_t dim,
+                                        bool largest) const {
+    Tensor values, indices;
+    kernel::TopK(*this, k, dim, largest, values, indices);
+    return std::make_tuple(values, indices);
+}
+
+std::tuple<Tensor, Tensor, Tensor> Tensor::Unique(
+        const utility::optional<int64_t>& dim) const {
+    Tensor values, inverse_indices, counts;
+    if (dim.has_value()) {
+        kernel::Unique(*this, dim.value(), values, inverse_indices, counts);
+    } else {
+        kernel::Unique(Reshape({NumElements()}), 0, values, inverse_indices,
+                       counts);
+    }
+    return std::make_tuple(values, inverse_indices, counts);
+}
+
 bool Tensor::IsNonZero() const {
     if (shape_.NumElements() != 1) {
         utility::LogError(
@@ -1691,7 +1808,7 @@ bool Tensor::IsNonZero() const {
                 "boolean.");
     }
     bool rc = false;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         rc = Item<scalar_t>() != static_cast<scalar_t>(0);
     });
     return rc;
@@ -1763,8 +1880,9 @@ void Tensor::Save(const std::string& file_name) const {
     t::io::WriteNpy(file_name, *this);
 }
 
-Tensor Tensor::Load(const std::string& file_name) {
-    return t::io::ReadNpy(file_name);
+Tensor Tensor::Load(const std::string& file_name, bool memory_map) {
+    return t::io::ReadNpy(file_name, memory_map ? t::io::MmapMode::CopyOnWrite
+                                                : t::io::MmapMode::None);
 }
 
 bool Tensor::AllEqual(const Tensor& other) const {
@@ -491,7 +491,13 @@ public:
     /// \param device The targeted device to convert to.
     /// \param copy If true, a new tensor is always created; if false, the copy
     /// is avoided when the original tensor is already on the targeted device.
-    Tensor To(const Device& device, bool copy = false) const;
+    /// \param non_blocking If true, the copy is enqueued on the current Stream
+    /// and this function returns without waiting for it. The returned tensor
+    /// must not be read, and the original tensor must not be modified, before
+    /// the copy has completed, see Stream::Record().
+    Tensor To(const Device& device,
+              bool copy = false,
+              bool non_blocking = false) const;
 
     /// Returns a tensor with the specified \p device and \p dtype.
     /// \param device The targeted device to convert to.
@@ -501,6 +507,15 @@ public:
     /// and have the targeted dtype.
     Tensor To(const Device& device, Dtype dtype, bool copy = false) const;
 
+    /// Returns a copy of the tensor in pinned (page-locked) host memory, or the
+    /// tensor itself if it is already pinned. Copies from pinned memory to CUDA
+    /// devices are faster and can be non-blocking. Only CPU tensors can be
+    /// pinned.
+    Tensor PinMemory() const;
+
+    /// Returns true if the tensor's data is in pinned host memory.
+    bool IsPinned() const;
+
     std::string ToString(bool with_suffix = true,
                          const std::string& indent = "") const;
 
@@ -691,6 +706,18 @@ public:
     /// is into the flattend tensor.
     Tensor ArgMax(const SizeVector& dims) const;
 
+    /// Returns the cumulative sum of the elements along \p dim. The returned
+    /// tensor has the same shape and dtype as the original tensor.
+    Tensor CumSum(int64_t dim) const;
+
+    /// Returns the cumulative product of the elements along \p dim. The
+    /// returned tensor has the same shape and dtype as the original tensor.
+    Tensor CumProd(int64_t dim) const;
+
+    /// Returns the cumulative maximum of the elements along \p dim. The
+    /// returned tensor has the same shape and dtype as the original tensor.
+    Tensor CumMax(int64_t dim) const;
+
     /// Element-wise square root of a tensor, returns a new tensor.
     Tensor Sqrt() const;
 
@@ -902,6 +929,58 @@ public:
     /// tensor.
     Tensor NonZero() const;
 
+    /// Returns the tensor sorted along \p dim. The sort is stable. NaN is
+    /// placed after all other values, in both orders.
+    ///
+    /// \param dim The dimension to sort along. Default is the last dimension.
+    /// \param descending If true, sorts in descending order.
+    Tensor Sort(int64_t dim = -1, bool descending = false) const;
+
+    /// Returns the int64 indices that sort the tensor along \p dim. The sort
+    /// is stable. NaN is placed after all other values, in both orders.
+    ///
+    /// \param dim The dimension to sort along. Default is the last dimension.
+    /// \param descending If true, sorts in descending order.
+    Tensor ArgSort(int64_t dim = -1, bool descending = false) const;
+
+    /// Returns the \p k largest (or smallest) elements along \p dim and their
+    /// int64 indices, ordered from the best to the worst. Ties are broken by
+    /// the lower index. NaN is ranked after all other values.
+    ///
+    /// \param k Number of elements to select, in [0, GetShape(dim)].
+    /// \param dim The dimension to select along. Default is the last
+    /// dimension.
+    /// \param largest If true, selects the largest elements, otherwise the
+    /// smallest.
+    /// \return Tuple (values, indices).
+    std::tuple<Tensor, Tensor> TopK(int64_t k,
+                                    int64_t dim = -1,
+                                    bool largest = true) const;
+
+    /// Returns the unique elements of the tensor in ascending order, together
+    /// with int64 inverse indices and counts. This is the same as NumPy's
+    /// `np.unique(a, return_inverse=True, return_counts=True, axis=dim)`.
+    /// NaN is sorted last and all NaNs form a single unique value.
+    ///
+    /// Example:
+    /// \code{.cpp}
+    /// Tensor keys = Tensor::Init<int32_t>({{1, 2}, {0, 5}, {1, 2}});
+    /// Tensor unique_keys, inverse_indices, counts;
+    /// std::tie(unique_keys, inverse_indices, counts) = keys.Unique(0);
+    /// // unique_keys:     [[0 5], [1 2]]
+    /// // inverse_indices: [1 0 1]
+    /// // counts:          [1 2]
+    /// \endcode
+    ///
+    /// \param dim If not given, the tensor is flattened and unique elements
+    /// are returned. Otherwise unique slices along \p dim are returned and
+    /// compared lexicographically.
+    /// \return Tuple (unique values, inverse indices, counts). Indexing the
+    /// unique values with the inverse indices along \p dim reconstructs the
+    /// (flattened) tensor.
+    std::tuple<Tensor, Tensor, Tensor> Unique(
+            const utility::optional<int64_t>& dim = utility::nullopt) const;
+
     /// Evaluate a single-element Tensor as a boolean value. This can be used to
     /// implement Tensor.__bool__() in Python, e.g.
     /// ```python
@@ -1158,7 +1237,12 @@ public:
     void Save(const std::string& file_name) const;
 
     /// Load tensor from numpy's npy format.
-    static Tensor Load(const std::string& file_name);
+    ///
+    /// \param file_name The .npy file to load.
+    /// \param memory_map If true, the file is memory-mapped copy-on-write
+    /// instead of read, so the tensor's data is paged in on access. Writes to
+    /// the tensor are not written back to the file.
+    static Tensor Load(const std::string& file_name, bool memory_map = false);
 
     /// Iterator for Tensor.
     struct Iterator {
@@ -1355,7 +1439,7 @@ inline bool Tensor::Item() const {
 
 template <typename S>
 inline void Tensor::Fill(S v) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(GetDtype(), [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(GetDtype(), [&]() {
         scalar_t casted_v = static_cast<scalar_t>(v);
         Tensor tmp(std::vector<scalar_t>({casted_v}), SizeVector({}),
                    GetDtype(), GetDevice());
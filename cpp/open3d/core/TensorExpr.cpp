@@ -0,0 +1,304 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/TensorExpr.h"
+
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Indexer.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+namespace {
+
+using kernel::FusedEWOpCode;
+
+/// Flattens an expression DAG into a topologically ordered program. Shared
+/// sub-expressions are evaluated once and the same tensor referenced by
+/// several leaves is only read once.
+class FusedEWCompiler {
+public:
+    template <typename NodePtr>
+    int64_t Compile(const NodePtr& node) {
+        auto it = node_to_register_.find(node.get());
+        if (it != node_to_register_.end()) {
+            return it->second;
+        }
+
+        kernel::FusedEWInstruction instr;
+        instr.op_code_ = node->op_code_;
+        instr.value0_ = node->value0_;
+        instr.value1_ = node->value1_;
+        if (node->op_code_ == FusedEWOpCode::Input) {
+            instr.lhs_ = GetInputIndex(node->tensor_);
+        } else if (node->op_code_ != FusedEWOpCode::Const) {
+            instr.lhs_ = Compile(node->lhs_);
+            if (node->rhs_ != nullptr) {
+                instr.rhs_ = Compile(node->rhs_);
+            }
+        }
+
+        const int64_t reg = static_cast<int64_t>(program_.size());
+        program_.push_back(instr);
+        node_to_register_[node.get()] = reg;
+        return reg;
+    }
+
+    const std::vector<Tensor>& GetInputs() const { return inputs_; }
+    const kernel::FusedEWProgram& GetProgram() const { return program_; }
+
+private:
+    int64_t GetInputIndex(const Tensor& tensor) {
+        for (size_t i = 0; i < inputs_.size(); ++i) {
+            if (inputs_[i].IsSame(tensor)) {
+                return static_cast<int64_t>(i);
+            }
+        }
+        inputs_.push_back(tensor);
+        return static_cast<int64_t>(inputs_.size()) - 1;
+    }
+
+    std::unordered_map<const void*, int64_t> node_to_register_;
+    std::vector<Tensor> inputs_;
+    kernel::FusedEWProgram program_;
+};
+
+}  // namespace
+
+TensorExpr::TensorExpr(const Tensor& tensor) {
+    auto node = std::make_shared<Node>();
+    node->op_code_ = FusedEWOpCode::Input;
+    node->tensor_ = tensor;
+    node->shape_ = tensor.GetShape();
+    node->dtype_ = tensor.GetDtype();
+    node->device_ = tensor.GetDevice();
+    node_ = node;
+}
+
+TensorExpr TensorExpr::Binary(const TensorExpr& value,
+                              FusedEWOpCode op_code) const {
+    if (value.GetDevice() != GetDevice()) {
+        utility::LogError("Device mismatch {} != {}.",
+                          value.GetDevice().ToString(),
+                          GetDevice().ToString());
+    }
+    if (value.GetDtype() != GetDtype()) {
+        utility::LogError("Dtype mismatch {} != {}.",
+                          value.GetDtype().ToString(), GetDtype().ToString());
+    }
+
+    auto node = std::make_shared<Node>();
+    node->op_code_ = op_code;
+    node->lhs_ = node_;
+    node->rhs_ = value.node_;
+    node->shape_ = shape_util::BroadcastedShape(GetShape(), value.GetShape());
+    node->dtype_ = GetDtype();
+    node->device_ = GetDevice();
+    return TensorExpr(node);
+}
+
+TensorExpr TensorExpr::Binary(Scalar value, FusedEWOpCode op_code) const {
+    auto node = std::make_shared<Node>();
+    node->op_code_ = FusedEWOpCode::Const;
+    node->value0_ = value;
+    node->shape_ = {};
+    node->dtype_ = GetDtype();
+    node->device_ = GetDevice();
+    return Binary(TensorExpr(node), op_code);
+}
+
+TensorExpr TensorExpr::Unary(FusedEWOpCode op_code, bool float_only) const {
+    if (float_only && GetDtype() != core::Float32 &&
+        GetDtype() != core::Float64) {
+        utility::LogError("Only supports Float32 and Float64, but {} is used.",
+                          GetDtype().ToString());
+    }
+
+    auto node = std::make_shared<Node>();
+    node->op_code_ = op_code;
+    node->lhs_ = node_;
+    node->shape_ = GetShape();
+    node->dtype_ = GetDtype();
+    node->device_ = GetDevice();
+    return TensorExpr(node);
+}
+
+TensorExpr TensorExpr::Add(const TensorExpr& value) const {
+    return Binary(value, FusedEWOpCode::Add);
+}
+
+TensorExpr TensorExpr::Add(Scalar value) const {
+    return Binary(value, FusedEWOpCode::Add);
+}
+
+TensorExpr TensorExpr::Sub(const TensorExpr& value) const {
+    return Binary(value, FusedEWOpCode::Sub);
+}
+
+TensorExpr TensorExpr::Sub(Scalar value) const {
+    return Binary(value, FusedEWOpCode::Sub);
+}
+
+TensorExpr TensorExpr::Mul(const TensorExpr& value) const {
+    return Binary(value, FusedEWOpCode::Mul);
+}
+
+TensorExpr TensorExpr::Mul(Scalar value) const {
+    return Binary(value, FusedEWOpCode::Mul);
+}
+
+TensorExpr TensorExpr::Div(const TensorExpr& value) const {
+    return Binary(value, FusedEWOpCode::Div);
+}
+
+TensorExpr TensorExpr::Div(Scalar value) const {
+    return Binary(value, FusedEWOpCode::Div);
+}
+
+TensorExpr TensorExpr::Sqrt() const {
+    return Unary(FusedEWOpCode::Sqrt, /*float_only=*/true);
+}
+
+TensorExpr TensorExpr::Sin() const {
+    return Unary(FusedEWOpCode::Sin, /*float_only=*/true);
+}
+
+TensorExpr TensorExpr::Cos() const {
+    return Unary(FusedEWOpCode::Cos, /*float_only=*/true);
+}
+
+TensorExpr TensorExpr::Neg() const { return Unary(FusedEWOpCode::Neg); }
+
+TensorExpr TensorExpr::Exp() const {
+    return Unary(FusedEWOpCode::Exp, /*float_only=*/true);
+}
+
+TensorExpr TensorExpr::Abs() const { return Unary(FusedEWOpCode::Abs); }
+
+TensorExpr TensorExpr::Floor() const { return Unary(FusedEWOpCode::Floor); }
+
+TensorExpr TensorExpr::Ceil() const { return Unary(FusedEWOpCode::Ceil); }
+
+TensorExpr TensorExpr::Round() const { return Unary(FusedEWOpCode::Round); }
+
+TensorExpr TensorExpr::Trunc() const { return Unary(FusedEWOpCode::Trunc); }
+
+TensorExpr TensorExpr::Clip(Scalar min_val, Scalar max_val) const {
+    auto node = std::make_shared<Node>();
+    node->op_code_ = FusedEWOpCode::Clip;
+    node->value0_ = min_val;
+    node->value1_ = max_val;
+    node->lhs_ = node_;
+    node->shape_ = GetShape();
+    node->dtype_ = GetDtype();
+    node->device_ = GetDevice();
+    return TensorExpr(node);
+}
+
+Tensor TensorExpr::Eval() const {
+    Tensor dst(GetShape(), GetDtype(), GetDevice());
+    EvalInto(dst);
+    return dst;
+}
+
+void TensorExpr::EvalInto(Tensor& dst) const {
+    AssertTensorShape(dst, GetShape());
+    AssertTensorDtype(dst, GetDtype());
+    AssertTensorDevice(dst, GetDevice());
+
+    FusedEWCompiler compiler;
+    compiler.Compile(node_);
+
+    // A single leaf is a plain copy.
+    if (node_->op_code_ == FusedEWOpCode::Input) {
+        dst.AsRvalue() = node_->tensor_;
+        return;
+    }
+
+    if (GetDevice().GetType() == Device::DeviceType::CPU &&
+        compiler.GetInputs().size() <= MAX_INPUTS) {
+        kernel::FusedEW(compiler.GetInputs(), compiler.GetProgram(), dst);
+    } else {
+        dst.AsRvalue() = EvalEager(node_);
+    }
+}
+
+Tensor TensorExpr::EvalEager(const std::shared_ptr<const Node>& node) {
+    switch (node->op_code_) {
+        case FusedEWOpCode::Input:
+            return node->tensor_;
+        case FusedEWOpCode::Const: {
+            Tensor dst;
+            DISPATCH_DTYPE_TO_TEMPLATE(node->dtype_, [&]() {
+                dst = Tensor::Full({}, node->value0_.To<scalar_t>(),
+                                   node->dtype_, node->device_);
+            });
+            return dst;
+        }
+        case FusedEWOpCode::Add:
+            return EvalEager(node->lhs_).Add(EvalEager(node->rhs_));
+        case FusedEWOpCode::Sub:
+            return EvalEager(node->lhs_).Sub(EvalEager(node->rhs_));
+        case FusedEWOpCode::Mul:
+            return EvalEager(node->lhs_).Mul(EvalEager(node->rhs_));
+        case FusedEWOpCode::Div:
+            return EvalEager(node->lhs_).Div(EvalEager(node->rhs_));
+        case FusedEWOpCode::Sqrt:
+            return EvalEager(node->lhs_).Sqrt();
+        case FusedEWOpCode::Sin:
+            return EvalEager(node->lhs_).Sin();
+        case FusedEWOpCode::Cos:
+            return EvalEager(node->lhs_).Cos();
+        case FusedEWOpCode::Neg:
+            return EvalEager(node->lhs_).Neg();
+        case FusedEWOpCode::Exp:
+            return EvalEager(node->lhs_).Exp();
+        case FusedEWOpCode::Abs:
+            return EvalEager(node->lhs_).Abs();
+        case FusedEWOpCode::Floor:
+            return EvalEager(node->lhs_).Floor();
+        case FusedEWOpCode::Ceil:
+            return EvalEager(node->lhs_).Ceil();
+        case FusedEWOpCode::Round:
+            return EvalEager(node->lhs_).Round();
+        case FusedEWOpCode::Trunc:
+            return EvalEager(node->lhs_).Trunc();
+        case FusedEWOpCode::Clip:
+            return EvalEager(node->lhs_).Clip(node->value0_, node->value1_);
+        default:
+            utility::LogError("Unsupported TensorExpr op code.");
+    }
+    return Tensor();
+}
+
+}  // namespace core
+}  // namespace open3d
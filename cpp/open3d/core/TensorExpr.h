@@ -0,0 +1,160 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+
+#include "open3d/core/Scalar.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/FusedEW.h"
+
+namespace open3d {
+namespace core {
+
+/// \brief A lazily evaluated chain of element-wise Tensor operations.
+///
+/// Building a TensorExpr only records the operations and checks shapes,
+/// dtypes and devices. Eval() compiles the expression into a single kernel
+/// that reads every input once and writes the output once, instead of
+/// materializing one temporary tensor per operation.
+///
+/// Example:
+/// \code{.cpp}
+/// Tensor a = Tensor::Ones({1000, 3}, core::Float32);
+/// Tensor b = Tensor::Ones({3}, core::Float32);
+/// // Equivalent to ((a * 2 + b).Sqrt()).Clip(0, 1), in a single pass.
+/// Tensor c = (TensorExpr(a) * 2 + b).Sqrt().Clip(0, 1).Eval();
+/// \endcode
+///
+/// On devices without a fused kernel, or when the expression references more
+/// distinct tensors than the Indexer supports, Eval() falls back to the eager
+/// Tensor operations and returns the same result.
+class TensorExpr {
+public:
+    /// Leaf expression referring to \p tensor. The tensor is not copied.
+    TensorExpr(const Tensor& tensor);
+
+    TensorExpr Add(const TensorExpr& value) const;
+    TensorExpr Add(Scalar value) const;
+    TensorExpr operator+(const TensorExpr& value) const { return Add(value); }
+    TensorExpr operator+(const Tensor& value) const {
+        return Add(TensorExpr(value));
+    }
+    TensorExpr operator+(Scalar value) const { return Add(value); }
+
+    TensorExpr Sub(const TensorExpr& value) const;
+    TensorExpr Sub(Scalar value) const;
+    TensorExpr operator-(const TensorExpr& value) const { return Sub(value); }
+    TensorExpr operator-(const Tensor& value) const {
+        return Sub(TensorExpr(value));
+    }
+    TensorExpr operator-(Scalar value) const { return Sub(value); }
+
+    TensorExpr Mul(const TensorExpr& value) const;
+    TensorExpr Mul(Scalar value) const;
+    TensorExpr operator*(const TensorExpr& value) const { return Mul(value); }
+    TensorExpr operator*(const Tensor& value) const {
+        return Mul(TensorExpr(value));
+    }
+    TensorExpr operator*(Scalar value) const { return Mul(value); }
+
+    TensorExpr Div(const TensorExpr& value) const;
+    TensorExpr Div(Scalar value) const;
+    TensorExpr operator/(const TensorExpr& value) const { return Div(value); }
+    TensorExpr operator/(const Tensor& value) const {
+        return Div(TensorExpr(value));
+    }
+    TensorExpr operator/(Scalar value) const { return Div(value); }
+
+    /// Element-wise square root. Only Float32 and Float64 are supported.
+    TensorExpr Sqrt() const;
+    /// Element-wise sine. Only Float32 and Float64 are supported.
+    TensorExpr Sin() const;
+    /// Element-wise cosine. Only Float32 and Float64 are supported.
+    TensorExpr Cos() const;
+    /// Element-wise negation.
+    TensorExpr Neg() const;
+    TensorExpr operator-() const { return Neg(); }
+    /// Element-wise exponential. Only Float32 and Float64 are supported.
+    TensorExpr Exp() const;
+    /// Element-wise absolute value.
+    TensorExpr Abs() const;
+    /// Element-wise floor.
+    TensorExpr Floor() const;
+    /// Element-wise ceil.
+    TensorExpr Ceil() const;
+    /// Element-wise round.
+    TensorExpr Round() const;
+    /// Element-wise trunc.
+    TensorExpr Trunc() const;
+    /// Element-wise clipping to [\p min_val, \p max_val].
+    TensorExpr Clip(Scalar min_val, Scalar max_val) const;
+
+    /// Evaluates the expression into a new contiguous tensor.
+    Tensor Eval() const;
+
+    /// Evaluates the expression into \p dst. \p dst must have the broadcasted
+    /// shape, dtype and device of the expression. \p dst may alias any of the
+    /// input tensors element-for-element, e.g. `(TensorExpr(a) * 2 + 1)
+    /// .EvalInto(a)` updates \p a in-place.
+    void EvalInto(Tensor& dst) const;
+
+    SizeVector GetShape() const { return node_->shape_; }
+    Dtype GetDtype() const { return node_->dtype_; }
+    Device GetDevice() const { return node_->device_; }
+
+private:
+    struct Node {
+        kernel::FusedEWOpCode op_code_;
+        /// Referenced tensor for FusedEWOpCode::Input.
+        Tensor tensor_;
+        Scalar value0_ = 0;
+        Scalar value1_ = 0;
+        std::shared_ptr<const Node> lhs_;
+        std::shared_ptr<const Node> rhs_;
+        SizeVector shape_;
+        Dtype dtype_;
+        Device device_;
+    };
+
+    explicit TensorExpr(std::shared_ptr<const Node> node)
+        : node_(std::move(node)) {}
+
+    TensorExpr Binary(const TensorExpr& value,
+                      kernel::FusedEWOpCode op_code) const;
+    TensorExpr Binary(Scalar value, kernel::FusedEWOpCode op_code) const;
+    TensorExpr Unary(kernel::FusedEWOpCode op_code,
+                     bool float_only = false) const;
+
+    /// Evaluates the expression with eager Tensor operations.
+    static Tensor EvalEager(const std::shared_ptr<const Node>& node);
+
+    std::shared_ptr<const Node> node_;
+};
+
+}  // namespace core
+}  // namespace open3d
@@ -39,8 +39,11 @@ namespace core {
 
 class CPUHashBackendBufferAccessor {
 public:
-    /// Must initialize from a non-const buffer to grab the heap top.
-    CPUHashBackendBufferAccessor(HashBackendBuffer &hashmap_buffer)
+    /// Must initialize from a non-const buffer to grab the heap top. Values
+    /// are zeroed unless \p reset_values is false, e.g. for buffers that hold
+    /// loaded entries.
+    CPUHashBackendBufferAccessor(HashBackendBuffer &hashmap_buffer,
+                                 bool reset_values = true)
         : capacity_(hashmap_buffer.GetCapacity()),
           key_dsize_(hashmap_buffer.GetKeyDsize()),
           value_dsizes_(hashmap_buffer.GetValueDsizes()),
@@ -49,7 +52,10 @@ public:
         std::vector<Tensor> value_buffers = hashmap_buffer.GetValueBuffers();
         for (size_t i = 0; i < value_buffers.size(); ++i) {
             void *value_buffer_ptr = value_buffers[i].GetDataPtr();
-            std::memset(value_buffer_ptr, 0, capacity_ * value_dsizes_[i]);
+            if (reset_values) {
+                std::memset(value_buffer_ptr, 0,
+                            capacity_ * value_dsizes_[i]);
+            }
             value_buffer_ptrs_.push_back(
                     static_cast<uint8_t *>(value_buffer_ptr));
         }
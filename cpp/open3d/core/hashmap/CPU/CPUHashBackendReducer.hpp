@@ -0,0 +1,145 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/hashmap/HashMap.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+/// Initializes and reduces the values of one value buffer element-wise. The
+/// reduction is atomic per element, so that concurrent reductions into the
+/// same entry are safe.
+class CPUHashBackendReducer {
+public:
+    using ValueFunc = void (*)(void* dst, const void* src, int64_t n);
+
+    CPUHashBackendReducer(const Dtype& dtype,
+                          int64_t value_dsize,
+                          HashReduceOp op)
+        : n_(value_dsize / dtype.ByteSize()) {
+        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+            switch (op) {
+                case HashReduceOp::Sum:
+                    init_ = Copy<scalar_t>;
+                    reduce_ = AtomicReduce<scalar_t, SumOp<scalar_t>>;
+                    break;
+                case HashReduceOp::Min:
+                    init_ = Copy<scalar_t>;
+                    reduce_ = AtomicReduce<scalar_t, MinOp<scalar_t>>;
+                    break;
+                case HashReduceOp::Max:
+                    init_ = Copy<scalar_t>;
+                    reduce_ = AtomicReduce<scalar_t, MaxOp<scalar_t>>;
+                    break;
+                case HashReduceOp::Count:
+                    init_ = One<scalar_t>;
+                    reduce_ = Increment<scalar_t>;
+                    break;
+                default:
+                    utility::LogError("Unsupported hash reduce op.");
+            }
+        });
+    }
+
+    /// Writes the value of a newly inserted entry. \p src is not read for
+    /// HashReduceOp::Count.
+    void Init(void* dst, const void* src) const { init_(dst, src, n_); }
+
+    /// Reduces \p src into the value of an existing entry. \p src is not read
+    /// for HashReduceOp::Count.
+    void Reduce(void* dst, const void* src) const { reduce_(dst, src, n_); }
+
+protected:
+    template <typename scalar_t>
+    struct SumOp {
+        scalar_t operator()(scalar_t a, scalar_t b) const { return a + b; }
+    };
+    template <typename scalar_t>
+    struct MinOp {
+        scalar_t operator()(scalar_t a, scalar_t b) const {
+            return std::min(a, b);
+        }
+    };
+    template <typename scalar_t>
+    struct MaxOp {
+        scalar_t operator()(scalar_t a, scalar_t b) const {
+            return std::max(a, b);
+        }
+    };
+
+    template <typename scalar_t>
+    static void Copy(void* dst, const void* src, int64_t n) {
+        std::memcpy(dst, src, n * sizeof(scalar_t));
+    }
+
+    template <typename scalar_t>
+    static void One(void* dst, const void* src, int64_t n) {
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst);
+        std::fill(dst_ptr, dst_ptr + n, static_cast<scalar_t>(1));
+    }
+
+    template <typename scalar_t, typename Op>
+    static void AtomicReduce(void* dst, const void* src, int64_t n) {
+        static_assert(sizeof(std::atomic<scalar_t>) == sizeof(scalar_t),
+                      "std::atomic must not change the value layout.");
+        std::atomic<scalar_t>* dst_ptr =
+                reinterpret_cast<std::atomic<scalar_t>*>(dst);
+        const scalar_t* src_ptr = static_cast<const scalar_t*>(src);
+        Op op;
+        for (int64_t i = 0; i < n; ++i) {
+            scalar_t expected = dst_ptr[i].load(std::memory_order_relaxed);
+            while (!dst_ptr[i].compare_exchange_weak(
+                    expected, op(expected, src_ptr[i]),
+                    std::memory_order_relaxed)) {
+            }
+        }
+    }
+
+    template <typename scalar_t>
+    static void Increment(void* dst, const void* src, int64_t n) {
+        const scalar_t one = static_cast<scalar_t>(1);
+        for (int64_t i = 0; i < n; ++i) {
+            AtomicReduce<scalar_t, SumOp<scalar_t>>(
+                    static_cast<scalar_t*>(dst) + i, &one, 1);
+        }
+    }
+
+    int64_t n_;
+    ValueFunc init_ = nullptr;
+    ValueFunc reduce_ = nullptr;
+};
+
+}  // namespace core
+}  // namespace open3d
@@ -24,6 +24,7 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/core/hashmap/CPU/OpenAddressingHashBackend.h"
 #include "open3d/core/hashmap/CPU/TBBHashBackend.h"
 #include "open3d/core/hashmap/Dispatch.h"
 #include "open3d/core/hashmap/HashMap.h"
@@ -41,7 +42,8 @@ std::shared_ptr<DeviceHashBackend> CreateCPUHashBackend(
         const Device& device,
         const HashBackendType& backend) {
     if (backend != HashBackendType::Default &&
-        backend != HashBackendType::TBB) {
+        backend != HashBackendType::TBB &&
+        backend != HashBackendType::OpenAddressing) {
         utility::LogError("Unsupported backend for CPU hashmap.");
     }
 
@@ -58,11 +60,19 @@ std::shared_ptr<DeviceHashBackend> CreateCPUHashBackend(
     }
 
     std::shared_ptr<DeviceHashBackend> device_hashmap_ptr;
-    DISPATCH_DTYPE_AND_DIM_TO_TEMPLATE(key_dtype, dim, [&] {
-        device_hashmap_ptr =
-                std::make_shared<TBBHashBackend<key_t, hash_t, eq_t>>(
-                        init_capacity, key_dsize, value_dsizes, device);
-    });
+    if (backend == HashBackendType::OpenAddressing) {
+        DISPATCH_DTYPE_AND_DIM_TO_TEMPLATE(key_dtype, dim, [&] {
+            device_hashmap_ptr = std::make_shared<
+                    OpenAddressingHashBackend<key_t, hash_t, eq_t>>(
+                    init_capacity, key_dsize, value_dsizes, device);
+        });
+    } else {  // if (backend == HashBackendType::TBB) {
+        DISPATCH_DTYPE_AND_DIM_TO_TEMPLATE(key_dtype, dim, [&] {
+            device_hashmap_ptr =
+                    std::make_shared<TBBHashBackend<key_t, hash_t, eq_t>>(
+                            init_capacity, key_dsize, value_dsizes, device);
+        });
+    }
     return device_hashmap_ptr;
 }
 
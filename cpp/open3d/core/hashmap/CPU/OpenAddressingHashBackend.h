@@ -0,0 +1,642 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+        (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define OPEN3D_HASHMAP_SSE2
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "open3d/core/hashmap/CPU/CPUHashBackendBufferAccessor.hpp"
+#include "open3d/core/hashmap/CPU/CPUHashBackendReducer.hpp"
+#include "open3d/core/hashmap/DeviceHashBackend.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace core {
+
+/// Flat open-addressing hash backend for the CPU.
+///
+/// The table is a contiguous array of one-byte control words and a parallel
+/// array of buffer indices. Slots are grouped in runs of 16 that are linearly
+/// probed one group at a time. The control word of an occupied slot stores 7
+/// bits of the key hash, so a whole group is filtered with a single SSE2
+/// comparison and keys are only fetched from the buffer on a tag hit.
+///
+/// Insertion is lock-free: a thread claims an empty slot with a CAS on its
+/// control word, writes the key/value pair to the buffer, then publishes the
+/// tag. Concurrent insertions of the same key always race for the same slot,
+/// so duplicates are never created. Erase leaves tombstones and is
+/// sequential, like TBBHashBackend::Erase.
+template <typename Key, typename Hash, typename Eq>
+class OpenAddressingHashBackend : public DeviceHashBackend {
+public:
+    OpenAddressingHashBackend(int64_t init_capacity,
+                              int64_t key_dsize,
+                              const std::vector<int64_t>& value_dsizes,
+                              const Device& device);
+    ~OpenAddressingHashBackend();
+
+    void Reserve(int64_t capacity) override;
+
+    void Insert(const void* input_keys,
+                const std::vector<const void*>& input_values_soa,
+                buf_index_t* output_buf_indices,
+                bool* output_masks,
+                int64_t count) override;
+
+    void InsertReduce(const void* input_keys,
+                      const std::vector<const void*>& input_values_soa,
+                      const std::vector<Dtype>& value_dtypes,
+                      const std::vector<HashReduceOp>& reduce_ops,
+                      buf_index_t* output_buf_indices,
+                      bool* output_masks,
+                      int64_t count) override;
+
+    void Find(const void* input_keys,
+              buf_index_t* output_buf_indices,
+              bool* output_masks,
+              int64_t count) override;
+
+    void Erase(const void* input_keys,
+               bool* output_masks,
+               int64_t count) override;
+
+    int64_t GetActiveIndices(buf_index_t* output_indices) override;
+
+    void Clear() override;
+
+    int64_t Size() const override;
+    int64_t GetBucketCount() const override;
+    std::vector<int64_t> BucketSizes() const override;
+    float LoadFactor() const override;
+
+    void Allocate(int64_t capacity) override;
+    void Free() override;
+
+    void GetTable(Tensor& ctrl, Tensor& slot_buf_indices) const override;
+    void SetTable(std::shared_ptr<HashBackendBuffer> buffer,
+                  const Tensor& ctrl,
+                  const Tensor& slot_buf_indices) override;
+
+protected:
+    static constexpr int kGroupWidth = 16;
+    /// Upper bound of active entries per slot. Capacity is fixed between
+    /// Allocate() calls, so this bounds the occupancy of the table.
+    static constexpr double kMaxLoadFactor = 0.75;
+
+    static constexpr uint8_t kEmpty = 0x80;
+    static constexpr uint8_t kDeleted = 0xFE;
+    static constexpr uint8_t kBusy = 0xFF;
+
+    /// Mixes the user hash so that both the group index (low bits) and the
+    /// tag (high 7 bits) are well distributed.
+    static uint64_t MixHash(uint64_t h) {
+        h ^= h >> 33;
+        h *= UINT64_C(0xff51afd7ed558ccd);
+        h ^= h >> 33;
+        h *= UINT64_C(0xc4ceb9fe1a85ec53);
+        h ^= h >> 33;
+        return h;
+    }
+
+    static uint8_t HashTag(uint64_t h) { return static_cast<uint8_t>(h >> 57); }
+
+    /// Snapshot of the control words of one group. All decisions for a probe
+    /// step are taken on the same snapshot.
+    struct GroupCtrl {
+        explicit GroupCtrl(const std::atomic<uint8_t>* group) {
+#ifdef OPEN3D_HASHMAP_SSE2
+            ctrl_ = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+#else
+            for (int i = 0; i < kGroupWidth; ++i) {
+                ctrl_[i] = group[i].load(std::memory_order_relaxed);
+            }
+#endif
+        }
+
+        /// Returns a bitmask of the slots whose control word equals \p byte.
+        uint32_t Match(uint8_t byte) const {
+#ifdef OPEN3D_HASHMAP_SSE2
+            return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(
+                    ctrl_, _mm_set1_epi8(static_cast<char>(byte)))));
+#else
+            uint32_t mask = 0;
+            for (int i = 0; i < kGroupWidth; ++i) {
+                mask |= static_cast<uint32_t>(ctrl_[i] == byte) << i;
+            }
+            return mask;
+#endif
+        }
+
+#ifdef OPEN3D_HASHMAP_SSE2
+        __m128i ctrl_;
+#else
+        uint8_t ctrl_[kGroupWidth];
+#endif
+    };
+
+    static int TrailingZeros(uint32_t mask) {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctz(mask);
+#endif
+    }
+
+    const Key& BufferKey(buf_index_t buf_index) const {
+        return *static_cast<const Key*>(
+                buffer_accessor_->GetKeyPtr(buf_index));
+    }
+
+    /// Inserts \p key if absent. On success, \p emplace() is called to obtain
+    /// the buffer index of the new entry while the slot is held busy. Returns
+    /// true on insertion, false if the key already exists. \p buf_index is
+    /// set in both cases.
+    template <typename Func>
+    bool InsertKey(const Key& key, Func&& emplace, buf_index_t& buf_index);
+
+    /// Returns the slot holding \p key, or -1 if absent.
+    int64_t FindSlot(const Key& key) const;
+
+    /// Rebuilds the table in place to drop tombstones.
+    void Rehash();
+
+    /// Sets the table to views of \p ctrl and \p slot_buf_indices.
+    void SetTableTensors(const Tensor& ctrl, const Tensor& slot_buf_indices);
+
+    /// The table is held in tensors so that it can view a memory-mapped file.
+    Tensor ctrl_tensor_;
+    Tensor slot_buf_indices_tensor_;
+    std::atomic<uint8_t>* ctrl_ = nullptr;
+    buf_index_t* slot_buf_indices_ = nullptr;
+    int64_t num_slots_ = 0;
+    int64_t group_mask_ = 0;
+
+    std::atomic<int64_t> size_{0};
+    int64_t num_deleted_ = 0;
+
+    Hash hash_fn_;
+    Eq eq_fn_;
+
+    std::shared_ptr<CPUHashBackendBufferAccessor> buffer_accessor_;
+};
+
+template <typename Key, typename Hash, typename Eq>
+OpenAddressingHashBackend<Key, Hash, Eq>::OpenAddressingHashBackend(
+        int64_t init_capacity,
+        int64_t key_dsize,
+        const std::vector<int64_t>& value_dsizes,
+        const Device& device)
+    : DeviceHashBackend(init_capacity, key_dsize, value_dsizes, device) {
+    Allocate(init_capacity);
+}
+
+template <typename Key, typename Hash, typename Eq>
+OpenAddressingHashBackend<Key, Hash, Eq>::~OpenAddressingHashBackend() {}
+
+template <typename Key, typename Hash, typename Eq>
+int64_t OpenAddressingHashBackend<Key, Hash, Eq>::Size() const {
+    return size_.load();
+}
+
+template <typename Key, typename Hash, typename Eq>
+template <typename Func>
+bool OpenAddressingHashBackend<Key, Hash, Eq>::InsertKey(
+        const Key& key, Func&& emplace, buf_index_t& buf_index) {
+    const uint64_t hash = MixHash(hash_fn_(key));
+    const uint8_t tag = HashTag(hash);
+    int64_t group = static_cast<int64_t>(hash) & group_mask_;
+
+    while (true) {
+        std::atomic<uint8_t>* ctrl = ctrl_ + group * kGroupWidth;
+        const GroupCtrl snapshot(ctrl);
+
+        // A busy slot may be a concurrent insertion of the same key: wait for
+        // it to be published before deciding.
+        if (snapshot.Match(kBusy) != 0) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        for (uint32_t mask = snapshot.Match(tag); mask != 0;
+             mask &= mask - 1) {
+            const int offset = TrailingZeros(mask);
+            const int64_t slot = group * kGroupWidth + offset;
+            if (ctrl[offset].load(std::memory_order_acquire) == tag &&
+                eq_fn_(BufferKey(slot_buf_indices_[slot]), key)) {
+                buf_index = slot_buf_indices_[slot];
+                return false;
+            }
+        }
+
+        const uint32_t empty_mask = snapshot.Match(kEmpty);
+        if (empty_mask == 0) {
+            group = (group + 1) & group_mask_;
+            continue;
+        }
+
+        // All threads inserting the same key target the first empty slot of
+        // the same group; the loser re-scans and finds the winner's key.
+        const int offset = TrailingZeros(empty_mask);
+        uint8_t expected = kEmpty;
+        if (ctrl[offset].compare_exchange_strong(expected, kBusy,
+                                                 std::memory_order_acq_rel)) {
+            const int64_t slot = group * kGroupWidth + offset;
+            buf_index = emplace();
+            slot_buf_indices_[slot] = buf_index;
+            ctrl[offset].store(tag, std::memory_order_release);
+            return true;
+        }
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+int64_t OpenAddressingHashBackend<Key, Hash, Eq>::FindSlot(
+        const Key& key) const {
+    const uint64_t hash = MixHash(hash_fn_(key));
+    const uint8_t tag = HashTag(hash);
+    int64_t group = static_cast<int64_t>(hash) & group_mask_;
+
+    while (true) {
+        const GroupCtrl snapshot(ctrl_ + group * kGroupWidth);
+        for (uint32_t mask = snapshot.Match(tag); mask != 0;
+             mask &= mask - 1) {
+            const int64_t slot = group * kGroupWidth + TrailingZeros(mask);
+            if (eq_fn_(BufferKey(slot_buf_indices_[slot]), key)) {
+                return slot;
+            }
+        }
+        // Insertion never skips an empty slot, so the probe sequence of a
+        // present key ends before the first group with an empty slot.
+        if (snapshot.Match(kEmpty) != 0) {
+            return -1;
+        }
+        group = (group + 1) & group_mask_;
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::Find(
+        const void* input_keys,
+        buf_index_t* output_buf_indices,
+        bool* output_masks,
+        int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < count; ++i) {
+        const int64_t slot = FindSlot(input_keys_templated[i]);
+        bool flag = (slot >= 0);
+        output_masks[i] = flag;
+        output_buf_indices[i] = flag ? slot_buf_indices_[slot] : 0;
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::Erase(const void* input_keys,
+                                                     bool* output_masks,
+                                                     int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+
+    for (int64_t i = 0; i < count; ++i) {
+        const int64_t slot = FindSlot(input_keys_templated[i]);
+        bool flag = (slot >= 0);
+        output_masks[i] = flag;
+        if (flag) {
+            buffer_accessor_->DeviceFree(slot_buf_indices_[slot]);
+            size_.fetch_sub(1);
+
+            // A group that still has an empty slot never forwarded a probe to
+            // the next group, so the slot can be emptied without a tombstone.
+            const GroupCtrl snapshot(ctrl_ +
+                                     (slot / kGroupWidth) * kGroupWidth);
+            if (snapshot.Match(kEmpty) != 0) {
+                ctrl_[slot].store(kEmpty);
+            } else {
+                ctrl_[slot].store(kDeleted);
+                ++num_deleted_;
+            }
+        }
+    }
+
+    // Tombstones are never reused by Insert. Keep at least one eighth of the
+    // slots empty even with the buffer at full capacity so that probing
+    // terminates.
+    if ((this->capacity_ + num_deleted_) * 8 > num_slots_ * 7) {
+        Rehash();
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::Rehash() {
+    std::vector<buf_index_t> active_buf_indices(size_.load());
+    GetActiveIndices(active_buf_indices.data());
+
+    for (int64_t i = 0; i < num_slots_; ++i) {
+        ctrl_[i].store(kEmpty, std::memory_order_relaxed);
+    }
+    num_deleted_ = 0;
+
+    const int64_t count = static_cast<int64_t>(active_buf_indices.size());
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < count; ++i) {
+        const buf_index_t buf_index = active_buf_indices[i];
+        buf_index_t unused;
+        InsertKey(
+                BufferKey(buf_index), [&]() { return buf_index; }, unused);
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+int64_t OpenAddressingHashBackend<Key, Hash, Eq>::GetActiveIndices(
+        buf_index_t* output_buf_indices) {
+    int64_t count = 0;
+    for (int64_t i = 0; i < num_slots_; ++i) {
+        // Occupied slots hold a tag in [0, 0x7F].
+        if (ctrl_[i].load(std::memory_order_relaxed) < kEmpty) {
+            output_buf_indices[count++] = slot_buf_indices_[i];
+        }
+    }
+    return count;
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::Clear() {
+    for (int64_t i = 0; i < num_slots_; ++i) {
+        ctrl_[i].store(kEmpty, std::memory_order_relaxed);
+    }
+    size_ = 0;
+    num_deleted_ = 0;
+    this->buffer_->ResetHeap();
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::Reserve(int64_t capacity) {
+    // The table is sized for the buffer capacity in Allocate().
+}
+
+template <typename Key, typename Hash, typename Eq>
+int64_t OpenAddressingHashBackend<Key, Hash, Eq>::GetBucketCount() const {
+    return num_slots_ / kGroupWidth;
+}
+
+template <typename Key, typename Hash, typename Eq>
+std::vector<int64_t> OpenAddressingHashBackend<Key, Hash, Eq>::BucketSizes()
+        const {
+    // Each group of slots is reported as a bucket.
+    std::vector<int64_t> ret(num_slots_ / kGroupWidth, 0);
+    for (int64_t i = 0; i < num_slots_; ++i) {
+        if (ctrl_[i].load(std::memory_order_relaxed) < kEmpty) {
+            ++ret[i / kGroupWidth];
+        }
+    }
+    return ret;
+}
+
+template <typename Key, typename Hash, typename Eq>
+float OpenAddressingHashBackend<Key, Hash, Eq>::LoadFactor() const {
+    return float(size_.load()) / float(num_slots_);
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::Insert(
+        const void* input_keys,
+        const std::vector<const void*>& input_values_soa,
+        buf_index_t* output_buf_indices,
+        bool* output_masks,
+        int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+
+    size_t n_values = input_values_soa.size();
+
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < count; ++i) {
+        const Key& key = input_keys_templated[i];
+
+        // Copy key value pair to buffer only if the slot is claimed.
+        auto emplace = [&]() {
+            buf_index_t buf_index = buffer_accessor_->DeviceAllocate();
+            void* key_ptr = buffer_accessor_->GetKeyPtr(buf_index);
+
+            // Copy templated key to buffer
+            *static_cast<Key*>(key_ptr) = key;
+
+            // Copy/reset non-templated value in buffer
+            for (size_t j = 0; j < n_values; ++j) {
+                uint8_t* dst_value = static_cast<uint8_t*>(
+                        buffer_accessor_->GetValuePtr(buf_index, j));
+
+                const uint8_t* src_value =
+                        static_cast<const uint8_t*>(input_values_soa[j]) +
+                        this->value_dsizes_[j] * i;
+                std::memcpy(dst_value, src_value, this->value_dsizes_[j]);
+            }
+            return buf_index;
+        };
+
+        buf_index_t buf_index;
+        bool flag = InsertKey(key, emplace, buf_index);
+        if (flag) {
+            size_.fetch_add(1);
+        }
+        output_masks[i] = flag;
+        output_buf_indices[i] = flag ? buf_index : 0;
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::InsertReduce(
+        const void* input_keys,
+        const std::vector<const void*>& input_values_soa,
+        const std::vector<Dtype>& value_dtypes,
+        const std::vector<HashReduceOp>& reduce_ops,
+        buf_index_t* output_buf_indices,
+        bool* output_masks,
+        int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+
+    size_t n_values = input_values_soa.size();
+    std::vector<CPUHashBackendReducer> reducers;
+    for (size_t j = 0; j < n_values; ++j) {
+        reducers.emplace_back(value_dtypes[j], this->value_dsizes_[j],
+                              reduce_ops[j]);
+    }
+
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < count; ++i) {
+        const Key& key = input_keys_templated[i];
+
+        // Values of a new entry are initialized while its slot is busy, so
+        // that they are visible to every later reduction.
+        auto emplace = [&]() {
+            buf_index_t buf_index = buffer_accessor_->DeviceAllocate();
+            void* key_ptr = buffer_accessor_->GetKeyPtr(buf_index);
+            *static_cast<Key*>(key_ptr) = key;
+
+            for (size_t j = 0; j < n_values; ++j) {
+                const uint8_t* src_value =
+                        static_cast<const uint8_t*>(input_values_soa[j]);
+                reducers[j].Init(
+                        buffer_accessor_->GetValuePtr(buf_index, j),
+                        src_value ? src_value + this->value_dsizes_[j] * i
+                                  : nullptr);
+            }
+            return buf_index;
+        };
+
+        buf_index_t buf_index;
+        bool flag = InsertKey(key, emplace, buf_index);
+        if (flag) {
+            size_.fetch_add(1);
+        } else {
+            for (size_t j = 0; j < n_values; ++j) {
+                const uint8_t* src_value =
+                        static_cast<const uint8_t*>(input_values_soa[j]);
+                reducers[j].Reduce(
+                        buffer_accessor_->GetValuePtr(buf_index, j),
+                        src_value ? src_value + this->value_dsizes_[j] * i
+                                  : nullptr);
+            }
+        }
+        output_masks[i] = flag;
+        output_buf_indices[i] = buf_index;
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::Allocate(int64_t capacity) {
+    this->capacity_ = capacity;
+
+    this->buffer_ = std::make_shared<HashBackendBuffer>(
+            this->capacity_, this->key_dsize_, this->value_dsizes_,
+            this->device_);
+
+    buffer_accessor_ =
+            std::make_shared<CPUHashBackendBufferAccessor>(*this->buffer_);
+
+    // Power-of-two number of groups so that probing wraps with a mask.
+    int64_t num_groups = 1;
+    while (num_groups * kGroupWidth * kMaxLoadFactor < capacity) {
+        num_groups *= 2;
+    }
+    const int64_t num_slots = num_groups * kGroupWidth;
+    SetTableTensors(Tensor::Full<uint8_t>({num_slots}, kEmpty, core::UInt8,
+                                          this->device_),
+                    Tensor::Zeros({num_slots}, core::UInt32, this->device_));
+
+    size_ = 0;
+    num_deleted_ = 0;
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::Free() {
+    ctrl_tensor_ = Tensor();
+    slot_buf_indices_tensor_ = Tensor();
+    ctrl_ = nullptr;
+    slot_buf_indices_ = nullptr;
+    num_slots_ = 0;
+    group_mask_ = 0;
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::SetTableTensors(
+        const Tensor& ctrl, const Tensor& slot_buf_indices) {
+    static_assert(sizeof(std::atomic<uint8_t>) == sizeof(uint8_t),
+                  "Control words must be stored as bytes.");
+    ctrl_tensor_ = ctrl;
+    slot_buf_indices_tensor_ = slot_buf_indices;
+    ctrl_ = reinterpret_cast<std::atomic<uint8_t>*>(
+            ctrl_tensor_.GetDataPtr<uint8_t>());
+    slot_buf_indices_ =
+            static_cast<buf_index_t*>(slot_buf_indices_tensor_.GetDataPtr());
+    num_slots_ = ctrl.GetLength();
+    group_mask_ = num_slots_ / kGroupWidth - 1;
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::GetTable(
+        Tensor& ctrl, Tensor& slot_buf_indices) const {
+    ctrl = ctrl_tensor_;
+    slot_buf_indices = slot_buf_indices_tensor_;
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::SetTable(
+        std::shared_ptr<HashBackendBuffer> buffer,
+        const Tensor& ctrl,
+        const Tensor& slot_buf_indices) {
+    const int64_t num_slots = ctrl.GetLength();
+    if (ctrl.GetDtype() != core::UInt8 || ctrl.NumDims() != 1 ||
+        !ctrl.IsContiguous() || num_slots < kGroupWidth ||
+        num_slots % kGroupWidth != 0 ||
+        ((num_slots / kGroupWidth) & (num_slots / kGroupWidth - 1)) != 0) {
+        utility::LogError(
+                "Control words must be a contiguous UInt8 tensor whose length "
+                "is a power of two multiple of {}, but got {}.",
+                kGroupWidth, ctrl.GetShape());
+    }
+    if (slot_buf_indices.GetDtype() != core::UInt32 ||
+        slot_buf_indices.GetShape() != ctrl.GetShape() ||
+        !slot_buf_indices.IsContiguous()) {
+        utility::LogError(
+                "Slot buffer indices must be a contiguous UInt32 tensor of "
+                "shape {}, but got {}.",
+                ctrl.GetShape(), slot_buf_indices.GetShape());
+    }
+    if (buffer->GetKeyDsize() != this->key_dsize_ ||
+        buffer->GetValueDsizes() != this->value_dsizes_) {
+        utility::LogError("Buffer element sizes mismatch with the hash map.");
+    }
+
+    this->capacity_ = buffer->GetCapacity();
+    this->buffer_ = buffer;
+    buffer_accessor_ = std::make_shared<CPUHashBackendBufferAccessor>(
+            *this->buffer_, /*reset_values=*/false);
+
+    SetTableTensors(ctrl, slot_buf_indices);
+    // The table has no tombstones, as written by GetTable after a fresh
+    // build, and every allocated buffer entry is active.
+    size_ = this->buffer_->GetHeapTopIndex();
+    num_deleted_ = 0;
+}
+
+}  // namespace core
+}  // namespace open3d
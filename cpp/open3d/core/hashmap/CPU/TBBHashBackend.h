@@ -28,10 +28,13 @@
 
 #include <tbb/concurrent_unordered_map.h>
 
+#include <atomic>
 #include <limits>
+#include <thread>
 #include <unordered_map>
 
 #include "open3d/core/hashmap/CPU/CPUHashBackendBufferAccessor.hpp"
+#include "open3d/core/hashmap/CPU/CPUHashBackendReducer.hpp"
 #include "open3d/core/hashmap/DeviceHashBackend.h"
 #include "open3d/utility/Parallel.h"
 
@@ -54,6 +57,14 @@ public:
                 bool* output_masks,
                 int64_t count) override;
 
+    void InsertReduce(const void* input_keys,
+                      const std::vector<const void*>& input_values_soa,
+                      const std::vector<Dtype>& value_dtypes,
+                      const std::vector<HashReduceOp>& reduce_ops,
+                      buf_index_t* output_buf_indices,
+                      bool* output_masks,
+                      int64_t count) override;
+
     void Find(const void* input_keys,
               buf_index_t* output_buf_indices,
               bool* output_masks,
@@ -235,6 +246,73 @@ void TBBHashBackend<Key, Hash, Eq>::Insert(
     }
 }
 
+template <typename Key, typename Hash, typename Eq>
+void TBBHashBackend<Key, Hash, Eq>::InsertReduce(
+        const void* input_keys,
+        const std::vector<const void*>& input_values_soa,
+        const std::vector<Dtype>& value_dtypes,
+        const std::vector<HashReduceOp>& reduce_ops,
+        buf_index_t* output_buf_indices,
+        bool* output_masks,
+        int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+
+    size_t n_values = input_values_soa.size();
+    std::vector<CPUHashBackendReducer> reducers;
+    for (size_t j = 0; j < n_values; ++j) {
+        reducers.emplace_back(value_dtypes[j], this->value_dsizes_[j],
+                              reduce_ops[j]);
+    }
+
+    // Placeholder of an entry whose buffer index is not published yet.
+    const buf_index_t kPending = std::numeric_limits<buf_index_t>::max();
+
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < count; ++i) {
+        const Key& key = input_keys_templated[i];
+
+        auto res = impl_->insert({key, kPending});
+        std::atomic<buf_index_t>* published =
+                reinterpret_cast<std::atomic<buf_index_t>*>(
+                        &res.first->second);
+
+        buf_index_t buf_index;
+        if (res.second) {
+            buf_index = buffer_accessor_->DeviceAllocate();
+            void* key_ptr = buffer_accessor_->GetKeyPtr(buf_index);
+            *static_cast<Key*>(key_ptr) = key;
+
+            for (size_t j = 0; j < n_values; ++j) {
+                const uint8_t* src_value =
+                        static_cast<const uint8_t*>(input_values_soa[j]);
+                reducers[j].Init(
+                        buffer_accessor_->GetValuePtr(buf_index, j),
+                        src_value ? src_value + this->value_dsizes_[j] * i
+                                  : nullptr);
+            }
+            published->store(buf_index, std::memory_order_release);
+        } else {
+            // Wait for a concurrent insertion of the same key to publish the
+            // initialized value.
+            while ((buf_index = published->load(std::memory_order_acquire)) ==
+                   kPending) {
+                std::this_thread::yield();
+            }
+            for (size_t j = 0; j < n_values; ++j) {
+                const uint8_t* src_value =
+                        static_cast<const uint8_t*>(input_values_soa[j]);
+                reducers[j].Reduce(
+                        buffer_accessor_->GetValuePtr(buf_index, j),
+                        src_value ? src_value + this->value_dsizes_[j] * i
+                                  : nullptr);
+            }
+        }
+
+        output_buf_indices[i] = buf_index;
+        output_masks[i] = res.second;
+    }
+}
+
 template <typename Key, typename Hash, typename Eq>
 void TBBHashBackend<Key, Hash, Eq>::Allocate(int64_t capacity) {
     this->capacity_ = capacity;
@@ -33,6 +33,32 @@
 namespace open3d {
 namespace core {
 
+void DeviceHashBackend::InsertReduce(
+        const void* input_keys,
+        const std::vector<const void*>& input_values_soa,
+        const std::vector<Dtype>& value_dtypes,
+        const std::vector<HashReduceOp>& reduce_ops,
+        buf_index_t* output_buf_indices,
+        bool* output_masks,
+        int64_t count) {
+    utility::LogError(
+            "InsertReduce is not supported by the hash backend on {}.",
+            device_.ToString());
+}
+
+void DeviceHashBackend::GetTable(Tensor& ctrl,
+                                 Tensor& slot_buf_indices) const {
+    utility::LogError("GetTable is only supported by the OpenAddressing "
+                      "hash backend.");
+}
+
+void DeviceHashBackend::SetTable(std::shared_ptr<HashBackendBuffer> buffer,
+                                 const Tensor& ctrl,
+                                 const Tensor& slot_buf_indices) {
+    utility::LogError("SetTable is only supported by the OpenAddressing "
+                      "hash backend.");
+}
+
 std::shared_ptr<DeviceHashBackend> CreateDeviceHashBackend(
         int64_t init_capacity,
         const Dtype& key_dtype,
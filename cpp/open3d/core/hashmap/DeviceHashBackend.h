@@ -35,6 +35,7 @@ namespace open3d {
 namespace core {
 
 enum class HashBackendType;
+enum class HashReduceOp;
 
 class DeviceHashBackend {
 public:
@@ -63,6 +64,17 @@ public:
                         bool* output_masks,
                         int64_t count) = 0;
 
+    /// Parallel insert contiguous arrays of keys and values, and reduce the
+    /// values of existing keys into the stored values. Only implemented by
+    /// the CPU backends.
+    virtual void InsertReduce(const void* input_keys,
+                              const std::vector<const void*>& input_values_soa,
+                              const std::vector<Dtype>& value_dtypes,
+                              const std::vector<HashReduceOp>& reduce_ops,
+                              buf_index_t* output_buf_indices,
+                              bool* output_masks,
+                              int64_t count);
+
     /// Parallel find a contiguous array of keys.
     virtual void Find(const void* input_keys,
                       buf_index_t* output_buf_indices,
@@ -110,6 +122,20 @@ public:
     virtual void Allocate(int64_t capacity) = 0;
     virtual void Free() = 0;
 
+    /// Get the flat hash table as tensors viewing the backend memory, with one
+    /// control word and one buffer index per slot. Together with the buffer,
+    /// they describe the hash map without rehashing. Only implemented by the
+    /// OpenAddressing backend.
+    virtual void GetTable(Tensor& ctrl, Tensor& slot_buf_indices) const;
+
+    /// Replace the buffer and the hash table with the given ones, e.g. views
+    /// of a memory-mapped file, without copying them. The table must come
+    /// from GetTable of a backend with the same key type, and every allocated
+    /// buffer entry must be active.
+    virtual void SetTable(std::shared_ptr<HashBackendBuffer> buffer,
+                          const Tensor& ctrl,
+                          const Tensor& slot_buf_indices);
+
 public:
     int64_t capacity_;
 
@@ -36,21 +36,7 @@ HashBackendBuffer::HashBackendBuffer(int64_t capacity,
                                      std::vector<int64_t> value_dsizes,
                                      const Device &device) {
     // First compute common bytesize divisor for fast copying values.
-    const std::vector<int64_t> kDivisors = {16, 12, 8, 4, 2, 1};
-
-    for (const auto &divisor : kDivisors) {
-        bool valid = true;
-        blocks_per_element_.clear();
-        for (size_t i = 0; i < value_dsizes.size(); ++i) {
-            int64_t bytesize = value_dsizes[i];
-            valid = valid && (bytesize % divisor == 0);
-            blocks_per_element_.push_back(bytesize / divisor);
-        }
-        if (valid) {
-            common_block_size_ = divisor;
-            break;
-        }
-    }
+    InitBlockSizes(value_dsizes);
 
     heap_ = Tensor({capacity}, core::UInt32, device);
 
@@ -76,6 +62,74 @@ HashBackendBuffer::HashBackendBuffer(int64_t capacity,
     ResetHeap();
 }
 
+HashBackendBuffer::HashBackendBuffer(const Tensor &heap,
+                                     int heap_top,
+                                     const Tensor &keys,
+                                     const std::vector<Tensor> &values) {
+    const int64_t capacity = heap.GetLength();
+    const Device device = heap.GetDevice();
+    if (heap.GetDtype() != core::UInt32 || heap.NumDims() != 1 ||
+        !heap.IsContiguous()) {
+        utility::LogError("Heap must be a contiguous 1D UInt32 tensor.");
+    }
+    if (heap_top < 0 || heap_top > capacity) {
+        utility::LogError("Heap top {} out of range [0, {}].", heap_top,
+                          capacity);
+    }
+
+    // Reinterpret rows of the input tensors as opaque elements.
+    auto wrap = [&](const Tensor &tensor, const std::string &name) {
+        if (tensor.GetLength() != capacity || !tensor.IsContiguous() ||
+            tensor.GetDevice() != device) {
+            utility::LogError(
+                    "Buffer {} must be a contiguous tensor of length {} on "
+                    "{}.",
+                    name, capacity, device.ToString());
+        }
+        int64_t dsize = capacity == 0 ? 0
+                                      : tensor.NumElements() / capacity *
+                                                tensor.GetDtype().ByteSize();
+        return Tensor({capacity}, {1}, const_cast<void *>(tensor.GetDataPtr()),
+                      Dtype(Dtype::DtypeCode::Object, dsize, name),
+                      tensor.GetBlob());
+    };
+
+    std::vector<int64_t> value_dsizes;
+    heap_ = heap;
+    key_buffer_ = wrap(keys, "_hash_k");
+    for (size_t i = 0; i < values.size(); ++i) {
+        value_buffers_.push_back(
+                wrap(values[i], "_hash_v_" + std::to_string(i)));
+        value_dsizes.push_back(value_buffers_.back().GetDtype().ByteSize());
+    }
+    InitBlockSizes(value_dsizes);
+
+    if (device.GetType() == Device::DeviceType::CUDA) {
+        heap_top_.cuda = Tensor::Init<int>({heap_top}, device);
+    } else {
+        heap_top_.cpu = heap_top;
+    }
+}
+
+void HashBackendBuffer::InitBlockSizes(
+        const std::vector<int64_t> &value_dsizes) {
+    const std::vector<int64_t> kDivisors = {16, 12, 8, 4, 2, 1};
+
+    for (const auto &divisor : kDivisors) {
+        bool valid = true;
+        blocks_per_element_.clear();
+        for (size_t i = 0; i < value_dsizes.size(); ++i) {
+            int64_t bytesize = value_dsizes[i];
+            valid = valid && (bytesize % divisor == 0);
+            blocks_per_element_.push_back(bytesize / divisor);
+        }
+        if (valid) {
+            common_block_size_ = divisor;
+            break;
+        }
+    }
+}
+
 void HashBackendBuffer::ResetHeap() {
     Device device = GetDevice();
 
@@ -74,6 +74,15 @@ public:
                       std::vector<int64_t> value_dsizes,
                       const Device &device);
 
+    /// Wrap existing buffers, e.g. views of a memory-mapped file, without
+    /// copying them. \p heap is a UInt32 tensor of buffer indices of which
+    /// the first \p heap_top are allocated. Keys and values are contiguous
+    /// tensors with one row per buffer index.
+    HashBackendBuffer(const Tensor &heap,
+                      int heap_top,
+                      const Tensor &keys,
+                      const std::vector<Tensor> &values);
+
     /// Reset the heap and heap top.
     void ResetHeap();
 
@@ -115,6 +124,9 @@ public:
     Tensor GetValueBuffer(size_t i = 0) const;
 
 protected:
+    /// Compute the common block size divisor of the value sizes.
+    void InitBlockSizes(const std::vector<int64_t> &value_dsizes);
+
     Tensor heap_;
     HeapTop heap_top_;
 
@@ -109,6 +109,41 @@ std::pair<Tensor, Tensor> HashMap::Insert(
     return std::make_pair(output_buf_indices, output_masks);
 }
 
+std::pair<Tensor, Tensor> HashMap::InsertReduce(const Tensor& input_keys,
+                                                const Tensor& input_values,
+                                                HashReduceOp reduce_op) {
+    Tensor output_buf_indices, output_masks;
+    InsertReduce(input_keys, input_values, reduce_op, output_buf_indices,
+                 output_masks);
+    return std::make_pair(output_buf_indices, output_masks);
+}
+
+std::pair<Tensor, Tensor> HashMap::InsertReduce(
+        const Tensor& input_keys,
+        const std::vector<Tensor>& input_values_soa,
+        const std::vector<HashReduceOp>& reduce_ops) {
+    Tensor output_buf_indices, output_masks;
+    InsertReduce(input_keys, input_values_soa, reduce_ops, output_buf_indices,
+                 output_masks);
+    return std::make_pair(output_buf_indices, output_masks);
+}
+
+std::pair<Tensor, Tensor> HashMap::BuildFrom(const Tensor& input_keys,
+                                             const Tensor& input_values) {
+    Tensor output_buf_indices, output_inverse_indices;
+    BuildFrom(input_keys, input_values, output_buf_indices,
+              output_inverse_indices);
+    return std::make_pair(output_buf_indices, output_inverse_indices);
+}
+
+std::pair<Tensor, Tensor> HashMap::BuildFrom(
+        const Tensor& input_keys, const std::vector<Tensor>& input_values_soa) {
+    Tensor output_buf_indices, output_inverse_indices;
+    BuildFrom(input_keys, input_values_soa, output_buf_indices,
+              output_inverse_indices);
+    return std::make_pair(output_buf_indices, output_inverse_indices);
+}
+
 std::pair<Tensor, Tensor> HashMap::Activate(const Tensor& input_keys) {
     Tensor output_buf_indices, output_masks;
     Activate(input_keys, output_buf_indices, output_masks);
@@ -181,6 +216,145 @@ void HashMap::Insert(const Tensor& input_keys,
     InsertImpl(input_keys, input_values_soa, output_buf_indices, output_masks);
 }
 
+void HashMap::InsertReduce(const Tensor& input_keys,
+                           const Tensor& input_values,
+                           HashReduceOp reduce_op,
+                           Tensor& output_buf_indices,
+                           Tensor& output_masks) {
+    InsertReduce(input_keys, std::vector<Tensor>{input_values}, {reduce_op},
+                 output_buf_indices, output_masks);
+}
+
+void HashMap::InsertReduce(const Tensor& input_keys,
+                           const std::vector<Tensor>& input_values_soa,
+                           const std::vector<HashReduceOp>& reduce_ops,
+                           Tensor& output_buf_indices,
+                           Tensor& output_masks) {
+    CheckKeyLength(input_keys);
+    CheckKeyCompatibility(input_keys);
+    if (input_values_soa.size() != dtypes_value_.size() ||
+        reduce_ops.size() != dtypes_value_.size()) {
+        utility::LogError(
+                "Input number of value arrays ({}) and reduce ops ({}) "
+                "mismatch with stored ({})",
+                input_values_soa.size(), reduce_ops.size(),
+                dtypes_value_.size());
+    }
+
+    int64_t length = input_keys.GetLength();
+    std::vector<const void*> input_values_ptrs;
+    for (size_t i = 0; i < input_values_soa.size(); ++i) {
+        // Counted values are not read and may be passed as empty tensors.
+        if (reduce_ops[i] == HashReduceOp::Count) {
+            input_values_ptrs.push_back(nullptr);
+            continue;
+        }
+
+        // Like Insert, only the number of elements per value must match.
+        const Tensor& input_value = input_values_soa[i];
+        if (input_value.GetDtype() != dtypes_value_[i] ||
+            input_value.GetLength() != length ||
+            input_value.NumElements() !=
+                    length * element_shapes_value_[i].NumElements()) {
+            utility::LogError(
+                    "Input value[{}] with dtype {} and shape {} mismatch with "
+                    "expected dtype {} and {} elements per key.",
+                    i, input_value.GetDtype().ToString(),
+                    input_value.GetShape(), dtypes_value_[i].ToString(),
+                    element_shapes_value_[i].NumElements());
+        }
+        input_values_ptrs.push_back(input_value.GetDataPtr());
+    }
+
+    int64_t new_size = Size() + length;
+    int64_t capacity = GetCapacity();
+    if (new_size > capacity) {
+        Reserve(std::max(new_size, capacity * 2));
+    }
+
+    PrepareIndicesOutput(output_buf_indices, length);
+    PrepareMasksOutput(output_masks, length);
+
+    device_hashmap_->InsertReduce(
+            input_keys.GetDataPtr(), input_values_ptrs, dtypes_value_,
+            reduce_ops,
+            static_cast<buf_index_t*>(output_buf_indices.GetDataPtr()),
+            output_masks.GetDataPtr<bool>(), length);
+}
+
+void HashMap::BuildFrom(const Tensor& input_keys,
+                        const Tensor& input_values,
+                        Tensor& output_buf_indices,
+                        Tensor& output_inverse_indices) {
+    BuildFrom(input_keys, std::vector<Tensor>{input_values}, output_buf_indices,
+              output_inverse_indices);
+}
+
+void HashMap::BuildFrom(const Tensor& input_keys,
+                        const std::vector<Tensor>& input_values_soa,
+                        Tensor& output_buf_indices,
+                        Tensor& output_inverse_indices) {
+    const int64_t length = input_keys.GetLength();
+    CheckKeyCompatibility(input_keys);
+    if (length > 0) {
+        CheckKeyValueLengthCompatibility(input_keys, input_values_soa);
+    }
+    CheckValueCompatibility(input_values_soa);
+
+    Clear();
+
+    const Device device = GetDevice();
+    if (length == 0) {
+        PrepareIndicesOutput(output_buf_indices, 0);
+        output_inverse_indices = Tensor({0}, core::Int64, device);
+        return;
+    }
+    if (device.GetType() != Device::DeviceType::CPU) {
+        Tensor input_buf_indices, output_masks;
+        Insert(input_keys, input_values_soa, input_buf_indices, output_masks);
+        Find(input_keys, input_buf_indices, output_masks);
+        GetActiveIndices(output_buf_indices);
+
+        // Map buffer indices back to their position in output_buf_indices.
+        Tensor positions({GetCapacity()}, core::Int64, device);
+        positions.IndexSet({output_buf_indices.To(core::Int64)},
+                           Tensor::Arange(0, Size(), 1, core::Int64, device));
+        output_inverse_indices =
+                positions.IndexGet({input_buf_indices.To(core::Int64)});
+        return;
+    }
+
+    // Sort and deduplicate the keys as rows of their flattened elements.
+    const int64_t key_numel = input_keys.NumElements() / length;
+    Tensor unique_keys, counts;
+    std::tie(unique_keys, output_inverse_indices, counts) =
+            input_keys.Reshape({length, key_numel}).Unique(0);
+    const int64_t num_unique = unique_keys.GetLength();
+
+    // The first occurrence of each unique key provides its values.
+    Tensor first_indices({num_unique}, core::Int64, device);
+    int64_t* first_indices_ptr = first_indices.GetDataPtr<int64_t>();
+    const int64_t* inverse_ptr = output_inverse_indices.GetDataPtr<int64_t>();
+    for (int64_t i = length - 1; i >= 0; --i) {
+        first_indices_ptr[inverse_ptr[i]] = i;
+    }
+    std::vector<Tensor> unique_values_soa;
+    for (const auto& input_value : input_values_soa) {
+        unique_values_soa.push_back(
+                input_value.IndexGet({first_indices}).Contiguous());
+    }
+
+    if (num_unique > GetCapacity()) {
+        Reserve(num_unique);
+    }
+
+    SizeVector unique_key_shape = input_keys.GetShape();
+    unique_key_shape[0] = num_unique;
+    Tensor output_masks;
+    InsertImpl(unique_keys.Reshape(unique_key_shape), unique_values_soa,
+               output_buf_indices, output_masks);
+}
+
 void HashMap::Activate(const Tensor& input_keys,
                        Tensor& output_buf_indices,
                        Tensor& output_masks) {
@@ -238,8 +412,10 @@ void HashMap::Save(const std::string& file_name) {
     t::io::WriteHashMap(file_name, *this);
 }
 
-HashMap HashMap::Load(const std::string& file_name) {
-    return t::io::ReadHashMap(file_name);
+HashMap HashMap::Load(const std::string& file_name, bool memory_map) {
+    return t::io::ReadHashMap(file_name,
+                              memory_map ? t::io::MmapMode::CopyOnWrite
+                                         : t::io::MmapMode::None);
 }
 
 HashMap HashMap::Clone() const { return To(GetDevice(), /*copy=*/true); }
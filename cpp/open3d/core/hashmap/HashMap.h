@@ -35,7 +35,13 @@ namespace core {
 
 class DeviceHashBackend;
 
-enum class HashBackendType { Slab, StdGPU, TBB, Default };
+/// Hash map backends. Slab and StdGPU run on CUDA devices, TBB and
+/// OpenAddressing on the CPU. Default selects StdGPU on CUDA and TBB on CPU.
+enum class HashBackendType { Slab, StdGPU, TBB, OpenAddressing, Default };
+
+/// Reductions applied by HashMap::InsertReduce to the values of keys that are
+/// already present. Count ignores the input values and counts the keys.
+enum class HashReduceOp { Sum, Min, Max, Count };
 
 class HashMap {
 public:
@@ -84,6 +90,52 @@ public:
             const Tensor& input_keys,
             const std::vector<Tensor>& input_values_soa);
 
+    /// Bulk build the hash map from arrays of keys and values that may contain
+    /// duplicate keys. The hash map is cleared first. For each unique key, the
+    /// values of its first occurrence are stored.
+    /// On CPU, the keys are deduplicated with a sort before insertion, so
+    /// unique keys are inserted once without contention and the result is
+    /// deterministic. On other devices, all keys are inserted and then found.
+    /// An empty batch leaves the hash map empty.
+    /// Return: output_buf_indices stores buffer indices of the unique keys,
+    /// in ascending key order on CPU.
+    /// Return: output_inverse_indices stores Int64 indices into
+    /// output_buf_indices, one per input key, so that input key i is stored at
+    /// output_buf_indices[output_inverse_indices[i]].
+    std::pair<Tensor, Tensor> BuildFrom(const Tensor& input_keys,
+                                        const Tensor& input_values);
+
+    /// Bulk build the hash map from arrays of keys and a structure of value
+    /// arrays in Tensors.
+    /// Return: output_buf_indices and output_inverse_indices, their roles are
+    /// the same as in single value BuildFrom interface.
+    std::pair<Tensor, Tensor> BuildFrom(
+            const Tensor& input_keys,
+            const std::vector<Tensor>& input_values_soa);
+
+    /// Parallel insert arrays of keys and values in Tensors, and reduce the
+    /// values of keys that already exist, either in the hash map or earlier
+    /// in the same batch, into the stored values with \p reduce_op.
+    /// The input values must have the stored dtypes. For HashReduceOp::Count,
+    /// the stored value is set to 1 on insertion and incremented for every
+    /// further occurrence; the input values are not read and may be empty
+    /// tensors.
+    /// Only CPU backends are supported.
+    /// Return: output_buf_indices stores the buffer index of every input key.
+    /// Return: output_masks stores if the key was newly inserted.
+    std::pair<Tensor, Tensor> InsertReduce(const Tensor& input_keys,
+                                           const Tensor& input_values,
+                                           HashReduceOp reduce_op);
+
+    /// Parallel insert-reduce arrays of keys and a structure of value arrays
+    /// in Tensors, with one reduction per value array.
+    /// Return: output_buf_indices and output_masks, their roles are the same
+    /// as in single value InsertReduce interface.
+    std::pair<Tensor, Tensor> InsertReduce(
+            const Tensor& input_keys,
+            const std::vector<Tensor>& input_values_soa,
+            const std::vector<HashReduceOp>& reduce_ops);
+
     /// Parallel activate arrays of keys in Tensor.
     /// Specifically useful for large value elements (e.g., a 3D tensor), where
     /// we can do in-place management after activation.
@@ -123,6 +175,38 @@ public:
                 Tensor& output_buf_indices,
                 Tensor& output_masks);
 
+    /// Same as BuildFrom with a single value array, but takes
+    /// output_buf_indices and output_inverse_indices as input.
+    void BuildFrom(const Tensor& input_keys,
+                   const Tensor& input_values,
+                   Tensor& output_buf_indices,
+                   Tensor& output_inverse_indices);
+
+    /// Same as BuildFrom with a SoA of values, but takes output_buf_indices
+    /// and output_inverse_indices as input.
+    void BuildFrom(const Tensor& input_keys,
+                   const std::vector<Tensor>& input_values_soa,
+                   Tensor& output_buf_indices,
+                   Tensor& output_inverse_indices);
+
+    /// Same as InsertReduce with a single value array, but takes
+    /// output_buf_indices and output_masks as input. If their shapes and types
+    /// match, reallocation is not needed.
+    void InsertReduce(const Tensor& input_keys,
+                      const Tensor& input_values,
+                      HashReduceOp reduce_op,
+                      Tensor& output_buf_indices,
+                      Tensor& output_masks);
+
+    /// Same as InsertReduce with a SoA of values, but takes output_buf_indices
+    /// and output_masks as input. If their shapes and types match,
+    /// reallocation is not needed.
+    void InsertReduce(const Tensor& input_keys,
+                      const std::vector<Tensor>& input_values_soa,
+                      const std::vector<HashReduceOp>& reduce_ops,
+                      Tensor& output_buf_indices,
+                      Tensor& output_masks);
+
     /// Same as Activate, but takes output_buf_indices
     /// and output_masks as input. If their shapes and types match, reallocation
     /// is not needed.
@@ -156,7 +240,11 @@ public:
 
     /// Load active keys and values from a npz file that contains 'key',
     /// 'n_values', 'value_{:03d}'.
-    static HashMap Load(const std::string& file_name);
+    /// If \p memory_map is true and the file was saved with its hash table,
+    /// the file is memory-mapped copy-on-write and used as is by an
+    /// OpenAddressing hash map, so loading does not depend on the number of
+    /// entries. Modifications are not written back to the file.
+    static HashMap Load(const std::string& file_name, bool memory_map = false);
 
     /// Clone the hash map with buffers.
     HashMap Clone() const;
@@ -53,6 +53,12 @@ std::pair<Tensor, Tensor> HashSet::Insert(const Tensor& input_keys) {
     return std::make_pair(output_buf_indices, output_masks);
 }
 
+std::pair<Tensor, Tensor> HashSet::BuildFrom(const Tensor& input_keys) {
+    Tensor output_buf_indices, output_inverse_indices;
+    BuildFrom(input_keys, output_buf_indices, output_inverse_indices);
+    return std::make_pair(output_buf_indices, output_inverse_indices);
+}
+
 std::pair<Tensor, Tensor> HashSet::Find(const Tensor& input_keys) {
     Tensor output_buf_indices, output_masks;
     Find(input_keys, output_buf_indices, output_masks);
@@ -78,6 +84,13 @@ void HashSet::Insert(const Tensor& input_keys,
                       output_masks);
 }
 
+void HashSet::BuildFrom(const Tensor& input_keys,
+                        Tensor& output_buf_indices,
+                        Tensor& output_inverse_indices) {
+    internal_->BuildFrom(input_keys, std::vector<Tensor>{}, output_buf_indices,
+                         output_inverse_indices);
+}
+
 void HashSet::Find(const Tensor& input_keys,
                    Tensor& output_buf_indices,
                    Tensor& output_masks) {
@@ -98,8 +111,8 @@ void HashSet::Save(const std::string& file_name) {
     t::io::WriteHashMap(file_name, *internal_);
 }
 
-HashSet HashSet::Load(const std::string& file_name) {
-    HashMap internal = t::io::ReadHashMap(file_name);
+HashSet HashSet::Load(const std::string& file_name, bool memory_map) {
+    HashMap internal = HashMap::Load(file_name, memory_map);
     return HashSet(internal);
 }
 
@@ -59,6 +59,13 @@ public:
     /// a success or failure (key already exists).
     std::pair<Tensor, Tensor> Insert(const Tensor& input_keys);
 
+    /// Bulk build the hash set from an array of keys that may contain
+    /// duplicates. The hash set is cleared first.
+    /// Return: output_buf_indices stores buffer indices of the unique keys.
+    /// Return: output_inverse_indices stores Int64 indices into
+    /// output_buf_indices, one per input key. See HashMap::BuildFrom.
+    std::pair<Tensor, Tensor> BuildFrom(const Tensor& input_keys);
+
     /// Parallel find an array of keys in Tensor.
     /// Return: output_buf_indices, its role is the same as in Insert.
     /// Return: output_masks stores if the finding is a success or failure (key
@@ -82,6 +89,12 @@ public:
                 Tensor& output_buf_indices,
                 Tensor& output_masks);
 
+    /// Same as BuildFrom, but takes output_buf_indices and
+    /// output_inverse_indices as input.
+    void BuildFrom(const Tensor& input_keys,
+                   Tensor& output_buf_indices,
+                   Tensor& output_inverse_indices);
+
     /// Same as Find, but takes output_buf_indices
     /// and output_masks as input. If their shapes and types match, reallocation
     /// is not needed.
@@ -106,7 +119,8 @@ public:
     void Save(const std::string& file_name);
 
     /// Load active keys and values from a npz file that contains 'key'.
-    static HashSet Load(const std::string& file_name);
+    /// See HashMap::Load for \p memory_map.
+    static HashSet Load(const std::string& file_name, bool memory_map = false);
 
     /// Clone the hash set with buffers.
     HashSet Clone() const;
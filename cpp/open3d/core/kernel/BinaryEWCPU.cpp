@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <type_traits>
+
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Indexer.h"
@@ -42,15 +44,50 @@ namespace open3d {
 namespace core {
 namespace kernel {
 
+// Minimum number of workloads per thread. Element-wise kernels are memory
+// bound, so smaller ranges are not worth the cost of waking up a thread.
+static constexpr int64_t BINARY_EW_GRAIN_SIZE = 32768;
+
 template <typename src_t, typename dst_t, typename element_func_t>
 static void LaunchBinaryEWKernel(const Indexer& indexer,
                                  const element_func_t& element_func) {
-    ParallelFor(Device("CPU:0"), indexer.NumWorkloads(),
-                [&indexer, &element_func](int64_t i) {
-                    element_func(indexer.GetInputPtr<src_t>(0, i),
-                                 indexer.GetInputPtr<src_t>(1, i),
-                                 indexer.GetOutputPtr<dst_t>(i));
-                });
+    // Offsets are computed once per run of the innermost dimension instead of
+    // once per element. Runs are specialized for contiguous operands and for a
+    // broadcast scalar operand, e.g. the rhs of (N, 3) + (N, 1), where
+    // pointers advance by the element size instead of a runtime stride.
+    auto loop = [&element_func](char* const* ptrs, const int64_t* byte_strides,
+                                int64_t n) {
+        const src_t* lhs = reinterpret_cast<const src_t*>(ptrs[0]);
+        const src_t* rhs = reinterpret_cast<const src_t*>(ptrs[1]);
+        dst_t* dst = reinterpret_cast<dst_t*>(ptrs[2]);
+        const bool lhs_contiguous = byte_strides[0] == sizeof(src_t);
+        const bool rhs_contiguous = byte_strides[1] == sizeof(src_t);
+        const bool dst_contiguous = byte_strides[2] == sizeof(dst_t);
+        if (dst_contiguous && lhs_contiguous && rhs_contiguous) {
+            for (int64_t i = 0; i < n; ++i) {
+                element_func(lhs + i, rhs + i, dst + i);
+            }
+        } else if (dst_contiguous && lhs_contiguous && byte_strides[1] == 0) {
+            for (int64_t i = 0; i < n; ++i) {
+                element_func(lhs + i, rhs, dst + i);
+            }
+        } else if (dst_contiguous && byte_strides[0] == 0 && rhs_contiguous) {
+            for (int64_t i = 0; i < n; ++i) {
+                element_func(lhs, rhs + i, dst + i);
+            }
+        } else {
+            for (int64_t i = 0; i < n; ++i) {
+                element_func(ptrs[0] + i * byte_strides[0],
+                             ptrs[1] + i * byte_strides[1],
+                             ptrs[2] + i * byte_strides[2]);
+            }
+        }
+    };
+    ParallelForRange(Device("CPU:0"), indexer.NumWorkloads(),
+                     BINARY_EW_GRAIN_SIZE,
+                     [&indexer, &loop](int64_t start, int64_t end) {
+                         indexer.ForEachInnerLoop(start, end, loop);
+                     });
 }
 
 template <typename src_t,
@@ -60,14 +97,26 @@ template <typename src_t,
 static void LaunchBinaryEWKernel(const Indexer& indexer,
                                  const element_func_t& element_func,
                                  const vec_func_t& vec_func) {
-    ParallelFor(
-            Device("CPU:0"), indexer.NumWorkloads(),
-            [&indexer, &element_func](int64_t i) {
-                element_func(indexer.GetInputPtr<src_t>(0, i),
-                             indexer.GetInputPtr<src_t>(1, i),
-                             indexer.GetOutputPtr<dst_t>(i));
-            },
-            vec_func);
+#ifdef BUILD_ISPC_MODULE
+    // Half types have no vectorized kernels. The ISPC kernels compute offsets
+    // per element, so they are only used if no operand is broadcast or
+    // strided.
+    if (std::is_arithmetic<src_t>::value &&
+        indexer.GetInput(0).IsContiguous() &&
+        indexer.GetInput(1).IsContiguous() &&
+        indexer.GetOutput().IsContiguous()) {
+        ParallelFor(
+                Device("CPU:0"), indexer.NumWorkloads(),
+                [&indexer, &element_func](int64_t i) {
+                    element_func(indexer.GetInputPtr<src_t>(0, i),
+                                 indexer.GetInputPtr<src_t>(1, i),
+                                 indexer.GetOutputPtr<dst_t>(i));
+                },
+                vec_func);
+        return;
+    }
+#endif
+    LaunchBinaryEWKernel<src_t, dst_t>(indexer, element_func);
 }
 
 template <typename scalar_t>
@@ -174,7 +223,7 @@ void BinaryEWCPU(const Tensor& lhs,
 #ifdef BUILD_ISPC_MODULE
             ispc::Indexer ispc_indexer = indexer.ToISPC();
 #endif
-            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(src_dtype, [&]() {
                 switch (op_code) {
                     case BinaryEWOpCode::LogicalAnd:
                         LaunchBinaryEWKernel<scalar_t, scalar_t>(
@@ -256,7 +305,7 @@ void BinaryEWCPU(const Tensor& lhs,
 #ifdef BUILD_ISPC_MODULE
             ispc::Indexer ispc_indexer = indexer.ToISPC();
 #endif
-            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(src_dtype, [&]() {
                 switch (op_code) {
                     case BinaryEWOpCode::LogicalAnd:
                         LaunchBinaryEWKernel<scalar_t, bool>(
@@ -347,7 +396,7 @@ void BinaryEWCPU(const Tensor& lhs,
 #ifdef BUILD_ISPC_MODULE
         ispc::Indexer ispc_indexer = indexer.ToISPC();
 #endif
-        DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(src_dtype, [&]() {
             switch (op_code) {
                 case BinaryEWOpCode::Add:
                     LaunchBinaryEWKernel<scalar_t, scalar_t>(
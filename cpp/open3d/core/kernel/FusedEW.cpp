@@ -0,0 +1,67 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/FusedEW.h"
+
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+void FusedEW(const std::vector<Tensor>& inputs,
+             const FusedEWProgram& program,
+             Tensor& dst) {
+    if (program.empty()) {
+        utility::LogError("FusedEW: empty program.");
+    }
+    for (const Tensor& input : inputs) {
+        if (!shape_util::CanBeBrocastedToShape(input.GetShape(),
+                                               dst.GetShape())) {
+            utility::LogError("Shape {} can not be broadcasted to {}.",
+                              input.GetShape(), dst.GetShape());
+        }
+        if (input.GetDevice() != dst.GetDevice()) {
+            utility::LogError("Source device {} != destination device {}.",
+                              input.GetDevice().ToString(),
+                              dst.GetDevice().ToString());
+        }
+    }
+
+    Device::DeviceType device_type = dst.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        FusedEWCPU(inputs, program, dst);
+    } else {
+        utility::LogError("FusedEW: Unimplemented device {}.",
+                          dst.GetDevice().ToString());
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
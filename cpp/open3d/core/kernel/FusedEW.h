@@ -0,0 +1,90 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/core/Scalar.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+enum class FusedEWOpCode {
+    Input,
+    Const,
+    Add,
+    Sub,
+    Mul,
+    Div,
+    Sqrt,
+    Sin,
+    Cos,
+    Neg,
+    Exp,
+    Abs,
+    Floor,
+    Ceil,
+    Round,
+    Trunc,
+    Clip
+};
+
+/// One instruction of a fused element-wise program.
+///
+/// Instruction i of a program writes to register i. Operands refer to
+/// registers of earlier instructions, so a program is always in topological
+/// order and the result is held by the last register.
+struct FusedEWInstruction {
+    FusedEWOpCode op_code_;
+    /// Input tensor index for FusedEWOpCode::Input, otherwise the register of
+    /// the first operand.
+    int64_t lhs_ = -1;
+    /// Register of the second operand for binary ops, -1 otherwise.
+    int64_t rhs_ = -1;
+    /// Value for FusedEWOpCode::Const, lower bound for FusedEWOpCode::Clip.
+    Scalar value0_ = 0;
+    /// Upper bound for FusedEWOpCode::Clip.
+    Scalar value1_ = 0;
+};
+
+using FusedEWProgram = std::vector<FusedEWInstruction>;
+
+/// Evaluates \p program element-wise in a single pass. All \p inputs are
+/// broadcasted to the shape of \p dst and must have the same dtype as \p dst.
+void FusedEW(const std::vector<Tensor>& inputs,
+             const FusedEWProgram& program,
+             Tensor& dst);
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                const FusedEWProgram& program,
+                Tensor& dst);
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
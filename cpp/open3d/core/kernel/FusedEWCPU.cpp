@@ -0,0 +1,234 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Indexer.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/FusedEW.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+// Number of elements evaluated per instruction before moving on to the next
+// instruction. All registers of a block stay in L1 cache, so the program walks
+// main memory only once for the inputs and once for the output.
+static constexpr int64_t FUSED_EW_BLOCK_SIZE = 256;
+
+template <typename scalar_t>
+static void CPURunFusedEWProgram(const Indexer& indexer,
+                                 const FusedEWProgram& program) {
+    const int64_t num_workloads = indexer.NumWorkloads();
+    const int64_t num_registers = static_cast<int64_t>(program.size());
+    const int64_t num_blocks =
+            (num_workloads + FUSED_EW_BLOCK_SIZE - 1) / FUSED_EW_BLOCK_SIZE;
+    if (num_blocks == 0) {
+        return;
+    }
+
+    std::vector<bool> inputs_contiguous(indexer.NumInputs());
+    for (int64_t i = 0; i < indexer.NumInputs(); ++i) {
+        inputs_contiguous[i] = indexer.GetInput(i).IsContiguous();
+    }
+    const bool output_contiguous = indexer.GetOutput().IsContiguous();
+
+    // Each thread owns one register file and a contiguous range of blocks.
+    const int64_t num_threads = std::min<int64_t>(
+            utility::EstimateMaxThreads(), num_blocks);
+    ParallelFor(Device("CPU:0"), num_threads, [&](int64_t thread_idx) {
+        std::vector<scalar_t> registers(num_registers * FUSED_EW_BLOCK_SIZE);
+        for (int64_t r = 0; r < num_registers; ++r) {
+            if (program[r].op_code_ == FusedEWOpCode::Const) {
+                std::fill_n(registers.begin() + r * FUSED_EW_BLOCK_SIZE,
+                            FUSED_EW_BLOCK_SIZE,
+                            program[r].value0_.To<scalar_t>());
+            }
+        }
+
+        const int64_t block_begin = num_blocks * thread_idx / num_threads;
+        const int64_t block_end = num_blocks * (thread_idx + 1) / num_threads;
+        for (int64_t block = block_begin; block < block_end; ++block) {
+            const int64_t start = block * FUSED_EW_BLOCK_SIZE;
+            const int64_t count =
+                    std::min(FUSED_EW_BLOCK_SIZE, num_workloads - start);
+
+            for (int64_t r = 0; r < num_registers; ++r) {
+                const FusedEWInstruction& instr = program[r];
+                scalar_t* out = registers.data() + r * FUSED_EW_BLOCK_SIZE;
+                // Operand registers, only meaningful for non-leaf instructions.
+                const bool is_leaf = instr.op_code_ == FusedEWOpCode::Input ||
+                                     instr.op_code_ == FusedEWOpCode::Const;
+                const scalar_t* a =
+                        is_leaf ? nullptr
+                                : registers.data() +
+                                          instr.lhs_ * FUSED_EW_BLOCK_SIZE;
+                const scalar_t* b =
+                        is_leaf || instr.rhs_ < 0
+                                ? nullptr
+                                : registers.data() +
+                                          instr.rhs_ * FUSED_EW_BLOCK_SIZE;
+                switch (instr.op_code_) {
+                    case FusedEWOpCode::Input:
+                        if (inputs_contiguous[instr.lhs_]) {
+                            const scalar_t* src =
+                                    indexer.GetInputPtr<scalar_t>(instr.lhs_,
+                                                                  start);
+                            std::copy(src, src + count, out);
+                        } else {
+                            for (int64_t j = 0; j < count; ++j) {
+                                out[j] = *indexer.GetInputPtr<scalar_t>(
+                                        instr.lhs_, start + j);
+                            }
+                        }
+                        break;
+                    case FusedEWOpCode::Const:
+                        break;
+                    case FusedEWOpCode::Add:
+                        for (int64_t j = 0; j < count; ++j) {
+                            out[j] = a[j] + b[j];
+                        }
+                        break;
+                    case FusedEWOpCode::Sub:
+                        for (int64_t j = 0; j < count; ++j) {
+                            out[j] = a[j] - b[j];
+                        }
+                        break;
+                    case FusedEWOpCode::Mul:
+                        for (int64_t j = 0; j < count; ++j) {
+                            out[j] = a[j] * b[j];
+                        }
+                        break;
+                    case FusedEWOpCode::Div:
+                        for (int64_t j = 0; j < count; ++j) {
+                            out[j] = a[j] / b[j];
+                        }
+                        break;
+                    case FusedEWOpCode::Sqrt:
+                        for (int64_t j = 0; j < count; ++j) {
+                            out[j] = static_cast<scalar_t>(std::sqrt(a[j]));
+                        }
+                        break;
+                    case FusedEWOpCode::Sin:
+                        for (int64_t j = 0; j < count; ++j) {
+                            out[j] = static_cast<scalar_t>(std::sin(a[j]));
+                        }
+                        break;
+                    case FusedEWOpCode::Cos:
+                        for (int64_t j = 0; j < count; ++j) {
+                            out[j] = static_cast<scalar_t>(std::cos(a[j]));
+                        }
+                        break;
+                    case FusedEWOpCode::Neg:
+                        for (int64_t j = 0; j < count; ++j) {
+                            out[j] = static_cast<scalar_t>(-a[j]);
+                        }
+                        break;
+                    case FusedEWOpCode::Exp:
+                        for (int64_t j = 0; j < count; ++j) {
+                            out[j] = static_cast<scalar_t>(std::exp(a[j]));
+                        }
+                        break;
+                    case FusedEWOpCode::Abs:
+                        for (int64_t j = 0; j < count; ++j) {
+                            out[j] = static_cast<scalar_t>(
+                                    std::abs(static_cast<double>(a[j])));
+                        }
+                        break;
+                    case FusedEWOpCode::Floor:
+                        for (int64_t j = 0; j < count; ++j) {
+                            out[j] = static_cast<scalar_t>(
+                                    std::floor(static_cast<double>(a[j])));
+                        }
+                        break;
+                    case FusedEWOpCode::Ceil:
+                        for (int64_t j = 0; j < count; ++j) {
+                            out[j] = static_cast<scalar_t>(
+                                    std::ceil(static_cast<double>(a[j])));
+                        }
+                        break;
+                    case FusedEWOpCode::Round:
+                        for (int64_t j = 0; j < count; ++j) {
+                            out[j] = static_cast<scalar_t>(
+                                    std::round(static_cast<double>(a[j])));
+                        }
+                        break;
+                    case FusedEWOpCode::Trunc:
+                        for (int64_t j = 0; j < count; ++j) {
+                            out[j] = static_cast<scalar_t>(
+                                    std::trunc(static_cast<double>(a[j])));
+                        }
+                        break;
+                    case FusedEWOpCode::Clip: {
+                        const scalar_t min_val = instr.value0_.To<scalar_t>();
+                        const scalar_t max_val = instr.value1_.To<scalar_t>();
+                        for (int64_t j = 0; j < count; ++j) {
+                            out[j] = a[j] < min_val
+                                             ? min_val
+                                             : (a[j] > max_val ? max_val
+                                                               : a[j]);
+                        }
+                        break;
+                    }
+                    default:
+                        utility::LogError(
+                                "Unimplemented op_code for FusedEWCPU");
+                        break;
+                }
+            }
+
+            const scalar_t* result = registers.data() +
+                                     (num_registers - 1) * FUSED_EW_BLOCK_SIZE;
+            if (output_contiguous) {
+                std::copy(result, result + count,
+                          indexer.GetOutputPtr<scalar_t>(start));
+            } else {
+                for (int64_t j = 0; j < count; ++j) {
+                    *indexer.GetOutputPtr<scalar_t>(start + j) = result[j];
+                }
+            }
+        }
+    });
+}
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                const FusedEWProgram& program,
+                Tensor& dst) {
+    Indexer indexer(inputs, dst, DtypePolicy::ALL_SAME);
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        CPURunFusedEWProgram<scalar_t>(indexer, program);
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -35,13 +35,17 @@ namespace open3d {
 namespace core {
 namespace kernel {
 
+// Minimum number of workloads per thread.
+static constexpr int64_t INDEX_GET_SET_GRAIN_SIZE = 16384;
+
 template <typename func_t>
 static void LaunchAdvancedIndexerKernel(const AdvancedIndexer& indexer,
                                         const func_t& func) {
-    ParallelFor(Device("CPU:0"), indexer.NumWorkloads(),
-                [&indexer, &func](int64_t i) {
-                    func(indexer.GetInputPtr(i), indexer.GetOutputPtr(i));
-                });
+    ParallelForRange(Device("CPU:0"), indexer.NumWorkloads(),
+                     INDEX_GET_SET_GRAIN_SIZE,
+                     [&indexer, &func](int64_t start, int64_t end) {
+                         indexer.ForEachWorkload(start, end, func);
+                     });
 }
 
 template <typename scalar_t>
@@ -71,7 +75,7 @@ void IndexGetCPU(const Tensor& src,
             CPUCopyObjectElementKernel(src, dst, object_byte_size);
         });
     } else {
-        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(dtype, [&]() {
             LaunchAdvancedIndexerKernel(ai, CPUCopyElementKernel<scalar_t>);
         });
     }
@@ -91,7 +95,7 @@ void IndexSetCPU(const Tensor& src,
             CPUCopyObjectElementKernel(src, dst, object_byte_size);
         });
     } else {
-        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(dtype, [&]() {
             LaunchAdvancedIndexerKernel(ai, CPUCopyElementKernel<scalar_t>);
         });
     }
@@ -42,7 +42,7 @@ Tensor NonZeroCPU(const Tensor& src) {
     std::vector<int64_t> indices(static_cast<size_t>(num_elements));
     std::iota(std::begin(indices), std::end(indices), 0);
     std::vector<int64_t> non_zero_indices(num_elements);
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(src.GetDtype(), [&]() {
         auto it = std::copy_if(
                 indices.begin(), indices.end(), non_zero_indices.begin(),
                 [&src_iter](int64_t index) {
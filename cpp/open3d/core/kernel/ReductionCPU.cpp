@@ -24,10 +24,15 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <functional>
 #include <limits>
+#include <vector>
 
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Indexer.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/Reduction.h"
 #include "open3d/utility/Logging.h"
@@ -37,33 +42,38 @@ namespace open3d {
 namespace core {
 namespace kernel {
 
+// The regular reduction kernels are function objects rather than functions, so
+// that the reduction engines are instantiated with their types and inline them.
+// Passing a function pointer would leave an indirect call in every inner loop
+// and prevent vectorization.
+
 template <typename scalar_t>
-static inline scalar_t CPUSumReductionKernel(scalar_t a, scalar_t b) {
-    return a + b;
-}
+struct CPUSumReductionKernel {
+    scalar_t operator()(scalar_t a, scalar_t b) const { return a + b; }
+};
 
 template <typename scalar_t>
-static inline scalar_t CPUProdReductionKernel(scalar_t a, scalar_t b) {
-    return a * b;
-}
+struct CPUProdReductionKernel {
+    scalar_t operator()(scalar_t a, scalar_t b) const { return a * b; }
+};
 
 template <typename scalar_t>
-static inline scalar_t CPUMinReductionKernel(scalar_t a, scalar_t b) {
-    return std::min(a, b);
-}
+struct CPUMinReductionKernel {
+    scalar_t operator()(scalar_t a, scalar_t b) const { return std::min(a, b); }
+};
 
 template <typename scalar_t>
-static inline scalar_t CPUMaxReductionKernel(scalar_t a, scalar_t b) {
-    return std::max(a, b);
-}
+struct CPUMaxReductionKernel {
+    scalar_t operator()(scalar_t a, scalar_t b) const { return std::max(a, b); }
+};
 
-static inline uint8_t CPUAllReductionKernel(uint8_t a, uint8_t b) {
-    return a && b;
-}
+struct CPUAllReductionKernel {
+    uint8_t operator()(uint8_t a, uint8_t b) const { return a & b; }
+};
 
-static inline uint8_t CPUAnyReductionKernel(uint8_t a, uint8_t b) {
-    return a || b;
-}
+struct CPUAnyReductionKernel {
+    uint8_t operator()(uint8_t a, uint8_t b) const { return a | b; }
+};
 
 template <typename scalar_t>
 static inline std::pair<int64_t, scalar_t> CPUArgMinReductionKernel(
@@ -93,35 +103,44 @@ public:
 
     template <typename func_t, typename scalar_t>
     void Run(const func_t& reduce_func, scalar_t identity) {
+        RunAccumulate<scalar_t>(reduce_func, identity);
+    }
+
+    /// Reads inputs as src_t and reduces them into outputs of type scalar_t,
+    /// e.g. Float16 inputs accumulated in float.
+    template <typename src_t, typename func_t, typename scalar_t>
+    void RunAccumulate(const func_t& reduce_func, scalar_t identity) {
         // See: PyTorch's TensorIterator::parallel_reduce for the reference
         // design of reduction strategy.
         if (utility::EstimateMaxThreads() == 1 || utility::InParallel()) {
-            LaunchReductionKernelSerial<scalar_t>(indexer_, reduce_func);
+            LaunchReductionKernelSerial<scalar_t, src_t>(indexer_,
+                                                         reduce_func);
         } else if (indexer_.NumOutputElements() <= 1) {
-            LaunchReductionKernelTwoPass<scalar_t>(indexer_, reduce_func,
-                                                   identity);
+            LaunchReductionKernelTwoPass<scalar_t, src_t>(
+                    indexer_, reduce_func, identity);
         } else {
-            LaunchReductionParallelDim<scalar_t>(indexer_, reduce_func);
+            LaunchReductionParallelDim<scalar_t, src_t>(indexer_,
+                                                        reduce_func);
         }
     }
 
 private:
-    template <typename scalar_t, typename func_t>
+    template <typename scalar_t, typename src_t, typename func_t>
     static void LaunchReductionKernelSerial(const Indexer& indexer,
                                             func_t element_kernel) {
         for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
              ++workload_idx) {
-            scalar_t* src = reinterpret_cast<scalar_t*>(
+            src_t* src = reinterpret_cast<src_t*>(
                     indexer.GetInputPtr(0, workload_idx));
             scalar_t* dst = reinterpret_cast<scalar_t*>(
                     indexer.GetOutputPtr(workload_idx));
-            *dst = element_kernel(*src, *dst);
+            *dst = element_kernel(static_cast<scalar_t>(*src), *dst);
         }
     }
 
     /// Create num_threads workers to compute partial reductions and then reduce
     /// to the final results. This only applies to reduction op with one output.
-    template <typename scalar_t, typename func_t>
+    template <typename scalar_t, typename src_t, typename func_t>
     static void LaunchReductionKernelTwoPass(const Indexer& indexer,
                                              func_t element_kernel,
                                              scalar_t identity) {
@@ -136,26 +155,25 @@ private:
                 (num_workloads + num_threads - 1) / num_threads;
         std::vector<scalar_t> thread_results(num_threads, identity);
 
-#pragma omp parallel for schedule(static) \
-        num_threads(utility::EstimateMaxThreads())
-        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+        ParallelFor(Device("CPU:0"), num_threads, [&](int64_t thread_idx) {
             int64_t start = thread_idx * workload_per_thread;
             int64_t end = std::min(start + workload_per_thread, num_workloads);
             for (int64_t workload_idx = start; workload_idx < end;
                  ++workload_idx) {
-                scalar_t* src = reinterpret_cast<scalar_t*>(
+                src_t* src = reinterpret_cast<src_t*>(
                         indexer.GetInputPtr(0, workload_idx));
                 thread_results[thread_idx] =
-                        element_kernel(*src, thread_results[thread_idx]);
+                        element_kernel(static_cast<scalar_t>(*src),
+                                       thread_results[thread_idx]);
             }
-        }
+        });
         scalar_t* dst = reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(0));
         for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
             *dst = element_kernel(thread_results[thread_idx], *dst);
         }
     }
 
-    template <typename scalar_t, typename func_t>
+    template <typename scalar_t, typename src_t, typename func_t>
     static void LaunchReductionParallelDim(const Indexer& indexer,
                                            func_t element_kernel) {
         // Prefers outer dimension >= num_threads.
@@ -183,13 +201,12 @@ private:
                     "LaunchReductionKernelTwoPass instead.");
         }
 
-#pragma omp parallel for schedule(static) \
-        num_threads(utility::EstimateMaxThreads())
-        for (int64_t i = 0; i < indexer_shape[best_dim]; ++i) {
+        ParallelFor(Device("CPU:0"), indexer_shape[best_dim], [&](int64_t i) {
             Indexer sub_indexer(indexer);
             sub_indexer.ShrinkDim(best_dim, i, 1);
-            LaunchReductionKernelSerial<scalar_t>(sub_indexer, element_kernel);
-        }
+            LaunchReductionKernelSerial<scalar_t, src_t>(sub_indexer,
+                                                         element_kernel);
+        });
     }
 
 private:
@@ -204,16 +221,19 @@ public:
 
     template <typename func_t, typename scalar_t>
     void Run(const func_t& reduce_func, scalar_t identity) {
+        RunAccumulate<scalar_t>(reduce_func, identity);
+    }
+
+    /// Reads inputs as src_t and compares them as scalar_t.
+    template <typename src_t, typename func_t, typename scalar_t>
+    void RunAccumulate(const func_t& reduce_func, scalar_t identity) {
         // Arg-reduction needs to iterate each output element separately in
         // sub-iterations. Each output elemnent corresponds to multiple input
         // elements. We need to keep track of the indices within each
         // sub-iteration.
         int64_t num_output_elements = indexer_.NumOutputElements();
 
-#pragma omp parallel for schedule(static) \
-        num_threads(utility::EstimateMaxThreads())
-        for (int64_t output_idx = 0; output_idx < num_output_elements;
-             output_idx++) {
+        auto reduce_output = [&](int64_t output_idx) {
             // sub_indexer.NumWorkloads() == ipo.
             // sub_indexer's workload_idx is indexer_'s ipo_idx.
             Indexer sub_indexer = indexer_.GetPerOutputIndexer(output_idx);
@@ -221,103 +241,463 @@ public:
             for (int64_t workload_idx = 0;
                  workload_idx < sub_indexer.NumWorkloads(); workload_idx++) {
                 int64_t src_idx = workload_idx;
-                scalar_t* src_val = reinterpret_cast<scalar_t*>(
+                src_t* src_val = reinterpret_cast<src_t*>(
                         sub_indexer.GetInputPtr(0, workload_idx));
                 int64_t* dst_idx = reinterpret_cast<int64_t*>(
                         sub_indexer.GetOutputPtr(0, workload_idx));
                 std::tie(*dst_idx, dst_val) =
-                        reduce_func(src_idx, *src_val, *dst_idx, dst_val);
+                        reduce_func(src_idx, static_cast<scalar_t>(*src_val),
+                                    *dst_idx, dst_val);
             }
-        }
+        };
+        ParallelFor(Device("CPU:0"), num_output_elements, reduce_output);
     }
 
 private:
     Indexer indexer_;
 };
 
+/// Number of elements along the reduction dim reduced by one work item of the
+/// contiguous reduction engine. Fixed so that results are independent of the
+/// number of threads.
+static constexpr int64_t CONTIGUOUS_REDUCTION_BLOCK_SIZE = 16384;
+
+/// Number of independent accumulators per block. The accumulators do not
+/// depend on each other, so the compiler can keep them in SIMD registers
+/// without reassociating floating point operations.
+static constexpr int64_t CONTIGUOUS_REDUCTION_NUM_LANES = 16;
+
+/// Reduction engine for contiguous tensors whose reduction dims are adjacent,
+/// i.e. tensors that can be viewed as [outer, reduce, inner] and reduced over
+/// the middle dim. This covers full reductions, reductions over the last dims
+/// (e.g. per-row sums) and over the first dims (e.g. Min({0}) of a point
+/// cloud).
+///
+/// The reduction dim is split into fixed-size blocks. Blocks are reduced in
+/// parallel into partial results, which are then combined in a fixed pairwise
+/// tree. The result is therefore deterministic for a given input.
+class CPUContiguousReductionEngine {
+public:
+    CPUContiguousReductionEngine(const CPUContiguousReductionEngine&) = delete;
+    CPUContiguousReductionEngine& operator=(
+            const CPUContiguousReductionEngine&) = delete;
+    CPUContiguousReductionEngine(const Tensor& src,
+                                 Tensor& dst,
+                                 const SizeVector& dims)
+        : src_(src), dst_(dst) {
+        const SizeVector sorted_dims = SortedDims(src, dims);
+        const SizeVector& shape = src.GetShape();
+        for (int64_t d = 0; d < src.NumDims(); ++d) {
+            if (d < sorted_dims.front()) {
+                outer_ *= shape[d];
+            } else if (d <= sorted_dims.back()) {
+                reduce_ *= shape[d];
+            } else {
+                inner_ *= shape[d];
+            }
+        }
+    }
+
+    /// Returns true if the engine supports reducing \p src over \p dims into
+    /// \p dst.
+    static bool CanRun(const Tensor& src,
+                       const Tensor& dst,
+                       const SizeVector& dims) {
+        if (!src.IsContiguous() || !dst.IsContiguous() ||
+            src.NumElements() == 0 || dims.size() == 0) {
+            return false;
+        }
+        const SizeVector sorted_dims = SortedDims(src, dims);
+        for (size_t i = 1; i < sorted_dims.size(); ++i) {
+            if (sorted_dims[i] != sorted_dims[i - 1] + 1) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Reads inputs as src_t and reduces them into dst as scalar_t.
+    template <typename src_t, typename func_t, typename scalar_t>
+    void Run(const func_t& reduce_func, scalar_t identity) {
+        const src_t* src = static_cast<const src_t*>(src_.GetDataPtr());
+        scalar_t* dst = static_cast<scalar_t*>(dst_.GetDataPtr());
+        const int64_t outer = outer_;
+        const int64_t reduce = reduce_;
+        const int64_t inner = inner_;
+
+        if (inner == 1) {
+            // Each row of [outer, reduce] is reduced over contiguous memory.
+            const int64_t num_blocks = DivUp(reduce, BlockSize());
+            std::vector<scalar_t> partials(outer * num_blocks);
+            ParallelFor(Device("CPU:0"), outer * num_blocks, [&](int64_t i) {
+                const int64_t start = (i % num_blocks) * BlockSize();
+                const int64_t end = std::min(start + BlockSize(), reduce);
+                partials[i] = ReduceLanes<scalar_t>(
+                        src + (i / num_blocks) * reduce, start, end,
+                        reduce_func, identity);
+            });
+            ParallelFor(Device("CPU:0"), outer, [&](int64_t o) {
+                dst[o] = TreeReduce(partials.data() + o * num_blocks,
+                                    num_blocks, 1, reduce_func);
+            });
+        } else {
+            // Rows of [outer, reduce, inner] are accumulated element-wise.
+            // The inner loop runs over contiguous memory.
+            const int64_t chunk = std::min(inner, BlockSize());
+            const int64_t num_chunks = DivUp(inner, chunk);
+            const int64_t rows_per_block =
+                    inner < BlockSize() ? DivUp(BlockSize(), inner) : reduce;
+            const int64_t num_blocks = DivUp(reduce, rows_per_block);
+            std::vector<scalar_t> partials(outer * num_blocks * inner);
+            ParallelFor(
+                    Device("CPU:0"), outer * num_blocks * num_chunks,
+                    [&](int64_t i) {
+                        const int64_t c = i % num_chunks;
+                        const int64_t b = (i / num_chunks) % num_blocks;
+                        const int64_t o = i / (num_chunks * num_blocks);
+                        const int64_t j_start = c * chunk;
+                        const int64_t j_end = std::min(j_start + chunk, inner);
+                        const int64_t k_start = b * rows_per_block;
+                        const int64_t k_end =
+                                std::min(k_start + rows_per_block, reduce);
+                        scalar_t* acc =
+                                partials.data() + (o * num_blocks + b) * inner;
+                        std::fill(acc + j_start, acc + j_end, identity);
+                        for (int64_t k = k_start; k < k_end; ++k) {
+                            const src_t* row = src + (o * reduce + k) * inner;
+                            for (int64_t j = j_start; j < j_end; ++j) {
+                                acc[j] = reduce_func(
+                                        static_cast<scalar_t>(row[j]), acc[j]);
+                            }
+                        }
+                    });
+            // Each combine is cheap, so hand out about one block of work
+            // per task.
+            ParallelForWithGrainSize(
+                    Device("CPU:0"), outer * inner,
+                    DivUp(BlockSize(), num_blocks), [&](int64_t i) {
+                        const int64_t o = i / inner;
+                        const int64_t j = i % inner;
+                        dst[i] = TreeReduce(
+                                partials.data() + o * num_blocks * inner + j,
+                                num_blocks, inner, reduce_func);
+                    });
+        }
+    }
+
+    /// Reads inputs as src_t, compares them as scalar_t and writes the int64
+    /// index of the first best element to dst. \p is_better is a strict
+    /// comparison, e.g. std::less for ArgMin.
+    template <typename src_t, typename comp_t, typename scalar_t>
+    void RunArg(const comp_t& is_better, scalar_t identity) {
+        using arg_t = std::pair<scalar_t, int64_t>;
+        const src_t* src = static_cast<const src_t*>(src_.GetDataPtr());
+        int64_t* dst = static_cast<int64_t*>(dst_.GetDataPtr());
+        const int64_t outer = outer_;
+        const int64_t reduce = reduce_;
+        const int64_t inner = inner_;
+        // Index -1 marks "no element found", e.g. all elements are NaN.
+        auto arg_combine = [&is_better](const arg_t& a, const arg_t& b) {
+            if (a.second < 0) return b;
+            if (b.second < 0) return a;
+            if (is_better(b.first, a.first)) return b;
+            if (is_better(a.first, b.first)) return a;
+            return a.second < b.second ? a : b;
+        };
+        auto value_combine = [&is_better](scalar_t a, scalar_t b) {
+            return is_better(a, b) ? a : b;
+        };
+
+        if (inner == 1) {
+            // Find the best value of each block with SIMD lanes, then its
+            // first index with a linear scan.
+            const int64_t num_blocks = DivUp(reduce, BlockSize());
+            std::vector<arg_t> partials(outer * num_blocks);
+            ParallelFor(Device("CPU:0"), outer * num_blocks, [&](int64_t i) {
+                const src_t* row = src + (i / num_blocks) * reduce;
+                const int64_t start = (i % num_blocks) * BlockSize();
+                const int64_t end = std::min(start + BlockSize(), reduce);
+                const scalar_t best = ReduceLanes<scalar_t>(
+                        row, start, end, value_combine, identity);
+                partials[i] = arg_t(identity, -1);
+                for (int64_t k = start; k < end; ++k) {
+                    if (static_cast<scalar_t>(row[k]) == best) {
+                        partials[i] = arg_t(best, k);
+                        break;
+                    }
+                }
+            });
+            ParallelFor(Device("CPU:0"), outer, [&](int64_t o) {
+                const int64_t idx =
+                        TreeReduce(partials.data() + o * num_blocks,
+                                   num_blocks, 1, arg_combine)
+                                .second;
+                dst[o] = std::max<int64_t>(idx, 0);
+            });
+        } else {
+            const int64_t chunk = std::min(inner, BlockSize());
+            const int64_t num_chunks = DivUp(inner, chunk);
+            const int64_t rows_per_block =
+                    inner < BlockSize() ? DivUp(BlockSize(), inner) : reduce;
+            const int64_t num_blocks = DivUp(reduce, rows_per_block);
+            std::vector<arg_t> partials(outer * num_blocks * inner);
+            ParallelFor(
+                    Device("CPU:0"), outer * num_blocks * num_chunks,
+                    [&](int64_t i) {
+                        const int64_t c = i % num_chunks;
+                        const int64_t b = (i / num_chunks) % num_blocks;
+                        const int64_t o = i / (num_chunks * num_blocks);
+                        const int64_t j_start = c * chunk;
+                        const int64_t j_end = std::min(j_start + chunk, inner);
+                        const int64_t k_start = b * rows_per_block;
+                        const int64_t k_end =
+                                std::min(k_start + rows_per_block, reduce);
+                        arg_t* acc =
+                                partials.data() + (o * num_blocks + b) * inner;
+                        std::fill(acc + j_start, acc + j_end,
+                                  arg_t(identity, -1));
+                        for (int64_t k = k_start; k < k_end; ++k) {
+                            const src_t* row = src + (o * reduce + k) * inner;
+                            for (int64_t j = j_start; j < j_end; ++j) {
+                                const scalar_t value =
+                                        static_cast<scalar_t>(row[j]);
+                                if (is_better(value, acc[j].first) ||
+                                    (acc[j].second < 0 &&
+                                     value == acc[j].first)) {
+                                    acc[j] = arg_t(value, k);
+                                }
+                            }
+                        }
+                    });
+            // Each combine is cheap, so hand out about one block of work
+            // per task.
+            ParallelForWithGrainSize(
+                    Device("CPU:0"), outer * inner,
+                    DivUp(BlockSize(), num_blocks), [&](int64_t i) {
+                        const int64_t o = i / inner;
+                        const int64_t j = i % inner;
+                        const int64_t idx =
+                                TreeReduce(partials.data() +
+                                                   o * num_blocks * inner + j,
+                                           num_blocks, inner, arg_combine)
+                                        .second;
+                        dst[i] = std::max<int64_t>(idx, 0);
+                    });
+        }
+    }
+
+private:
+    static SizeVector SortedDims(const Tensor& src, const SizeVector& dims) {
+        SizeVector sorted_dims;
+        for (int64_t dim : dims) {
+            sorted_dims.push_back(shape_util::WrapDim(dim, src.NumDims()));
+        }
+        std::sort(sorted_dims.begin(), sorted_dims.end());
+        return sorted_dims;
+    }
+
+    static constexpr int64_t BlockSize() {
+        return CONTIGUOUS_REDUCTION_BLOCK_SIZE;
+    }
+
+    static int64_t DivUp(int64_t a, int64_t b) { return (a + b - 1) / b; }
+
+    /// Reduces src[start:end] with independent accumulators, which are then
+    /// combined pairwise.
+    template <typename scalar_t, typename src_t, typename func_t>
+    static scalar_t ReduceLanes(const src_t* src,
+                                int64_t start,
+                                int64_t end,
+                                const func_t& reduce_func,
+                                scalar_t identity) {
+        constexpr int64_t num_lanes = CONTIGUOUS_REDUCTION_NUM_LANES;
+        scalar_t acc[num_lanes];
+        std::fill(acc, acc + num_lanes, identity);
+        int64_t k = start;
+        for (; k + num_lanes <= end; k += num_lanes) {
+            for (int64_t l = 0; l < num_lanes; ++l) {
+                acc[l] = reduce_func(static_cast<scalar_t>(src[k + l]), acc[l]);
+            }
+        }
+        for (int64_t l = 0; k < end; ++k, ++l) {
+            acc[l] = reduce_func(static_cast<scalar_t>(src[k]), acc[l]);
+        }
+        return TreeReduce(acc, num_lanes, 1, reduce_func);
+    }
+
+    /// Combines values[0], values[stride], ..., values[(n - 1) * stride]
+    /// pairwise in place and returns the result.
+    template <typename value_t, typename func_t>
+    static value_t TreeReduce(value_t* values,
+                              int64_t n,
+                              int64_t stride,
+                              const func_t& reduce_func) {
+        for (int64_t step = 1; step < n; step *= 2) {
+            for (int64_t i = 0; i + step < n; i += 2 * step) {
+                values[i * stride] = reduce_func(values[(i + step) * stride],
+                                                 values[i * stride]);
+            }
+        }
+        return values[0];
+    }
+
+    Tensor src_;
+    Tensor dst_;
+    int64_t outer_ = 1;
+    int64_t reduce_ = 1;
+    int64_t inner_ = 1;
+};
+
+/// Runs a regular reduction of src_t inputs into a scalar_t output \p dst.
+/// Contiguous reductions over adjacent dims use CPUContiguousReductionEngine,
+/// all others fall back to the generic CPUReductionEngine.
+template <typename src_t, typename scalar_t>
+static void RunRegularReduction(const Indexer& indexer,
+                                const Tensor& src,
+                                Tensor& dst,
+                                const SizeVector& dims,
+                                ReductionOpCode op_code) {
+    auto run = [&](auto reduce_func, scalar_t identity) {
+        if (CPUContiguousReductionEngine::CanRun(src, dst, dims)) {
+            CPUContiguousReductionEngine re(src, dst, dims);
+            re.Run<src_t>(reduce_func, identity);
+        } else {
+            CPUReductionEngine re(indexer);
+            dst.Fill(identity);
+            re.RunAccumulate<src_t>(reduce_func, identity);
+        }
+    };
+    switch (op_code) {
+        case ReductionOpCode::Sum:
+            run(CPUSumReductionKernel<scalar_t>(), 0);
+            break;
+        case ReductionOpCode::Prod:
+            run(CPUProdReductionKernel<scalar_t>(), 1);
+            break;
+        case ReductionOpCode::Min:
+            if (src.NumElements() == 0) {
+                utility::LogError("Zero-size Tensor does not suport Min.");
+            } else {
+                run(CPUMinReductionKernel<scalar_t>(),
+                    std::numeric_limits<scalar_t>::max());
+            }
+            break;
+        case ReductionOpCode::Max:
+            if (src.NumElements() == 0) {
+                utility::LogError("Zero-size Tensor does not suport Max.");
+            } else {
+                run(CPUMaxReductionKernel<scalar_t>(),
+                    std::numeric_limits<scalar_t>::lowest());
+            }
+            break;
+        default:
+            utility::LogError("Unsupported op code.");
+            break;
+    }
+}
+
+/// Runs an arg-reduction of src_t inputs, keeping the temporary min/max values
+/// as scalar_t in \p dst_acc.
+template <typename src_t, typename scalar_t>
+static void RunArgReduction(const Indexer& indexer,
+                            const Tensor& src,
+                            Tensor& dst,
+                            Tensor& dst_acc,
+                            const SizeVector& dims,
+                            ReductionOpCode op_code) {
+    const bool is_contiguous =
+            CPUContiguousReductionEngine::CanRun(src, dst, dims);
+    scalar_t identity;
+    switch (op_code) {
+        case ReductionOpCode::ArgMin:
+            if (src.NumElements() == 0) {
+                utility::LogError("Zero-size Tensor does not suport ArgMin.");
+            }
+            identity = std::numeric_limits<scalar_t>::max();
+            if (is_contiguous) {
+                CPUContiguousReductionEngine re(src, dst, dims);
+                re.RunArg<src_t>(std::less<scalar_t>(), identity);
+            } else {
+                CPUArgReductionEngine re(indexer);
+                dst_acc.Fill(identity);
+                re.RunAccumulate<src_t>(CPUArgMinReductionKernel<scalar_t>,
+                                        identity);
+            }
+            break;
+        case ReductionOpCode::ArgMax:
+            if (src.NumElements() == 0) {
+                utility::LogError("Zero-size Tensor does not suport ArgMax.");
+            }
+            identity = std::numeric_limits<scalar_t>::lowest();
+            if (is_contiguous) {
+                CPUContiguousReductionEngine re(src, dst, dims);
+                re.RunArg<src_t>(std::greater<scalar_t>(), identity);
+            } else {
+                CPUArgReductionEngine re(indexer);
+                dst_acc.Fill(identity);
+                re.RunAccumulate<src_t>(CPUArgMaxReductionKernel<scalar_t>,
+                                        identity);
+            }
+            break;
+        default:
+            utility::LogError("Unsupported op code.");
+            break;
+    }
+}
+
 void ReductionCPU(const Tensor& src,
                   Tensor& dst,
                   const SizeVector& dims,
                   bool keepdim,
                   ReductionOpCode op_code) {
+    // Half-precision inputs are accumulated in float to avoid losing precision
+    // (and overflowing Float16) in long reductions.
+    const bool is_half =
+            src.GetDtype() == core::Float16 || src.GetDtype() == core::BFloat16;
     if (s_regular_reduce_ops.find(op_code) != s_regular_reduce_ops.end()) {
-        Indexer indexer({src}, dst, DtypePolicy::ALL_SAME, dims);
-        CPUReductionEngine re(indexer);
-        DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
-            scalar_t identity;
-            switch (op_code) {
-                case ReductionOpCode::Sum:
-                    identity = 0;
-                    dst.Fill(identity);
-                    re.Run(CPUSumReductionKernel<scalar_t>, identity);
-                    break;
-                case ReductionOpCode::Prod:
-                    identity = 1;
-                    dst.Fill(identity);
-                    re.Run(CPUProdReductionKernel<scalar_t>, identity);
-                    break;
-                case ReductionOpCode::Min:
-                    if (indexer.NumWorkloads() == 0) {
-                        utility::LogError(
-                                "Zero-size Tensor does not suport Min.");
-                    } else {
-                        identity = std::numeric_limits<scalar_t>::max();
-                        dst.Fill(identity);
-                        re.Run(CPUMinReductionKernel<scalar_t>, identity);
-                    }
-                    break;
-                case ReductionOpCode::Max:
-                    if (indexer.NumWorkloads() == 0) {
-                        utility::LogError(
-                                "Zero-size Tensor does not suport Max.");
-                    } else {
-                        identity = std::numeric_limits<scalar_t>::lowest();
-                        dst.Fill(identity);
-                        re.Run(CPUMaxReductionKernel<scalar_t>, identity);
-                    }
-                    break;
-                default:
-                    utility::LogError("Unsupported op code.");
-                    break;
+        if (is_half) {
+            // A Float32 dst is used as the accumulator directly.
+            Tensor dst_acc =
+                    dst.GetDtype() == core::Float32
+                            ? dst
+                            : Tensor(dst.GetShape(), core::Float32,
+                                     dst.GetDevice());
+            Indexer indexer({src}, dst_acc, DtypePolicy::NONE, dims);
+            DISPATCH_HALF_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+                RunRegularReduction<scalar_t, float>(indexer, src, dst_acc,
+                                                     dims, op_code);
+            });
+            if (!dst_acc.IsSame(dst)) {
+                dst.AsRvalue() = dst_acc;
             }
-        });
+        } else {
+            Indexer indexer({src}, dst, DtypePolicy::ALL_SAME, dims);
+            DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+                RunRegularReduction<scalar_t, scalar_t>(indexer, src, dst,
+                                                        dims, op_code);
+            });
+        }
     } else if (s_arg_reduce_ops.find(op_code) != s_arg_reduce_ops.end()) {
         if (dst.GetDtype() != core::Int64) {
             utility::LogError("Arg-reduction must have int64 output dtype.");
         }
         // Accumulation buffer to store temporary min/max values.
-        Tensor dst_acc(dst.GetShape(), src.GetDtype(), src.GetDevice());
+        Tensor dst_acc(dst.GetShape(),
+                       is_half ? core::Float32 : src.GetDtype(),
+                       src.GetDevice());
 
         Indexer indexer({src}, {dst, dst_acc}, DtypePolicy::INPUT_SAME, dims);
-        CPUArgReductionEngine re(indexer);
-        DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
-            scalar_t identity;
-            switch (op_code) {
-                case ReductionOpCode::ArgMin:
-                    if (indexer.NumWorkloads() == 0) {
-                        utility::LogError(
-                                "Zero-size Tensor does not suport ArgMin.");
-                    } else {
-                        identity = std::numeric_limits<scalar_t>::max();
-                        dst_acc.Fill(identity);
-                        re.Run(CPUArgMinReductionKernel<scalar_t>, identity);
-                    }
-                    break;
-                case ReductionOpCode::ArgMax:
-                    if (indexer.NumWorkloads() == 0) {
-                        utility::LogError(
-                                "Zero-size Tensor does not suport ArgMax.");
-                    } else {
-                        identity = std::numeric_limits<scalar_t>::lowest();
-                        dst_acc.Fill(identity);
-                        re.Run(CPUArgMaxReductionKernel<scalar_t>, identity);
-                    }
-                    break;
-                default:
-                    utility::LogError("Unsupported op code.");
-                    break;
-            }
-        });
+        if (is_half) {
+            DISPATCH_HALF_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+                RunArgReduction<scalar_t, float>(indexer, src, dst, dst_acc,
+                                                 dims, op_code);
+            });
+        } else {
+            DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+                RunArgReduction<scalar_t, scalar_t>(indexer, src, dst,
+                                                    dst_acc, dims, op_code);
+            });
+        }
     } else if (s_boolean_reduce_ops.find(op_code) !=
                s_boolean_reduce_ops.end()) {
         if (src.GetDtype() != core::Bool) {
@@ -329,21 +709,29 @@ void ReductionCPU(const Tensor& src,
                     "Boolean reduction only supports boolean output tensor.");
         }
         Indexer indexer({src}, dst, DtypePolicy::ALL_SAME, dims);
-        CPUReductionEngine re(indexer);
-        switch (op_code) {
-            case ReductionOpCode::All:
-                // Identity == true. 0-sized tensor, returns true.
-                dst.Fill(true);
-                re.Run(CPUAllReductionKernel, static_cast<uint8_t>(true));
-                break;
-            case ReductionOpCode::Any:
-                // Identity == false. 0-sized tensor, returns false.
-                dst.Fill(false);
-                re.Run(CPUAnyReductionKernel, static_cast<uint8_t>(false));
-                break;
-            default:
-                utility::LogError("Unsupported op code.");
-                break;
+        if (op_code != ReductionOpCode::All &&
+            op_code != ReductionOpCode::Any) {
+            utility::LogError("Unsupported op code.");
+        }
+        // Identity is true for All and false for Any, which is also the
+        // result for 0-sized tensors.
+        const bool is_all = op_code == ReductionOpCode::All;
+        const uint8_t identity = static_cast<uint8_t>(is_all);
+        if (CPUContiguousReductionEngine::CanRun(src, dst, dims)) {
+            CPUContiguousReductionEngine re(src, dst, dims);
+            if (is_all) {
+                re.Run<uint8_t>(CPUAllReductionKernel(), identity);
+            } else {
+                re.Run<uint8_t>(CPUAnyReductionKernel(), identity);
+            }
+        } else {
+            CPUReductionEngine re(indexer);
+            dst.Fill(is_all);
+            if (is_all) {
+                re.Run(CPUAllReductionKernel(), identity);
+            } else {
+                re.Run(CPUAnyReductionKernel(), identity);
+            }
         }
     } else {
         utility::LogError("Unsupported op code.");
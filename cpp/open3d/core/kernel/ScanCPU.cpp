@@ -0,0 +1,137 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Indexer.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Scan.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ParallelScan.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+// Lines shorter than this are always scanned by a single thread.
+static constexpr int64_t MIN_PARALLEL_SCAN_LENGTH = 65536;
+
+template <typename scalar_t, typename func_t>
+static void CPUScanEngine(const Tensor& src,
+                          Tensor& dst,
+                          int64_t dim,
+                          func_t scan_op) {
+    // Each workload of the indexer is the first element of one line along
+    // dim. Elements of the same line are reached with the strides of dim.
+    Indexer indexer({src.Slice(dim, 0, 1)}, dst.Slice(dim, 0, 1),
+                    DtypePolicy::ALL_SAME);
+    const int64_t num_lines = indexer.NumWorkloads();
+    const int64_t length = src.GetShape(dim);
+    const int64_t src_stride = src.GetStride(dim);
+    const int64_t dst_stride = dst.GetStride(dim);
+
+    auto scan_line_serial = [&](int64_t line) {
+        const scalar_t* src_ptr = indexer.GetInputPtr<scalar_t>(0, line);
+        scalar_t* dst_ptr = indexer.GetOutputPtr<scalar_t>(line);
+        scalar_t acc = src_ptr[0];
+        dst_ptr[0] = acc;
+        for (int64_t i = 1; i < length; ++i) {
+            acc = scan_op(acc, src_ptr[i * src_stride]);
+            dst_ptr[i * dst_stride] = acc;
+        }
+    };
+
+    if (num_lines >= utility::EstimateMaxThreads() ||
+        length < MIN_PARALLEL_SCAN_LENGTH || utility::InParallel()) {
+        ParallelFor(src.GetDevice(), num_lines, scan_line_serial);
+        return;
+    }
+
+    // Few long lines: scan each line with a parallel scan.
+    const bool same_buffer = src.GetDataPtr() == dst.GetDataPtr();
+    std::vector<scalar_t> src_buffer;
+    std::vector<scalar_t> dst_buffer;
+    for (int64_t line = 0; line < num_lines; ++line) {
+        const scalar_t* src_ptr = indexer.GetInputPtr<scalar_t>(0, line);
+        scalar_t* dst_ptr = indexer.GetOutputPtr<scalar_t>(line);
+        if (src_stride == 1 && dst_stride == 1 && !same_buffer) {
+            utility::InclusivePrefixScan(src_ptr, src_ptr + length, dst_ptr,
+                                         scan_op);
+        } else {
+            // Strided or in-place lines are scanned between two buffers.
+            src_buffer.resize(length);
+            dst_buffer.resize(length);
+            for (int64_t i = 0; i < length; ++i) {
+                src_buffer[i] = src_ptr[i * src_stride];
+            }
+            utility::InclusivePrefixScan(src_buffer.data(),
+                                         src_buffer.data() + length,
+                                         dst_buffer.data(), scan_op);
+            for (int64_t i = 0; i < length; ++i) {
+                dst_ptr[i * dst_stride] = dst_buffer[i];
+            }
+        }
+    }
+}
+
+void ScanCPU(const Tensor& src, Tensor& dst, int64_t dim, ScanOpCode op_code) {
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        switch (op_code) {
+            case ScanOpCode::Sum:
+                CPUScanEngine<scalar_t>(
+                        src, dst, dim,
+                        [](scalar_t a, scalar_t b) -> scalar_t {
+                            return a + b;
+                        });
+                break;
+            case ScanOpCode::Prod:
+                CPUScanEngine<scalar_t>(
+                        src, dst, dim,
+                        [](scalar_t a, scalar_t b) -> scalar_t {
+                            return a * b;
+                        });
+                break;
+            case ScanOpCode::Max:
+                CPUScanEngine<scalar_t>(
+                        src, dst, dim,
+                        [](scalar_t a, scalar_t b) -> scalar_t {
+                            return std::max(a, b);
+                        });
+                break;
+            default:
+                utility::LogError("Unsupported op code.");
+                break;
+        }
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
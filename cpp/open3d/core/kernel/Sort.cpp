@@ -0,0 +1,170 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/Sort.h"
+
+#include "open3d/core/Device.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Returns \p src as a contiguous 2D tensor where \p dim becomes the columns
+/// (\p to_last = true) or the rows (\p to_last = false). \p dim is swapped
+/// with the last or the first dimension respectively.
+static Tensor To2D(const Tensor& src, int64_t dim, bool to_last) {
+    const int64_t num_dims = src.NumDims();
+    const int64_t length = src.GetShape(dim);
+    int64_t others = 1;
+    for (int64_t i = 0; i < num_dims; ++i) {
+        others *= i == dim ? 1 : src.GetShape(i);
+    }
+    Tensor swapped =
+            src.Transpose(dim, to_last ? num_dims - 1 : 0).Contiguous();
+    if (to_last) {
+        return swapped.Reshape({others, length});
+    } else {
+        return swapped.Reshape({length, others});
+    }
+}
+
+/// Inverse of To2D, where the length along \p dim may have changed to
+/// \p new_length.
+static Tensor From2D(const Tensor& src_2d,
+                     const SizeVector& shape,
+                     int64_t dim,
+                     bool to_last,
+                     int64_t new_length) {
+    const int64_t swapped_dim =
+            to_last ? static_cast<int64_t>(shape.size()) - 1 : 0;
+    SizeVector swapped_shape = shape;
+    std::swap(swapped_shape[dim], swapped_shape[swapped_dim]);
+    swapped_shape[swapped_dim] = new_length;
+    return src_2d.Reshape(swapped_shape)
+            .Transpose(dim, swapped_dim)
+            .Contiguous();
+}
+
+void Sort(const Tensor& src,
+          int64_t dim,
+          bool descending,
+          Tensor& dst_values,
+          Tensor& dst_indices) {
+    if (src.NumDims() == 0) {
+        utility::LogError("Sort: 0-D tensor can not be sorted.");
+    }
+    dim = shape_util::WrapDim(dim, src.NumDims());
+
+    Tensor src_2d = To2D(src, dim, /*to_last=*/true);
+    Tensor values_2d(src_2d.GetShape(), src.GetDtype(), src.GetDevice());
+    Tensor indices_2d(src_2d.GetShape(), core::Int64, src.GetDevice());
+
+    if (src.NumElements() > 0) {
+        Device::DeviceType device_type = src.GetDevice().GetType();
+        if (device_type == Device::DeviceType::CPU) {
+            SortCPU(src_2d, descending, values_2d, indices_2d);
+        } else {
+            utility::LogError("Sort: Unimplemented device");
+        }
+    }
+
+    dst_values = From2D(values_2d, src.GetShape(), dim, /*to_last=*/true,
+                        src.GetShape(dim));
+    dst_indices = From2D(indices_2d, src.GetShape(), dim, /*to_last=*/true,
+                         src.GetShape(dim));
+}
+
+void TopK(const Tensor& src,
+          int64_t k,
+          int64_t dim,
+          bool largest,
+          Tensor& dst_values,
+          Tensor& dst_indices) {
+    if (src.NumDims() == 0) {
+        utility::LogError("TopK: 0-D tensor is not supported.");
+    }
+    dim = shape_util::WrapDim(dim, src.NumDims());
+    if (k < 0 || k > src.GetShape(dim)) {
+        utility::LogError("TopK: k must be in [0, {}], but got {}.",
+                          src.GetShape(dim), k);
+    }
+
+    Tensor src_2d = To2D(src, dim, /*to_last=*/true);
+    const int64_t num_rows = src_2d.GetShape(0);
+    Tensor values_2d({num_rows, k}, src.GetDtype(), src.GetDevice());
+    Tensor indices_2d({num_rows, k}, core::Int64, src.GetDevice());
+
+    if (num_rows > 0 && k > 0) {
+        Device::DeviceType device_type = src.GetDevice().GetType();
+        if (device_type == Device::DeviceType::CPU) {
+            TopKCPU(src_2d, k, largest, values_2d, indices_2d);
+        } else {
+            utility::LogError("TopK: Unimplemented device");
+        }
+    }
+
+    dst_values = From2D(values_2d, src.GetShape(), dim, /*to_last=*/true, k);
+    dst_indices =
+            From2D(indices_2d, src.GetShape(), dim, /*to_last=*/true, k);
+}
+
+void Unique(const Tensor& src,
+            int64_t dim,
+            Tensor& dst_values,
+            Tensor& dst_inverse_indices,
+            Tensor& dst_counts) {
+    if (src.NumDims() == 0) {
+        utility::LogError("Unique: 0-D tensor is not supported.");
+    }
+    dim = shape_util::WrapDim(dim, src.NumDims());
+
+    Tensor src_2d = To2D(src, dim, /*to_last=*/false);
+    const int64_t num_rows = src_2d.GetShape(0);
+    Tensor values_2d;
+    dst_inverse_indices = Tensor({num_rows}, core::Int64, src.GetDevice());
+    dst_counts = Tensor({0}, core::Int64, src.GetDevice());
+
+    if (num_rows == 0) {
+        values_2d = src_2d;
+    } else {
+        Device::DeviceType device_type = src.GetDevice().GetType();
+        if (device_type == Device::DeviceType::CPU) {
+            UniqueCPU(src_2d, values_2d, dst_inverse_indices, dst_counts);
+        } else {
+            utility::LogError("Unique: Unimplemented device");
+        }
+    }
+
+    dst_values = From2D(values_2d, src.GetShape(), dim, /*to_last=*/false,
+                        values_2d.GetShape(0));
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,84 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Sorts \p src along \p dim. \p dst_values gets the sorted values and
+/// \p dst_indices (Int64) the positions of the sorted values along \p dim in
+/// \p src. The sort is stable.
+void Sort(const Tensor& src,
+          int64_t dim,
+          bool descending,
+          Tensor& dst_values,
+          Tensor& dst_indices);
+
+/// Selects the \p k largest (or smallest) elements of \p src along \p dim,
+/// ordered from the best to the worst. Ties are broken by the lower index.
+void TopK(const Tensor& src,
+          int64_t k,
+          int64_t dim,
+          bool largest,
+          Tensor& dst_values,
+          Tensor& dst_indices);
+
+/// Finds the unique slices of \p src along \p dim, sorted in lexicographic
+/// order. \p dst_inverse_indices (Int64) maps each slice of \p src to its
+/// slice in \p dst_values, and \p dst_counts (Int64) holds the number of
+/// occurrences of each unique slice.
+void Unique(const Tensor& src,
+            int64_t dim,
+            Tensor& dst_values,
+            Tensor& dst_inverse_indices,
+            Tensor& dst_counts);
+
+/// The device kernels work on rows of a contiguous 2D tensor
+/// {num_rows, row_length}. Sort and TopK sort within each row, Unique finds
+/// unique rows.
+void SortCPU(const Tensor& src,
+             bool descending,
+             Tensor& dst_values,
+             Tensor& dst_indices);
+
+void TopKCPU(const Tensor& src,
+             int64_t k,
+             bool largest,
+             Tensor& dst_values,
+             Tensor& dst_indices);
+
+void UniqueCPU(const Tensor& src,
+               Tensor& dst_values,
+               Tensor& dst_inverse_indices,
+               Tensor& dst_counts);
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
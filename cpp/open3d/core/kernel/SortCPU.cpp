@@ -0,0 +1,317 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Sort.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ParallelScan.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+// Below this many elements per thread a row is sorted by a single thread.
+static constexpr int64_t MIN_ELEMENTS_PER_THREAD = 4096;
+
+static int64_t NumThreadsFor(int64_t num_elements) {
+    if (utility::InParallel()) {
+        return 1;
+    }
+    return std::max<int64_t>(
+            1, std::min<int64_t>(utility::EstimateMaxThreads(),
+                                 num_elements / MIN_ELEMENTS_PER_THREAD));
+}
+
+template <typename scalar_t>
+static inline bool IsNaN(scalar_t x) {
+    return x != x;
+}
+
+/// Ascending order with NaN after all other values, as in NumPy. Unlike the
+/// raw operator<, this is a strict weak ordering for floating point values.
+template <typename scalar_t>
+static inline bool LessNaNLast(scalar_t a, scalar_t b) {
+    return !IsNaN(a) && (IsNaN(b) || a < b);
+}
+
+/// Descending order with NaN after all other values.
+template <typename scalar_t>
+static inline bool GreaterNaNLast(scalar_t a, scalar_t b) {
+    return !IsNaN(a) && (IsNaN(b) || a > b);
+}
+
+/// Stable parallel merge sort of \p indices with \p comp. Each thread sorts a
+/// chunk, then sorted chunks are merged pairwise in log2(num_chunks) rounds.
+template <typename Compare>
+static void ParallelStableSort(int64_t* indices, int64_t n, Compare comp) {
+    const int64_t num_chunks = NumThreadsFor(n);
+    if (num_chunks <= 1) {
+        std::stable_sort(indices, indices + n, comp);
+        return;
+    }
+
+    std::vector<int64_t> bounds(num_chunks + 1);
+    for (int64_t c = 0; c <= num_chunks; ++c) {
+        bounds[c] = n * c / num_chunks;
+    }
+
+    ParallelFor(Device("CPU:0"), num_chunks, [&](int64_t c) {
+        std::stable_sort(indices + bounds[c], indices + bounds[c + 1], comp);
+    });
+
+    std::vector<int64_t> buffer(n);
+    int64_t* src = indices;
+    int64_t* dst = buffer.data();
+    for (int64_t width = 1; width < num_chunks; width *= 2) {
+        const int64_t num_pairs = (num_chunks + 2 * width - 1) / (2 * width);
+        ParallelFor(Device("CPU:0"), num_pairs, [&](int64_t p) {
+            const int64_t lo = bounds[2 * width * p];
+            const int64_t mid = bounds[std::min(2 * width * p + width,
+                                                num_chunks)];
+            const int64_t hi = bounds[std::min(2 * width * p + 2 * width,
+                                               num_chunks)];
+            std::merge(src + lo, src + mid, src + mid, src + hi, dst + lo,
+                       comp);
+        });
+        std::swap(src, dst);
+    }
+    if (src != indices) {
+        std::copy(src, src + n, indices);
+    }
+}
+
+/// Returns the \p k best indices of \p n elements, ordered from the best.
+/// \p comp must be a strict total order. Long rows are split into chunks
+/// whose local top-k are merged.
+template <typename Compare>
+static void SelectTopK(int64_t n, int64_t k, Compare comp, int64_t* top_k) {
+    const int64_t num_chunks = NumThreadsFor(n);
+    std::vector<int64_t> candidates;
+    if (num_chunks <= 1) {
+        candidates.resize(n);
+        std::iota(candidates.begin(), candidates.end(), 0);
+    } else {
+        std::vector<std::vector<int64_t>> chunk_candidates(num_chunks);
+        ParallelFor(Device("CPU:0"), num_chunks, [&](int64_t c) {
+            const int64_t begin = n * c / num_chunks;
+            const int64_t end = n * (c + 1) / num_chunks;
+            std::vector<int64_t>& local = chunk_candidates[c];
+            local.resize(end - begin);
+            std::iota(local.begin(), local.end(), begin);
+            if (static_cast<int64_t>(local.size()) > k) {
+                std::nth_element(local.begin(), local.begin() + k, local.end(),
+                                 comp);
+                local.resize(k);
+            }
+        });
+        for (const std::vector<int64_t>& local : chunk_candidates) {
+            candidates.insert(candidates.end(), local.begin(), local.end());
+        }
+    }
+    std::partial_sort(candidates.begin(), candidates.begin() + k,
+                      candidates.end(), comp);
+    std::copy(candidates.begin(), candidates.begin() + k, top_k);
+}
+
+/// Runs \p func(row) for all rows. Many short rows are distributed over
+/// threads, while a few long rows are processed one by one so that each row can
+/// use all threads.
+template <typename func_t>
+static void ForEachRow(int64_t num_rows, func_t func) {
+    if (num_rows >= utility::EstimateMaxThreads()) {
+        ParallelFor(Device("CPU:0"), num_rows, func);
+    } else {
+        for (int64_t row = 0; row < num_rows; ++row) {
+            func(row);
+        }
+    }
+}
+
+template <typename scalar_t>
+static void SortRows(const Tensor& src,
+                     bool descending,
+                     Tensor& dst_values,
+                     Tensor& dst_indices) {
+    const int64_t row_length = src.GetShape(1);
+    const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+    scalar_t* values_ptr = dst_values.GetDataPtr<scalar_t>();
+    int64_t* indices_ptr = dst_indices.GetDataPtr<int64_t>();
+
+    ForEachRow(src.GetShape(0), [&](int64_t row) {
+        const scalar_t* row_src = src_ptr + row * row_length;
+        int64_t* row_indices = indices_ptr + row * row_length;
+        std::iota(row_indices, row_indices + row_length, 0);
+        if (descending) {
+            ParallelStableSort(row_indices, row_length,
+                               [&](int64_t a, int64_t b) {
+                                   return GreaterNaNLast(row_src[a],
+                                                         row_src[b]);
+                               });
+        } else {
+            ParallelStableSort(row_indices, row_length,
+                               [&](int64_t a, int64_t b) {
+                                   return LessNaNLast(row_src[a], row_src[b]);
+                               });
+        }
+        scalar_t* row_values = values_ptr + row * row_length;
+        for (int64_t i = 0; i < row_length; ++i) {
+            row_values[i] = row_src[row_indices[i]];
+        }
+    });
+}
+
+template <typename scalar_t>
+static void TopKRows(const Tensor& src,
+                     int64_t k,
+                     bool largest,
+                     Tensor& dst_values,
+                     Tensor& dst_indices) {
+    const int64_t row_length = src.GetShape(1);
+    const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+    scalar_t* values_ptr = dst_values.GetDataPtr<scalar_t>();
+    int64_t* indices_ptr = dst_indices.GetDataPtr<int64_t>();
+
+    ForEachRow(src.GetShape(0), [&](int64_t row) {
+        const scalar_t* row_src = src_ptr + row * row_length;
+        int64_t* row_indices = indices_ptr + row * k;
+        if (largest) {
+            SelectTopK(row_length, k,
+                       [&](int64_t a, int64_t b) {
+                           return GreaterNaNLast(row_src[a], row_src[b]) ||
+                                  (!GreaterNaNLast(row_src[b], row_src[a]) &&
+                                   a < b);
+                       },
+                       row_indices);
+        } else {
+            SelectTopK(row_length, k,
+                       [&](int64_t a, int64_t b) {
+                           return LessNaNLast(row_src[a], row_src[b]) ||
+                                  (!LessNaNLast(row_src[b], row_src[a]) &&
+                                   a < b);
+                       },
+                       row_indices);
+        }
+        scalar_t* row_values = values_ptr + row * k;
+        for (int64_t i = 0; i < k; ++i) {
+            row_values[i] = row_src[row_indices[i]];
+        }
+    });
+}
+
+template <typename scalar_t>
+static void UniqueRows(const Tensor& src,
+                       Tensor& dst_values,
+                       Tensor& dst_inverse_indices,
+                       Tensor& dst_counts) {
+    const int64_t num_rows = src.GetShape(0);
+    const int64_t row_length = src.GetShape(1);
+    const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+    int64_t* inverse_ptr = dst_inverse_indices.GetDataPtr<int64_t>();
+    auto row_less = [&](int64_t a, int64_t b) {
+        const scalar_t* row_a = src_ptr + a * row_length;
+        const scalar_t* row_b = src_ptr + b * row_length;
+        return std::lexicographical_compare(row_a, row_a + row_length, row_b,
+                                            row_b + row_length,
+                                            LessNaNLast<scalar_t>);
+    };
+
+    std::vector<int64_t> order(num_rows);
+    std::iota(order.begin(), order.end(), 0);
+    ParallelStableSort(order.data(), num_rows, row_less);
+
+    // is_new[i] is 1 if the i-th sorted row starts a new unique row. Its
+    // inclusive prefix sum is the unique row id plus one.
+    std::vector<int64_t> is_new(num_rows);
+    is_new[0] = 1;
+    ParallelFor(Device("CPU:0"), num_rows - 1, [&](int64_t i) {
+        is_new[i + 1] = row_less(order[i], order[i + 1]) ? 1 : 0;
+    });
+    std::vector<int64_t> unique_ids(num_rows);
+    utility::InclusivePrefixSum(is_new.data(), is_new.data() + num_rows,
+                                unique_ids.data());
+    const int64_t num_unique = unique_ids[num_rows - 1];
+
+    dst_values =
+            Tensor({num_unique, row_length}, src.GetDtype(), src.GetDevice());
+    dst_counts = Tensor({num_unique}, core::Int64, src.GetDevice());
+    scalar_t* values_ptr = dst_values.GetDataPtr<scalar_t>();
+    int64_t* counts_ptr = dst_counts.GetDataPtr<int64_t>();
+
+    ParallelFor(Device("CPU:0"), num_rows, [&](int64_t i) {
+        const int64_t unique_id = unique_ids[i] - 1;
+        inverse_ptr[order[i]] = unique_id;
+        if (is_new[i]) {
+            std::copy(src_ptr + order[i] * row_length,
+                      src_ptr + (order[i] + 1) * row_length,
+                      values_ptr + unique_id * row_length);
+            // The run of equal rows ends where the next one starts.
+            int64_t end = i + 1;
+            while (end < num_rows && !is_new[end]) {
+                ++end;
+            }
+            counts_ptr[unique_id] = end - i;
+        }
+    });
+}
+
+void SortCPU(const Tensor& src,
+             bool descending,
+             Tensor& dst_values,
+             Tensor& dst_indices) {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        SortRows<scalar_t>(src, descending, dst_values, dst_indices);
+    });
+}
+
+void TopKCPU(const Tensor& src,
+             int64_t k,
+             bool largest,
+             Tensor& dst_values,
+             Tensor& dst_indices) {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        TopKRows<scalar_t>(src, k, largest, dst_values, dst_indices);
+    });
+}
+
+void UniqueCPU(const Tensor& src,
+               Tensor& dst_values,
+               Tensor& dst_inverse_indices,
+               Tensor& dst_counts) {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        UniqueRows<scalar_t>(src, dst_values, dst_inverse_indices, dst_counts);
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
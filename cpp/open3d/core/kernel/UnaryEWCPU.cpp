@@ -26,6 +26,7 @@
 
 #include <cmath>
 #include <cstring>
+#include <type_traits>
 
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
@@ -45,24 +46,58 @@ namespace open3d {
 namespace core {
 namespace kernel {
 
+// Minimum number of workloads per thread. Element-wise kernels are memory
+// bound, so smaller ranges are not worth the cost of waking up a thread.
+static constexpr int64_t UNARY_EW_GRAIN_SIZE = 32768;
+
 template <typename element_func_t>
 static void LaunchUnaryEWKernel(const Indexer& indexer,
                                 const element_func_t& element_func) {
-    ParallelFor(Device("CPU:0"), indexer.NumWorkloads(),
-                [&indexer, &element_func](int64_t i) {
-                    element_func(indexer.GetInputPtr(0, i),
-                                 indexer.GetOutputPtr(i));
-                });
+    auto loop = [&element_func](char* const* ptrs, const int64_t* byte_strides,
+                                int64_t n) {
+        for (int64_t i = 0; i < n; ++i) {
+            element_func(ptrs[0] + i * byte_strides[0],
+                         ptrs[1] + i * byte_strides[1]);
+        }
+    };
+    ParallelForRange(Device("CPU:0"), indexer.NumWorkloads(),
+                     UNARY_EW_GRAIN_SIZE,
+                     [&indexer, &loop](int64_t start, int64_t end) {
+                         indexer.ForEachInnerLoop(start, end, loop);
+                     });
 }
 
 template <typename src_t, typename dst_t, typename element_func_t>
 static void LaunchUnaryEWKernel(const Indexer& indexer,
                                 const element_func_t& element_func) {
-    ParallelFor(Device("CPU:0"), indexer.NumWorkloads(),
-                [&indexer, &element_func](int64_t i) {
-                    element_func(indexer.GetInputPtr<src_t>(0, i),
-                                 indexer.GetOutputPtr<dst_t>(i));
-                });
+    // Offsets are computed once per run of the innermost dimension instead of
+    // once per element. Runs are specialized for a contiguous or broadcast
+    // scalar source, e.g. when copying a (N, 1) tensor into a (N, 3) tensor.
+    auto loop = [&element_func](char* const* ptrs, const int64_t* byte_strides,
+                                int64_t n) {
+        const src_t* src = reinterpret_cast<const src_t*>(ptrs[0]);
+        dst_t* dst = reinterpret_cast<dst_t*>(ptrs[1]);
+        const bool dst_contiguous = byte_strides[1] == sizeof(dst_t);
+        if (dst_contiguous && byte_strides[0] == sizeof(src_t)) {
+            for (int64_t i = 0; i < n; ++i) {
+                element_func(src + i, dst + i);
+            }
+        } else if (dst_contiguous && byte_strides[0] == 0) {
+            for (int64_t i = 0; i < n; ++i) {
+                element_func(src, dst + i);
+            }
+        } else {
+            for (int64_t i = 0; i < n; ++i) {
+                element_func(ptrs[0] + i * byte_strides[0],
+                             ptrs[1] + i * byte_strides[1]);
+            }
+        }
+    };
+    ParallelForRange(Device("CPU:0"), indexer.NumWorkloads(),
+                     UNARY_EW_GRAIN_SIZE,
+                     [&indexer, &loop](int64_t start, int64_t end) {
+                         indexer.ForEachInnerLoop(start, end, loop);
+                     });
 }
 
 template <typename src_t,
@@ -72,13 +107,24 @@ template <typename src_t,
 static void LaunchUnaryEWKernel(const Indexer& indexer,
                                 const element_func_t& element_func,
                                 const vec_func_t& vec_func) {
-    ParallelFor(
-            Device("CPU:0"), indexer.NumWorkloads(),
-            [&indexer, &element_func](int64_t i) {
-                element_func(indexer.GetInputPtr<src_t>(0, i),
-                             indexer.GetOutputPtr<dst_t>(i));
-            },
-            vec_func);
+#ifdef BUILD_ISPC_MODULE
+    // Half types have no vectorized kernels. The ISPC kernels compute offsets
+    // per element, so they are only used if no operand is broadcast or
+    // strided.
+    if (std::is_arithmetic<src_t>::value &&
+        indexer.GetInput(0).IsContiguous() &&
+        indexer.GetOutput().IsContiguous()) {
+        ParallelFor(
+                Device("CPU:0"), indexer.NumWorkloads(),
+                [&indexer, &element_func](int64_t i) {
+                    element_func(indexer.GetInputPtr<src_t>(0, i),
+                                 indexer.GetOutputPtr<dst_t>(i));
+                },
+                vec_func);
+        return;
+    }
+#endif
+    LaunchUnaryEWKernel<src_t, dst_t>(indexer, element_func);
 }
 
 template <typename src_t, typename dst_t>
@@ -193,7 +239,7 @@ void CopyCPU(const Tensor& src, Tensor& dst) {
                src.NumElements() == 1 && !src_dtype.IsObject()) {
         int64_t num_elements = dst.NumElements();
 
-        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dst_dtype, [&]() {
             scalar_t scalar_element = src.To(dst_dtype).Item<scalar_t>();
             scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
             ParallelFor(Device("CPU:0"), num_elements,
@@ -210,9 +256,9 @@ void CopyCPU(const Tensor& src, Tensor& dst) {
             });
 
         } else {
-            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(src_dtype, [&]() {
                 using src_t = scalar_t;
-                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
+                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dst_dtype, [&]() {
                     using dst_t = scalar_t;
                     LaunchUnaryEWKernel<src_t, dst_t>(
                             indexer, CPUCopyElementKernel<src_t, dst_t>);
@@ -228,9 +274,11 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
     Dtype dst_dtype = dst.GetDtype();
 
     auto assert_dtype_is_float = [](Dtype dtype) -> void {
-        if (dtype != core::Float32 && dtype != core::Float64) {
+        if (dtype != core::Float32 && dtype != core::Float64 &&
+            dtype != core::Float16 && dtype != core::BFloat16) {
             utility::LogError(
-                    "Only supports Float32 and Float64, but {} is used.",
+                    "Only supports Float32, Float64, Float16 and BFloat16, "
+                    "but {} is used.",
                     dtype.ToString());
         }
     };
@@ -241,7 +289,7 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
 #ifdef BUILD_ISPC_MODULE
             ispc::Indexer ispc_indexer = indexer.ToISPC();
 #endif
-            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(src_dtype, [&]() {
                 LaunchUnaryEWKernel<scalar_t, scalar_t>(
                         indexer, CPULogicalNotElementKernel<scalar_t, scalar_t>,
                         OPEN3D_TEMPLATE_VECTORIZED(scalar_t,
@@ -253,7 +301,7 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
 #ifdef BUILD_ISPC_MODULE
             ispc::Indexer ispc_indexer = indexer.ToISPC();
 #endif
-            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(src_dtype, [&]() {
                 LaunchUnaryEWKernel<scalar_t, bool>(
                         indexer, CPULogicalNotElementKernel<scalar_t, bool>,
                         OPEN3D_TEMPLATE_VECTORIZED(
@@ -273,7 +321,7 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
 #ifdef BUILD_ISPC_MODULE
         ispc::Indexer ispc_indexer = indexer.ToISPC();
 #endif
-        DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(src_dtype, [&]() {
             if (op_code == UnaryEWOpCode::IsNan) {
                 LaunchUnaryEWKernel<scalar_t, bool>(
                         indexer, CPUIsNanElementKernel<scalar_t>,
@@ -297,7 +345,7 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
 #ifdef BUILD_ISPC_MODULE
         ispc::Indexer ispc_indexer = indexer.ToISPC();
 #endif
-        DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(src_dtype, [&]() {
             switch (op_code) {
                 case UnaryEWOpCode::Sqrt:
                     assert_dtype_is_float(src_dtype);
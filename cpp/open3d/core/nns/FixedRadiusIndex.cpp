@@ -26,18 +26,85 @@
 
 #include "open3d/core/nns/FixedRadiusIndex.h"
 
+#include <tuple>
+#include <vector>
+
 #include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
 #include "open3d/core/TensorCheck.h"
+#include "open3d/core/nns/MortonOrder.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
 namespace core {
 namespace nns {
 
-FixedRadiusIndex::FixedRadiusIndex(){};
+namespace {
+
+/// Restores the input order of the ragged results of a radius search that
+/// was run on queries sorted with \p queries_order.
+void RestoreQueryOrder(const Tensor &queries_order,
+                       Tensor &neighbors_index,
+                       Tensor &neighbors_distance,
+                       Tensor &neighbors_row_splits) {
+    const Device host("CPU:0");
+    const Device device = neighbors_row_splits.GetDevice();
+    const Tensor order = queries_order.To(host).Contiguous();
+    const Tensor row_splits = neighbors_row_splits.To(host).Contiguous();
+    const int64_t *order_ptr = order.GetDataPtr<int64_t>();
+    const int64_t *row_splits_ptr = row_splits.GetDataPtr<int64_t>();
+    const int64_t num_queries = order.GetLength();
+
+    // sorted_pos[i] is the position of input query i in the sorted queries.
+    std::vector<int64_t> sorted_pos(num_queries);
+    for (int64_t i = 0; i < num_queries; ++i) {
+        sorted_pos[order_ptr[i]] = i;
+    }
+
+    Tensor out_row_splits = Tensor::Empty({num_queries + 1}, Int64, host);
+    int64_t *out_row_splits_ptr = out_row_splits.GetDataPtr<int64_t>();
+    out_row_splits_ptr[0] = 0;
+    for (int64_t i = 0; i < num_queries; ++i) {
+        const int64_t j = sorted_pos[i];
+        out_row_splits_ptr[i + 1] = out_row_splits_ptr[i] +
+                                    row_splits_ptr[j + 1] - row_splits_ptr[j];
+    }
+
+    Tensor gather_indices =
+            Tensor::Empty({out_row_splits_ptr[num_queries]}, Int64, host);
+    int64_t *gather_indices_ptr = gather_indices.GetDataPtr<int64_t>();
+    ParallelFor(host, num_queries, [&](int64_t i) {
+        const int64_t src = row_splits_ptr[sorted_pos[i]];
+        for (int64_t k = out_row_splits_ptr[i]; k < out_row_splits_ptr[i + 1];
+             ++k) {
+            gather_indices_ptr[k] = src + k - out_row_splits_ptr[i];
+        }
+    });
+
+    gather_indices = gather_indices.To(device);
+    neighbors_index = neighbors_index.IndexGet({gather_indices});
+    neighbors_distance = neighbors_distance.IndexGet({gather_indices});
+    neighbors_row_splits = out_row_splits.To(device);
+}
+
+/// Restores the input order of the rows of a hybrid search result that was
+/// computed for queries sorted with \p queries_order.
+Tensor RestoreQueryOrder(const Tensor &queries_order, const Tensor &rows) {
+    Tensor restored = Tensor::Empty(rows.GetShape(), rows.GetDtype(),
+                                    rows.GetDevice());
+    restored.IndexSet({queries_order}, rows);
+    return restored;
+}
+
+}  // namespace
+
+FixedRadiusIndex::FixedRadiusIndex(MortonOrder morton_order)
+    : morton_order_(morton_order){};
 
 FixedRadiusIndex::FixedRadiusIndex(const Tensor &dataset_points,
-                                   double radius) {
+                                   double radius,
+                                   MortonOrder morton_order)
+    : morton_order_(morton_order) {
     AssertTensorDtypes(dataset_points, {Float32, Float64});
     SetTensorData(dataset_points, radius);
 };
@@ -71,6 +138,19 @@ bool FixedRadiusIndex::SetTensorData(const Tensor &dataset_points,
     dataset_points_ = dataset_points.Contiguous();
     points_row_splits_ = points_row_splits.Contiguous();
 
+    if (morton_order_ == MortonOrder::None) {
+        ordered_points_ = dataset_points_;
+        points_order_ = Tensor();
+    } else {
+        // Sort with the cell size of the hash table, so that the points of
+        // each cell are contiguous.
+        Tensor order = ComputeMortonOrder(dataset_points_, points_row_splits_,
+                                          2 * radius);
+        ordered_points_ = dataset_points_.IndexGet({order});
+        points_order_ = order.Append(
+                Tensor::Full({1}, -1, Int64, dataset_points_.GetDevice()));
+    }
+
     const int64_t num_dataset_points = GetDatasetSize();
     const int64_t num_batch = points_row_splits.GetShape()[0] - 1;
     const Device device = GetDevice();
@@ -95,7 +175,7 @@ bool FixedRadiusIndex::SetTensorData(const Tensor &dataset_points,
             Tensor::Empty({hash_table_splits.back() + 1}, UInt32, device);
 
 #define BUILD_PARAMETERS                                             \
-    dataset_points_, radius, points_row_splits_, hash_table_splits_, \
+    ordered_points_, radius, points_row_splits_, hash_table_splits_, \
             hash_table_index_, hash_table_cell_splits_
 
 #define CALL_BUILD(type, fn)                \
@@ -159,12 +239,17 @@ std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
 
     Tensor query_points_ = query_points.Contiguous();
     Tensor queries_row_splits_ = queries_row_splits.Contiguous();
+    Tensor queries_order;
+    if (morton_order_ == MortonOrder::PointsAndQueries) {
+        std::tie(query_points_, queries_order) =
+                SortQueries(query_points_, queries_row_splits_, radius);
+    }
 
     Tensor neighbors_index, neighbors_distance;
     Tensor neighbors_row_splits = Tensor({num_query_points + 1}, Int64, device);
 
 #define RADIUS_PARAMETERS                                               \
-    dataset_points_, query_points_, radius, points_row_splits_,         \
+    ordered_points_, query_points_, radius, points_row_splits_,         \
             queries_row_splits_, hash_table_splits_, hash_table_index_, \
             hash_table_cell_splits_, Metric::L2, false, true, sort,     \
             neighbors_index, neighbors_row_splits, neighbors_distance
@@ -188,6 +273,15 @@ std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
         CALL_RADIUS(double, FixedRadiusSearchCPU)
     }
 
+    if (morton_order_ != MortonOrder::None) {
+        neighbors_index = points_order_.IndexGet({neighbors_index.To(Int64)})
+                                  .To(neighbors_index.GetDtype());
+    }
+    if (morton_order_ == MortonOrder::PointsAndQueries) {
+        RestoreQueryOrder(queries_order, neighbors_index, neighbors_distance,
+                          neighbors_row_splits);
+    }
+
     return std::make_tuple(neighbors_index, neighbors_distance,
                            neighbors_row_splits);
 };
@@ -231,11 +325,16 @@ std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchHybrid(
 
     Tensor query_points_ = query_points.Contiguous();
     Tensor queries_row_splits_ = queries_row_splits.Contiguous();
+    Tensor queries_order;
+    if (morton_order_ == MortonOrder::PointsAndQueries) {
+        std::tie(query_points_, queries_order) =
+                SortQueries(query_points_, queries_row_splits_, radius);
+    }
 
     Tensor neighbors_index, neighbors_distance, neighbors_count;
 
 #define HYBRID_PARAMETERS                                                \
-    dataset_points_, query_points_, radius, max_knn, points_row_splits_, \
+    ordered_points_, query_points_, radius, max_knn, points_row_splits_, \
             queries_row_splits_, hash_table_splits_, hash_table_index_,  \
             hash_table_cell_splits_, Metric::L2, neighbors_index,        \
             neighbors_count, neighbors_distance
@@ -259,9 +358,31 @@ std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchHybrid(
         CALL_HYBRID(double, HybridSearchCPU)
     }
 
-    return std::make_tuple(neighbors_index.View({num_query_points, max_knn}),
-                           neighbors_distance.View({num_query_points, max_knn}),
-                           neighbors_count.View({num_query_points}));
+    neighbors_index = neighbors_index.View({num_query_points, max_knn});
+    neighbors_distance = neighbors_distance.View({num_query_points, max_knn});
+    neighbors_count = neighbors_count.View({num_query_points});
+    if (morton_order_ != MortonOrder::None) {
+        neighbors_index = points_order_.IndexGet({neighbors_index.To(Int64)})
+                                  .To(neighbors_index.GetDtype());
+    }
+    if (morton_order_ == MortonOrder::PointsAndQueries) {
+        neighbors_index = RestoreQueryOrder(queries_order, neighbors_index);
+        neighbors_distance =
+                RestoreQueryOrder(queries_order, neighbors_distance);
+        neighbors_count = RestoreQueryOrder(queries_order, neighbors_count);
+    }
+
+    return std::make_tuple(neighbors_index, neighbors_distance,
+                           neighbors_count);
+}
+
+std::pair<Tensor, Tensor> FixedRadiusIndex::SortQueries(
+        const Tensor &query_points,
+        const Tensor &queries_row_splits,
+        double radius) const {
+    Tensor order =
+            ComputeMortonOrder(query_points, queries_row_splits, 2 * radius);
+    return std::make_pair(query_points.IndexGet({order}), order);
 }
 
 }  // namespace nns
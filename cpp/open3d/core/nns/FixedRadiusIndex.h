@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <utility>
 #include <vector>
 
 #include "open3d/core/Dtype.h"
@@ -395,19 +396,39 @@ void HybridSearchCUDA(const Tensor& points,
                       Tensor& neighbors_distance);
 #endif
 
+/// Memory order of the points that FixedRadiusIndex works on.
+enum class MortonOrder {
+    None,             ///< Points and queries are used in input order.
+    Points,           ///< Dataset points are stored in Morton order.
+    PointsAndQueries  ///< Queries are also processed in Morton order.
+};
+
 /// \class FixedRadiusIndex
 ///
 /// \brief FixedRadiusIndex for nearest neighbor range search.
+///
+/// With MortonOrder::Points, the dataset points are sorted along a Z-order
+/// curve when the index is built, so that the points of neighboring hash cells
+/// are close in memory. With MortonOrder::PointsAndQueries, the queries of each
+/// search are sorted as well, so that consecutive queries visit the same cells.
+/// This helps for inputs without spatial coherence, e.g. merged LiDAR sweeps.
+/// In both cases the returned indices refer to the input order of the dataset
+/// points and the results are returned in the input order of the queries.
 class FixedRadiusIndex : public NNSIndex {
 public:
     /// \brief Default Constructor.
-    FixedRadiusIndex();
+    ///
+    /// \param morton_order Memory order used for points and queries.
+    explicit FixedRadiusIndex(MortonOrder morton_order = MortonOrder::None);
 
     /// \brief Parameterized Constructor.
     ///
     /// \param dataset_points Provides a set of data points as Tensor for KDTree
     /// construction.
-    FixedRadiusIndex(const Tensor& dataset_points, double radius);
+    /// \param morton_order Memory order used for points and queries.
+    FixedRadiusIndex(const Tensor& dataset_points,
+                     double radius,
+                     MortonOrder morton_order = MortonOrder::None);
     ~FixedRadiusIndex();
     FixedRadiusIndex(const FixedRadiusIndex&) = delete;
     FixedRadiusIndex& operator=(const FixedRadiusIndex&) = delete;
@@ -462,6 +483,20 @@ public:
     const int64_t max_hash_tabls_size = 33554432;
 
 protected:
+    /// Sorts the queries of each batch item in Morton order. Returns the
+    /// sorted queries and the permutation as Int64 tensor.
+    std::pair<Tensor, Tensor> SortQueries(const Tensor& query_points,
+                                          const Tensor& queries_row_splits,
+                                          double radius) const;
+
+protected:
+    MortonOrder morton_order_;
+    /// Dataset points in the order of the hash table.
+    Tensor ordered_points_;
+    /// Maps positions in ordered_points_ to input indices. Holds an extra
+    /// trailing -1, so that -1 padding maps to itself with negative index
+    /// wrap-around. Unused for MortonOrder::None.
+    Tensor points_order_;
     Tensor points_row_splits_;
     Tensor hash_table_splits_;
     Tensor hash_table_cell_splits_;
@@ -28,7 +28,10 @@
 
 #include <tbb/parallel_for.h>
 
+#include <algorithm>
 #include <set>
+#include <utility>
+#include <vector>
 
 #include "open3d/core/Atomic.h"
 #include "open3d/core/nns/NeighborSearchCommon.h"
@@ -189,6 +192,117 @@ Eigen::Array<typename TDerived::Scalar, VECSIZE, 1> NeighborsDist(
     return dist;
 }
 
+/// Calls \p f(idx, dist) for every point within the search radius of the
+/// query position \p pos.
+///
+/// \tparam METRIC    The distance metric. One of L1, L2, Linf.
+///
+/// \tparam IGNORE_QUERY_POINT    If true then points with the same position
+///         as the query point are skipped.
+///
+/// \param threshold    The radius for L1 and Linf or the squared radius for
+///        L2. The distances passed to \p f are squared for L2 as well.
+template <class T, int METRIC, bool IGNORE_QUERY_POINT, class FUNC>
+void VisitNeighbors(const utility::MiniVec<T, 3>& pos,
+                    const T* const points,
+                    const T radius,
+                    const T threshold,
+                    const T inv_voxel_size,
+                    const size_t first_cell_idx,
+                    const size_t hash_table_size,
+                    const uint32_t* const hash_table_cell_splits,
+                    const uint32_t* const hash_table_index,
+                    FUNC f) {
+    using namespace open3d::utility;
+
+// number of elements for vectorization
+#define VECSIZE 8
+    typedef MiniVec<T, 3> Vec3_t;
+    typedef Eigen::Array<T, VECSIZE, 1> Vec_t;
+    typedef Eigen::Array<int32_t, VECSIZE, 1> Veci_t;
+
+    typedef Eigen::Array<T, 3, 1> Pos_t;
+    typedef Eigen::Array<T, VECSIZE, 3> Poslist_t;
+
+    std::set<size_t> bins_to_visit;
+
+    auto voxel_index = ComputeVoxelIndex(pos, inv_voxel_size);
+    size_t hash = SpatialHash(voxel_index) % hash_table_size;
+
+    bins_to_visit.insert(first_cell_idx + hash);
+
+    for (int dz = -1; dz <= 1; dz += 2)
+        for (int dy = -1; dy <= 1; dy += 2)
+            for (int dx = -1; dx <= 1; dx += 2) {
+                Vec3_t p = pos + radius * Vec3_t(T(dx), T(dy), T(dz));
+                voxel_index = ComputeVoxelIndex(p, inv_voxel_size);
+                hash = SpatialHash(voxel_index) % hash_table_size;
+                bins_to_visit.insert(first_cell_idx + hash);
+            }
+
+    const Pos_t pos_arr(pos[0], pos[1], pos[2]);
+    Poslist_t xyz;
+    Veci_t idx_vec;
+    int vec_i = 0;
+
+    for (size_t bin : bins_to_visit) {
+        size_t begin_idx = hash_table_cell_splits[bin];
+        size_t end_idx = hash_table_cell_splits[bin + 1];
+
+        for (size_t j = begin_idx; j < end_idx; ++j) {
+            int64_t idx = hash_table_index[j];
+            if (IGNORE_QUERY_POINT) {
+                if (points[idx * 3 + 0] == pos[0] &&
+                    points[idx * 3 + 1] == pos[1] &&
+                    points[idx * 3 + 2] == pos[2])
+                    continue;
+            }
+            xyz(vec_i, 0) = points[idx * 3 + 0];
+            xyz(vec_i, 1) = points[idx * 3 + 1];
+            xyz(vec_i, 2) = points[idx * 3 + 2];
+            idx_vec(vec_i) = idx;
+            ++vec_i;
+            if (VECSIZE == vec_i) {
+                Vec_t dist =
+                        NeighborsDist<METRIC, Pos_t, VECSIZE>(pos_arr, xyz);
+                for (int k = 0; k < VECSIZE; ++k) {
+                    if (dist[k] <= threshold) {
+                        f(idx_vec[k], dist[k]);
+                    }
+                }
+                vec_i = 0;
+            }
+        }
+    }
+    // process the tail
+    if (vec_i) {
+        Vec_t dist = NeighborsDist<METRIC, Pos_t, VECSIZE>(pos_arr, xyz);
+        for (int k = 0; k < vec_i; ++k) {
+            if (dist[k] <= threshold) {
+                f(idx_vec[k], dist[k]);
+            }
+        }
+    }
+#undef VECSIZE
+}
+
+/// Sorts the neighbors of one query by distance and keeps at most
+/// \p max_neighbors of them. Without \p sort, the first \p max_neighbors
+/// neighbors are kept. A \p max_neighbors value of 0 keeps all neighbors.
+template <class T>
+void SelectNeighbors(std::vector<std::pair<T, int32_t>>& neighbors,
+                     const bool sort,
+                     const size_t max_neighbors) {
+    const size_t num_keep =
+            max_neighbors ? std::min(neighbors.size(), max_neighbors)
+                          : neighbors.size();
+    if (sort) {
+        std::partial_sort(neighbors.begin(), neighbors.begin() + num_keep,
+                          neighbors.end());
+    }
+    neighbors.resize(num_keep);
+}
+
 /// Implementation of FixedRadiusSearchCPU with template params for metrics
 /// and boolean options.
 template <class T,
@@ -210,18 +324,13 @@ void _FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
                            const size_t hash_table_cell_splits_size,
                            const uint32_t* const hash_table_cell_splits,
                            const uint32_t* const hash_table_index,
-                           OUTPUT_ALLOCATOR& output_allocator) {
+                           OUTPUT_ALLOCATOR& output_allocator,
+                           const bool sort,
+                           const size_t max_neighbors,
+                           const bool single_pass) {
     using namespace open3d::utility;
-
-// number of elements for vectorization
-#define VECSIZE 8
     typedef MiniVec<T, 3> Vec3_t;
-    typedef Eigen::Array<T, VECSIZE, 1> Vec_t;
-    typedef Eigen::Array<int32_t, VECSIZE, 1> Veci_t;
-
-    typedef Eigen::Array<T, 3, 1> Pos_t;
-    typedef Eigen::Array<T, VECSIZE, 3> Poslist_t;
-    typedef Eigen::Array<bool, VECSIZE, 1> Result_t;
+    typedef std::pair<T, int32_t> Neighbor_t;
 
     const int batch_size = points_row_splits_size - 1;
 
@@ -244,6 +353,133 @@ void _FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
     const T voxel_size = 2 * radius;
     const T inv_voxel_size = 1 / voxel_size;
 
+    // sorting and capping need all neighbors of a query before writing them
+    const bool select_neighbors = sort || max_neighbors > 0;
+
+    auto visit_neighbors = [&](size_t query_idx, int batch_idx, auto f) {
+        const size_t hash_table_size = hash_table_splits[batch_idx + 1] -
+                                       hash_table_splits[batch_idx];
+        const size_t first_cell_idx = hash_table_splits[batch_idx];
+        Vec3_t pos(queries + query_idx * 3);
+        VisitNeighbors<T, METRIC, IGNORE_QUERY_POINT>(
+                pos, points, radius, threshold, inv_voxel_size,
+                first_cell_idx, hash_table_size, hash_table_cell_splits,
+                hash_table_index, f);
+    };
+
+    // output pointers, allocated once the total number of neighbors is known
+    int32_t* indices_ptr;
+    T* distances_ptr;
+    auto alloc_output = [&](size_t num_indices) {
+        output_allocator.AllocIndices(&indices_ptr, num_indices);
+        if (RETURN_DISTANCES)
+            output_allocator.AllocDistances(&distances_ptr, num_indices);
+        else
+            output_allocator.AllocDistances(&distances_ptr, 0);
+
+        query_neighbors_row_splits[0] = 0;
+        InclusivePrefixSum(query_neighbors_row_splits + 1,
+                           query_neighbors_row_splits + num_queries + 1,
+                           query_neighbors_row_splits + 1);
+    };
+
+    if (single_pass) {
+        // Each chunk of queries gathers its neighbors into its own buffers.
+        // The buffers are copied to the output after the prefix sum over the
+        // neighbor counts. This visits the hash table only once per query at
+        // the cost of holding the results twice for a short time.
+        struct Chunk {
+            size_t begin;
+            size_t end;
+            std::vector<int32_t> indices;
+            std::vector<T> distances;
+        };
+        const size_t chunk_size = 256;
+        std::vector<Chunk> chunks;
+        std::vector<int> chunk_batch_idx;
+        for (int i = 0; i < batch_size; ++i) {
+            for (int64_t begin = queries_row_splits[i];
+                 begin < queries_row_splits[i + 1]; begin += chunk_size) {
+                Chunk chunk;
+                chunk.begin = begin;
+                chunk.end = std::min<size_t>(begin + chunk_size,
+                                             queries_row_splits[i + 1]);
+                chunks.push_back(std::move(chunk));
+                chunk_batch_idx.push_back(i);
+            }
+        }
+
+        tbb::parallel_for(
+                tbb::blocked_range<size_t>(0, chunks.size(), 1),
+                [&](const tbb::blocked_range<size_t>& r) {
+                    std::vector<Neighbor_t> neighbors;
+                    for (size_t c = r.begin(); c != r.end(); ++c) {
+                        Chunk& chunk = chunks[c];
+                        for (size_t i = chunk.begin; i != chunk.end; ++i) {
+                            size_t neighbors_count = 0;
+                            if (select_neighbors) {
+                                neighbors.clear();
+                                visit_neighbors(
+                                        i, chunk_batch_idx[c],
+                                        [&](int32_t idx, T dist) {
+                                            neighbors.emplace_back(dist, idx);
+                                        });
+                                SelectNeighbors(neighbors, sort,
+                                                max_neighbors);
+                                for (const Neighbor_t& n : neighbors) {
+                                    chunk.indices.push_back(n.second);
+                                    if (RETURN_DISTANCES) {
+                                        chunk.distances.push_back(n.first);
+                                    }
+                                }
+                                neighbors_count = neighbors.size();
+                            } else {
+                                visit_neighbors(
+                                        i, chunk_batch_idx[c],
+                                        [&](int32_t idx, T dist) {
+                                            chunk.indices.push_back(idx);
+                                            if (RETURN_DISTANCES) {
+                                                chunk.distances.push_back(
+                                                        dist);
+                                            }
+                                            ++neighbors_count;
+                                        });
+                            }
+                            // note the +1
+                            query_neighbors_row_splits[i + 1] =
+                                    neighbors_count;
+                        }
+                    }
+                });
+
+        size_t num_indices = 0;
+        for (const Chunk& chunk : chunks) {
+            num_indices += chunk.indices.size();
+        }
+        alloc_output(num_indices);
+
+        tbb::parallel_for(
+                tbb::blocked_range<size_t>(0, chunks.size(), 1),
+                [&](const tbb::blocked_range<size_t>& r) {
+                    for (size_t c = r.begin(); c != r.end(); ++c) {
+                        Chunk& chunk = chunks[c];
+                        const int64_t offset =
+                                query_neighbors_row_splits[chunk.begin];
+                        std::copy(chunk.indices.begin(), chunk.indices.end(),
+                                  indices_ptr + offset);
+                        if (RETURN_DISTANCES) {
+                            std::copy(chunk.distances.begin(),
+                                      chunk.distances.end(),
+                                      distances_ptr + offset);
+                        }
+                        // release the memory early
+                        std::vector<int32_t>().swap(chunk.indices);
+                        std::vector<T>().swap(chunk.distances);
+                    }
+                });
+        return;
+    }
+
     // counts the number of indices we have to return. This is the number of all
     // neighbors we find.
     size_t num_indices = 0;
@@ -251,82 +487,20 @@ void _FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
     // count the number of neighbors for all query points and update num_indices
     // and populate query_neighbors_row_splits with the number of neighbors
     // for each query point
-    for (int i = 0; i < batch_size; ++i) {
-        const size_t hash_table_size =
-                hash_table_splits[i + 1] - hash_table_splits[i];
-        const size_t first_cell_idx = hash_table_splits[i];
+    for (int b = 0; b < batch_size; ++b) {
         tbb::parallel_for(
-                tbb::blocked_range<size_t>(queries_row_splits[i],
-                                           queries_row_splits[i + 1]),
+                tbb::blocked_range<size_t>(queries_row_splits[b],
+                                           queries_row_splits[b + 1]),
                 [&](const tbb::blocked_range<size_t>& r) {
                     size_t num_indices_local = 0;
                     for (size_t i = r.begin(); i != r.end(); ++i) {
                         size_t neighbors_count = 0;
-
-                        Vec3_t pos(queries + i * 3);
-
-                        std::set<size_t> bins_to_visit;
-
-                        auto voxel_index =
-                                ComputeVoxelIndex(pos, inv_voxel_size);
-                        size_t hash =
-                                SpatialHash(voxel_index) % hash_table_size;
-
-                        bins_to_visit.insert(first_cell_idx + hash);
-
-                        for (int dz = -1; dz <= 1; dz += 2)
-                            for (int dy = -1; dy <= 1; dy += 2)
-                                for (int dx = -1; dx <= 1; dx += 2) {
-                                    Vec3_t p =
-                                            pos + radius * Vec3_t(T(dx), T(dy),
-                                                                  T(dz));
-                                    voxel_index = ComputeVoxelIndex(
-                                            p, inv_voxel_size);
-                                    hash = SpatialHash(voxel_index) %
-                                           hash_table_size;
-                                    bins_to_visit.insert(first_cell_idx + hash);
-                                }
-
-                        Poslist_t xyz;
-                        int vec_i = 0;
-
-                        for (size_t bin : bins_to_visit) {
-                            size_t begin_idx = hash_table_cell_splits[bin];
-                            size_t end_idx = hash_table_cell_splits[bin + 1];
-
-                            for (size_t j = begin_idx; j < end_idx; ++j) {
-                                uint32_t idx = hash_table_index[j];
-                                if (IGNORE_QUERY_POINT) {
-                                    if (points[idx * 3 + 0] == pos[0] &&
-                                        points[idx * 3 + 1] == pos[1] &&
-                                        points[idx * 3 + 2] == pos[2])
-                                        continue;
-                                }
-                                xyz(vec_i, 0) = points[idx * 3 + 0];
-                                xyz(vec_i, 1) = points[idx * 3 + 1];
-                                xyz(vec_i, 2) = points[idx * 3 + 2];
-                                ++vec_i;
-                                if (VECSIZE == vec_i) {
-                                    Pos_t pos_arr(pos[0], pos[1], pos[2]);
-                                    Vec_t dist = NeighborsDist<METRIC, Pos_t,
-                                                               VECSIZE>(pos_arr,
-                                                                        xyz);
-                                    Result_t test_result = dist <= threshold;
-                                    neighbors_count += test_result.count();
-                                    vec_i = 0;
-                                }
-                            }
-                        }
-                        // process the tail
-                        if (vec_i) {
-                            Pos_t pos_arr(pos[0], pos[1], pos[2]);
-                            Vec_t dist = NeighborsDist<METRIC, Pos_t, VECSIZE>(
-                                    pos_arr, xyz);
-                            Result_t test_result = dist <= threshold;
-                            for (int k = 0; k < vec_i; ++k) {
-                                neighbors_count += int(test_result(k));
-                            }
-                            vec_i = 0;
+                        visit_neighbors(i, b, [&](int32_t, T) {
+                            ++neighbors_count;
+                        });
+                        if (max_neighbors > 0) {
+                            neighbors_count =
+                                    std::min(neighbors_count, max_neighbors);
                         }
                         num_indices_local += neighbors_count;
                         // note the +1
@@ -338,130 +512,42 @@ void _FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
                 });
     }
 
-    // Allocate output arrays
-    // output for the indices to the neighbors
-    int32_t* indices_ptr;
-    output_allocator.AllocIndices(&indices_ptr, num_indices);
-
-    // output for the distances
-    T* distances_ptr;
-    if (RETURN_DISTANCES)
-        output_allocator.AllocDistances(&distances_ptr, num_indices);
-    else
-        output_allocator.AllocDistances(&distances_ptr, 0);
-
-    query_neighbors_row_splits[0] = 0;
-    InclusivePrefixSum(query_neighbors_row_splits + 1,
-                       query_neighbors_row_splits + num_queries + 1,
-                       query_neighbors_row_splits + 1);
+    alloc_output(num_indices);
 
     // now populate the indices_ptr and distances_ptr array
-    for (int i = 0; i < batch_size; ++i) {
-        const size_t hash_table_size =
-                hash_table_splits[i + 1] - hash_table_splits[i];
-        const size_t first_cell_idx = hash_table_splits[i];
+    for (int b = 0; b < batch_size; ++b) {
         tbb::parallel_for(
-                tbb::blocked_range<size_t>(queries_row_splits[i],
-                                           queries_row_splits[i + 1]),
+                tbb::blocked_range<size_t>(queries_row_splits[b],
+                                           queries_row_splits[b + 1]),
                 [&](const tbb::blocked_range<size_t>& r) {
+                    std::vector<Neighbor_t> neighbors;
                     for (size_t i = r.begin(); i != r.end(); ++i) {
-                        size_t neighbors_count = 0;
-
                         size_t indices_offset = query_neighbors_row_splits[i];
-
-                        Vec3_t pos(queries[i * 3 + 0], queries[i * 3 + 1],
-                                   queries[i * 3 + 2]);
-
-                        std::set<size_t> bins_to_visit;
-
-                        auto voxel_index =
-                                ComputeVoxelIndex(pos, inv_voxel_size);
-                        size_t hash =
-                                SpatialHash(voxel_index) % hash_table_size;
-
-                        bins_to_visit.insert(first_cell_idx + hash);
-
-                        for (int dz = -1; dz <= 1; dz += 2)
-                            for (int dy = -1; dy <= 1; dy += 2)
-                                for (int dx = -1; dx <= 1; dx += 2) {
-                                    Vec3_t p =
-                                            pos + radius * Vec3_t(T(dx), T(dy),
-                                                                  T(dz));
-                                    voxel_index = ComputeVoxelIndex(
-                                            p, inv_voxel_size);
-                                    hash = SpatialHash(voxel_index) %
-                                           hash_table_size;
-                                    bins_to_visit.insert(first_cell_idx + hash);
-                                }
-
-                        Poslist_t xyz;
-                        Veci_t idx_vec;
-                        int vec_i = 0;
-
-                        for (size_t bin : bins_to_visit) {
-                            size_t begin_idx = hash_table_cell_splits[bin];
-                            size_t end_idx = hash_table_cell_splits[bin + 1];
-
-                            for (size_t j = begin_idx; j < end_idx; ++j) {
-                                int64_t idx = hash_table_index[j];
-                                if (IGNORE_QUERY_POINT) {
-                                    if (points[idx * 3 + 0] == pos[0] &&
-                                        points[idx * 3 + 1] == pos[1] &&
-                                        points[idx * 3 + 2] == pos[2])
-                                        continue;
-                                }
-                                xyz(vec_i, 0) = points[idx * 3 + 0];
-                                xyz(vec_i, 1) = points[idx * 3 + 1];
-                                xyz(vec_i, 2) = points[idx * 3 + 2];
-                                idx_vec(vec_i) = idx;
-                                ++vec_i;
-                                if (VECSIZE == vec_i) {
-                                    Pos_t pos_arr(pos[0], pos[1], pos[2]);
-                                    Vec_t dist = NeighborsDist<METRIC, Pos_t,
-                                                               VECSIZE>(pos_arr,
-                                                                        xyz);
-                                    Result_t test_result = dist <= threshold;
-                                    for (int k = 0; k < vec_i; ++k) {
-                                        if (test_result(k)) {
-                                            indices_ptr[indices_offset +
-                                                        neighbors_count] =
-                                                    idx_vec[k];
-                                            if (RETURN_DISTANCES) {
-                                                distances_ptr[indices_offset +
-                                                              neighbors_count] =
-                                                        dist[k];
-                                            }
-                                        }
-                                        neighbors_count += int(test_result(k));
-                                    }
-                                    vec_i = 0;
+                        if (select_neighbors) {
+                            neighbors.clear();
+                            visit_neighbors(i, b, [&](int32_t idx, T dist) {
+                                neighbors.emplace_back(dist, idx);
+                            });
+                            SelectNeighbors(neighbors, sort, max_neighbors);
+                            for (const Neighbor_t& n : neighbors) {
+                                indices_ptr[indices_offset] = n.second;
+                                if (RETURN_DISTANCES) {
+                                    distances_ptr[indices_offset] = n.first;
                                 }
+                                ++indices_offset;
                             }
-                        }
-                        // process the tail
-                        if (vec_i) {
-                            Pos_t pos_arr(pos[0], pos[1], pos[2]);
-                            Vec_t dist = NeighborsDist<METRIC, Pos_t, VECSIZE>(
-                                    pos_arr, xyz);
-                            Result_t test_result = dist <= threshold;
-                            for (int k = 0; k < vec_i; ++k) {
-                                if (test_result(k)) {
-                                    indices_ptr[indices_offset +
-                                                neighbors_count] = idx_vec[k];
-                                    if (RETURN_DISTANCES) {
-                                        distances_ptr[indices_offset +
-                                                      neighbors_count] =
-                                                dist[k];
-                                    }
+                        } else {
+                            visit_neighbors(i, b, [&](int32_t idx, T dist) {
+                                indices_ptr[indices_offset] = idx;
+                                if (RETURN_DISTANCES) {
+                                    distances_ptr[indices_offset] = dist;
                                 }
-                                neighbors_count += int(test_result(k));
-                            }
-                            vec_i = 0;
+                                ++indices_offset;
+                            });
                         }
                     }
                 });
     }
-#undef VECSIZE
 }
 
 }  // namespace
@@ -544,6 +630,20 @@ void _FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
 ///         elements. Both functions must accept the argument size==0.
 ///         In this case ptr does not need to be set.
 ///
+/// \param sort    If true then the neighbors of each query are sorted in
+///        ascending order of distance.
+///
+/// \param max_neighbors    The maximum number of neighbors returned for each
+///        query. With \p sort these are the nearest neighbors, otherwise an
+///        arbitrary subset. 0 returns all neighbors.
+///
+/// \param single_pass    If true then the hash table is visited once per
+///        query and the neighbors are gathered in per-chunk buffers, which
+///        are merged after a prefix sum over the counts. If false then a
+///        first pass counts the neighbors and a second pass writes them in
+///        place, which needs no intermediate buffers but computes all
+///        distances twice.
+///
 template <class T, class OUTPUT_ALLOCATOR>
 void FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
                           const size_t num_points,
@@ -562,7 +662,10 @@ void FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
                           const Metric metric,
                           const bool ignore_query_point,
                           const bool return_distances,
-                          OUTPUT_ALLOCATOR& output_allocator) {
+                          OUTPUT_ALLOCATOR& output_allocator,
+                          const bool sort = false,
+                          const size_t max_neighbors = 0,
+                          const bool single_pass = true) {
     // Dispatch all template parameter combinations
 
 #define FN_PARAMETERS                                                       \
@@ -570,7 +673,8 @@ void FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
             radius, points_row_splits_size, points_row_splits,              \
             queries_row_splits_size, queries_row_splits, hash_table_splits, \
             hash_table_cell_splits_size, hash_table_cell_splits,            \
-            hash_table_index, output_allocator
+            hash_table_index, output_allocator, sort, max_neighbors,        \
+            single_pass
 
 #define CALL_TEMPLATE(METRIC, IGNORE_QUERY_POINT, RETURN_DISTANCES)            \
     if (METRIC == metric && IGNORE_QUERY_POINT == ignore_query_point &&        \
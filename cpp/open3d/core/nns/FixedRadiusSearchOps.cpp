@@ -25,6 +25,10 @@
 // ----------------------------------------------------------------------------
 //
 
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/core/nns/FixedRadiusIndex.h"
 #include "open3d/core/nns/FixedRadiusSearchImpl.h"
@@ -83,7 +87,7 @@ void FixedRadiusSearchCPU(const Tensor& points,
             hash_table_cell_splits.GetShape()[0],
             hash_table_cell_splits.GetDataPtr<uint32_t>(),
             hash_table_index.GetDataPtr<uint32_t>(), metric, ignore_query_point,
-            return_distances, output_allocator);
+            return_distances, output_allocator, sort);
 
     neighbors_index = output_allocator.NeighborsIndex();
     neighbors_distance = output_allocator.NeighborsDistance();
@@ -103,7 +107,54 @@ void HybridSearchCPU(const Tensor& points,
                      Tensor& neighbors_index,
                      Tensor& neighbors_count,
                      Tensor& neighbors_distance) {
-    utility::LogError("Not implemented.");
+    Device device = points.GetDevice();
+    NeighborSearchAllocator<T> output_allocator(device);
+    const int64_t num_queries = queries.GetShape()[0];
+    Tensor neighbors_row_splits =
+            Tensor::Empty({num_queries + 1}, Int64, device);
+
+    // The radius search keeps the max_knn nearest neighbors in ascending
+    // order of distance, which are then padded to max_knn per query.
+    open3d::core::nns::impl::FixedRadiusSearchCPU(
+            neighbors_row_splits.GetDataPtr<int64_t>(), points.GetShape()[0],
+            points.GetDataPtr<T>(), num_queries, queries.GetDataPtr<T>(),
+            T(radius), points_row_splits.GetShape()[0],
+            points_row_splits.GetDataPtr<int64_t>(),
+            queries_row_splits.GetShape()[0],
+            queries_row_splits.GetDataPtr<int64_t>(),
+            hash_table_splits.GetDataPtr<uint32_t>(),
+            hash_table_cell_splits.GetShape()[0],
+            hash_table_cell_splits.GetDataPtr<uint32_t>(),
+            hash_table_index.GetDataPtr<uint32_t>(), metric,
+            /*ignore_query_point=*/false, /*return_distances=*/true,
+            output_allocator, /*sort=*/true, max_knn);
+
+    neighbors_index = Tensor::Full({num_queries * max_knn}, -1, Int32, device);
+    neighbors_distance = Tensor::Zeros({num_queries * max_knn},
+                                       Dtype::FromType<T>(), device);
+    neighbors_count = Tensor::Empty({num_queries}, Int32, device);
+
+    const int64_t* row_splits_ptr = neighbors_row_splits.GetDataPtr<int64_t>();
+    const int32_t* ragged_index_ptr = output_allocator.IndicesPtr();
+    const T* ragged_distance_ptr = output_allocator.DistancesPtr();
+    int32_t* index_ptr = neighbors_index.GetDataPtr<int32_t>();
+    T* distance_ptr = neighbors_distance.GetDataPtr<T>();
+    int32_t* count_ptr = neighbors_count.GetDataPtr<int32_t>();
+    tbb::parallel_for(
+            tbb::blocked_range<int64_t>(0, num_queries),
+            [&](const tbb::blocked_range<int64_t>& r) {
+                for (int64_t i = r.begin(); i != r.end(); ++i) {
+                    const int64_t begin = row_splits_ptr[i];
+                    const int64_t count = row_splits_ptr[i + 1] - begin;
+                    std::copy(ragged_index_ptr + begin,
+                              ragged_index_ptr + begin + count,
+                              index_ptr + i * max_knn);
+                    std::copy(ragged_distance_ptr + begin,
+                              ragged_distance_ptr + begin + count,
+                              distance_ptr + i * max_knn);
+                    count_ptr[i] = int32_t(count);
+                }
+            });
 }
 
 #define INSTANTIATE_BUILD(T)                                                  \
@@ -0,0 +1,482 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/HnswIndex.h"
+
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+namespace {
+
+/// Seed for drawing the node levels, so that the graph of a dataset is
+/// reproducible up to the order of concurrent insertions.
+constexpr uint32_t kLevelSeed = 5489u;
+
+template <class T>
+inline T SquaredDistance(const T *const a, const T *const b, int64_t dim) {
+    T sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+    int64_t i = 0;
+    for (; i + 4 <= dim; i += 4) {
+        const T d0 = a[i] - b[i];
+        const T d1 = a[i + 1] - b[i + 1];
+        const T d2 = a[i + 2] - b[i + 2];
+        const T d3 = a[i + 3] - b[i + 3];
+        sum0 += d0 * d0;
+        sum1 += d1 * d1;
+        sum2 += d2 * d2;
+        sum3 += d3 * d3;
+    }
+    for (; i < dim; ++i) {
+        const T d = a[i] - b[i];
+        sum0 += d * d;
+    }
+    return (sum0 + sum1) + (sum2 + sum3);
+}
+
+/// Visited flags for one graph traversal per thread. Bumping the tag clears
+/// all flags at once.
+class VisitedSet {
+public:
+    void Reset(size_t size) {
+        if (marks_.size() < size) {
+            marks_.assign(size, 0);
+            tag_ = 0;
+        }
+        if (++tag_ == 0) {
+            std::fill(marks_.begin(), marks_.end(), 0);
+            tag_ = 1;
+        }
+    }
+
+    /// Returns false if \p node was already visited.
+    bool Insert(int32_t node) {
+        if (marks_[node] == tag_) {
+            return false;
+        }
+        marks_[node] = tag_;
+        return true;
+    }
+
+private:
+    std::vector<uint32_t> marks_;
+    uint32_t tag_ = 0;
+};
+
+VisitedSet &GetVisitedSet(size_t size) {
+    thread_local VisitedSet visited;
+    visited.Reset(size);
+    return visited;
+}
+
+}  // namespace
+
+HnswIndex::HnswIndex(int max_degree, int ef_construction, int ef_search)
+    : max_degree_(max_degree),
+      ef_construction_(ef_construction),
+      ef_search_(ef_search) {
+    if (max_degree < 2) {
+        utility::LogError("max_degree should be at least 2, but got {}.",
+                          max_degree);
+    }
+    if (ef_construction <= 0) {
+        utility::LogError("ef_construction should be larger than 0.");
+    }
+    SetEfSearch(ef_search);
+}
+
+HnswIndex::HnswIndex(const Tensor &dataset_points,
+                     int max_degree,
+                     int ef_construction,
+                     int ef_search)
+    : HnswIndex(max_degree, ef_construction, ef_search) {
+    SetTensorData(dataset_points);
+}
+
+HnswIndex::~HnswIndex() {}
+
+void HnswIndex::SetEfSearch(int ef_search) {
+    if (ef_search <= 0) {
+        utility::LogError("ef_search should be larger than 0.");
+    }
+    ef_search_ = ef_search;
+}
+
+bool HnswIndex::SetTensorData(const Tensor &dataset_points) {
+    AssertTensorDtypes(dataset_points, {Float32, Float64});
+    AssertTensorDevice(dataset_points, Device("CPU:0"));
+    if (dataset_points.NumDims() != 2) {
+        utility::LogError(
+                "dataset_points must be 2D matrix, with shape "
+                "{n_dataset_points, d}.");
+    }
+    if (dataset_points.GetShape(0) > std::numeric_limits<int32_t>::max()) {
+        utility::LogError("HnswIndex supports at most {} points.",
+                          std::numeric_limits<int32_t>::max());
+    }
+
+    dataset_points_ = dataset_points.Contiguous();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+        BuildGraph<scalar_t>();
+    });
+    return true;
+}
+
+std::pair<Tensor, Tensor> HnswIndex::SearchKnn(const Tensor &query_points,
+                                               int knn) const {
+    return SearchKnn(query_points, knn, ef_search_);
+}
+
+std::pair<Tensor, Tensor> HnswIndex::SearchKnn(const Tensor &query_points,
+                                               int knn,
+                                               int ef_search) const {
+    const Dtype dtype = GetDtype();
+    const Device device = GetDevice();
+
+    AssertTensorDevice(query_points, device);
+    AssertTensorDtype(query_points, dtype);
+    AssertTensorShape(query_points, {utility::nullopt, GetDimension()});
+
+    if (knn <= 0) {
+        utility::LogError("knn should be larger than 0.");
+    }
+    if (ef_search <= 0) {
+        utility::LogError("ef_search should be larger than 0.");
+    }
+
+    const int64_t num_neighbors = std::min(
+            static_cast<int64_t>(GetDatasetSize()), static_cast<int64_t>(knn));
+    const int64_t num_query_points = query_points.GetShape(0);
+
+    Tensor indices = Tensor::Empty({num_query_points, num_neighbors}, Int32,
+                                   device);
+    Tensor distances = Tensor::Empty({num_query_points, num_neighbors}, dtype,
+                                     device);
+    if (num_neighbors == 0) {
+        return std::make_pair(indices, distances);
+    }
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const Tensor query_contiguous = query_points.Contiguous();
+        SearchGraph<scalar_t>(query_contiguous.GetDataPtr<scalar_t>(),
+                              num_query_points, num_neighbors, ef_search,
+                              indices.GetDataPtr<int32_t>(),
+                              distances.GetDataPtr<scalar_t>());
+    });
+    return std::make_pair(indices, distances);
+}
+
+int32_t *HnswIndex::GetLinks(int32_t node, int level) {
+    if (level == 0) {
+        return base_links_.data() + int64_t(node) * (2 * max_degree_ + 1);
+    }
+    return upper_links_[node].data() + (level - 1) * (max_degree_ + 1);
+}
+
+const int32_t *HnswIndex::GetLinks(int32_t node, int level) const {
+    return const_cast<HnswIndex *>(this)->GetLinks(node, level);
+}
+
+template <class T>
+void HnswIndex::BuildGraph() {
+    const int64_t num_points = GetDatasetSize();
+
+    // Levels follow a geometric distribution, so that each level holds about
+    // 1 / max_degree_ of the nodes of the level below.
+    std::mt19937 gen(kLevelSeed);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    const double level_mult = 1.0 / std::log(static_cast<double>(max_degree_));
+    levels_.resize(num_points);
+    for (int &level : levels_) {
+        level = static_cast<int>(-std::log(1.0 - uniform(gen)) * level_mult);
+    }
+
+    base_links_.assign(num_points * (2 * max_degree_ + 1), 0);
+    upper_links_.assign(num_points, {});
+    for (int64_t i = 0; i < num_points; ++i) {
+        upper_links_[i].assign(levels_[i] * (max_degree_ + 1), 0);
+    }
+    if (num_points == 0) {
+        entry_point_ = -1;
+        max_level_ = -1;
+        return;
+    }
+
+    entry_point_ = 0;
+    max_level_ = levels_[0];
+    std::vector<std::mutex> locks(num_points);
+    std::mutex entry_point_lock;
+    tbb::parallel_for(tbb::blocked_range<int64_t>(1, num_points),
+                      [&](const tbb::blocked_range<int64_t> &r) {
+                          for (int64_t i = r.begin(); i != r.end(); ++i) {
+                              InsertNode<T>(static_cast<int32_t>(i), locks,
+                                            entry_point_lock);
+                          }
+                      });
+}
+
+template <class T>
+void HnswIndex::InsertNode(int32_t node,
+                           std::vector<std::mutex> &locks,
+                           std::mutex &entry_point_lock) {
+    const T *const points = dataset_points_.GetDataPtr<T>();
+    const int64_t dim = GetDimension();
+    const T *const query = points + node * dim;
+    const int level = levels_[node];
+
+    // A node that becomes the new entry point holds the lock until it is
+    // fully linked, so that no search starts above its links.
+    std::unique_lock<std::mutex> entry_lock(entry_point_lock);
+    const int32_t entry_point = entry_point_;
+    const int max_level = max_level_;
+    if (level <= max_level) {
+        entry_lock.unlock();
+    }
+
+    std::vector<Candidate<T>> entry_points = {
+            {SquaredDistance(query, points + entry_point * dim, dim),
+             entry_point}};
+    for (int l = max_level; l > level; --l) {
+        entry_points = SearchLevel(query, entry_points, 1, l, &locks);
+    }
+    for (int l = std::min(level, max_level); l >= 0; --l) {
+        std::vector<Candidate<T>> neighbors = SearchLevel(
+                query, entry_points, ef_construction_, l, &locks);
+        entry_points = neighbors;
+        neighbors.erase(std::remove_if(neighbors.begin(), neighbors.end(),
+                                       [node](const Candidate<T> &c) {
+                                           return c.second == node;
+                                       }),
+                        neighbors.end());
+        SelectNeighbors(neighbors, max_degree_);
+        {
+            std::lock_guard<std::mutex> lock(locks[node]);
+            int32_t *links = GetLinks(node, l);
+            links[0] = static_cast<int32_t>(neighbors.size());
+            for (size_t i = 0; i < neighbors.size(); ++i) {
+                links[i + 1] = neighbors[i].second;
+            }
+        }
+        const int max_links = l == 0 ? 2 * max_degree_ : max_degree_;
+        for (const Candidate<T> &neighbor : neighbors) {
+            Connect<T>(neighbor.second, node, l, max_links, locks);
+        }
+    }
+
+    if (level > max_level) {
+        entry_point_ = node;
+        max_level_ = level;
+    }
+}
+
+template <class T>
+void HnswIndex::Connect(int32_t node,
+                        int32_t new_neighbor,
+                        int level,
+                        int max_links,
+                        std::vector<std::mutex> &locks) {
+    std::lock_guard<std::mutex> lock(locks[node]);
+    int32_t *links = GetLinks(node, level);
+    if (links[0] < max_links) {
+        links[++links[0]] = new_neighbor;
+        return;
+    }
+
+    const T *const points = dataset_points_.GetDataPtr<T>();
+    const int64_t dim = GetDimension();
+    const T *const base = points + node * dim;
+    std::vector<Candidate<T>> candidates;
+    candidates.reserve(links[0] + 1);
+    candidates.emplace_back(
+            SquaredDistance(base, points + new_neighbor * dim, dim),
+            new_neighbor);
+    for (int32_t i = 1; i <= links[0]; ++i) {
+        candidates.emplace_back(
+                SquaredDistance(base, points + links[i] * dim, dim), links[i]);
+    }
+    std::sort(candidates.begin(), candidates.end());
+    SelectNeighbors(candidates, max_links);
+    links[0] = static_cast<int32_t>(candidates.size());
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        links[i + 1] = candidates[i].second;
+    }
+}
+
+template <class T>
+std::vector<HnswIndex::Candidate<T>> HnswIndex::SearchLevel(
+        const T *const query,
+        const std::vector<Candidate<T>> &entry_points,
+        int ef,
+        int level,
+        std::vector<std::mutex> *locks) const {
+    const T *const points = dataset_points_.GetDataPtr<T>();
+    const int64_t dim = GetDimension();
+    const size_t max_results = static_cast<size_t>(ef);
+    VisitedSet &visited = GetVisitedSet(levels_.size());
+
+    // Closest unexpanded candidate first, furthest result first.
+    std::priority_queue<Candidate<T>, std::vector<Candidate<T>>,
+                        std::greater<Candidate<T>>>
+            candidates;
+    std::priority_queue<Candidate<T>> results;
+    for (const Candidate<T> &entry_point : entry_points) {
+        if (visited.Insert(entry_point.second)) {
+            candidates.push(entry_point);
+            results.push(entry_point);
+        }
+    }
+    while (results.size() > max_results) {
+        results.pop();
+    }
+
+    std::vector<int32_t> neighbors;
+    while (!candidates.empty()) {
+        const Candidate<T> current = candidates.top();
+        if (results.size() == max_results &&
+            current.first > results.top().first) {
+            break;
+        }
+        candidates.pop();
+
+        if (locks) {
+            std::lock_guard<std::mutex> lock((*locks)[current.second]);
+            const int32_t *links = GetLinks(current.second, level);
+            neighbors.assign(links + 1, links + 1 + links[0]);
+        } else {
+            const int32_t *links = GetLinks(current.second, level);
+            neighbors.assign(links + 1, links + 1 + links[0]);
+        }
+
+        for (const int32_t neighbor : neighbors) {
+            if (!visited.Insert(neighbor)) {
+                continue;
+            }
+            const T dist =
+                    SquaredDistance(query, points + neighbor * dim, dim);
+            if (results.size() < max_results || dist < results.top().first) {
+                candidates.emplace(dist, neighbor);
+                results.emplace(dist, neighbor);
+                if (results.size() > max_results) {
+                    results.pop();
+                }
+            }
+        }
+    }
+
+    std::vector<Candidate<T>> sorted(results.size());
+    for (auto it = sorted.rbegin(); it != sorted.rend(); ++it) {
+        *it = results.top();
+        results.pop();
+    }
+    return sorted;
+}
+
+template <class T>
+void HnswIndex::SelectNeighbors(std::vector<Candidate<T>> &candidates,
+                                int max_links) const {
+    if (candidates.size() <= static_cast<size_t>(max_links)) {
+        return;
+    }
+    const T *const points = dataset_points_.GetDataPtr<T>();
+    const int64_t dim = GetDimension();
+    std::vector<Candidate<T>> selected;
+    selected.reserve(max_links);
+    for (const Candidate<T> &candidate : candidates) {
+        if (selected.size() == static_cast<size_t>(max_links)) {
+            break;
+        }
+        const T *const p = points + candidate.second * dim;
+        bool keep = true;
+        for (const Candidate<T> &other : selected) {
+            if (SquaredDistance(p, points + other.second * dim, dim) <
+                candidate.first) {
+                keep = false;
+                break;
+            }
+        }
+        if (keep) {
+            selected.push_back(candidate);
+        }
+    }
+    candidates.swap(selected);
+}
+
+template <class T>
+void HnswIndex::SearchGraph(const T *const queries,
+                            int64_t num_queries,
+                            int knn,
+                            int ef_search,
+                            int32_t *indices,
+                            T *distances) const {
+    const T *const points = dataset_points_.GetDataPtr<T>();
+    const int64_t dim = GetDimension();
+    const int ef = std::max(ef_search, knn);
+    tbb::parallel_for(
+            tbb::blocked_range<int64_t>(0, num_queries),
+            [&](const tbb::blocked_range<int64_t> &r) {
+                for (int64_t i = r.begin(); i != r.end(); ++i) {
+                    const T *const query = queries + i * dim;
+                    std::vector<Candidate<T>> entry_points = {
+                            {SquaredDistance(query,
+                                             points + entry_point_ * dim, dim),
+                             entry_point_}};
+                    for (int l = max_level_; l > 0; --l) {
+                        entry_points = SearchLevel(query, entry_points, 1, l,
+                                                   nullptr);
+                    }
+                    const std::vector<Candidate<T>> neighbors = SearchLevel(
+                            query, entry_points, ef, 0, nullptr);
+
+                    // The graph may be disconnected for degenerate data.
+                    for (int j = 0; j < knn; ++j) {
+                        if (j < static_cast<int>(neighbors.size())) {
+                            indices[i * knn + j] = neighbors[j].second;
+                            distances[i * knn + j] = neighbors[j].first;
+                        } else {
+                            indices[i * knn + j] = -1;
+                            distances[i * knn + j] = 0;
+                        }
+                    }
+                }
+            });
+}
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
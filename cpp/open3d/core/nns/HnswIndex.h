@@ -0,0 +1,210 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NNSIndex.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+/// \class HnswIndex
+///
+/// \brief Approximate k nearest neighbor index based on a Hierarchical
+/// Navigable Small World graph.
+///
+/// Every dataset point is a node, linked to close points on level 0 and, with
+/// exponentially decreasing probability, on higher levels. A search descends
+/// greedily from the top level and then explores level 0 with a candidate
+/// list of ef_search nodes. Larger ef_search values raise the recall at the
+/// cost of speed. Unlike KDTrees, the search time scales well with the
+/// dimension, e.g. for matching FPFH features.
+///
+/// The index only supports SearchKnn() on CPU. Distances are squared L2.
+class HnswIndex : public NNSIndex {
+public:
+    /// \brief Default Constructor.
+    ///
+    /// \param max_degree Number of links per node on levels above 0. Level 0
+    /// keeps twice as many. Larger values raise the recall and the memory
+    /// footprint.
+    /// \param ef_construction Size of the candidate list while building the
+    /// graph. Larger values build a better graph more slowly.
+    /// \param ef_search Default size of the candidate list while searching.
+    HnswIndex(int max_degree = 16,
+              int ef_construction = 200,
+              int ef_search = 64);
+
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param dataset_points Provides a set of data points as Tensor for graph
+    /// construction.
+    HnswIndex(const Tensor &dataset_points,
+              int max_degree = 16,
+              int ef_construction = 200,
+              int ef_search = 64);
+    ~HnswIndex();
+    HnswIndex(const HnswIndex &) = delete;
+    HnswIndex &operator=(const HnswIndex &) = delete;
+
+public:
+    bool SetTensorData(const Tensor &dataset_points) override;
+
+    bool SetTensorData(const Tensor &dataset_points, double radius) override {
+        utility::LogError(
+                "HnswIndex::SetTensorData with radius not implemented.");
+    }
+
+    /// Perform approximate K nearest neighbor search with the default
+    /// ef_search.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, d}, same
+    /// dtype with dataset_points.
+    /// \param knn Number of nearest neighbor to search.
+    /// \return Pair of Tensors: (indices, distances):
+    /// - indices: Tensor of shape {n, knn}, with dtype Int32. Sorted by
+    /// distance. Padded with -1 if fewer than knn points were reached.
+    /// - distainces: Tensor of shape {n, knn}, same dtype with dataset_points.
+    std::pair<Tensor, Tensor> SearchKnn(const Tensor &query_points,
+                                        int knn) const override;
+
+    /// Perform approximate K nearest neighbor search.
+    ///
+    /// \param ef_search Size of the candidate list. Values below knn are
+    /// raised to knn.
+    std::pair<Tensor, Tensor> SearchKnn(const Tensor &query_points,
+                                        int knn,
+                                        int ef_search) const;
+
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(
+            const Tensor &query_points,
+            const Tensor &radii,
+            bool sort) const override {
+        utility::LogError("HnswIndex::SearchRadius not implemented.");
+    }
+
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(
+            const Tensor &query_points,
+            double radius,
+            bool sort) const override {
+        utility::LogError("HnswIndex::SearchRadius not implemented.");
+    }
+
+    std::tuple<Tensor, Tensor, Tensor> SearchHybrid(
+            const Tensor &query_points,
+            double radius,
+            int max_knn) const override {
+        utility::LogError("HnswIndex::SearchHybrid not implemented.");
+    }
+
+    /// Set the default size of the candidate list for SearchKnn().
+    void SetEfSearch(int ef_search);
+
+    int GetEfSearch() const { return ef_search_; }
+
+protected:
+    /// (squared distance, node) pair.
+    template <class T>
+    using Candidate = std::pair<T, int32_t>;
+
+    template <class T>
+    void BuildGraph();
+
+    /// Insert \p node into the graph while other threads insert other nodes.
+    /// \p locks guard the link lists of each node.
+    template <class T>
+    void InsertNode(int32_t node,
+                    std::vector<std::mutex> &locks,
+                    std::mutex &entry_point_lock);
+
+    /// Add a link from \p node to \p new_neighbor on \p level, pruning the
+    /// links of \p node if it has more than \p max_links.
+    template <class T>
+    void Connect(int32_t node,
+                 int32_t new_neighbor,
+                 int level,
+                 int max_links,
+                 std::vector<std::mutex> &locks);
+
+    /// Best-first search on one level, starting from \p entry_points.
+    /// Returns up to \p ef nodes closest to \p query, sorted by distance.
+    /// \p locks must be given while the graph is being built.
+    template <class T>
+    std::vector<Candidate<T>> SearchLevel(
+            const T *const query,
+            const std::vector<Candidate<T>> &entry_points,
+            int ef,
+            int level,
+            std::vector<std::mutex> *locks) const;
+
+    /// Keep at most \p max_links of the sorted \p candidates, skipping those
+    /// that are closer to an already kept candidate than to the base node.
+    /// This keeps links in different directions, which keeps the graph
+    /// navigable for clustered data.
+    template <class T>
+    void SelectNeighbors(std::vector<Candidate<T>> &candidates,
+                         int max_links) const;
+
+    template <class T>
+    void SearchGraph(const T *const queries,
+                     int64_t num_queries,
+                     int knn,
+                     int ef_search,
+                     int32_t *indices,
+                     T *distances) const;
+
+    /// Returns the link list of \p node on \p level, see base_links_.
+    int32_t *GetLinks(int32_t node, int level);
+    const int32_t *GetLinks(int32_t node, int level) const;
+
+protected:
+    int max_degree_;
+    int ef_construction_;
+    int ef_search_;
+
+    /// Top level of each node.
+    std::vector<int> levels_;
+    /// Level 0 links. Node i owns 2 * max_degree_ + 1 entries starting at
+    /// i * (2 * max_degree_ + 1): the number of links, then the links.
+    std::vector<int32_t> base_links_;
+    /// Links on levels 1 to levels_[i] of node i, max_degree_ + 1 entries per
+    /// level in the same layout as base_links_.
+    std::vector<std::vector<int32_t>> upper_links_;
+    int32_t entry_point_ = -1;
+    int max_level_ = -1;
+};
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -80,9 +80,9 @@ bool KnnIndex::SetTensorData(const Tensor& dataset_points,
                 "Please recompile Open3d With -DBUILD_CUDA_MODULE=ON.");
 #endif
     } else {
-        utility::LogError(
-                "CPU Tensor is not supported in KnnIndex. Please use "
-                "NanoFlannIndex instead.");
+        dataset_points_ = dataset_points.Contiguous();
+        points_row_splits_ = points_row_splits.Contiguous();
+        return true;
     }
     return false;
 }
@@ -143,9 +143,8 @@ std::pair<Tensor, Tensor> KnnIndex::SearchKnn(const Tensor& query_points,
                 "-DBUILD_CUDA_MODULE=ON.");
 #endif
     } else {
-        utility::LogError(
-                "-DBUILD_CUDA_MODULE=OFF. Please compile Open3d with "
-                "-DBUILD_CUDA_MODULE=ON.");
+        CALL(float, KnnSearchCPU)
+        CALL(double, KnnSearchCPU)
     }
     return std::make_pair(neighbors_index, neighbors_distance);
 }
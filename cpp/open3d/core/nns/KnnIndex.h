@@ -36,6 +36,16 @@ namespace open3d {
 namespace core {
 namespace nns {
 
+template <class T, class TIndex>
+void KnnSearchCPU(const Tensor& points,
+                  const Tensor& points_row_splits,
+                  const Tensor& queries,
+                  const Tensor& queries_row_splits,
+                  int knn,
+                  Tensor& neighbors_index,
+                  Tensor& neighbors_row_splits,
+                  Tensor& neighbors_distance);
+
 #ifdef BUILD_CUDA_MODULE
 template <class T, class TIndex>
 void KnnSearchCUDA(const Tensor& points,
@@ -48,6 +58,13 @@ void KnnSearchCUDA(const Tensor& points,
                    Tensor& neighbors_distance);
 #endif
 
+/// \class KnnIndex
+///
+/// \brief Brute force k nearest neighbor index.
+///
+/// Compares every query against every dataset point. On CPU this is faster
+/// than a KDTree for small or high dimensional datasets, e.g. matching
+/// feature descriptors.
 class KnnIndex : public NNSIndex {
 public:
     KnnIndex();
@@ -0,0 +1,257 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/KnnIndex.h"
+#include "open3d/core/nns/NeighborSearchAllocator.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+namespace {
+
+/// Number of queries whose top-k heaps are kept alive while the point tiles
+/// are streamed through the cache.
+constexpr int64_t kQueryBlockSize = 64;
+
+/// Number of queries sharing each load of a point coordinate in the inner
+/// loop. The inner loop is unrolled by hand for this width.
+constexpr int64_t kQueryMicroBlockSize = 4;
+
+/// Number of points per tile. The accumulators of a micro block of queries
+/// against one tile stay in the L1 cache.
+constexpr int64_t kPointTileSize = 256;
+
+/// Pushes a candidate into a max-heap holding the k closest (distance, index)
+/// pairs seen so far.
+template <class T, class TIndex>
+inline void PushCandidate(std::pair<T, TIndex>* heap,
+                          int64_t& heap_size,
+                          int64_t k,
+                          T distance,
+                          TIndex index) {
+    const std::pair<T, TIndex> candidate(distance, index);
+    if (heap_size < k) {
+        heap[heap_size++] = candidate;
+        std::push_heap(heap, heap + heap_size);
+    } else if (candidate < heap[0]) {
+        std::pop_heap(heap, heap + k);
+        heap[k - 1] = candidate;
+        std::push_heap(heap, heap + k);
+    }
+}
+
+/// Brute force k nearest neighbor search of one batch.
+///
+/// \param points_t Points transposed to shape {dim, num_points}, so that one
+/// coordinate of consecutive points is contiguous.
+/// \param queries Row major queries of shape {num_queries, dim}.
+/// \param k Number of neighbors, must not exceed num_points.
+/// \param indices Output of shape {num_queries, k}.
+/// \param distances Output of shape {num_queries, k}.
+template <class T, class TIndex>
+void KnnSearchBruteForceCPU(const T* points_t,
+                            int64_t num_points,
+                            const T* queries,
+                            int64_t num_queries,
+                            int64_t dim,
+                            int64_t k,
+                            TIndex* indices,
+                            T* distances) {
+    if (num_queries == 0 || k == 0) {
+        return;
+    }
+    tbb::parallel_for(
+            tbb::blocked_range<int64_t>(0, num_queries, kQueryBlockSize),
+            [&](const tbb::blocked_range<int64_t>& r) {
+                std::vector<std::pair<T, TIndex>> heaps(kQueryBlockSize * k);
+                std::vector<int64_t> heap_sizes(kQueryBlockSize);
+                std::vector<T> acc(kQueryMicroBlockSize * kPointTileSize);
+
+                for (int64_t b_begin = r.begin(); b_begin < r.end();
+                     b_begin += kQueryBlockSize) {
+                    const int64_t b_end =
+                            std::min(b_begin + kQueryBlockSize, r.end());
+                    std::fill(heap_sizes.begin(), heap_sizes.end(), 0);
+
+                    for (int64_t p_begin = 0; p_begin < num_points;
+                         p_begin += kPointTileSize) {
+                        const int64_t tile_size = std::min(
+                                kPointTileSize, num_points - p_begin);
+
+                        for (int64_t q_begin = b_begin; q_begin < b_end;
+                             q_begin += kQueryMicroBlockSize) {
+                            const int64_t micro_size = std::min(
+                                    kQueryMicroBlockSize, b_end - q_begin);
+
+                            // Squared distances of the micro block against the
+                            // tile. The micro block is padded with its last
+                            // query so that the inner loop has a fixed width
+                            // and is vectorized by the compiler.
+                            std::fill(acc.begin(), acc.end(), T(0));
+                            for (int64_t c = 0; c < dim; ++c) {
+                                T q[kQueryMicroBlockSize];
+                                for (int64_t m = 0; m < kQueryMicroBlockSize;
+                                     ++m) {
+                                    const int64_t q_idx =
+                                            q_begin +
+                                            std::min(m, micro_size - 1);
+                                    q[m] = queries[q_idx * dim + c];
+                                }
+                                const T* p = points_t + c * num_points +
+                                             p_begin;
+                                T* acc0 = acc.data();
+                                T* acc1 = acc0 + kPointTileSize;
+                                T* acc2 = acc1 + kPointTileSize;
+                                T* acc3 = acc2 + kPointTileSize;
+                                for (int64_t j = 0; j < tile_size; ++j) {
+                                    const T d0 = q[0] - p[j];
+                                    const T d1 = q[1] - p[j];
+                                    const T d2 = q[2] - p[j];
+                                    const T d3 = q[3] - p[j];
+                                    acc0[j] += d0 * d0;
+                                    acc1[j] += d1 * d1;
+                                    acc2[j] += d2 * d2;
+                                    acc3[j] += d3 * d3;
+                                }
+                            }
+
+                            for (int64_t m = 0; m < micro_size; ++m) {
+                                const int64_t local = q_begin + m - b_begin;
+                                std::pair<T, TIndex>* heap =
+                                        heaps.data() + local * k;
+                                const T* acc_m =
+                                        acc.data() + m * kPointTileSize;
+                                for (int64_t j = 0; j < tile_size; ++j) {
+                                    PushCandidate(heap, heap_sizes[local], k,
+                                                  acc_m[j],
+                                                  TIndex(p_begin + j));
+                                }
+                            }
+                        }
+                    }
+
+                    for (int64_t q_idx = b_begin; q_idx < b_end; ++q_idx) {
+                        std::pair<T, TIndex>* heap =
+                                heaps.data() + (q_idx - b_begin) * k;
+                        std::sort_heap(heap, heap + k);
+                        for (int64_t j = 0; j < k; ++j) {
+                            distances[q_idx * k + j] = heap[j].first;
+                            indices[q_idx * k + j] = heap[j].second;
+                        }
+                    }
+                }
+            });
+}
+
+}  // namespace
+
+template <class T, class TIndex>
+void KnnSearchCPU(const Tensor& points,
+                  const Tensor& points_row_splits,
+                  const Tensor& queries,
+                  const Tensor& queries_row_splits,
+                  int knn,
+                  Tensor& neighbors_index,
+                  Tensor& neighbors_row_splits,
+                  Tensor& neighbors_distance) {
+    const int64_t num_queries = queries.GetShape(0);
+    const int64_t dim = points.GetShape(1);
+    const int64_t batch_size = points_row_splits.GetShape(0) - 1;
+    const int64_t* points_row_splits_ptr =
+            points_row_splits.GetDataPtr<int64_t>();
+    const int64_t* queries_row_splits_ptr =
+            queries_row_splits.GetDataPtr<int64_t>();
+    int64_t* neighbors_row_splits_ptr =
+            neighbors_row_splits.GetDataPtr<int64_t>();
+
+    // Every query of a batch gets min(knn, num_points) neighbors.
+    neighbors_row_splits_ptr[0] = 0;
+    for (int64_t b = 0; b < batch_size; ++b) {
+        const int64_t k = std::min<int64_t>(
+                knn, points_row_splits_ptr[b + 1] - points_row_splits_ptr[b]);
+        for (int64_t i = queries_row_splits_ptr[b];
+             i < queries_row_splits_ptr[b + 1]; ++i) {
+            neighbors_row_splits_ptr[i + 1] = neighbors_row_splits_ptr[i] + k;
+        }
+    }
+    const int64_t num_neighbors = neighbors_row_splits_ptr[num_queries];
+
+    NeighborSearchAllocator<T, TIndex> output_allocator(points.GetDevice());
+    TIndex* indices_ptr;
+    T* distances_ptr;
+    output_allocator.AllocIndices(&indices_ptr, num_neighbors);
+    output_allocator.AllocDistances(&distances_ptr, num_neighbors);
+
+    for (int64_t b = 0; b < batch_size; ++b) {
+        const int64_t num_points_b =
+                points_row_splits_ptr[b + 1] - points_row_splits_ptr[b];
+        const int64_t query_begin = queries_row_splits_ptr[b];
+        const int64_t num_queries_b =
+                queries_row_splits_ptr[b + 1] - query_begin;
+        const int64_t offset = neighbors_row_splits_ptr[query_begin];
+        const Tensor points_t = points.Slice(0, points_row_splits_ptr[b],
+                                             points_row_splits_ptr[b + 1])
+                                        .T()
+                                        .Contiguous();
+        KnnSearchBruteForceCPU<T, TIndex>(
+                points_t.GetDataPtr<T>(), num_points_b,
+                queries.GetDataPtr<T>() + query_begin * dim, num_queries_b,
+                dim, std::min<int64_t>(knn, num_points_b),
+                indices_ptr + offset, distances_ptr + offset);
+    }
+
+    neighbors_index = output_allocator.NeighborsIndex();
+    neighbors_distance = output_allocator.NeighborsDistance();
+    if (batch_size == 1) {
+        const int64_t k = std::min<int64_t>(knn, points.GetShape(0));
+        neighbors_index = neighbors_index.View({num_queries, k});
+        neighbors_distance = neighbors_distance.View({num_queries, k});
+    }
+}
+
+#define INSTANTIATE(T, TIndex)                                                \
+    template void KnnSearchCPU<T, TIndex>(                                    \
+            const Tensor& points, const Tensor& points_row_splits,            \
+            const Tensor& queries, const Tensor& queries_row_splits, int knn, \
+            Tensor& neighbors_index, Tensor& neighbors_row_splits,            \
+            Tensor& neighbors_distance);
+
+INSTANTIATE(float, int32_t)
+INSTANTIATE(float, int64_t)
+INSTANTIATE(double, int32_t)
+INSTANTIATE(double, int64_t)
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,132 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/MortonOrder.h"
+
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+namespace {
+
+template <class T>
+void ComputeMortonOrderCPU(const T* points,
+                           const int64_t* row_splits,
+                           int64_t num_batch,
+                           double cell_size,
+                           int64_t* order) {
+    std::vector<std::pair<uint64_t, int64_t>> codes;
+    for (int64_t b = 0; b < num_batch; ++b) {
+        const int64_t begin = row_splits[b];
+        const int64_t end = row_splits[b + 1];
+        const int64_t n = end - begin;
+
+        double min_bound[3], max_bound[3];
+        for (int d = 0; d < 3; ++d) {
+            min_bound[d] = std::numeric_limits<double>::max();
+            max_bound[d] = std::numeric_limits<double>::lowest();
+        }
+        for (int64_t i = begin; i < end; ++i) {
+            for (int d = 0; d < 3; ++d) {
+                const double v = points[3 * i + d];
+                min_bound[d] = std::min(min_bound[d], v);
+                max_bound[d] = std::max(max_bound[d], v);
+            }
+        }
+        double extent = 0;
+        for (int d = 0; d < 3; ++d) {
+            extent = std::max(extent, max_bound[d] - min_bound[d]);
+        }
+        const double max_cell = double((1 << 21) - 1);
+        const double inv_cell_size =
+                1.0 / std::max(cell_size, extent / max_cell);
+
+        codes.resize(n);
+        ParallelFor(Device("CPU:0"), n, [&](int64_t i) {
+            const T* p = points + 3 * (begin + i);
+            uint32_t cell[3];
+            for (int d = 0; d < 3; ++d) {
+                const double c =
+                        std::floor((p[d] - min_bound[d]) * inv_cell_size);
+                cell[d] = uint32_t(std::min(std::max(c, 0.0), max_cell));
+            }
+            codes[i] = std::make_pair(MortonEncode(cell[0], cell[1], cell[2]),
+                                      begin + i);
+        });
+        // Ties keep their input order since the index is the second key.
+        tbb::parallel_sort(codes.begin(), codes.end());
+        for (int64_t i = 0; i < n; ++i) {
+            order[begin + i] = codes[i].second;
+        }
+    }
+}
+
+}  // namespace
+
+Tensor ComputeMortonOrder(const Tensor& points,
+                          const Tensor& row_splits,
+                          double cell_size) {
+    AssertTensorDtypes(points, {Float32, Float64});
+    AssertTensorShape(points, {utility::nullopt, 3});
+    AssertTensorDevice(row_splits, Device("CPU:0"));
+    AssertTensorDtype(row_splits, Int64);
+    if (cell_size <= 0) {
+        utility::LogError("cell_size should be positive.");
+    }
+
+    // The codes are computed on the host. For CUDA tensors this costs one
+    // round trip of the points, which is small compared to the search.
+    const Device host("CPU:0");
+    const Tensor points_host = points.To(host).Contiguous();
+    const Tensor row_splits_host = row_splits.Contiguous();
+
+    Tensor order = Tensor::Empty({points_host.GetLength()}, Int64, host);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points_host.GetDtype(), [&]() {
+        ComputeMortonOrderCPU(points_host.GetDataPtr<scalar_t>(),
+                              row_splits_host.GetDataPtr<int64_t>(),
+                              row_splits_host.GetLength() - 1, cell_size,
+                              order.GetDataPtr<int64_t>());
+    });
+
+    return order.To(points.GetDevice());
+}
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
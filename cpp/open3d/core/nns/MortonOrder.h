@@ -0,0 +1,87 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+/// Interleaves the lower 21 bits of the cell coordinates \p x, \p y and \p z
+/// into a 63-bit Morton (Z-order) code.
+inline uint64_t MortonEncode(uint32_t x, uint32_t y, uint32_t z) {
+    auto spread = [](uint64_t v) {
+        v &= 0x1fffff;
+        v = (v | v << 32) & 0x1f00000000ffff;
+        v = (v | v << 16) & 0x1f0000ff0000ff;
+        v = (v | v << 8) & 0x100f00f00f00f00f;
+        v = (v | v << 4) & 0x10c30c30c30c30c3;
+        v = (v | v << 2) & 0x1249249249249249;
+        return v;
+    };
+    return spread(x) | spread(y) << 1 | spread(z) << 2;
+}
+
+/// Inverse of MortonEncode, recovers the cell coordinates \p x, \p y and \p z
+/// from a 63-bit Morton code.
+inline void MortonDecode(uint64_t code, uint32_t& x, uint32_t& y, uint32_t& z) {
+    auto compact = [](uint64_t v) {
+        v &= 0x1249249249249249;
+        v = (v | v >> 2) & 0x10c30c30c30c30c3;
+        v = (v | v >> 4) & 0x100f00f00f00f00f;
+        v = (v | v >> 8) & 0x1f0000ff0000ff;
+        v = (v | v >> 16) & 0x1f00000000ffff;
+        v = (v | v >> 32) & 0x1fffff;
+        return static_cast<uint32_t>(v);
+    };
+    x = compact(code);
+    y = compact(code >> 1);
+    z = compact(code >> 2);
+}
+
+/// Computes the permutation that sorts 3D points along a Morton curve.
+///
+/// Points are quantized to cells of \p cell_size relative to the minimum
+/// bound of their batch item. The cell size is enlarged if needed so that the
+/// extent fits into 21 bits per axis. Points only move within their batch
+/// item, so \p row_splits stays valid for the reordered points.
+///
+/// \param points Tensor of shape {N, 3} with dtype Float32 or Float64.
+/// \param row_splits Int64 tensor of shape {batch_size + 1} on CPU.
+/// \param cell_size Edge length of the quantization cells.
+/// \return Int64 tensor of shape {N} on the device of \p points, such that
+/// points.IndexGet({order}) is in Morton order.
+Tensor ComputeMortonOrder(const Tensor& points,
+                          const Tensor& row_splits,
+                          double cell_size);
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -28,6 +28,7 @@
 #include <tbb/parallel_for.h>
 
 #include <algorithm>
+#include <limits>
 #include <mutex>
 #include <nanoflann.hpp>
 
@@ -49,15 +50,18 @@ struct NanoFlannIndexHolder : NanoFlannIndexHolderBase {
     struct DataAdaptor {
         DataAdaptor(size_t dataset_size,
                     int dimension,
-                    const TReal *const data_ptr)
+                    const TReal *const data_ptr,
+                    const TIndex *const point_indices)
             : dataset_size_(dataset_size),
               dimension_(dimension),
-              data_ptr_(data_ptr) {}
+              data_ptr_(data_ptr),
+              point_indices_(point_indices) {}
 
         inline size_t kdtree_get_point_count() const { return dataset_size_; }
 
         inline TReal kdtree_get_pt(const size_t idx, const size_t dim) const {
-            return data_ptr_[idx * dimension_ + dim];
+            const size_t point_idx = point_indices_ ? point_indices_[idx] : idx;
+            return data_ptr_[point_idx * dimension_ + dim];
         }
 
         template <class BBOX>
@@ -67,7 +71,11 @@ struct NanoFlannIndexHolder : NanoFlannIndexHolderBase {
 
         size_t dataset_size_ = 0;
         int dimension_ = 0;
-        const TReal *const data_ptr_;
+        /// Not const, so that a tree can follow its points when the buffer
+        /// holding them is reallocated. See UpdateKdTreeData().
+        const TReal *data_ptr_;
+        /// Optional indices of the points in data_ptr_ held by the tree.
+        const TIndex *point_indices_;
     };
 
     /// Adaptor Selector.
@@ -94,8 +102,10 @@ struct NanoFlannIndexHolder : NanoFlannIndexHolderBase {
 
     NanoFlannIndexHolder(size_t dataset_size,
                          int dimension,
-                         const TReal *data_ptr) {
-        adaptor_.reset(new DataAdaptor(dataset_size, dimension, data_ptr));
+                         const TReal *data_ptr,
+                         const TIndex *point_indices = nullptr) {
+        adaptor_.reset(new DataAdaptor(dataset_size, dimension, data_ptr,
+                                       point_indices));
         index_.reset(new KDTree_t(dimension, *adaptor_.get()));
         index_->buildIndex();
     }
@@ -110,9 +120,10 @@ template <class T, int METRIC>
 void _BuildKdTree(size_t num_points,
                   const T *const points,
                   size_t dimension,
+                  const index_t *const point_indices,
                   NanoFlannIndexHolderBase **holder) {
-    *holder = new NanoFlannIndexHolder<METRIC, T, index_t>(num_points,
-                                                           dimension, points);
+    *holder = new NanoFlannIndexHolder<METRIC, T, index_t>(
+            num_points, dimension, points, point_indices);
 }
 
 template <class T, class OUTPUT_ALLOCATOR, int METRIC>
@@ -403,6 +414,265 @@ void _HybridSearchCPU(NanoFlannIndexHolderBase *holder,
             });
 }
 
+/// Result set for nanoflann's findNeighbors() that keeps the \p knn closest
+/// points within \p radius over all sub-trees of a dynamic index. Points
+/// flagged in \p removed are skipped.
+template <class T>
+class SubTreeKnnResultSet {
+public:
+    SubTreeKnnResultSet(size_t knn, T radius, const uint8_t *const removed)
+        : knn_(knn), radius_(radius), removed_(removed) {
+        neighbors_.reserve(knn);
+    }
+
+    void Reset() { neighbors_.clear(); }
+
+    void SetSubTree(index_t offset, const index_t *const indices) {
+        offset_ = offset;
+        indices_ = indices;
+    }
+
+    size_t size() const { return neighbors_.size(); }
+
+    bool full() const { return neighbors_.size() == knn_; }
+
+    T worstDist() const { return full() ? neighbors_.front().first : radius_; }
+
+    bool addPoint(T dist, index_t idx) {
+        const index_t dataset_idx = offset_ + (indices_ ? indices_[idx] : idx);
+        if (removed_[dataset_idx] || dist >= worstDist()) {
+            return true;
+        }
+        if (full()) {
+            std::pop_heap(neighbors_.begin(), neighbors_.end());
+            neighbors_.pop_back();
+        }
+        neighbors_.emplace_back(dist, dataset_idx);
+        std::push_heap(neighbors_.begin(), neighbors_.end());
+        return true;
+    }
+
+    /// Returns the (distance, index) pairs sorted by distance. Call Reset()
+    /// before reusing the result set.
+    const std::vector<std::pair<T, index_t>> &Sorted() {
+        std::sort_heap(neighbors_.begin(), neighbors_.end());
+        return neighbors_;
+    }
+
+private:
+    size_t knn_;
+    T radius_;
+    const uint8_t *const removed_;
+    index_t offset_ = 0;
+    const index_t *indices_ = nullptr;
+    std::vector<std::pair<T, index_t>> neighbors_;
+};
+
+/// Result set for nanoflann's findNeighbors() that collects all points within
+/// \p radius over all sub-trees of a dynamic index. Points flagged in
+/// \p removed are skipped.
+template <class T>
+class SubTreeRadiusResultSet {
+public:
+    SubTreeRadiusResultSet(T radius,
+                           const uint8_t *const removed,
+                           std::vector<std::pair<T, index_t>> &neighbors)
+        : radius_(radius), removed_(removed), neighbors_(neighbors) {}
+
+    void SetSubTree(index_t offset, const index_t *const indices) {
+        offset_ = offset;
+        indices_ = indices;
+    }
+
+    size_t size() const { return neighbors_.size(); }
+
+    bool full() const { return true; }
+
+    T worstDist() const { return radius_; }
+
+    bool addPoint(T dist, index_t idx) {
+        const index_t dataset_idx = offset_ + (indices_ ? indices_[idx] : idx);
+        if (dist < radius_ && !removed_[dataset_idx]) {
+            neighbors_.emplace_back(dist, dataset_idx);
+        }
+        return true;
+    }
+
+private:
+    T radius_;
+    const uint8_t *const removed_;
+    index_t offset_ = 0;
+    const index_t *indices_ = nullptr;
+    std::vector<std::pair<T, index_t>> &neighbors_;
+};
+
+template <class T, int METRIC, class RESULT_SET>
+void _SearchSubTrees(const std::vector<NanoFlannSubTree> &sub_trees,
+                     const T *const query,
+                     RESULT_SET &result_set) {
+    typedef NanoFlannIndexHolder<METRIC, T, index_t> holder_t;
+    const nanoflann::SearchParams params;
+    for (const NanoFlannSubTree &sub_tree : sub_trees) {
+        if (sub_tree.num_removed == sub_tree.num_points) {
+            continue;
+        }
+        result_set.SetSubTree(static_cast<index_t>(sub_tree.offset),
+                              sub_tree.num_points < sub_tree.size
+                                      ? sub_tree.indices.data()
+                                      : nullptr);
+        static_cast<holder_t *>(sub_tree.holder.get())
+                ->index_->findNeighbors(result_set, query, params);
+    }
+}
+
+template <class T, int METRIC>
+void _UpdateKdTreeData(NanoFlannIndexHolderBase *holder,
+                       const T *const points) {
+    static_cast<NanoFlannIndexHolder<METRIC, T, index_t> *>(holder)
+            ->adaptor_->data_ptr_ = points;
+}
+
+template <class T, class OUTPUT_ALLOCATOR, int METRIC>
+void _KnnSearchSubTreesCPU(const std::vector<NanoFlannSubTree> &sub_trees,
+                           const uint8_t *const removed,
+                           int64_t *query_neighbors_row_splits,
+                           size_t num_queries,
+                           const T *const queries,
+                           const size_t dimension,
+                           int knn,
+                           OUTPUT_ALLOCATOR &output_allocator) {
+    const size_t num_indices = static_cast<size_t>(knn) * num_queries;
+    index_t *indices_ptr;
+    output_allocator.AllocIndices(&indices_ptr, num_indices);
+    T *distances_ptr;
+    output_allocator.AllocDistances(&distances_ptr, num_indices);
+    for (size_t i = 0; i <= num_queries; ++i) {
+        query_neighbors_row_splits[i] = static_cast<int64_t>(i) * knn;
+    }
+    if (num_indices == 0) {
+        return;
+    }
+
+    tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, num_queries),
+            [&](const tbb::blocked_range<size_t> &r) {
+                SubTreeKnnResultSet<T> result_set(
+                        knn, std::numeric_limits<T>::max(), removed);
+                for (size_t i = r.begin(); i != r.end(); ++i) {
+                    result_set.Reset();
+                    _SearchSubTrees<T, METRIC>(
+                            sub_trees, &queries[i * dimension], result_set);
+                    const auto &neighbors = result_set.Sorted();
+                    // The caller limits knn to the number of points left.
+                    for (size_t j = 0; j < neighbors.size(); ++j) {
+                        indices_ptr[i * knn + j] = neighbors[j].second;
+                        distances_ptr[i * knn + j] = neighbors[j].first;
+                    }
+                }
+            });
+}
+
+template <class T, class OUTPUT_ALLOCATOR, int METRIC>
+void _RadiusSearchSubTreesCPU(const std::vector<NanoFlannSubTree> &sub_trees,
+                              const uint8_t *const removed,
+                              int64_t *query_neighbors_row_splits,
+                              size_t num_queries,
+                              const T *const queries,
+                              const size_t dimension,
+                              const T *const radii,
+                              bool sort,
+                              OUTPUT_ALLOCATOR &output_allocator) {
+    std::vector<std::vector<std::pair<T, index_t>>> neighbors(num_queries);
+    std::vector<int64_t> neighbors_count(num_queries, 0);
+
+    tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, num_queries),
+            [&](const tbb::blocked_range<size_t> &r) {
+                for (size_t i = r.begin(); i != r.end(); ++i) {
+                    T radius = radii[i];
+                    if (METRIC == L2) {
+                        radius = radius * radius;
+                    }
+                    SubTreeRadiusResultSet<T> result_set(radius, removed,
+                                                         neighbors[i]);
+                    _SearchSubTrees<T, METRIC>(
+                            sub_trees, &queries[i * dimension], result_set);
+                    if (sort) {
+                        std::sort(neighbors[i].begin(), neighbors[i].end());
+                    }
+                    neighbors_count[i] = neighbors[i].size();
+                }
+            });
+
+    query_neighbors_row_splits[0] = 0;
+    utility::InclusivePrefixSum(neighbors_count.data(),
+                                neighbors_count.data() + neighbors_count.size(),
+                                query_neighbors_row_splits + 1);
+
+    const int64_t num_indices = query_neighbors_row_splits[num_queries];
+    index_t *indices_ptr;
+    output_allocator.AllocIndices(&indices_ptr, num_indices);
+    T *distances_ptr;
+    output_allocator.AllocDistances(&distances_ptr, num_indices);
+
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_queries),
+                      [&](const tbb::blocked_range<size_t> &r) {
+                          for (size_t i = r.begin(); i != r.end(); ++i) {
+                              int64_t idx = query_neighbors_row_splits[i];
+                              for (const auto &dist_idx : neighbors[i]) {
+                                  indices_ptr[idx] = dist_idx.second;
+                                  distances_ptr[idx] = dist_idx.first;
+                                  ++idx;
+                              }
+                          }
+                      });
+}
+
+template <class T, class OUTPUT_ALLOCATOR, int METRIC>
+void _HybridSearchSubTreesCPU(const std::vector<NanoFlannSubTree> &sub_trees,
+                              const uint8_t *const removed,
+                              size_t num_queries,
+                              const T *const queries,
+                              const size_t dimension,
+                              const T radius,
+                              const int max_knn,
+                              OUTPUT_ALLOCATOR &output_allocator) {
+    const size_t num_indices = static_cast<size_t>(max_knn) * num_queries;
+    index_t *indices_ptr, *counts_ptr;
+    output_allocator.AllocIndices(&indices_ptr, num_indices);
+    output_allocator.AllocCounts(&counts_ptr, num_queries);
+    T *distances_ptr;
+    output_allocator.AllocDistances(&distances_ptr, num_indices);
+
+    const T search_radius = METRIC == L2 ? radius * radius : radius;
+    tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, num_queries),
+            [&](const tbb::blocked_range<size_t> &r) {
+                SubTreeKnnResultSet<T> result_set(max_knn, search_radius,
+                                                  removed);
+                for (size_t i = r.begin(); i != r.end(); ++i) {
+                    result_set.Reset();
+                    _SearchSubTrees<T, METRIC>(
+                            sub_trees, &queries[i * dimension], result_set);
+                    const auto &neighbors = result_set.Sorted();
+                    counts_ptr[i] = static_cast<index_t>(neighbors.size());
+
+                    int neighbor_idx = 0;
+                    for (; neighbor_idx < counts_ptr[i]; ++neighbor_idx) {
+                        const auto &dist_idx = neighbors[neighbor_idx];
+                        indices_ptr[i * max_knn + neighbor_idx] =
+                                dist_idx.second;
+                        distances_ptr[i * max_knn + neighbor_idx] =
+                                dist_idx.first;
+                    }
+                    for (; neighbor_idx < max_knn; ++neighbor_idx) {
+                        indices_ptr[i * max_knn + neighbor_idx] = -1;
+                        distances_ptr[i * max_knn + neighbor_idx] = 0;
+                    }
+                }
+            });
+}
+
 }  // namespace
 
 /// Build KD Tree. This function build a KDTree for given dataset points.
@@ -419,13 +689,20 @@ void _HybridSearchCPU(NanoFlannIndexHolderBase *holder,
 /// \param metric   Onf of L1, L2. Defines the distance metric for the
 /// search
 ///
+/// \param point_indices    Optional array with \p num_points indices into
+/// \p points. If given, the tree holds only these points and returns
+/// positions in this array instead of indices into \p points. The array
+/// must outlive the tree.
+///
 template <class T>
-std::unique_ptr<NanoFlannIndexHolderBase> BuildKdTree(size_t num_points,
-                                                      const T *const points,
-                                                      size_t dimension,
-                                                      const Metric metric) {
+std::unique_ptr<NanoFlannIndexHolderBase> BuildKdTree(
+        size_t num_points,
+        const T *const points,
+        size_t dimension,
+        const Metric metric,
+        const index_t *const point_indices = nullptr) {
     NanoFlannIndexHolderBase *holder = nullptr;
-#define FN_PARAMETERS num_points, points, dimension, &holder
+#define FN_PARAMETERS num_points, points, dimension, point_indices, &holder
 
 #define CALL_TEMPLATE(METRIC)                   \
     if (METRIC == metric) {                     \
@@ -713,6 +990,142 @@ void HybridSearchCPU(NanoFlannIndexHolderBase *holder,
 #undef FN_PARAMETERS
 }
 
+/// Points a KDTree built with BuildKdTree() to a new location of its points,
+/// e.g. after the buffer holding them has been reallocated. The points
+/// themselves must not have changed, so the tree does not need a rebuild.
+template <class T>
+void UpdateKdTreeData(NanoFlannIndexHolderBase *holder,
+                      const T *const points,
+                      const Metric metric) {
+#define CALL_TEMPLATE(METRIC)                         \
+    if (METRIC == metric) {                           \
+        _UpdateKdTreeData<T, METRIC>(holder, points); \
+    }
+
+#define CALL_TEMPLATE2 \
+    CALL_TEMPLATE(L1)  \
+    CALL_TEMPLATE(L2)
+
+    CALL_TEMPLATE2
+
+#undef CALL_TEMPLATE
+#undef CALL_TEMPLATE2
+}
+
+/// KNN search over the sub-trees of a dynamic index. Each query gets exactly
+/// \p knn neighbors sorted by distance, so \p knn must not exceed the number
+/// of points that are not removed. Indices are dataset indices, i.e. local
+/// tree indices plus the offset of the sub-tree.
+///
+/// \param sub_trees    The sub-trees, built with BuildKdTree().
+///
+/// \param removed    Array with one flag per dataset point. Points with a
+///        non-zero flag are skipped.
+///
+/// See KnnSearchCPU() for the remaining parameters.
+template <class T, class OUTPUT_ALLOCATOR>
+void KnnSearchSubTreesCPU(const std::vector<NanoFlannSubTree> &sub_trees,
+                          const uint8_t *const removed,
+                          int64_t *query_neighbors_row_splits,
+                          size_t num_queries,
+                          const T *const queries,
+                          const size_t dimension,
+                          int knn,
+                          const Metric metric,
+                          OUTPUT_ALLOCATOR &output_allocator) {
+#define FN_PARAMETERS                                                   \
+    sub_trees, removed, query_neighbors_row_splits, num_queries, queries, \
+            dimension, knn, output_allocator
+
+#define CALL_TEMPLATE(METRIC)                                              \
+    if (METRIC == metric) {                                                \
+        _KnnSearchSubTreesCPU<T, OUTPUT_ALLOCATOR, METRIC>(FN_PARAMETERS); \
+    }
+
+#define CALL_TEMPLATE2 \
+    CALL_TEMPLATE(L1)  \
+    CALL_TEMPLATE(L2)
+
+    CALL_TEMPLATE2
+
+#undef CALL_TEMPLATE
+#undef CALL_TEMPLATE2
+
+#undef FN_PARAMETERS
+}
+
+/// Radius search over the sub-trees of a dynamic index. The output has the
+/// same layout as RadiusSearchCPU() with return_distances enabled.
+///
+/// See KnnSearchSubTreesCPU() and RadiusSearchCPU() for the parameters.
+template <class T, class OUTPUT_ALLOCATOR>
+void RadiusSearchSubTreesCPU(const std::vector<NanoFlannSubTree> &sub_trees,
+                             const uint8_t *const removed,
+                             int64_t *query_neighbors_row_splits,
+                             size_t num_queries,
+                             const T *const queries,
+                             const size_t dimension,
+                             const T *const radii,
+                             const Metric metric,
+                             bool sort,
+                             OUTPUT_ALLOCATOR &output_allocator) {
+#define FN_PARAMETERS                                                   \
+    sub_trees, removed, query_neighbors_row_splits, num_queries, queries, \
+            dimension, radii, sort, output_allocator
+
+#define CALL_TEMPLATE(METRIC)                                                 \
+    if (METRIC == metric) {                                                   \
+        _RadiusSearchSubTreesCPU<T, OUTPUT_ALLOCATOR, METRIC>(FN_PARAMETERS); \
+    }
+
+#define CALL_TEMPLATE2 \
+    CALL_TEMPLATE(L1)  \
+    CALL_TEMPLATE(L2)
+
+    CALL_TEMPLATE2
+
+#undef CALL_TEMPLATE
+#undef CALL_TEMPLATE2
+
+#undef FN_PARAMETERS
+}
+
+/// Hybrid search over the sub-trees of a dynamic index. The output has the
+/// same layout as HybridSearchCPU(). Unlike HybridSearchCPU(), the search
+/// radius shrinks once \p max_knn neighbors have been found.
+///
+/// See KnnSearchSubTreesCPU() and HybridSearchCPU() for the parameters.
+template <class T, class OUTPUT_ALLOCATOR>
+void HybridSearchSubTreesCPU(const std::vector<NanoFlannSubTree> &sub_trees,
+                             const uint8_t *const removed,
+                             size_t num_queries,
+                             const T *const queries,
+                             const size_t dimension,
+                             const T radius,
+                             const int max_knn,
+                             const Metric metric,
+                             OUTPUT_ALLOCATOR &output_allocator) {
+#define FN_PARAMETERS                                                    \
+    sub_trees, removed, num_queries, queries, dimension, radius, max_knn, \
+            output_allocator
+
+#define CALL_TEMPLATE(METRIC)                                                 \
+    if (METRIC == metric) {                                                   \
+        _HybridSearchSubTreesCPU<T, OUTPUT_ALLOCATOR, METRIC>(FN_PARAMETERS); \
+    }
+
+#define CALL_TEMPLATE2 \
+    CALL_TEMPLATE(L1)  \
+    CALL_TEMPLATE(L2)
+
+    CALL_TEMPLATE2
+
+#undef CALL_TEMPLATE
+#undef CALL_TEMPLATE2
+
+#undef FN_PARAMETERS
+}
+
 }  // namespace impl
 }  // namespace nns
 }  // namespace core
@@ -26,6 +26,9 @@
 
 #include "open3d/core/nns/NanoFlannIndex.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/TensorCheck.h"
 #include "open3d/core/nns/NanoFlannImpl.h"
@@ -40,6 +43,13 @@ namespace nns {
 
 typedef int32_t index_t;
 
+namespace {
+/// A new sub-tree is merged into the next older one as long as the older one
+/// is at most this many times larger. Sub-tree sizes thus grow geometrically
+/// from the newest to the oldest.
+constexpr int64_t kSubTreeMergeRatio = 2;
+}  // namespace
+
 NanoFlannIndex::NanoFlannIndex(){};
 
 NanoFlannIndex::NanoFlannIndex(const Tensor &dataset_points) {
@@ -57,6 +67,12 @@ bool NanoFlannIndex::SetTensorData(const Tensor &dataset_points) {
                 "{n_dataset_points, d}.");
     }
 
+    is_dynamic_ = false;
+    sub_trees_.clear();
+    points_buffer_ = Tensor();
+    removed_.clear();
+    num_removed_ = 0;
+
     dataset_points_ = dataset_points.Contiguous();
     DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
         holder_ = impl::BuildKdTree<scalar_t>(
@@ -67,6 +83,183 @@ bool NanoFlannIndex::SetTensorData(const Tensor &dataset_points) {
     return true;
 };
 
+void NanoFlannIndex::BuildSubTree(NanoFlannSubTree &sub_tree) const {
+    std::vector<index_t> indices;
+    const uint8_t *const removed = removed_.data() + sub_tree.offset;
+    for (int64_t i = 0; i < sub_tree.size; ++i) {
+        if (!removed[i]) {
+            indices.push_back(static_cast<index_t>(i));
+        }
+    }
+    sub_tree.num_points = static_cast<int64_t>(indices.size());
+    sub_tree.num_removed = 0;
+    if (sub_tree.num_points < sub_tree.size) {
+        sub_tree.indices = std::move(indices);
+    } else {
+        sub_tree.indices = std::vector<index_t>();
+    }
+
+    sub_tree.holder.reset();
+    if (sub_tree.num_points == 0) {
+        return;
+    }
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+        sub_tree.holder = impl::BuildKdTree<scalar_t>(
+                sub_tree.num_points,
+                points_buffer_.GetDataPtr<scalar_t>() +
+                        sub_tree.offset * GetDimension(),
+                GetDimension(), /* metric */ L2,
+                sub_tree.num_points < sub_tree.size ? sub_tree.indices.data()
+                                                    : nullptr);
+    });
+}
+
+int64_t NanoFlannIndex::GetNumIndexedPoints() const {
+    if (!is_dynamic_) {
+        return static_cast<int64_t>(GetDatasetSize());
+    }
+    int64_t num_points = 0;
+    for (const NanoFlannSubTree &sub_tree : sub_trees_) {
+        num_points += sub_tree.num_points;
+    }
+    return num_points;
+}
+
+void NanoFlannIndex::MakeDynamic() {
+    if (is_dynamic_) {
+        return;
+    }
+    const int64_t num_points = GetDatasetSize();
+    points_buffer_ = dataset_points_;
+    removed_.assign(num_points, 0);
+    num_removed_ = 0;
+    if (num_points > 0) {
+        NanoFlannSubTree sub_tree;
+        sub_tree.size = num_points;
+        sub_tree.num_points = num_points;
+        sub_tree.holder = std::move(holder_);
+        sub_trees_.push_back(std::move(sub_tree));
+    }
+    holder_.reset();
+    is_dynamic_ = true;
+}
+
+void NanoFlannIndex::AddPoints(const Tensor &points) {
+    AssertTensorDtypes(points, {Float32, Float64});
+    if (points.NumDims() != 2) {
+        utility::LogError("points must be 2D matrix, with shape {n, d}.");
+    }
+    if (dataset_points_.NumDims() != 2) {
+        dataset_points_ = Tensor::Empty({0, points.GetShape(1)},
+                                        points.GetDtype(), points.GetDevice());
+    }
+    AssertTensorDevice(points, GetDevice());
+    AssertTensorDtype(points, GetDtype());
+    AssertTensorShape(points, {utility::nullopt, GetDimension()});
+    MakeDynamic();
+
+    const int64_t offset = GetDatasetSize();
+    const int64_t num_new_points = points.GetShape(0);
+    const int64_t num_points = offset + num_new_points;
+    if (num_new_points == 0) {
+        return;
+    }
+    if (num_points > std::numeric_limits<index_t>::max()) {
+        utility::LogError("NanoFlannIndex supports at most {} points.",
+                          std::numeric_limits<index_t>::max());
+    }
+
+    // Grow the buffer geometrically. Its address changes, so existing trees
+    // are pointed to the copy of their points instead of being rebuilt.
+    if (num_points > points_buffer_.GetShape(0)) {
+        const int64_t capacity =
+                std::max(num_points, 2 * points_buffer_.GetShape(0));
+        Tensor buffer = Tensor::Empty({capacity, GetDimension()}, GetDtype(),
+                                      GetDevice());
+        if (offset > 0) {
+            buffer.Slice(0, 0, offset) = dataset_points_;
+        }
+        points_buffer_ = buffer;
+        DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+            const scalar_t *const buffer_ptr =
+                    points_buffer_.GetDataPtr<scalar_t>();
+            for (const NanoFlannSubTree &sub_tree : sub_trees_) {
+                if (!sub_tree.holder) {
+                    continue;
+                }
+                impl::UpdateKdTreeData(
+                        sub_tree.holder.get(),
+                        buffer_ptr + sub_tree.offset * GetDimension(),
+                        /* metric */ L2);
+            }
+        });
+    }
+    points_buffer_.Slice(0, offset, num_points) = points;
+    dataset_points_ = points_buffer_.Slice(0, 0, num_points);
+    removed_.resize(num_points, 0);
+
+    // Merge like a binary counter: only the resulting newest tree is built.
+    NanoFlannSubTree new_tree;
+    new_tree.offset = offset;
+    new_tree.size = num_new_points;
+    sub_trees_.push_back(std::move(new_tree));
+    while (sub_trees_.size() >= 2) {
+        NanoFlannSubTree &older = sub_trees_[sub_trees_.size() - 2];
+        const NanoFlannSubTree &newer = sub_trees_.back();
+        if (older.size > kSubTreeMergeRatio * newer.size) {
+            break;
+        }
+        older.size += newer.size;
+        sub_trees_.pop_back();
+    }
+    BuildSubTree(sub_trees_.back());
+}
+
+void NanoFlannIndex::RemovePoints(const Tensor &indices) {
+    AssertTensorDtypes(indices, {Int32, Int64});
+    if (indices.NumDims() != 1) {
+        utility::LogError("indices must be 1D, with shape {n}.");
+    }
+    MakeDynamic();
+
+    const Tensor indices_cpu =
+            indices.To(Device("CPU:0"), Int64).Contiguous();
+    const int64_t *const indices_ptr = indices_cpu.GetDataPtr<int64_t>();
+    const int64_t num_indices = indices_cpu.GetShape(0);
+    const int64_t num_points = GetDatasetSize();
+    for (int64_t i = 0; i < num_indices; ++i) {
+        if (indices_ptr[i] < 0 || indices_ptr[i] >= num_points) {
+            utility::LogError("Index {} is out of range [0, {}).",
+                              indices_ptr[i], num_points);
+        }
+    }
+
+    for (int64_t i = 0; i < num_indices; ++i) {
+        const int64_t idx = indices_ptr[i];
+        if (removed_[idx]) {
+            continue;
+        }
+        removed_[idx] = 1;
+        ++num_removed_;
+        auto sub_tree = std::upper_bound(
+                sub_trees_.begin(), sub_trees_.end(), idx,
+                [](int64_t value, const NanoFlannSubTree &sub_tree) {
+                    return value < sub_tree.offset;
+                });
+        --sub_tree;
+        ++sub_tree->num_removed;
+    }
+
+    // Searches still visit removed points, so purge them from a tree once
+    // they are the majority. The rebuild costs no more than the removals
+    // since the last build, which keeps removals amortized O(log n).
+    for (NanoFlannSubTree &sub_tree : sub_trees_) {
+        if (2 * sub_tree.num_removed > sub_tree.num_points) {
+            BuildSubTree(sub_tree);
+        }
+    }
+}
+
 std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnn(const Tensor &query_points,
                                                     int knn) const {
     const Dtype dtype = GetDtype();
@@ -80,8 +273,8 @@ std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnn(const Tensor &query_points,
         utility::LogError("knn should be larger than 0.");
     }
 
-    const int64_t num_neighbors = std::min(
-            static_cast<int64_t>(GetDatasetSize()), static_cast<int64_t>(knn));
+    const int64_t num_neighbors =
+            std::min(GetNumActivePoints(), static_cast<int64_t>(knn));
     const int64_t num_query_points = query_points.GetShape(0);
 
     Tensor indices, distances;
@@ -90,15 +283,25 @@ std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnn(const Tensor &query_points,
         const Tensor query_contiguous = query_points.Contiguous();
         NeighborSearchAllocator<scalar_t> output_allocator(device);
 
-        impl::KnnSearchCPU(
-                holder_.get(), neighbors_row_splits.GetDataPtr<int64_t>(),
-                dataset_points_.GetShape(0),
-                dataset_points_.GetDataPtr<scalar_t>(),
-                query_contiguous.GetShape(0),
-                query_contiguous.GetDataPtr<scalar_t>(),
-                query_contiguous.GetShape(1), num_neighbors, /* metric */ L2,
-                /* ignore_query_point */ false,
-                /* return_distances */ true, output_allocator);
+        if (is_dynamic_) {
+            impl::KnnSearchSubTreesCPU(
+                    sub_trees_, removed_.data(),
+                    neighbors_row_splits.GetDataPtr<int64_t>(),
+                    query_contiguous.GetShape(0),
+                    query_contiguous.GetDataPtr<scalar_t>(),
+                    query_contiguous.GetShape(1), num_neighbors,
+                    /* metric */ L2, output_allocator);
+        } else {
+            impl::KnnSearchCPU(
+                    holder_.get(), neighbors_row_splits.GetDataPtr<int64_t>(),
+                    dataset_points_.GetShape(0),
+                    dataset_points_.GetDataPtr<scalar_t>(),
+                    query_contiguous.GetShape(0),
+                    query_contiguous.GetDataPtr<scalar_t>(),
+                    query_contiguous.GetShape(1), num_neighbors,
+                    /* metric */ L2, /* ignore_query_point */ false,
+                    /* return_distances */ true, output_allocator);
+        }
         indices = output_allocator.NeighborsIndex();
         distances = output_allocator.NeighborsDistance();
         indices = indices.View({num_query_points, num_neighbors});
@@ -134,16 +337,28 @@ std::tuple<Tensor, Tensor, Tensor> NanoFlannIndex::SearchRadius(
         const Tensor query_contiguous = query_points.Contiguous();
         NeighborSearchAllocator<scalar_t> output_allocator(device);
 
-        impl::RadiusSearchCPU(
-                holder_.get(), neighbors_row_splits.GetDataPtr<int64_t>(),
-                dataset_points_.GetShape(0),
-                dataset_points_.GetDataPtr<scalar_t>(),
-                query_contiguous.GetShape(0),
-                query_contiguous.GetDataPtr<scalar_t>(),
-                query_contiguous.GetShape(1), radii.GetDataPtr<scalar_t>(),
-                /* metric */ L2,
-                /* ignore_query_point */ false, /* return_distances */ true,
-                /* normalize_distances */ false, sort, output_allocator);
+        if (is_dynamic_) {
+            impl::RadiusSearchSubTreesCPU(
+                    sub_trees_, removed_.data(),
+                    neighbors_row_splits.GetDataPtr<int64_t>(),
+                    query_contiguous.GetShape(0),
+                    query_contiguous.GetDataPtr<scalar_t>(),
+                    query_contiguous.GetShape(1),
+                    radii.GetDataPtr<scalar_t>(), /* metric */ L2, sort,
+                    output_allocator);
+        } else {
+            impl::RadiusSearchCPU(
+                    holder_.get(), neighbors_row_splits.GetDataPtr<int64_t>(),
+                    dataset_points_.GetShape(0),
+                    dataset_points_.GetDataPtr<scalar_t>(),
+                    query_contiguous.GetShape(0),
+                    query_contiguous.GetDataPtr<scalar_t>(),
+                    query_contiguous.GetShape(1),
+                    radii.GetDataPtr<scalar_t>(), /* metric */ L2,
+                    /* ignore_query_point */ false,
+                    /* return_distances */ true,
+                    /* normalize_distances */ false, sort, output_allocator);
+        }
         indices = output_allocator.NeighborsIndex();
         distances = output_allocator.NeighborsDistance();
     });
@@ -186,14 +401,24 @@ std::tuple<Tensor, Tensor, Tensor> NanoFlannIndex::SearchHybrid(
         const Tensor query_contiguous = query_points.Contiguous();
         NeighborSearchAllocator<scalar_t> output_allocator(device);
 
-        impl::HybridSearchCPU(holder_.get(), dataset_points_.GetShape(0),
-                              dataset_points_.GetDataPtr<scalar_t>(),
-                              query_contiguous.GetShape(0),
-                              query_contiguous.GetDataPtr<scalar_t>(),
-                              query_contiguous.GetShape(1),
-                              static_cast<scalar_t>(radius), max_knn,
-                              /* metric*/ L2, /* ignore_query_point */ false,
-                              /* return_distances */ true, output_allocator);
+        if (is_dynamic_) {
+            impl::HybridSearchSubTreesCPU(
+                    sub_trees_, removed_.data(), query_contiguous.GetShape(0),
+                    query_contiguous.GetDataPtr<scalar_t>(),
+                    query_contiguous.GetShape(1),
+                    static_cast<scalar_t>(radius), max_knn, /* metric */ L2,
+                    output_allocator);
+        } else {
+            impl::HybridSearchCPU(
+                    holder_.get(), dataset_points_.GetShape(0),
+                    dataset_points_.GetDataPtr<scalar_t>(),
+                    query_contiguous.GetShape(0),
+                    query_contiguous.GetDataPtr<scalar_t>(),
+                    query_contiguous.GetShape(1),
+                    static_cast<scalar_t>(radius), max_knn,
+                    /* metric*/ L2, /* ignore_query_point */ false,
+                    /* return_distances */ true, output_allocator);
+        }
 
         indices = output_allocator.NeighborsIndex().View(
                 {num_query_points, max_knn});
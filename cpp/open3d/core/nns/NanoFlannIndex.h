@@ -40,6 +40,12 @@ namespace nns {
 /// \class NanoFlann
 ///
 /// \brief KDTree with NanoFlann for nearest neighbor search.
+///
+/// The index is static after SetTensorData(). AddPoints() and RemovePoints()
+/// turn it into a dynamic index: a forest of KDTrees over contiguous ranges of
+/// the dataset, where newer trees are smaller and get merged into older ones
+/// as they grow, so each point is rebuilt O(log n) times. Searches on a
+/// dynamic index return the same layout as on a static one.
 class NanoFlannIndex : public NNSIndex {
 public:
     /// \brief Default Constructor.
@@ -118,9 +124,60 @@ public:
                                                     double radius,
                                                     int max_knn) const override;
 
+    /// Append points to the dataset without rebuilding the whole index.
+    ///
+    /// The new points get the indices following the existing ones, indices
+    /// of existing points do not change. Must not be called concurrently with
+    /// a search.
+    ///
+    /// \param points Points to add. Must be 2D, with shape {n, d}, same dtype
+    /// with dataset_points. If the index is empty, the points define its
+    /// dtype and dimension.
+    void AddPoints(const Tensor &points);
+
+    /// Remove points from the dataset.
+    ///
+    /// Removed points keep their index and storage until the next
+    /// SetTensorData(), but are no longer returned by any search. A KDTree
+    /// is rebuilt without its removed points once they make up more than
+    /// half of it. Removing a point twice has no effect. Must not be called
+    /// concurrently with a search.
+    ///
+    /// \param indices Indices of the points to remove. Must be 1D, with dtype
+    /// Int32 or Int64.
+    void RemovePoints(const Tensor &indices);
+
+    /// Returns the number of dataset points that have not been removed.
+    int64_t GetNumActivePoints() const {
+        return static_cast<int64_t>(GetDatasetSize()) - num_removed_;
+    }
+
+    /// Returns the number of dataset points held by the KDTrees, including
+    /// removed points that have not been purged yet.
+    int64_t GetNumIndexedPoints() const;
+
+protected:
+    /// Switch from a single KDTree to the sub-tree forest used by AddPoints()
+    /// and RemovePoints().
+    void MakeDynamic();
+
+    /// (Re)build the KDTree of a sub-tree over the points of its range that
+    /// are not removed.
+    void BuildSubTree(NanoFlannSubTree &sub_tree) const;
+
 protected:
     // Tensor dataset_points_;
     std::unique_ptr<NanoFlannIndexHolderBase> holder_;
+
+    /// True once AddPoints() or RemovePoints() has been called.
+    bool is_dynamic_ = false;
+    /// Sub-trees of a dynamic index, ordered by offset.
+    std::vector<NanoFlannSubTree> sub_trees_;
+    /// Storage of dataset_points_ with spare rows for AddPoints().
+    Tensor points_buffer_;
+    /// One flag per dataset point, set by RemovePoints().
+    std::vector<uint8_t> removed_;
+    int64_t num_removed_ = 0;
 };
 }  // namespace nns
 }  // namespace core
@@ -32,6 +32,28 @@ namespace open3d {
 namespace core {
 namespace nns {
 
+namespace {
+
+/// Datasets up to this size are searched by brute force on CPU. Building and
+/// traversing a KDTree does not pay off for so few points.
+constexpr int64_t kBruteForceMaxPoints = 2048;
+
+/// From this dimension on, a KDTree has to visit a large fraction of its
+/// leaves, so brute force is used for larger datasets as well.
+constexpr int64_t kBruteForceMinHighDim = 16;
+constexpr int64_t kBruteForceMaxPointsHighDim = 65536;
+
+/// Returns true if brute force KNN search is expected to be faster than a
+/// KDTree on CPU.
+bool UseBruteForceKnnCPU(int64_t num_points, int64_t dimension) {
+    if (dimension >= kBruteForceMinHighDim) {
+        return num_points <= kBruteForceMaxPointsHighDim;
+    }
+    return num_points <= kBruteForceMaxPoints;
+}
+
+}  // namespace
+
 NearestNeighborSearch::~NearestNeighborSearch(){};
 
 bool NearestNeighborSearch::SetIndex() {
@@ -49,7 +71,13 @@ bool NearestNeighborSearch::KnnIndex() {
                 "-DBUILD_CUDA_MODULE=OFF. Please recompile Open3D with "
                 "-DBUILD_CUDA_MODULE=ON.");
 #endif
+    } else if (dataset_points_.NumDims() == 2 &&
+               UseBruteForceKnnCPU(dataset_points_.GetShape(0),
+                                   dataset_points_.GetShape(1))) {
+        knn_index_.reset(new nns::KnnIndex());
+        return knn_index_->SetTensorData(dataset_points_);
     } else {
+        knn_index_.reset();
         return SetIndex();
     }
 };
@@ -95,6 +123,13 @@ bool NearestNeighborSearch::HybridIndex(utility::optional<double> radius) {
     }
 };
 
+bool NearestNeighborSearch::ApproximateKnnIndex(int max_degree,
+                                                int ef_construction) {
+    AssertNotCUDA(dataset_points_);
+    hnsw_index_.reset(new nns::HnswIndex(max_degree, ef_construction));
+    return hnsw_index_->SetTensorData(dataset_points_);
+}
+
 std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
         const Tensor& query_points, int knn) {
     AssertTensorDevice(query_points, dataset_points_.GetDevice());
@@ -106,7 +141,9 @@ std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
             utility::LogError("Index is not set.");
         }
     } else {
-        if (nanoflann_index_) {
+        if (knn_index_) {
+            return knn_index_->SearchKnn(query_points, knn);
+        } else if (nanoflann_index_) {
             return nanoflann_index_->SearchKnn(query_points, knn);
         } else {
             utility::LogError("Index is not set.");
@@ -114,6 +151,16 @@ std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
     }
 }
 
+std::pair<Tensor, Tensor> NearestNeighborSearch::ApproximateKnnSearch(
+        const Tensor& query_points, int knn, int ef_search) {
+    AssertTensorDevice(query_points, dataset_points_.GetDevice());
+
+    if (!hnsw_index_) {
+        utility::LogError("Index is not set.");
+    }
+    return hnsw_index_->SearchKnn(query_points, knn, ef_search);
+}
+
 std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
         const Tensor& query_points, double radius, bool sort) {
     AssertTensorDevice(query_points, dataset_points_.GetDevice());
@@ -30,6 +30,7 @@
 
 #include "open3d/core/Tensor.h"
 #include "open3d/core/nns/FixedRadiusIndex.h"
+#include "open3d/core/nns/HnswIndex.h"
 #include "open3d/core/nns/KnnIndex.h"
 #include "open3d/core/nns/NanoFlannIndex.h"
 #include "open3d/utility/Optional.h"
@@ -57,6 +58,9 @@ public:
 public:
     /// Set index for knn search.
     ///
+    /// On CPU, small or high dimensional datasets are searched by brute force
+    /// and all others with a KDTree.
+    ///
     /// \return Returns true if building index success, otherwise false.
     bool KnnIndex();
 
@@ -76,6 +80,15 @@ public:
     /// \return Returns true if building index success, otherwise false.
     bool HybridIndex(utility::optional<double> radius = {});
 
+    /// Set index for approximate knn search. CPU only.
+    ///
+    /// \param max_degree Number of links per point in the HNSW graph. Larger
+    /// values raise the recall and the memory footprint.
+    /// \param ef_construction Size of the candidate list while building the
+    /// graph.
+    /// \return Returns true if building index success, otherwise false.
+    bool ApproximateKnnIndex(int max_degree = 16, int ef_construction = 200);
+
     /// Perform knn search.
     ///
     /// \param query_points Query points. Must be 2D, with shape {n, d}.
@@ -86,6 +99,18 @@ public:
     ///              The distances are squared L2 distances.
     std::pair<Tensor, Tensor> KnnSearch(const Tensor &query_points, int knn);
 
+    /// Perform approximate knn search.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, d}.
+    /// \param knn Number of neighbors to search per query point.
+    /// \param ef_search Size of the candidate list per query. Larger values
+    /// raise the recall at the cost of speed.
+    /// \return Pair of Tensors, (indices, distances), in the same format as
+    /// KnnSearch(). Indices are -1 if fewer than knn points were reached.
+    std::pair<Tensor, Tensor> ApproximateKnnSearch(const Tensor &query_points,
+                                                   int knn,
+                                                   int ef_search = 64);
+
     /// Perform fixed radius search. All query points share the same radius.
     ///
     /// \param query_points Data points for querying. Must be 2D, with shape {n,
@@ -140,6 +165,7 @@ protected:
     std::unique_ptr<NanoFlannIndex> nanoflann_index_;
     std::unique_ptr<nns::FixedRadiusIndex> fixed_radius_index_;
     std::unique_ptr<nns::KnnIndex> knn_index_;
+    std::unique_ptr<nns::HnswIndex> hnsw_index_;
     const Tensor dataset_points_;
 };
 }  // namespace nns
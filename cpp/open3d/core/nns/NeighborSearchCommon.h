@@ -26,7 +26,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "open3d/utility/MiniVec.h"
 
@@ -73,6 +75,24 @@ struct NanoFlannIndexHolderBase {
     virtual ~NanoFlannIndexHolderBase() {}
 };
 
+/// A sub-tree of a dynamic NanoFlannIndex. It covers the dataset points
+/// [offset, offset + size) and holds those that were not removed when it was
+/// built. Adding offset to a local index of the tree gives the index of the
+/// point in the dataset.
+struct NanoFlannSubTree {
+    int64_t offset = 0;
+    int64_t size = 0;
+    /// Number of points held by the tree.
+    int64_t num_points = 0;
+    /// Number of points held by the tree that are marked as removed.
+    int64_t num_removed = 0;
+    /// Local indices of the points held by the tree. Only used if the tree
+    /// does not hold all points of its range, i.e. if num_points < size.
+    std::vector<int32_t> indices;
+    /// The KDTree. Null if the tree holds no points.
+    std::unique_ptr<NanoFlannIndexHolderBase> holder;
+};
+
 }  // namespace nns
 }  // namespace core
 }  // namespace open3d
@@ -31,46 +31,149 @@
 
 #include "open3d/geometry/KDTreeFlann.h"
 
+#include <algorithm>
 #include <nanoflann.hpp>
 
 #include "open3d/geometry/HalfEdgeTriangleMesh.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+/// Per-thread scratch space for a single query. The buffers are reused across
+/// queries, so repeated searches stop allocating once they have grown.
+template <typename Scalar>
+struct SearchBuffer {
+    std::vector<Scalar> query;
+    std::vector<Eigen::Index> indices;
+    std::vector<Scalar> distance2;
+    std::vector<std::pair<Eigen::Index, Scalar>> indices_dists;
+};
+
+template <typename Scalar>
+SearchBuffer<Scalar> &GetSearchBuffer() {
+    static thread_local SearchBuffer<Scalar> buffer;
+    return buffer;
+}
+
+/// Returns \p query in the scalar type of the KDTree.
+inline const double *CastQuery(const double *query,
+                               size_t /*dimension*/,
+                               SearchBuffer<double> & /*buffer*/) {
+    return query;
+}
+
+inline const float *CastQuery(const double *query,
+                              size_t dimension,
+                              SearchBuffer<float> &buffer) {
+    buffer.query.resize(dimension);
+    std::copy_n(query, dimension, buffer.query.begin());
+    return buffer.query.data();
+}
+
+/// Searches the \p knn nearest neighbors of \p query and writes them to
+/// \p indices and \p distance2, which must hold \p knn elements. If \p radius
+/// is non-negative, only neighbors closer than \p radius are kept. Returns the
+/// number of neighbors written.
+template <typename Scalar, typename KDTree>
+int SearchKNNRaw(const KDTree &kdtree,
+                 size_t dimension,
+                 const double *query,
+                 int knn,
+                 double radius,
+                 int *indices,
+                 double *distance2) {
+    SearchBuffer<Scalar> &buffer = GetSearchBuffer<Scalar>();
+    const Scalar *query_cast = CastQuery(query, dimension, buffer);
+    buffer.indices.resize(knn);
+    buffer.distance2.resize(knn);
+    int k = int(kdtree.index->knnSearch(query_cast, knn, buffer.indices.data(),
+                                        buffer.distance2.data()));
+    if (radius >= 0.0) {
+        k = int(std::distance(
+                buffer.distance2.begin(),
+                std::lower_bound(buffer.distance2.begin(),
+                                 buffer.distance2.begin() + k,
+                                 Scalar(radius * radius))));
+    }
+    std::copy_n(buffer.indices.begin(), k, indices);
+    std::copy_n(buffer.distance2.begin(), k, distance2);
+    return k;
+}
+
+/// Searches all neighbors within \p radius of \p query and appends them to
+/// \p indices and \p distance2. Returns the number of neighbors appended.
+template <typename Scalar, typename KDTree>
+int SearchRadiusRaw(const KDTree &kdtree,
+                    size_t dimension,
+                    const double *query,
+                    double radius,
+                    std::vector<int> &indices,
+                    std::vector<double> &distance2) {
+    SearchBuffer<Scalar> &buffer = GetSearchBuffer<Scalar>();
+    const Scalar *query_cast = CastQuery(query, dimension, buffer);
+    size_t k = kdtree.index->radiusSearch(query_cast, Scalar(radius * radius),
+                                          buffer.indices_dists,
+                                          nanoflann::SearchParams(-1, 0.0));
+    for (size_t i = 0; i < k; ++i) {
+        indices.push_back(int(buffer.indices_dists[i].first));
+        distance2.push_back(double(buffer.indices_dists[i].second));
+    }
+    return int(k);
+}
+
+}  // unnamed namespace
+
 KDTreeFlann::KDTreeFlann() {}
 
-KDTreeFlann::KDTreeFlann(const Eigen::MatrixXd &data) { SetMatrixData(data); }
+KDTreeFlann::KDTreeFlann(const Eigen::MatrixXd &data,
+                         Precision precision /* = Precision::Float64 */) {
+    SetMatrixData(data, precision);
+}
 
-KDTreeFlann::KDTreeFlann(const Geometry &geometry) { SetGeometry(geometry); }
+KDTreeFlann::KDTreeFlann(const Geometry &geometry,
+                         Precision precision /* = Precision::Float64 */) {
+    SetGeometry(geometry, precision);
+}
 
-KDTreeFlann::KDTreeFlann(const pipelines::registration::Feature &feature) {
-    SetFeature(feature);
+KDTreeFlann::KDTreeFlann(const pipelines::registration::Feature &feature,
+                         Precision precision /* = Precision::Float64 */) {
+    SetFeature(feature, precision);
 }
 
 KDTreeFlann::~KDTreeFlann() {}
 
-bool KDTreeFlann::SetMatrixData(const Eigen::MatrixXd &data) {
+bool KDTreeFlann::SetMatrixData(
+        const Eigen::MatrixXd &data,
+        Precision precision /* = Precision::Float64 */) {
     return SetRawData(Eigen::Map<const Eigen::MatrixXd>(
-            data.data(), data.rows(), data.cols()));
+                              data.data(), data.rows(), data.cols()),
+                      precision);
 }
 
-bool KDTreeFlann::SetGeometry(const Geometry &geometry) {
+bool KDTreeFlann::SetGeometry(const Geometry &geometry,
+                              Precision precision /* = Precision::Float64 */) {
     switch (geometry.GetGeometryType()) {
-        case Geometry::GeometryType::PointCloud:
+        case Geometry::GeometryType::PointCloud: {
+            const auto &points = ((const PointCloud &)geometry).points_;
             return SetRawData(Eigen::Map<const Eigen::MatrixXd>(
-                    (const double *)((const PointCloud &)geometry)
-                            .points_.data(),
-                    3, ((const PointCloud &)geometry).points_.size()));
+                                      (const double *)points.data(), 3,
+                                      points.size()),
+                              precision);
+        }
         case Geometry::GeometryType::TriangleMesh:
-        case Geometry::GeometryType::HalfEdgeTriangleMesh:
+        case Geometry::GeometryType::HalfEdgeTriangleMesh: {
+            const auto &vertices = ((const TriangleMesh &)geometry).vertices_;
             return SetRawData(Eigen::Map<const Eigen::MatrixXd>(
-                    (const double *)((const TriangleMesh &)geometry)
-                            .vertices_.data(),
-                    3, ((const TriangleMesh &)geometry).vertices_.size()));
+                                      (const double *)vertices.data(), 3,
+                                      vertices.size()),
+                              precision);
+        }
         case Geometry::GeometryType::Image:
         case Geometry::GeometryType::Unspecified:
         default:
@@ -80,8 +183,9 @@ bool KDTreeFlann::SetGeometry(const Geometry &geometry) {
     }
 }
 
-bool KDTreeFlann::SetFeature(const pipelines::registration::Feature &feature) {
-    return SetMatrixData(feature.data_);
+bool KDTreeFlann::SetFeature(const pipelines::registration::Feature &feature,
+                             Precision precision /* = Precision::Float64 */) {
+    return SetMatrixData(feature.data_, precision);
 }
 
 template <typename T>
@@ -116,18 +220,20 @@ int KDTreeFlann::SearchKNN(const T &query,
     // This is optimized code for heavily repeated search.
     // Other flann::Index::knnSearch() implementations lose performance due to
     // memory allocation/deallocation.
-    if (data_.empty() || dataset_size_ <= 0 ||
-        size_t(query.rows()) != dimension_ || knn < 0) {
+    if (!IsQueryValid(query.rows()) || knn < 0) {
         return -1;
     }
     indices.resize(knn);
     distance2.resize(knn);
-    std::vector<Eigen::Index> indices_eigen(knn);
-    int k = nanoflann_index_->index->knnSearch(
-            query.data(), knn, indices_eigen.data(), distance2.data());
+    int k = precision_ == Precision::Float32
+                    ? SearchKNNRaw<float>(*nanoflann_index_float_, dimension_,
+                                          query.data(), knn, -1.0,
+                                          indices.data(), distance2.data())
+                    : SearchKNNRaw<double>(*nanoflann_index_, dimension_,
+                                           query.data(), knn, -1.0,
+                                           indices.data(), distance2.data());
     indices.resize(k);
     distance2.resize(k);
-    std::copy_n(indices_eigen.begin(), k, indices.begin());
     return k;
 }
 
@@ -140,21 +246,18 @@ int KDTreeFlann::SearchRadius(const T &query,
     // Since max_nn is not given, we let flann to do its own memory management.
     // Other flann::Index::radiusSearch() implementations lose performance due
     // to memory management and CPU caching.
-    if (data_.empty() || dataset_size_ <= 0 ||
-        size_t(query.rows()) != dimension_) {
+    if (!IsQueryValid(query.rows())) {
         return -1;
     }
-    std::vector<std::pair<Eigen::Index, double>> indices_dists;
-    int k = nanoflann_index_->index->radiusSearch(
-            query.data(), radius * radius, indices_dists,
-            nanoflann::SearchParams(-1, 0.0));
-    indices.resize(k);
-    distance2.resize(k);
-    for (int i = 0; i < k; ++i) {
-        indices[i] = indices_dists[i].first;
-        distance2[i] = indices_dists[i].second;
-    }
-    return k;
+    indices.clear();
+    distance2.clear();
+    return precision_ == Precision::Float32
+                   ? SearchRadiusRaw<float>(*nanoflann_index_float_, dimension_,
+                                            query.data(), radius, indices,
+                                            distance2)
+                   : SearchRadiusRaw<double>(*nanoflann_index_, dimension_,
+                                             query.data(), radius, indices,
+                                             distance2);
 }
 
 template <typename T>
@@ -167,37 +270,216 @@ int KDTreeFlann::SearchHybrid(const T &query,
     // It is also the recommended setting for search.
     // Other flann::Index::radiusSearch() implementations lose performance due
     // to memory allocation/deallocation.
-    if (data_.empty() || dataset_size_ <= 0 ||
-        size_t(query.rows()) != dimension_ || max_nn < 0) {
+    if (!IsQueryValid(query.rows()) || max_nn < 0) {
         return -1;
     }
+    indices.resize(max_nn);
     distance2.resize(max_nn);
-    std::vector<Eigen::Index> indices_eigen(max_nn);
-    int k = nanoflann_index_->index->knnSearch(
-            query.data(), max_nn, indices_eigen.data(), distance2.data());
-    k = std::distance(distance2.begin(),
-                      std::lower_bound(distance2.begin(), distance2.begin() + k,
-                                       radius * radius));
+    int k = precision_ == Precision::Float32
+                    ? SearchKNNRaw<float>(*nanoflann_index_float_, dimension_,
+                                          query.data(), max_nn, radius,
+                                          indices.data(), distance2.data())
+                    : SearchKNNRaw<double>(*nanoflann_index_, dimension_,
+                                           query.data(), max_nn, radius,
+                                           indices.data(), distance2.data());
     indices.resize(k);
     distance2.resize(k);
-    std::copy_n(indices_eigen.begin(), k, indices.begin());
     return k;
 }
 
-bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data) {
+int64_t KDTreeFlann::Search(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                            const KDTreeSearchParam &param,
+                            std::vector<int> &indices,
+                            std::vector<double> &distance2,
+                            std::vector<int64_t> &row_splits) const {
+    switch (param.GetSearchType()) {
+        case KDTreeSearchParam::SearchType::Knn:
+            return SearchKNN(queries,
+                             ((const KDTreeSearchParamKNN &)param).knn_,
+                             indices, distance2, row_splits);
+        case KDTreeSearchParam::SearchType::Radius:
+            return SearchRadius(
+                    queries, ((const KDTreeSearchParamRadius &)param).radius_,
+                    indices, distance2, row_splits);
+        case KDTreeSearchParam::SearchType::Hybrid:
+            return SearchHybrid(
+                    queries, ((const KDTreeSearchParamHybrid &)param).radius_,
+                    ((const KDTreeSearchParamHybrid &)param).max_nn_, indices,
+                    distance2, row_splits);
+        default:
+            return -1;
+    }
+    return -1;
+}
+
+int64_t KDTreeFlann::SearchKNN(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                               int knn,
+                               std::vector<int> &indices,
+                               std::vector<double> &distance2,
+                               std::vector<int64_t> &row_splits) const {
+    if (!IsQueryValid(queries.rows()) || knn < 0) {
+        return -1;
+    }
+    return SearchKNNBatch(queries, knn, -1.0, indices, distance2, row_splits);
+}
+
+int64_t KDTreeFlann::SearchRadius(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        double radius,
+        std::vector<int> &indices,
+        std::vector<double> &distance2,
+        std::vector<int64_t> &row_splits) const {
+    if (!IsQueryValid(queries.rows())) {
+        return -1;
+    }
+    const int num_queries = int(queries.cols());
+    row_splits.assign(num_queries + 1, 0);
+
+    // The number of neighbors is not known in advance. Every chunk of
+    // consecutive queries is searched into its own buffers, which are then
+    // concatenated in query order.
+    const int num_chunks =
+            std::max(1, std::min(utility::EstimateMaxThreads(), num_queries));
+    auto chunk_begin = [&](int chunk) {
+        return int(int64_t(num_queries) * chunk / num_chunks);
+    };
+    std::vector<std::vector<int>> chunk_indices(num_chunks);
+    std::vector<std::vector<double>> chunk_distance2(num_chunks);
+#pragma omp parallel for schedule(static, 1) num_threads(num_chunks)
+    for (int chunk = 0; chunk < num_chunks; ++chunk) {
+        for (int i = chunk_begin(chunk); i < chunk_begin(chunk + 1); ++i) {
+            const double *query = queries.col(i).data();
+            row_splits[i + 1] =
+                    precision_ == Precision::Float32
+                            ? SearchRadiusRaw<float>(
+                                      *nanoflann_index_float_, dimension_,
+                                      query, radius, chunk_indices[chunk],
+                                      chunk_distance2[chunk])
+                            : SearchRadiusRaw<double>(
+                                      *nanoflann_index_, dimension_, query,
+                                      radius, chunk_indices[chunk],
+                                      chunk_distance2[chunk]);
+        }
+    }
+    for (int i = 0; i < num_queries; ++i) {
+        row_splits[i + 1] += row_splits[i];
+    }
+
+    const int64_t num_neighbors = row_splits[num_queries];
+    indices.resize(num_neighbors);
+    distance2.resize(num_neighbors);
+#pragma omp parallel for schedule(static, 1) num_threads(num_chunks)
+    for (int chunk = 0; chunk < num_chunks; ++chunk) {
+        const int64_t offset = row_splits[chunk_begin(chunk)];
+        std::copy(chunk_indices[chunk].begin(), chunk_indices[chunk].end(),
+                  indices.begin() + offset);
+        std::copy(chunk_distance2[chunk].begin(), chunk_distance2[chunk].end(),
+                  distance2.begin() + offset);
+    }
+    return num_neighbors;
+}
+
+int64_t KDTreeFlann::SearchHybrid(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        double radius,
+        int max_nn,
+        std::vector<int> &indices,
+        std::vector<double> &distance2,
+        std::vector<int64_t> &row_splits) const {
+    if (!IsQueryValid(queries.rows()) || max_nn < 0) {
+        return -1;
+    }
+    return SearchKNNBatch(queries, max_nn, radius, indices, distance2,
+                          row_splits);
+}
+
+int64_t KDTreeFlann::SearchKNNBatch(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        int knn,
+        double radius,
+        std::vector<int> &indices,
+        std::vector<double> &distance2,
+        std::vector<int64_t> &row_splits) const {
+    // Every query owns a slot of knn results. Slots are compacted afterwards,
+    // which is a no-op if every query finds knn neighbors.
+    const int num_queries = int(queries.cols());
+    indices.resize(int64_t(num_queries) * knn);
+    distance2.resize(int64_t(num_queries) * knn);
+    row_splits.resize(num_queries + 1);
+    row_splits[0] = 0;
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < num_queries; ++i) {
+        const double *query = queries.col(i).data();
+        int *slot_indices = indices.data() + int64_t(i) * knn;
+        double *slot_distance2 = distance2.data() + int64_t(i) * knn;
+        row_splits[i + 1] =
+                precision_ == Precision::Float32
+                        ? SearchKNNRaw<float>(*nanoflann_index_float_,
+                                              dimension_, query, knn, radius,
+                                              slot_indices, slot_distance2)
+                        : SearchKNNRaw<double>(*nanoflann_index_, dimension_,
+                                               query, knn, radius,
+                                               slot_indices, slot_distance2);
+    }
+
+    int64_t num_neighbors = 0;
+    for (int i = 0; i < num_queries; ++i) {
+        const int64_t slot = int64_t(i) * knn;
+        const int64_t k = row_splits[i + 1];
+        if (num_neighbors != slot) {
+            std::copy(indices.begin() + slot, indices.begin() + slot + k,
+                      indices.begin() + num_neighbors);
+            std::copy(distance2.begin() + slot, distance2.begin() + slot + k,
+                      distance2.begin() + num_neighbors);
+        }
+        num_neighbors += k;
+        row_splits[i + 1] = num_neighbors;
+    }
+    indices.resize(num_neighbors);
+    distance2.resize(num_neighbors);
+    return num_neighbors;
+}
+
+bool KDTreeFlann::IsQueryValid(int64_t dimension) const {
+    return dataset_size_ > 0 && size_t(dimension) == dimension_ &&
+           (nanoflann_index_ || nanoflann_index_float_);
+}
+
+bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data,
+                             Precision precision) {
     dimension_ = data.rows();
     dataset_size_ = data.cols();
+    precision_ = precision;
+    nanoflann_index_.reset();
+    data_interface_.reset();
+    std::vector<double>().swap(data_);
+    nanoflann_index_float_.reset();
+    data_interface_float_.reset();
+    std::vector<float>().swap(data_float_);
     if (dimension_ == 0 || dataset_size_ == 0) {
         utility::LogWarning("[KDTreeFlann::SetRawData] Failed due to no data.");
         return false;
     }
-    data_.resize(dataset_size_ * dimension_);
-    memcpy(data_.data(), data.data(),
-           dataset_size_ * dimension_ * sizeof(double));
-    data_interface_.reset(new Eigen::Map<const Eigen::MatrixXd>(data));
-    nanoflann_index_.reset(
-            new KDTree_t(dimension_, std::cref(*data_interface_), 15));
-    nanoflann_index_->index->buildIndex();
+    if (precision == Precision::Float32) {
+        data_float_.resize(dataset_size_ * dimension_);
+        std::copy_n(data.data(), dataset_size_ * dimension_,
+                    data_float_.begin());
+        data_interface_float_.reset(new Eigen::Map<const Eigen::MatrixXf>(
+                data_float_.data(), dimension_, dataset_size_));
+        nanoflann_index_float_.reset(new KDTreeFloat_t(
+                dimension_, std::cref(*data_interface_float_), 15));
+        nanoflann_index_float_->index->buildIndex();
+    } else {
+        data_.resize(dataset_size_ * dimension_);
+        memcpy(data_.data(), data.data(),
+               dataset_size_ * dimension_ * sizeof(double));
+        data_interface_.reset(new Eigen::Map<const Eigen::MatrixXd>(
+                data_.data(), dimension_, dataset_size_));
+        nanoflann_index_.reset(
+                new KDTree_t(dimension_, std::cref(*data_interface_), 15));
+        nanoflann_index_->index->buildIndex();
+    }
     return true;
 }
 
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -50,21 +51,39 @@ namespace geometry {
 /// \brief KDTree with FLANN for nearest neighbor search.
 class KDTreeFlann {
 public:
+    /// \enum Precision
+    ///
+    /// \brief Floating point precision of the points stored in the KDTree.
+    enum class Precision {
+        /// Points and distances are stored as double.
+        Float64,
+        /// Points are stored and compared as float. This halves the memory of
+        /// the index and speeds up searches, at the cost of accuracy for
+        /// points far from the origin. Distances are still returned as double.
+        Float32,
+    };
+
     /// \brief Default Constructor.
     KDTreeFlann();
     /// \brief Parameterized Constructor.
     ///
     /// \param data Provides set of data points for KDTree construction.
-    KDTreeFlann(const Eigen::MatrixXd &data);
+    /// \param precision Precision of the KDTree.
+    KDTreeFlann(const Eigen::MatrixXd &data,
+                Precision precision = Precision::Float64);
     /// \brief Parameterized Constructor.
     ///
     /// \param geometry Provides geometry from which KDTree is constructed.
-    KDTreeFlann(const Geometry &geometry);
+    /// \param precision Precision of the KDTree.
+    KDTreeFlann(const Geometry &geometry,
+                Precision precision = Precision::Float64);
     /// \brief Parameterized Constructor.
     ///
     /// \param feature Provides a set of features from which the KDTree is
     /// constructed.
-    KDTreeFlann(const pipelines::registration::Feature &feature);
+    /// \param precision Precision of the KDTree.
+    KDTreeFlann(const pipelines::registration::Feature &feature,
+                Precision precision = Precision::Float64);
     ~KDTreeFlann();
     KDTreeFlann(const KDTreeFlann &) = delete;
     KDTreeFlann &operator=(const KDTreeFlann &) = delete;
@@ -73,15 +92,24 @@ public:
     /// Sets the data for the KDTree from a matrix.
     ///
     /// \param data Data points for KDTree Construction.
-    bool SetMatrixData(const Eigen::MatrixXd &data);
+    /// \param precision Precision of the KDTree.
+    bool SetMatrixData(const Eigen::MatrixXd &data,
+                       Precision precision = Precision::Float64);
     /// Sets the data for the KDTree from geometry.
     ///
     /// \param geometry Geometry for KDTree Construction.
-    bool SetGeometry(const Geometry &geometry);
+    /// \param precision Precision of the KDTree.
+    bool SetGeometry(const Geometry &geometry,
+                     Precision precision = Precision::Float64);
     /// Sets the data for the KDTree from the feature data.
     ///
     /// \param feature Set of features for KDTree construction.
-    bool SetFeature(const pipelines::registration::Feature &feature);
+    /// \param precision Precision of the KDTree.
+    bool SetFeature(const pipelines::registration::Feature &feature,
+                    Precision precision = Precision::Float64);
+
+    /// Returns the precision the KDTree was built with.
+    Precision GetPrecision() const { return precision_; }
 
     template <typename T>
     int Search(const T &query,
@@ -108,12 +136,69 @@ public:
                      std::vector<int> &indices,
                      std::vector<double> &distance2) const;
 
+    /// \brief Batched search for all columns of \p queries.
+    ///
+    /// Queries are processed in parallel. The neighbors of query i are
+    /// written to indices[row_splits[i]:row_splits[i + 1]] and
+    /// distance2[row_splits[i]:row_splits[i + 1]]. The output vectors are
+    /// resized as needed, so reusing them across calls avoids reallocation.
+    ///
+    /// \param queries Query points, one per column. The number of rows must
+    /// match the dimension of the KDTree.
+    /// \param param Search parameters.
+    /// \param indices Output neighbor indices.
+    /// \param distance2 Output squared distances.
+    /// \param row_splits Output offsets of size queries.cols() + 1.
+    /// \return The total number of neighbors found, or -1 on failure.
+    int64_t Search(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                   const KDTreeSearchParam &param,
+                   std::vector<int> &indices,
+                   std::vector<double> &distance2,
+                   std::vector<int64_t> &row_splits) const;
+
+    /// \brief Batched KNN search. See the batched Search() for the output
+    /// layout.
+    int64_t SearchKNN(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                      int knn,
+                      std::vector<int> &indices,
+                      std::vector<double> &distance2,
+                      std::vector<int64_t> &row_splits) const;
+
+    /// \brief Batched radius search. See the batched Search() for the output
+    /// layout.
+    int64_t SearchRadius(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                         double radius,
+                         std::vector<int> &indices,
+                         std::vector<double> &distance2,
+                         std::vector<int64_t> &row_splits) const;
+
+    /// \brief Batched hybrid search. See the batched Search() for the output
+    /// layout.
+    int64_t SearchHybrid(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                         double radius,
+                         int max_nn,
+                         std::vector<int> &indices,
+                         std::vector<double> &distance2,
+                         std::vector<int64_t> &row_splits) const;
+
 private:
     /// \brief Sets the KDTree data from the data provided by the other methods.
     ///
     /// Internal method that sets all the members of KDTree by data provided by
     /// features, geometry, etc.
-    bool SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data);
+    bool SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data,
+                    Precision precision);
+
+    /// Returns true if the KDTree is built and accepts \p dimension queries.
+    bool IsQueryValid(int64_t dimension) const;
+
+    /// Shared implementation of the batched KNN and hybrid searches.
+    int64_t SearchKNNBatch(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                           int knn,
+                           double radius,
+                           std::vector<int> &indices,
+                           std::vector<double> &distance2,
+                           std::vector<int64_t> &row_splits) const;
 
 protected:
     using KDTree_t = nanoflann::KDTreeEigenMatrixAdaptor<
@@ -121,10 +206,19 @@ protected:
             -1,
             nanoflann::metric_L2,
             false>;
+    using KDTreeFloat_t = nanoflann::KDTreeEigenMatrixAdaptor<
+            Eigen::Map<const Eigen::MatrixXf>,
+            -1,
+            nanoflann::metric_L2,
+            false>;
 
     std::vector<double> data_;
     std::unique_ptr<Eigen::Map<const Eigen::MatrixXd>> data_interface_;
     std::unique_ptr<KDTree_t> nanoflann_index_;
+    std::vector<float> data_float_;
+    std::unique_ptr<Eigen::Map<const Eigen::MatrixXf>> data_interface_float_;
+    std::unique_ptr<KDTreeFloat_t> nanoflann_index_float_;
+    Precision precision_ = Precision::Float64;
     size_t dimension_ = 0;
     size_t dataset_size_ = 0;
 };
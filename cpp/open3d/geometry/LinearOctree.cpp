@@ -0,0 +1,399 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/LinearOctree.h"
+
+#include <tbb/parallel_sort.h>
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <limits>
+
+#include "open3d/core/nns/MortonOrder.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/VoxelGrid.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+// Code of items that are out of bound. Valid codes use at most 63 bits.
+static constexpr uint64_t kInvalidCode = std::numeric_limits<uint64_t>::max();
+
+constexpr size_t LinearOctree::kMaxDepth;
+
+LinearOctree& LinearOctree::Clear() {
+    leaf_codes_.clear();
+    leaf_colors_.clear();
+    leaf_point_splits_.clear();
+    point_indices_.clear();
+    return *this;
+}
+
+void LinearOctree::ConvertFromPointCloud(
+        const geometry::PointCloud& point_cloud, double size_expand) {
+    if (size_expand > 1 || size_expand < 0) {
+        utility::LogError("size_expand shall be between 0 and 1");
+    }
+    if (max_depth_ > kMaxDepth) {
+        utility::LogError("max_depth {} exceeds the supported depth {}.",
+                          max_depth_, kMaxDepth);
+    }
+
+    // Set bounds
+    Clear();
+    Eigen::Array3d min_bound = point_cloud.GetMinBound();
+    Eigen::Array3d max_bound = point_cloud.GetMaxBound();
+    Eigen::Array3d center = (min_bound + max_bound) / 2;
+    Eigen::Array3d half_sizes = center - min_bound;
+    double max_half_size = half_sizes.maxCoeff();
+    origin_ = min_bound.min(center - max_half_size);
+    if (max_half_size == 0) {
+        size_ = size_expand;
+    } else {
+        size_ = max_half_size * 2 * (1 + size_expand);
+    }
+
+    const std::vector<Eigen::Vector3d>& points = point_cloud.points_;
+    std::vector<std::pair<uint64_t, size_t>> code_items(points.size());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t idx = 0; idx < int64_t(points.size()); ++idx) {
+        uint64_t code;
+        if (!ComputeLeafCode(points[idx], code)) {
+            code = kInvalidCode;
+        }
+        code_items[idx] = std::make_pair(code, size_t(idx));
+    }
+    const std::vector<Eigen::Vector3d> no_colors;
+    BuildFromCodes(code_items,
+                   point_cloud.HasColors() ? point_cloud.colors_ : no_colors,
+                   /*store_point_indices=*/true);
+}
+
+void LinearOctree::CreateFromVoxelGrid(const geometry::VoxelGrid& voxel_grid) {
+    if (max_depth_ > kMaxDepth) {
+        utility::LogError("max_depth {} exceeds the supported depth {}.",
+                          max_depth_, kMaxDepth);
+    }
+    Clear();
+    origin_ = voxel_grid.origin_;
+    size_ = (voxel_grid.GetMaxBound() - origin_).maxCoeff();
+
+    // Keep the iteration order of the voxels so that, as in
+    // Octree::CreateFromVoxelGrid, the last voxel of a leaf sets its color.
+    std::vector<const geometry::Voxel*> voxels;
+    voxels.reserve(voxel_grid.voxels_.size());
+    for (const auto& voxel_iter : voxel_grid.voxels_) {
+        voxels.push_back(&voxel_iter.second);
+    }
+
+    double half_voxel_size = voxel_grid.voxel_size_ / 2.;
+    std::vector<std::pair<uint64_t, size_t>> code_items(voxels.size());
+    std::vector<Eigen::Vector3d> colors(voxels.size());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t idx = 0; idx < int64_t(voxels.size()); ++idx) {
+        const geometry::Voxel& voxel = *voxels[idx];
+        Eigen::Vector3d mid_point = half_voxel_size + origin_.array() +
+                                    voxel.grid_index_.array().cast<double>() *
+                                            voxel_grid.voxel_size_;
+        uint64_t code;
+        if (!ComputeLeafCode(mid_point, code)) {
+            code = kInvalidCode;
+        }
+        code_items[idx] = std::make_pair(code, size_t(idx));
+        colors[idx] = voxel.color_;
+    }
+    BuildFromCodes(code_items, colors, /*store_point_indices=*/false);
+}
+
+std::shared_ptr<geometry::VoxelGrid> LinearOctree::ToVoxelGrid() const {
+    auto voxel_grid = std::make_shared<geometry::VoxelGrid>();
+    voxel_grid->origin_ = origin_;
+    double leaf_size = size_;
+    for (size_t depth = 0; depth < max_depth_; ++depth) {
+        leaf_size /= 2.0;
+    }
+    voxel_grid->voxel_size_ = leaf_size;
+    for (size_t i = 0; i < leaf_codes_.size(); ++i) {
+        uint32_t x, y, z;
+        core::nns::MortonDecode(leaf_codes_[i], x, y, z);
+        voxel_grid->AddVoxel(geometry::Voxel(
+                Eigen::Vector3i(int(x), int(y), int(z)), leaf_colors_[i]));
+    }
+    return voxel_grid;
+}
+
+void LinearOctree::CreateFromOctree(const geometry::Octree& octree) {
+    if (octree.max_depth_ > kMaxDepth) {
+        utility::LogError("max_depth {} exceeds the supported depth {}.",
+                          octree.max_depth_, kMaxDepth);
+    }
+    Clear();
+    origin_ = octree.origin_;
+    size_ = octree.size_;
+    max_depth_ = octree.max_depth_;
+
+    // Octree::Traverse visits the children in Morton order, so the leaves are
+    // collected already sorted.
+    bool has_point_leaves = false;
+    leaf_point_splits_.push_back(0);
+    auto f_collect_leaves =
+            [&](const std::shared_ptr<OctreeNode>& node,
+                const std::shared_ptr<OctreeNodeInfo>& node_info) -> bool {
+        auto leaf_node = std::dynamic_pointer_cast<OctreeLeafNode>(node);
+        if (leaf_node == nullptr) {
+            return false;
+        }
+        auto color_leaf_node =
+                std::dynamic_pointer_cast<OctreeColorLeafNode>(leaf_node);
+        if (color_leaf_node == nullptr) {
+            utility::LogError("Unsupported leaf node type.");
+        }
+        uint64_t code;
+        Eigen::Vector3d center =
+                node_info->origin_.array() + node_info->size_ / 2.0;
+        if (node_info->depth_ != max_depth_ ||
+            !ComputeLeafCode(center, code)) {
+            utility::LogError("Leaf nodes must be at max_depth.");
+        }
+        leaf_codes_.push_back(code);
+        leaf_colors_.push_back(color_leaf_node->color_);
+        if (auto point_color_leaf_node =
+                    std::dynamic_pointer_cast<OctreePointColorLeafNode>(
+                            leaf_node)) {
+            has_point_leaves = true;
+            point_indices_.insert(point_indices_.end(),
+                                  point_color_leaf_node->indices_.begin(),
+                                  point_color_leaf_node->indices_.end());
+        }
+        leaf_point_splits_.push_back(point_indices_.size());
+        return false;
+    };
+    octree.Traverse(f_collect_leaves);
+    if (!has_point_leaves) {
+        leaf_point_splits_.clear();
+    }
+}
+
+std::shared_ptr<geometry::Octree> LinearOctree::ToOctree() const {
+    auto octree =
+            std::make_shared<geometry::Octree>(max_depth_, origin_, size_);
+    auto leaf_center = [this](size_t leaf_index) -> Eigen::Vector3d {
+        OctreeNodeInfo node_info = GetLeafNodeInfo(leaf_index);
+        return node_info.origin_.array() + node_info.size_ / 2.0;
+    };
+    if (!HasPointIndices()) {
+        for (size_t i = 0; i < leaf_codes_.size(); ++i) {
+            octree->InsertPoint(
+                    leaf_center(i), OctreeColorLeafNode::GetInitFunction(),
+                    OctreeColorLeafNode::GetUpdateFunction(leaf_colors_[i]));
+        }
+        return octree;
+    }
+
+    // Insert the points by increasing index, as ConvertFromPointCloud does, so
+    // that the internal nodes list their points in the same order.
+    std::vector<std::pair<size_t, size_t>> point_leaves;
+    point_leaves.reserve(point_indices_.size());
+    for (size_t i = 0; i < leaf_codes_.size(); ++i) {
+        if (leaf_point_splits_[i] == leaf_point_splits_[i + 1]) {
+            octree->InsertPoint(
+                    leaf_center(i), OctreePointColorLeafNode::GetInitFunction(),
+                    OctreeColorLeafNode::GetUpdateFunction(leaf_colors_[i]),
+                    OctreeInternalPointNode::GetInitFunction());
+        }
+        for (size_t j = leaf_point_splits_[i]; j < leaf_point_splits_[i + 1];
+             ++j) {
+            point_leaves.emplace_back(point_indices_[j], i);
+        }
+    }
+    std::sort(point_leaves.begin(), point_leaves.end());
+    for (const auto& point_leaf : point_leaves) {
+        size_t idx = point_leaf.first;
+        size_t leaf = point_leaf.second;
+        octree->InsertPoint(
+                leaf_center(leaf), OctreePointColorLeafNode::GetInitFunction(),
+                OctreePointColorLeafNode::GetUpdateFunction(idx,
+                                                            leaf_colors_[leaf]),
+                OctreeInternalPointNode::GetInitFunction(),
+                OctreeInternalPointNode::GetUpdateFunction(idx));
+    }
+    return octree;
+}
+
+bool LinearOctree::ComputeLeafCode(const Eigen::Vector3d& point,
+                                   uint64_t& code) const {
+    // Descend like Octree::InsertPointRecurse, so that points on cell borders
+    // end up in the same leaf as in Octree.
+    Eigen::Vector3d origin = origin_;
+    double size = size_;
+    if (!Octree::IsPointInBound(point, origin, size)) {
+        return false;
+    }
+    code = 0;
+    for (size_t depth = 0; depth < max_depth_; ++depth) {
+        double child_size = size / 2.0;
+        size_t x_index = point(0) < origin(0) + child_size ? 0 : 1;
+        size_t y_index = point(1) < origin(1) + child_size ? 0 : 1;
+        size_t z_index = point(2) < origin(2) + child_size ? 0 : 1;
+        origin += Eigen::Vector3d(x_index * child_size, y_index * child_size,
+                                  z_index * child_size);
+        size = child_size;
+        if (!Octree::IsPointInBound(point, origin, size)) {
+            return false;
+        }
+        code = code << 3 | (x_index + y_index * 2 + z_index * 4);
+    }
+    return true;
+}
+
+std::pair<int64_t, OctreeNodeInfo> LinearOctree::LocateLeafNode(
+        const Eigen::Vector3d& point) const {
+    uint64_t code;
+    if (ComputeLeafCode(point, code)) {
+        auto it = std::lower_bound(leaf_codes_.begin(), leaf_codes_.end(),
+                                   code);
+        if (it != leaf_codes_.end() && *it == code) {
+            size_t leaf_index = it - leaf_codes_.begin();
+            return std::make_pair(int64_t(leaf_index),
+                                  GetLeafNodeInfo(leaf_index));
+        }
+    }
+    return std::make_pair(int64_t(-1), OctreeNodeInfo());
+}
+
+OctreeNodeInfo LinearOctree::GetLeafNodeInfo(size_t leaf_index) const {
+    uint64_t code = leaf_codes_[leaf_index];
+    Eigen::Vector3d origin = origin_;
+    double size = size_;
+    size_t child_index = 0;
+    for (size_t depth = 0; depth < max_depth_; ++depth) {
+        double child_size = size / 2.0;
+        child_index = (code >> (3 * (max_depth_ - depth - 1))) & 7;
+        origin = origin + Eigen::Vector3d(double(child_index % 2),
+                                          double((child_index / 2) % 2),
+                                          double((child_index / 4) % 2)) *
+                                  child_size;
+        size = child_size;
+    }
+    return OctreeNodeInfo(origin, size, max_depth_, child_index);
+}
+
+void LinearOctree::Traverse(const std::function<bool(const OctreeNodeInfo&,
+                                                     size_t begin,
+                                                     size_t end)>& f) const {
+    if (leaf_codes_.empty()) {
+        return;
+    }
+    // The root's child index is 0, though it isn't a child node
+    TraverseRecurse(OctreeNodeInfo(origin_, size_, 0, 0), 0,
+                    leaf_codes_.size(), f);
+}
+
+void LinearOctree::TraverseRecurse(
+        const OctreeNodeInfo& node_info,
+        size_t begin,
+        size_t end,
+        const std::function<bool(const OctreeNodeInfo&,
+                                 size_t begin,
+                                 size_t end)>& f) const {
+    // Allow caller to avoid traversing further down this tree path
+    if (f(node_info, begin, end) || node_info.depth_ == max_depth_) {
+        return;
+    }
+
+    // The leaves of a node are sorted by child index, so each child covers a
+    // contiguous subrange.
+    double child_size = node_info.size_ / 2.0;
+    size_t shift = 3 * (max_depth_ - node_info.depth_ - 1);
+    for (size_t child_index = 0; child_index < 8 && begin < end;
+         ++child_index) {
+        size_t child_end =
+                std::partition_point(leaf_codes_.begin() + begin,
+                                     leaf_codes_.begin() + end,
+                                     [&](uint64_t code) {
+                                         return ((code >> shift) & 7) <=
+                                                child_index;
+                                     }) -
+                leaf_codes_.begin();
+        if (child_end == begin) {
+            continue;
+        }
+        Eigen::Vector3d child_origin =
+                node_info.origin_ + Eigen::Vector3d(double(child_index % 2),
+                                                    double((child_index / 2) %
+                                                           2),
+                                                    double((child_index / 4) %
+                                                           2)) *
+                                            child_size;
+        TraverseRecurse(OctreeNodeInfo(child_origin, child_size,
+                                       node_info.depth_ + 1, child_index),
+                        begin, child_end, f);
+        begin = child_end;
+    }
+}
+
+void LinearOctree::BuildFromCodes(
+        std::vector<std::pair<uint64_t, size_t>>& code_items,
+        const std::vector<Eigen::Vector3d>& colors,
+        bool store_point_indices) {
+    // Ties are broken by item, so the last item of a leaf is the one with the
+    // largest index. Out-of-bound items sort last and are dropped.
+    tbb::parallel_sort(code_items.begin(), code_items.end());
+    size_t num_items =
+            std::lower_bound(code_items.begin(), code_items.end(),
+                             std::make_pair(kInvalidCode, size_t(0))) -
+            code_items.begin();
+
+    Clear();
+    if (store_point_indices) {
+        point_indices_.resize(num_items);
+    }
+    for (size_t i = 0; i < num_items; ++i) {
+        if (i == 0 || code_items[i].first != code_items[i - 1].first) {
+            leaf_codes_.push_back(code_items[i].first);
+            leaf_colors_.push_back(Eigen::Vector3d::Zero());
+            if (store_point_indices) {
+                leaf_point_splits_.push_back(i);
+            }
+        }
+        if (!colors.empty()) {
+            leaf_colors_.back() = colors[code_items[i].second];
+        }
+        if (store_point_indices) {
+            point_indices_[i] = code_items[i].second;
+        }
+    }
+    if (store_point_indices) {
+        leaf_point_splits_.push_back(num_items);
+    }
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,182 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "open3d/geometry/Octree.h"
+
+namespace open3d {
+namespace geometry {
+
+class PointCloud;
+class VoxelGrid;
+
+/// \class LinearOctree
+///
+/// \brief Pointer-free octree stored as flat arrays of leaves.
+///
+/// Each leaf is identified by the Morton code of its cell at max_depth_, and
+/// the leaves are kept sorted by code. Every internal node of the equivalent
+/// Octree covers a contiguous range of leaves, so internal nodes are implicit
+/// and traversal needs no pointers. The leaf of a point is found by a binary
+/// search over the codes.
+class LinearOctree {
+public:
+    /// Maximum depth supported by the 63-bit Morton codes.
+    static constexpr size_t kMaxDepth = 21;
+
+    /// \brief Default Constructor.
+    LinearOctree() : origin_(0, 0, 0), size_(0), max_depth_(0) {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_depth Sets the value of the max depth of the octree.
+    explicit LinearOctree(size_t max_depth)
+        : origin_(0, 0, 0), size_(0), max_depth_(max_depth) {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_depth Sets the value of the max depth of the octree.
+    /// \param origin Sets the global min bound of the octree.
+    /// \param size Sets the outer bounding box edge size for the whole octree.
+    LinearOctree(size_t max_depth, const Eigen::Vector3d& origin, double size)
+        : origin_(origin), size_(size), max_depth_(max_depth) {}
+
+public:
+    /// Removes all leaves, keeping the bounds and the max depth.
+    LinearOctree& Clear();
+    /// Returns true if the octree has no leaves.
+    bool IsEmpty() const { return leaf_codes_.empty(); }
+    /// Returns true if the leaves store the indices of their points.
+    bool HasPointIndices() const { return !leaf_point_splits_.empty(); }
+    /// Returns the number of leaves.
+    size_t NumLeaves() const { return leaf_codes_.size(); }
+
+    /// \brief Convert octree from point cloud.
+    ///
+    /// Equivalent to Octree::ConvertFromPointCloud. The leaf codes of all
+    /// points are computed and sorted in parallel.
+    ///
+    /// \param point_cloud Input point cloud.
+    /// \param size_expand A small expansion size such that the octree is
+    /// slightly bigger than the original point cloud bounds to accomodate all
+    /// points.
+    void ConvertFromPointCloud(const geometry::PointCloud& point_cloud,
+                               double size_expand = 0.01);
+
+    /// Convert from voxel grid, equivalent to Octree::CreateFromVoxelGrid.
+    void CreateFromVoxelGrid(const geometry::VoxelGrid& voxel_grid);
+
+    /// Convert to VoxelGrid.
+    std::shared_ptr<geometry::VoxelGrid> ToVoxelGrid() const;
+
+    /// \brief Convert from an Octree.
+    ///
+    /// Only OctreeColorLeafNode and OctreePointColorLeafNode leaves are
+    /// supported.
+    void CreateFromOctree(const geometry::Octree& octree);
+
+    /// Convert to an Octree with the same nodes.
+    std::shared_ptr<geometry::Octree> ToOctree() const;
+
+    /// \brief Returns the Morton code of the leaf cell containing \p point.
+    ///
+    /// The point is assigned to a cell the same way Octree::InsertPoint
+    /// descends the tree. Returns false if the point is out of bound.
+    bool ComputeLeafCode(const Eigen::Vector3d& point, uint64_t& code) const;
+
+    /// \brief Returns the index of the leaf where the query point resides and
+    /// the OctreeNodeInfo of that leaf.
+    ///
+    /// The index is -1 if there is no such leaf.
+    ///
+    /// \param point Coordinates of the point.
+    std::pair<int64_t, OctreeNodeInfo> LocateLeafNode(
+            const Eigen::Vector3d& point) const;
+
+    /// Returns the OctreeNodeInfo of the leaf with index \p leaf_index.
+    OctreeNodeInfo GetLeafNodeInfo(size_t leaf_index) const;
+
+    /// \brief DFS traversal of the octree from the root, with callback
+    /// function called for each node, in the same order as Octree::Traverse.
+    ///
+    /// \param f Callback which fires with each traversed internal/leaf node.
+    /// Arguments supply the node information and the range [begin, end) of
+    /// leaves below the node. A node is a leaf iff its depth is max_depth_.
+    /// If f returns true, children of this node will not be traversed.
+    void Traverse(const std::function<bool(const OctreeNodeInfo&,
+                                           size_t begin,
+                                           size_t end)>& f) const;
+
+public:
+    /// Global min bound (include). A point is within bound iff
+    /// origin_ <= point < origin_ + size_.
+    Eigen::Vector3d origin_;
+
+    /// Outer bounding box edge size for the whole octree. A point is within
+    /// bound iff origin_ <= point < origin_ + size_.
+    double size_;
+
+    /// Max depth of octree. All leaves are at this depth.
+    size_t max_depth_;
+
+    /// Sorted Morton codes of the leaf cells.
+    std::vector<uint64_t> leaf_codes_;
+
+    /// Color of each leaf.
+    std::vector<Eigen::Vector3d> leaf_colors_;
+
+    /// Leaf i holds point_indices_[leaf_point_splits_[i]] to
+    /// point_indices_[leaf_point_splits_[i + 1] - 1]. Empty if the leaves do
+    /// not store points.
+    std::vector<size_t> leaf_point_splits_;
+
+    /// Point indices grouped by leaf.
+    std::vector<size_t> point_indices_;
+
+private:
+    void TraverseRecurse(const OctreeNodeInfo& node_info,
+                         size_t begin,
+                         size_t end,
+                         const std::function<bool(const OctreeNodeInfo&,
+                                                  size_t begin,
+                                                  size_t end)>& f) const;
+
+    /// Builds the leaves from unsorted (code, item) pairs. Codes of items that
+    /// are out of bound must be set to UINT64_MAX. The color of a leaf is the
+    /// color of its last item.
+    void BuildFromCodes(std::vector<std::pair<uint64_t, size_t>>& code_items,
+                        const std::vector<Eigen::Vector3d>& colors,
+                        bool store_point_indices);
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -260,6 +260,9 @@ public:
 /// \class Octree
 ///
 /// \brief Octree datastructure.
+///
+/// See LinearOctree for a pointer-free representation of the same tree that is
+/// faster to build, search and store.
 class Octree : public Geometry3D, public utility::IJsonConvertible {
 public:
     /// \brief Default Constructor.
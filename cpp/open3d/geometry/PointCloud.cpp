@@ -511,15 +511,17 @@ PointCloud::RemoveRadiusOutliers(size_t nb_points,
     std::vector<bool> mask = std::vector<bool>(points_.size());
     utility::OMPProgressBar progress_bar(
             points_.size(), "Remove radius outliers: ", print_progress);
-#pragma omp parallel for schedule(static) \
-        num_threads(utility::EstimateMaxThreads())
-    for (int i = 0; i < int(points_.size()); i++) {
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+    {
         std::vector<int> tmp_indices;
         std::vector<double> dist;
-        size_t nb_neighbors = kdtree.SearchRadius(points_[i], search_radius,
-                                                  tmp_indices, dist);
-        mask[i] = (nb_neighbors > nb_points);
-        ++progress_bar;
+#pragma omp for schedule(static)
+        for (int i = 0; i < int(points_.size()); i++) {
+            size_t nb_neighbors = kdtree.SearchRadius(
+                    points_[i], search_radius, tmp_indices, dist);
+            mask[i] = (nb_neighbors > nb_points);
+            ++progress_bar;
+        }
     }
     std::vector<size_t> indices;
     for (size_t i = 0; i < mask.size(); i++) {
@@ -600,19 +602,24 @@ std::vector<Eigen::Matrix3d> PointCloud::EstimatePerPointCovariances(
 
     KDTreeFlann kdtree;
     kdtree.SetGeometry(input);
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)points.size(); i++) {
+#pragma omp parallel
+    {
+        // Reused across points to avoid reallocating per query.
         std::vector<int> indices;
         std::vector<double> distance2;
-        if (kdtree.Search(points[i], search_param, indices, distance2) >= 3) {
-            auto covariance = utility::ComputeCovariance(points, indices);
-            if (input.HasCovariances() && covariance.isIdentity(1e-4)) {
-                covariances[i] = input.covariances_[i];
+#pragma omp for schedule(static)
+        for (int i = 0; i < (int)points.size(); i++) {
+            if (kdtree.Search(points[i], search_param, indices, distance2) >=
+                3) {
+                auto covariance = utility::ComputeCovariance(points, indices);
+                if (input.HasCovariances() && covariance.isIdentity(1e-4)) {
+                    covariances[i] = input.covariances_[i];
+                } else {
+                    covariances[i] = covariance;
+                }
             } else {
-                covariances[i] = covariance;
+                covariances[i] = Eigen::Matrix3d::Identity();
             }
-        } else {
-            covariances[i] = Eigen::Matrix3d::Identity();
         }
     }
     return covariances;
@@ -328,6 +328,12 @@ public:
     /// Returns a list of point labels, -1 indicates noise according to
     /// the algorithm.
     ///
+    /// Points are binned into a grid with cells of size \p eps and
+    /// neighborhoods are streamed cell by cell, so the memory use is linear
+    /// in the number of points. Core points are merged with a concurrent
+    /// disjoint set. Clusters are numbered in the order of their lowest
+    /// point index.
+    ///
     /// \param eps Density parameter that is used to find neighbouring points.
     /// \param min_points Minimum number of points to form a cluster.
     /// \param print_progress If `true` the progress is visualized in the
@@ -338,21 +344,28 @@ public:
 
     /// \brief Segment PointCloud plane using the RANSAC algorithm.
     ///
+    /// Hypotheses are scored in parallel. The search stops early once a plane
+    /// with enough inliers makes further iterations unlikely to find a better
+    /// one with the given \p probability.
+    ///
     /// \param distance_threshold Max distance a point can be from the plane
     /// model, and still be considered an inlier.
     /// \param ransac_n Number of initial points to be considered inliers in
     /// each iteration.
-    /// \param num_iterations Number of iterations.
+    /// \param num_iterations Maximum number of iterations.
     /// \param seed Sets the seed value used in the random
     /// generator, set to nullopt to use a random seed value with each function
-    /// call.
+    /// call. Results are reproducible for a fixed seed.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// Use 1.0 to always run \p num_iterations iterations.
     /// \return Returns the plane model ax + by + cz + d = 0 and the indices of
     /// the plane inliers.
     std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlane(
             const double distance_threshold = 0.01,
             const int ransac_n = 3,
             const int num_iterations = 100,
-            utility::optional<int> seed = utility::nullopt) const;
+            utility::optional<int> seed = utility::nullopt,
+            const double probability = 0.99999999) const;
 
     /// \brief Factory function to create a pointcloud from a depth image and a
     /// camera model.
@@ -25,9 +25,13 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
-#include <unordered_set>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
 
-#include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/Parallel.h"
@@ -36,77 +40,320 @@
 namespace open3d {
 namespace geometry {
 
-std::vector<int> PointCloud::ClusterDBSCAN(double eps,
-                                           size_t min_points,
-                                           bool print_progress) const {
-    KDTreeFlann kdtree(*this);
+namespace {
+
+/// Disjoint-set forest that can be merged concurrently. Links always point
+/// from the larger to the smaller index, so the root of every set is its
+/// smallest element and parents only ever decrease.
+class ConcurrentDisjointSet {
+public:
+    explicit ConcurrentDisjointSet(size_t size) : parents_(size) {
+        for (size_t i = 0; i < size; ++i) {
+            parents_[i].store(int(i), std::memory_order_relaxed);
+        }
+    }
+
+    int Find(int x) {
+        while (true) {
+            int parent = parents_[x].load(std::memory_order_relaxed);
+            if (parent == x) {
+                return x;
+            }
+            int grandparent = parents_[parent].load(std::memory_order_relaxed);
+            if (grandparent != parent) {
+                // Path halving, a failed exchange only means another thread
+                // already shortened the path.
+                parents_[x].compare_exchange_weak(parent, grandparent,
+                                                  std::memory_order_relaxed);
+            }
+            x = grandparent;
+        }
+    }
+
+    void Union(int a, int b) {
+        while (true) {
+            a = Find(a);
+            b = Find(b);
+            if (a == b) {
+                return;
+            }
+            if (a < b) {
+                std::swap(a, b);
+            }
+            // Link only if a is still a root, otherwise retry from the top.
+            int expected = a;
+            if (parents_[a].compare_exchange_strong(expected, b)) {
+                return;
+            }
+        }
+    }
+
+private:
+    std::vector<std::atomic<int>> parents_;
+};
+
+/// Uniform grid with cells of at least eps, stored as point indices sorted
+/// by cell. Every eps-neighbor of a point lies in the 27 cells around it.
+/// Cells are keyed in x-y-z order, so the three cells of a z column are
+/// adjacent and their points form one contiguous range.
+class DBSCANGrid {
+public:
+    typedef std::array<std::pair<int64_t, int64_t>, 9> Neighborhood;
 
-    // Precompute all neighbors.
-    utility::LogDebug("Precompute neighbors.");
-    utility::ProgressBar progress_bar(points_.size(), "Precompute neighbors.",
-                                      print_progress);
-    std::vector<std::vector<int>> nbs(points_.size());
+    DBSCANGrid(const std::vector<Eigen::Vector3d> &points, double eps) {
+        Eigen::Vector3d min_bound = points[0];
+        Eigen::Vector3d max_bound = points[0];
+        for (const Eigen::Vector3d &p : points) {
+            min_bound = min_bound.cwiseMin(p);
+            max_bound = max_bound.cwiseMax(p);
+        }
+        // Coarser cells keep every coordinate within 21 bits, which is still
+        // correct since only the lower bound on the cell size matters.
+        double cell_size = std::max(
+                eps, (max_bound - min_bound).maxCoeff() / double(kMaxCoord));
+        if (!(cell_size > 0)) {
+            cell_size = 1;
+        }
+        min_bound_ = min_bound;
+        inv_cell_size_ = 1.0 / cell_size;
+
+        const int64_t num_points = int64_t(points.size());
+        std::vector<uint64_t> keys(num_points);
 #pragma omp parallel for schedule(static) \
         num_threads(utility::EstimateMaxThreads())
-    for (int idx = 0; idx < int(points_.size()); ++idx) {
-        std::vector<double> dists2;
-        kdtree.SearchRadius(points_[idx], eps, nbs[idx], dists2);
+        for (int64_t i = 0; i < num_points; ++i) {
+            Eigen::Vector3i cell = ((points[i] - min_bound_) * inv_cell_size_)
+                                           .array()
+                                           .floor()
+                                           .cast<int>()
+                                           .matrix();
+            keys[i] = EncodeKey(cell(0), cell(1), cell(2));
+        }
+
+        order_.resize(num_points);
+        std::iota(order_.begin(), order_.end(), 0);
+        std::sort(order_.begin(), order_.end(), [&](int a, int b) {
+            return keys[a] < keys[b] || (keys[a] == keys[b] && a < b);
+        });
 
-#pragma omp critical(ClusterDBSCAN)
-        { ++progress_bar; }
+        sorted_points_.resize(num_points);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < num_points; ++i) {
+            sorted_points_[i] = points[order_[i]];
+        }
+        for (int64_t i = 0; i < num_points; ++i) {
+            uint64_t key = keys[order_[i]];
+            if (cell_keys_.empty() || cell_keys_.back() != key) {
+                cell_keys_.push_back(key);
+                cell_begins_.push_back(i);
+            }
+        }
+        cell_begins_.push_back(num_points);
+        for (size_t c = 0; c < cell_keys_.size(); ++c) {
+            uint64_t row_key = cell_keys_[c] >> kBits;
+            if (row_keys_.empty() || row_keys_.back() != row_key) {
+                row_keys_.push_back(row_key);
+                row_begins_.push_back(c);
+            }
+        }
+        row_begins_.push_back(cell_keys_.size());
     }
-    utility::LogDebug("Done Precompute neighbors.");
 
-    // Set all labels to undefined (-2).
-    utility::LogDebug("Compute Clusters");
-    progress_bar.Reset(points_.size(), "Clustering", print_progress);
-    std::vector<int> labels(points_.size(), -2);
-    int cluster_label = 0;
-    for (size_t idx = 0; idx < points_.size(); ++idx) {
-        // Label is not undefined.
-        if (labels[idx] != -2) {
-            continue;
+    int64_t NumPoints() const { return int64_t(order_.size()); }
+
+    int64_t NumCells() const { return int64_t(cell_keys_.size()); }
+
+    /// Points of cell c are [CellBegin(c), CellBegin(c + 1)) in cell order.
+    int64_t CellBegin(int64_t c) const { return cell_begins_[c]; }
+
+    /// Original index of the i-th point in cell order.
+    int Index(int64_t i) const { return order_[i]; }
+
+    /// Returns the ranges of points in the 27 cells around cell c, one per
+    /// z column. Empty columns give empty ranges.
+    Neighborhood GetNeighborhood(int64_t c) const {
+        const uint64_t key = cell_keys_[c];
+        const int64_t x = int64_t(key >> (2 * kBits));
+        const int64_t y = int64_t((key >> kBits) & kMaxCoord);
+        const int64_t z = int64_t(key & kMaxCoord);
+        Neighborhood nbhd;
+        int n = 0;
+        for (int64_t nx = x - 1; nx <= x + 1; ++nx) {
+            for (int64_t ny = y - 1; ny <= y + 1; ++ny, ++n) {
+                nbhd[n] = std::make_pair(int64_t(0), int64_t(0));
+                if (nx < 0 || ny < 0 || nx > kMaxCoord || ny > kMaxCoord) {
+                    continue;
+                }
+                // Locate the x-y row first, the row index is small enough to
+                // stay in cache, then the z column within the row.
+                const uint64_t row_key =
+                        (uint64_t(nx) << kBits) | uint64_t(ny);
+                auto row = std::lower_bound(row_keys_.begin(),
+                                            row_keys_.end(), row_key);
+                if (row == row_keys_.end() || *row != row_key) {
+                    continue;
+                }
+                const size_t r = row - row_keys_.begin();
+                auto row_begin = cell_keys_.begin() + row_begins_[r];
+                auto row_end = cell_keys_.begin() + row_begins_[r + 1];
+                auto begin = std::lower_bound(
+                        row_begin, row_end,
+                        EncodeKey(nx, ny, std::max(z - 1, int64_t(0))));
+                auto end = std::upper_bound(
+                        begin, row_end,
+                        EncodeKey(nx, ny, z < kMaxCoord ? z + 1 : z));
+                nbhd[n] = std::make_pair(
+                        cell_begins_[begin - cell_keys_.begin()],
+                        cell_begins_[end - cell_keys_.begin()]);
+            }
         }
+        return nbhd;
+    }
 
-        // Check density.
-        if (nbs[idx].size() < min_points) {
-            labels[idx] = -1;
-            continue;
+    /// Calls f(j) for every point j (in cell order) in the neighborhood that
+    /// lies strictly within eps of the i-th point. Stops early once f returns
+    /// false.
+    template <typename Func>
+    void VisitNeighbors(const Neighborhood &nbhd,
+                        int64_t i,
+                        double eps2,
+                        Func f) const {
+        const Eigen::Vector3d &p = sorted_points_[i];
+        for (const auto &range : nbhd) {
+            for (int64_t j = range.first; j < range.second; ++j) {
+                if ((sorted_points_[j] - p).squaredNorm() < eps2 && !f(j)) {
+                    return;
+                }
+            }
         }
+    }
 
-        std::unordered_set<int> nbs_next(nbs[idx].begin(), nbs[idx].end());
-        std::unordered_set<int> nbs_visited;
-        nbs_visited.insert(int(idx));
+private:
+    static constexpr int kBits = 21;
+    static constexpr int64_t kMaxCoord = (int64_t(1) << kBits) - 1;
 
-        labels[idx] = cluster_label;
+    static uint64_t EncodeKey(int64_t x, int64_t y, int64_t z) {
+        return (uint64_t(x) << (2 * kBits)) | (uint64_t(y) << kBits) |
+               uint64_t(z);
+    }
+
+    Eigen::Vector3d min_bound_;
+    double inv_cell_size_;
+    std::vector<int> order_;
+    std::vector<Eigen::Vector3d> sorted_points_;
+    std::vector<uint64_t> cell_keys_;
+    std::vector<int64_t> cell_begins_;
+    std::vector<uint64_t> row_keys_;
+    std::vector<size_t> row_begins_;
+};
+
+}  // namespace
+
+std::vector<int> PointCloud::ClusterDBSCAN(double eps,
+                                           size_t min_points,
+                                           bool print_progress) const {
+    if (points_.empty()) {
+        return {};
+    }
+    const double eps2 = eps * eps;
+
+    // Bin the points, neighborhoods are then streamed from the grid instead
+    // of being stored per point.
+    utility::LogDebug("Build DBSCAN grid.");
+    DBSCANGrid grid(points_, eps);
+    const int64_t num_points = grid.NumPoints();
+    utility::LogDebug("Done build DBSCAN grid.");
+
+    // A core point has at least min_points neighbors, itself included.
+    utility::LogDebug("Find core points.");
+    const int64_t num_cells = grid.NumCells();
+    utility::OMPProgressBar progress_bar(num_cells, "Find core points",
+                                         print_progress);
+    std::vector<uint8_t> is_core(num_points, 0);
+#pragma omp parallel for schedule(dynamic, 64) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t c = 0; c < num_cells; ++c) {
+        const DBSCANGrid::Neighborhood nbhd = grid.GetNeighborhood(c);
+        for (int64_t i = grid.CellBegin(c); i < grid.CellBegin(c + 1); ++i) {
+            size_t count = 0;
+            grid.VisitNeighbors(nbhd, i, eps2, [&](int64_t) {
+                return ++count < min_points;
+            });
+            is_core[grid.Index(i)] = count >= min_points;
+        }
         ++progress_bar;
-        while (!nbs_next.empty()) {
-            int nb = *nbs_next.begin();
-            nbs_next.erase(nbs_next.begin());
-            nbs_visited.insert(nb);
-
-            // Noise label.
-            if (labels[nb] == -1) {
-                labels[nb] = cluster_label;
-                ++progress_bar;
-            }
-            // Not undefined label.
-            if (labels[nb] != -2) {
+    }
+
+    // Merge each core point with the core points around it. Every pair is
+    // visited from both sides, so only the one from the lower position links.
+    utility::LogDebug("Merge core points.");
+    progress_bar.Reset(num_cells, "Merge core points", print_progress);
+    ConcurrentDisjointSet clusters(num_points);
+#pragma omp parallel for schedule(dynamic, 64) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t c = 0; c < num_cells; ++c) {
+        const DBSCANGrid::Neighborhood nbhd = grid.GetNeighborhood(c);
+        for (int64_t i = grid.CellBegin(c); i < grid.CellBegin(c + 1); ++i) {
+            const int idx = grid.Index(i);
+            if (!is_core[idx]) {
                 continue;
             }
-            labels[nb] = cluster_label;
-            ++progress_bar;
-
-            if (nbs[nb].size() >= min_points) {
-                for (int qnb : nbs[nb]) {
-                    if (nbs_visited.count(qnb) == 0) {
-                        nbs_next.insert(qnb);
-                    }
+            grid.VisitNeighbors(nbhd, i, eps2, [&](int64_t j) {
+                const int nb = grid.Index(j);
+                if (j > i && is_core[nb]) {
+                    clusters.Union(idx, nb);
                 }
+                return true;
+            });
+        }
+        ++progress_bar;
+    }
+
+    // Clusters are numbered in the order of their smallest core point, which
+    // is also the root of their set.
+    std::vector<int> labels(num_points, -1);
+    int cluster_label = 0;
+    for (int64_t idx = 0; idx < num_points; ++idx) {
+        if (is_core[idx] && clusters.Find(int(idx)) == idx) {
+            labels[idx] = cluster_label++;
+        }
+    }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t idx = 0; idx < num_points; ++idx) {
+        if (is_core[idx]) {
+            const int root = clusters.Find(int(idx));
+            if (root != idx) {
+                labels[idx] = labels[root];
             }
         }
+    }
 
-        cluster_label++;
+    // Border points join the lowest labeled cluster among their core
+    // neighbors, the rest is noise.
+    utility::LogDebug("Label border points.");
+    progress_bar.Reset(num_cells, "Label border points", print_progress);
+#pragma omp parallel for schedule(dynamic, 64) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t c = 0; c < num_cells; ++c) {
+        const DBSCANGrid::Neighborhood nbhd = grid.GetNeighborhood(c);
+        for (int64_t i = grid.CellBegin(c); i < grid.CellBegin(c + 1); ++i) {
+            const int idx = grid.Index(i);
+            if (is_core[idx]) {
+                continue;
+            }
+            int label = -1;
+            grid.VisitNeighbors(nbhd, i, eps2, [&](int64_t j) {
+                const int nb = grid.Index(j);
+                if (is_core[nb] && (label == -1 || labels[nb] < label)) {
+                    label = labels[nb];
+                }
+                return true;
+            });
+            labels[idx] = label;
+        }
+        ++progress_bar;
     }
 
     utility::LogDebug("Done Compute Clusters: {:d}", cluster_label);
@@ -34,6 +34,7 @@
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/RANSAC.h"
 
 namespace open3d {
 namespace geometry {
@@ -46,6 +47,11 @@ public:
     RANSACResult() : fitness_(0), inlier_rmse_(0) {}
     ~RANSACResult() {}
 
+    bool IsBetterRANSACThan(const RANSACResult &other) const {
+        return fitness_ > other.fitness_ || (fitness_ == other.fitness_ &&
+                                             inlier_rmse_ < other.inlier_rmse_);
+    }
+
 public:
     double fitness_;
     double inlier_rmse_;
@@ -57,11 +63,11 @@ public:
 RANSACResult EvaluateRANSACBasedOnDistance(
         const std::vector<Eigen::Vector3d> &points,
         const Eigen::Vector4d plane_model,
-        std::vector<size_t> &inliers,
-        double distance_threshold,
-        double error) {
+        double distance_threshold) {
     RANSACResult result;
 
+    double error = 0;
+    size_t inlier_num = 0;
     for (size_t idx = 0; idx < points.size(); ++idx) {
         Eigen::Vector4d point(points[idx](0), points[idx](1), points[idx](2),
                               1);
@@ -69,11 +75,10 @@ RANSACResult EvaluateRANSACBasedOnDistance(
 
         if (distance < distance_threshold) {
             error += distance;
-            inliers.emplace_back(idx);
+            ++inlier_num;
         }
     }
 
-    size_t inlier_num = inliers.size();
     if (inlier_num == 0) {
         result.fitness_ = 0;
         result.inlier_rmse_ = 0;
@@ -136,27 +141,15 @@ std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
         const double distance_threshold /* = 0.01 */,
         const int ransac_n /* = 3 */,
         const int num_iterations /* = 100 */,
-        utility::optional<int> seed /* = utility::nullopt */) const {
-    RANSACResult result;
-    double error = 0;
-
-    // Initialize the plane model ax + by + cz + d = 0.
-    Eigen::Vector4d plane_model = Eigen::Vector4d(0, 0, 0, 0);
-    // Initialize the best plane model.
+        utility::optional<int> seed /* = utility::nullopt */,
+        const double probability /* = 0.99999999 */) const {
+    // Initialize the best plane model ax + by + cz + d = 0.
     Eigen::Vector4d best_plane_model = Eigen::Vector4d(0, 0, 0, 0);
 
     // Initialize consensus set.
     std::vector<size_t> inliers;
 
     size_t num_points = points_.size();
-    std::vector<size_t> indices(num_points);
-    std::iota(std::begin(indices), std::end(indices), 0);
-
-    if (!seed.has_value()) {
-        std::random_device rd;
-        seed = rd();
-    }
-    std::mt19937 rng(seed.value());
 
     // Return if ransac_n is less than the required plane model parameters.
     if (ransac_n < 3) {
@@ -168,41 +161,49 @@ std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
         utility::LogError("There must be at least 'ransac_n' points.");
         return std::make_tuple(best_plane_model, inliers);
     }
+    if (probability <= 0 || probability > 1) {
+        utility::LogError("Probability must be > 0 and <= 1.0");
+        return std::make_tuple(best_plane_model, inliers);
+    }
 
-    for (int itr = 0; itr < num_iterations; itr++) {
-        for (int i = 0; i < ransac_n; ++i) {
-            std::swap(indices[i], indices[rng() % num_points]);
-        }
-        inliers.clear();
-        for (int idx = 0; idx < ransac_n; ++idx) {
-            inliers.emplace_back(indices[idx]);
-        }
-
-        // Fit model to num_model_parameters randomly selected points among the
-        // inliers.
+    // Fit model to ransac_n randomly selected points.
+    auto fit = [&](const std::vector<size_t> &sample,
+                   Eigen::Vector4d &plane_model) {
         if (ransac_n == 3) {
             plane_model = TriangleMesh::ComputeTrianglePlane(
-                    points_[inliers[0]], points_[inliers[1]],
-                    points_[inliers[2]]);
+                    points_[sample[0]], points_[sample[1]], points_[sample[2]]);
         } else {
-            plane_model = GetPlaneFromPoints(points_, inliers);
-        }
-
-        if (plane_model.isZero(0)) {
-            continue;
-        }
-
-        error = 0;
-        inliers.clear();
-        auto this_result = EvaluateRANSACBasedOnDistance(
-                points_, plane_model, inliers, distance_threshold, error);
-        if (this_result.fitness_ > result.fitness_ ||
-            (this_result.fitness_ == result.fitness_ &&
-             this_result.inlier_rmse_ < result.inlier_rmse_)) {
-            result = this_result;
-            best_plane_model = plane_model;
+            plane_model = GetPlaneFromPoints(points_, sample);
         }
+        return !plane_model.isZero(0);
+    };
+    auto is_inlier = [&](const Eigen::Vector4d &plane_model, size_t idx) {
+        return std::abs(plane_model.dot(points_[idx].homogeneous())) <
+               distance_threshold;
+    };
+    auto score = [&](const Eigen::Vector4d &plane_model) {
+        return EvaluateRANSACBasedOnDistance(points_, plane_model,
+                                             distance_threshold);
+    };
+    auto inlier_ratio = [](const Eigen::Vector4d &, const RANSACResult &r) {
+        return r.fitness_;
+    };
+
+    // A single pre-verification point rejects most planes through clutter
+    // before they are scored on the whole cloud.
+    utility::RANSACEngine engine(ransac_n, num_iterations, probability,
+                                 /*num_pre_verify=*/1);
+    auto ransac = engine.Run<Eigen::Vector4d, RANSACResult>(
+            num_points, fit, is_inlier, score, inlier_ratio,
+            seed.has_value() ? utility::optional<unsigned int>(
+                                       static_cast<unsigned int>(seed.value()))
+                             : utility::nullopt);
+    RANSACResult result = ransac.score_;
+    if (ransac.found_) {
+        best_plane_model = ransac.model_;
     }
+    utility::LogDebug("RANSAC | Iterations: {:d}, Validations: {:d}",
+                      ransac.num_iterations_, ransac.num_validations_);
 
     // Find the final inliers using best_plane_model.
     inliers.clear();
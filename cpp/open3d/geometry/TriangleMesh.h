@@ -27,6 +27,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <tuple>
@@ -435,6 +436,23 @@ public:
             double maximum_error,
             double boundary_weight) const;
 
+    /// Function to simplify mesh using Quadric Error Metric Decimation by
+    /// Garland and Heckbert, with the edge collapses spread over threads.
+    /// Each round collapses a set of edges that do not share triangles, so
+    /// the result differs slightly from SimplifyQuadricDecimation. Merged
+    /// vertices average their normals and colors.
+    /// \param target_number_of_triangles defines the number of triangles that
+    /// the simplified mesh should have. It is not guaranteed that this number
+    /// will be reached.
+    /// \param maximum_error defines the maximum error where a vertex is allowed
+    /// to be merged
+    /// \param boundary_weight a weight applied to edge vertices used to
+    /// preserve boundaries
+    std::shared_ptr<TriangleMesh> SimplifyQuadricDecimationParallel(
+            int target_number_of_triangles,
+            double maximum_error = std::numeric_limits<double>::infinity(),
+            double boundary_weight = 1.0) const;
+
     /// Function to select points from \p input TriangleMesh into
     /// output TriangleMesh
     /// Vertices with indices in \p indices are selected.
@@ -24,12 +24,20 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/geometry/TriangleMeshSimplification.h"
+
 #include <Eigen/Dense>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <numeric>
 #include <queue>
 #include <tuple>
+#include <unordered_map>
 
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -552,5 +560,622 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
     return mesh;
 }
 
+namespace {
+
+/// Builds the vertex to triangle adjacency of the live triangles. The
+/// triangles of vertex v are adjacency[offsets[v]] to adjacency[offsets[v+1]]
+/// in ascending order.
+void BuildVertexTriangles(const std::vector<Eigen::Vector3i>& triangles,
+                          const std::vector<uint8_t>& triangles_deleted,
+                          int64_t num_vertices,
+                          std::vector<int64_t>& offsets,
+                          std::vector<int>& adjacency) {
+    const int64_t num_triangles = int64_t(triangles.size());
+    offsets.assign(num_vertices + 1, 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t tidx = 0; tidx < num_triangles; ++tidx) {
+        if (triangles_deleted[tidx]) {
+            continue;
+        }
+        for (int k = 0; k < 3; ++k) {
+#pragma omp atomic
+            offsets[triangles[tidx](k) + 1]++;
+        }
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    std::vector<int64_t> cursors(offsets.begin(), offsets.end() - 1);
+    adjacency.resize(offsets.back());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t tidx = 0; tidx < num_triangles; ++tidx) {
+        if (triangles_deleted[tidx]) {
+            continue;
+        }
+        for (int k = 0; k < 3; ++k) {
+            int64_t pos;
+#pragma omp atomic capture
+            pos = cursors[triangles[tidx](k)]++;
+            adjacency[pos] = int(tidx);
+        }
+    }
+    // Sorted lists keep the quadric sums independent of the thread timing.
+#pragma omp parallel for schedule(dynamic, 1024) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t vidx = 0; vidx < num_vertices; ++vidx) {
+        std::sort(adjacency.begin() + offsets[vidx],
+                  adjacency.begin() + offsets[vidx + 1]);
+    }
+}
+
+/// Collects the vertices w > vidx that share a live triangle with vidx,
+/// sorted and with repetitions, i.e. an edge used by a single triangle
+/// appears once.
+void CollectEdgeEnds(int64_t vidx,
+                     const std::vector<Eigen::Vector3i>& triangles,
+                     const std::vector<int64_t>& offsets,
+                     const std::vector<int>& adjacency,
+                     std::vector<int>& ends) {
+    ends.clear();
+    for (int64_t i = offsets[vidx]; i < offsets[vidx + 1]; ++i) {
+        const Eigen::Vector3i& tria = triangles[adjacency[i]];
+        for (int k = 0; k < 3; ++k) {
+            if (tria(k) > vidx) {
+                ends.push_back(tria(k));
+            }
+        }
+    }
+    std::sort(ends.begin(), ends.end());
+}
+
+/// Computes the optimal position of the merged vertex and its quadric error,
+/// falling back to the end points and the midpoint if the quadric is
+/// singular.
+double ComputeCollapse(const Quadric& Qbar,
+                       const Eigen::Vector3d& v0,
+                       const Eigen::Vector3d& v1,
+                       Eigen::Vector3d& vbar) {
+    if (Qbar.IsInvertible()) {
+        vbar = Qbar.Minimum();
+        return Qbar.Eval(vbar);
+    }
+    Eigen::Vector3d vmid = (v0 + v1) / 2;
+    double cost0 = Qbar.Eval(v0);
+    double cost1 = Qbar.Eval(v1);
+    double costmid = Qbar.Eval(vmid);
+    double cost = std::min(cost0, std::min(cost1, costmid));
+    if (cost == costmid) {
+        vbar = vmid;
+    } else if (cost == cost0) {
+        vbar = v0;
+    } else {
+        vbar = v1;
+    }
+    return cost;
+}
+
+/// Orders edges by cost and breaks ties by the edge index. The bit pattern
+/// of a float sorts like its value when it is not negative.
+uint64_t EdgeKey(float cost, int64_t eidx) {
+    uint32_t cost_bits;
+    std::memcpy(&cost_bits, &cost, sizeof(cost_bits));
+    return (uint64_t(cost_bits) << 32) | uint64_t(eidx);
+}
+
+void AtomicMin(std::atomic<uint64_t>& target, uint64_t value) {
+    uint64_t current = target.load(std::memory_order_relaxed);
+    while (value < current &&
+           !target.compare_exchange_weak(current, value,
+                                         std::memory_order_relaxed)) {
+    }
+}
+
+uint64_t EdgePairKey(int vidx0, int vidx1) {
+    return (uint64_t(vidx0) << 32) | uint64_t(uint32_t(vidx1));
+}
+
+/// 32 bit hash of an edge, cf. SplitMix64.
+uint64_t HashEdge(int vidx0, int vidx1) {
+    uint64_t z = EdgePairKey(vidx0, vidx1) + 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return (z ^ (z >> 31)) >> 32;
+}
+
+/// Fraction of the collapsible edges, cheapest first, that are candidates
+/// in a round.
+constexpr double kCandidateFraction = 0.125;
+
+/// Number of independent sets collected per round.
+constexpr int kSelectionPasses = 4;
+
+}  // namespace
+
+void QuadricDecimationParallel(std::vector<Eigen::Vector3d>& vertices,
+                               std::vector<Eigen::Vector3i>& triangles,
+                               std::vector<int>& vertex_map,
+                               std::vector<int>& triangle_map,
+                               int64_t target_number_of_triangles,
+                               double maximum_error,
+                               double boundary_weight) {
+    const int64_t num_vertices = int64_t(vertices.size());
+    const int64_t num_triangles = int64_t(triangles.size());
+    const uint64_t kNoEdge = std::numeric_limits<uint64_t>::max();
+
+    std::vector<uint8_t> triangles_deleted(num_triangles, 0);
+    std::vector<int> merged_into(num_vertices);
+    std::iota(merged_into.begin(), merged_into.end(), 0);
+
+    std::vector<int64_t> offsets;
+    std::vector<int> adjacency;
+    BuildVertexTriangles(triangles, triangles_deleted, num_vertices, offsets,
+                         adjacency);
+
+    // Compute the error metric per vertex.
+    std::vector<Eigen::Vector4d> triangle_planes(num_triangles);
+    std::vector<double> triangle_areas(num_triangles);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t tidx = 0; tidx < num_triangles; ++tidx) {
+        const Eigen::Vector3i& tria = triangles[tidx];
+        triangle_planes[tidx] = TriangleMesh::ComputeTrianglePlane(
+                vertices[tria(0)], vertices[tria(1)], vertices[tria(2)]);
+        triangle_areas[tidx] = TriangleMesh::ComputeTriangleArea(
+                vertices[tria(0)], vertices[tria(1)], vertices[tria(2)]);
+    }
+    std::vector<Quadric> Qs(num_vertices);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t vidx = 0; vidx < num_vertices; ++vidx) {
+        for (int64_t i = offsets[vidx]; i < offsets[vidx + 1]; ++i) {
+            int tidx = adjacency[i];
+            Qs[vidx] += Quadric(triangle_planes[tidx], triangle_areas[tidx]);
+        }
+    }
+
+    // For boundary edges add a plane through the edge that is perpendicular
+    // to its triangle.
+    {
+        std::vector<std::pair<int, int>> boundary_edges;
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+        {
+            std::vector<int> ends;
+            std::vector<std::pair<int, int>> local_edges;
+#pragma omp for schedule(dynamic, 1024) nowait
+            for (int64_t vidx = 0; vidx < num_vertices; ++vidx) {
+                CollectEdgeEnds(vidx, triangles, offsets, adjacency, ends);
+                for (size_t i = 0; i < ends.size(); ++i) {
+                    if ((i == 0 || ends[i - 1] != ends[i]) &&
+                        (i + 1 == ends.size() || ends[i + 1] != ends[i])) {
+                        local_edges.emplace_back(int(vidx), ends[i]);
+                    }
+                }
+            }
+#pragma omp critical(QuadricDecimationParallel)
+            boundary_edges.insert(boundary_edges.end(), local_edges.begin(),
+                                  local_edges.end());
+        }
+        std::sort(boundary_edges.begin(), boundary_edges.end());
+        for (const auto& edge : boundary_edges) {
+            for (int64_t i = offsets[edge.first]; i < offsets[edge.first + 1];
+                 ++i) {
+                int tidx = adjacency[i];
+                const Eigen::Vector3i& tria = triangles[tidx];
+                if (tria(0) != edge.second && tria(1) != edge.second &&
+                    tria(2) != edge.second) {
+                    continue;
+                }
+                const Eigen::Vector3d& vert0 = vertices[edge.first];
+                const Eigen::Vector3d& vert1 = vertices[edge.second];
+                Eigen::Vector3d normal =
+                        (vert1 - vert0).cross(triangle_planes[tidx].head<3>());
+                double norm = normal.norm();
+                if (norm > 0) {
+                    normal /= norm;
+                    Eigen::Vector4d plane(normal(0), normal(1), normal(2),
+                                          -normal.dot(vert0));
+                    Quadric quad(plane,
+                                 triangle_areas[tidx] * boundary_weight);
+                    Qs[edge.first] += quad;
+                    Qs[edge.second] += quad;
+                }
+                break;
+            }
+        }
+    }
+
+    // Edges whose collapse would flip a triangle stay blocked until one of
+    // their vertices moves.
+    std::unordered_map<uint64_t, int> blocked_edges;
+    std::vector<int> moved_round(num_vertices, -1);
+
+    // Edges are grouped by their smaller vertex. The costs of the previous
+    // round are reused for edges whose vertices did not move.
+    std::vector<int64_t> edge_offsets, prev_edge_offsets;
+    std::vector<int> edge_ends, prev_edge_ends;
+    std::vector<float> edge_costs, prev_edge_costs;
+    std::vector<float> candidate_costs;
+    std::vector<std::pair<int, int64_t>> candidates;
+    std::vector<std::atomic<uint64_t>> vertex_best(num_vertices);
+    for (auto& best : vertex_best) {
+        best.store(kNoEdge, std::memory_order_relaxed);
+    }
+    std::vector<uint8_t> locked(num_vertices);
+    std::vector<std::pair<uint64_t, int>> selected;
+
+    int64_t n_triangles = num_triangles;
+    for (int round = 0; n_triangles > target_number_of_triangles; ++round) {
+        if (round > 0) {
+            BuildVertexTriangles(triangles, triangles_deleted, num_vertices,
+                                 offsets, adjacency);
+        }
+        std::swap(edge_offsets, prev_edge_offsets);
+        std::swap(edge_ends, prev_edge_ends);
+        std::swap(edge_costs, prev_edge_costs);
+
+        // Enumerate the edges.
+        edge_offsets.assign(num_vertices + 1, 0);
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+        {
+            std::vector<int> ends;
+#pragma omp for schedule(dynamic, 1024)
+            for (int64_t vidx = 0; vidx < num_vertices; ++vidx) {
+                CollectEdgeEnds(vidx, triangles, offsets, adjacency, ends);
+                edge_offsets[vidx + 1] = int64_t(
+                        std::unique(ends.begin(), ends.end()) - ends.begin());
+            }
+        }
+        std::partial_sum(edge_offsets.begin(), edge_offsets.end(),
+                         edge_offsets.begin());
+        const int64_t num_edges = edge_offsets.back();
+        if (num_edges >= int64_t(std::numeric_limits<uint32_t>::max())) {
+            utility::LogError(
+                    "[QuadricDecimationParallel] Too many edges: {}.",
+                    num_edges);
+        }
+        edge_ends.resize(num_edges);
+        edge_costs.resize(num_edges);
+
+        // Cost the edges that may be collapsed.
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+        {
+            std::vector<int> ends;
+#pragma omp for schedule(dynamic, 1024)
+            for (int64_t vidx = 0; vidx < num_vertices; ++vidx) {
+                CollectEdgeEnds(vidx, triangles, offsets, adjacency, ends);
+                ends.erase(std::unique(ends.begin(), ends.end()), ends.end());
+                int64_t eidx = edge_offsets[vidx];
+                int64_t prev_eidx = round > 0 ? prev_edge_offsets[vidx] : 0;
+                const int64_t prev_end =
+                        round > 0 ? prev_edge_offsets[vidx + 1] : 0;
+                for (int end : ends) {
+                    edge_ends[eidx] = end;
+                    while (prev_eidx < prev_end &&
+                           prev_edge_ends[prev_eidx] < end) {
+                        ++prev_eidx;
+                    }
+                    if (prev_eidx < prev_end &&
+                        prev_edge_ends[prev_eidx] == end &&
+                        moved_round[vidx] < round - 1 &&
+                        moved_round[end] < round - 1) {
+                        edge_costs[eidx] = prev_edge_costs[prev_eidx];
+                        ++eidx;
+                        continue;
+                    }
+                    edge_costs[eidx] = std::numeric_limits<float>::infinity();
+                    auto blocked =
+                            blocked_edges.find(EdgePairKey(int(vidx), end));
+                    if (blocked == blocked_edges.end() ||
+                        blocked->second <
+                                std::max(moved_round[vidx], moved_round[end])) {
+                        Eigen::Vector3d vbar;
+                        double cost = ComputeCollapse(Qs[vidx] + Qs[end],
+                                                      vertices[vidx],
+                                                      vertices[end], vbar);
+                        if (cost <= maximum_error) {
+                            edge_costs[eidx] = float(std::max(cost, 0.0));
+                        }
+                    }
+                    ++eidx;
+                }
+            }
+        }
+
+        // Candidates are the cheapest edges of the round. Strictly ordering
+        // them by cost would leave few local minima on smooth surfaces, so
+        // among the candidates a hash of the edge decides.
+        candidate_costs.clear();
+        for (float cost : edge_costs) {
+            if (cost != std::numeric_limits<float>::infinity()) {
+                candidate_costs.push_back(cost);
+            }
+        }
+        if (candidate_costs.empty()) {
+            break;
+        }
+        auto nth = candidate_costs.begin() +
+                   int64_t(double(candidate_costs.size() - 1) *
+                           kCandidateFraction);
+        std::nth_element(candidate_costs.begin(), nth, candidate_costs.end());
+        const float threshold = *nth;
+        candidates.clear();
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+        {
+            std::vector<std::pair<int, int64_t>> local_candidates;
+#pragma omp for schedule(dynamic, 1024) nowait
+            for (int64_t vidx = 0; vidx < num_vertices; ++vidx) {
+                for (int64_t eidx = edge_offsets[vidx];
+                     eidx < edge_offsets[vidx + 1]; ++eidx) {
+                    if (edge_costs[eidx] <= threshold) {
+                        local_candidates.emplace_back(int(vidx), eidx);
+                    }
+                }
+            }
+#pragma omp critical(QuadricDecimationParallel)
+            candidates.insert(candidates.end(), local_candidates.begin(),
+                              local_candidates.end());
+        }
+
+        // A candidate is collapsed if it has the lowest key among the
+        // candidates around every vertex of its triangles, so two collapses
+        // never share a triangle. The vertices of the collapsed triangles are
+        // then locked and the selection is repeated on the rest.
+        auto Key = [&](const std::pair<int, int64_t>& candidate) {
+            return (HashEdge(candidate.first, edge_ends[candidate.second])
+                    << 32) |
+                   uint64_t(candidate.second);
+        };
+        auto RegionBest = [&](int vidx) {
+            uint64_t best = kNoEdge;
+            for (int64_t i = offsets[vidx]; i < offsets[vidx + 1]; ++i) {
+                const Eigen::Vector3i& tria = triangles[adjacency[i]];
+                for (int k = 0; k < 3; ++k) {
+                    best = std::min(best, vertex_best[tria(k)].load(
+                                                  std::memory_order_relaxed));
+                }
+            }
+            return best;
+        };
+        selected.clear();
+        std::fill(locked.begin(), locked.end(), 0);
+        for (int pass = 0; pass < kSelectionPasses; ++pass) {
+            candidates.erase(
+                    std::remove_if(candidates.begin(), candidates.end(),
+                                   [&](const std::pair<int, int64_t>& c) {
+                                       return locked[c.first] ||
+                                              locked[edge_ends[c.second]];
+                                   }),
+                    candidates.end());
+            const int64_t num_candidates = int64_t(candidates.size());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+            for (int64_t c = 0; c < num_candidates; ++c) {
+                uint64_t key = Key(candidates[c]);
+                AtomicMin(vertex_best[candidates[c].first], key);
+                AtomicMin(vertex_best[edge_ends[candidates[c].second]], key);
+            }
+
+            const size_t n_before = selected.size();
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+            {
+                std::vector<std::pair<uint64_t, int>> local_selected;
+#pragma omp for schedule(static) nowait
+                for (int64_t c = 0; c < num_candidates; ++c) {
+                    const int vidx = candidates[c].first;
+                    const int64_t eidx = candidates[c].second;
+                    uint64_t key = Key(candidates[c]);
+                    if (RegionBest(vidx) == key &&
+                        RegionBest(edge_ends[eidx]) == key) {
+                        local_selected.emplace_back(
+                                EdgeKey(edge_costs[eidx], eidx), vidx);
+                    }
+                }
+#pragma omp critical(QuadricDecimationParallel)
+                selected.insert(selected.end(), local_selected.begin(),
+                                local_selected.end());
+            }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+            for (int64_t c = 0; c < num_candidates; ++c) {
+                vertex_best[candidates[c].first].store(
+                        kNoEdge, std::memory_order_relaxed);
+                vertex_best[edge_ends[candidates[c].second]].store(
+                        kNoEdge, std::memory_order_relaxed);
+            }
+            if (selected.size() == n_before) {
+                break;
+            }
+            for (size_t s = n_before; s < selected.size(); ++s) {
+                const int vidx0 = selected[s].second;
+                const int vidx1 = edge_ends[uint32_t(selected[s].first)];
+                for (int vidx : {vidx0, vidx1}) {
+                    for (int64_t i = offsets[vidx]; i < offsets[vidx + 1];
+                         ++i) {
+                        const Eigen::Vector3i& tria = triangles[adjacency[i]];
+                        locked[tria(0)] = locked[tria(1)] = locked[tria(2)] =
+                                1;
+                    }
+                }
+            }
+        }
+        if (selected.empty()) {
+            break;
+        }
+
+        // Only take the cheapest collapses needed to reach the target.
+        std::sort(selected.begin(), selected.end());
+        int64_t n_removable = 0;
+        size_t n_selected = 0;
+        while (n_selected < selected.size() &&
+               n_triangles - n_removable > target_number_of_triangles) {
+            int vidx0 = selected[n_selected].second;
+            int vidx1 = edge_ends[uint32_t(selected[n_selected].first)];
+            for (int64_t i = offsets[vidx1]; i < offsets[vidx1 + 1]; ++i) {
+                const Eigen::Vector3i& tria = triangles[adjacency[i]];
+                n_removable += tria(0) == vidx0 || tria(1) == vidx0 ||
+                               tria(2) == vidx0;
+            }
+            ++n_selected;
+        }
+
+        // Collapse vidx1 into vidx0.
+        int64_t n_removed = 0;
+        int64_t n_flipped = 0;
+#pragma omp parallel for schedule(dynamic, 64) \
+        reduction(+ : n_removed, n_flipped) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t s = 0; s < int64_t(n_selected); ++s) {
+            const int64_t eidx = int64_t(uint32_t(selected[s].first));
+            const int vidx0 = selected[s].second;
+            const int vidx1 = edge_ends[eidx];
+            Eigen::Vector3d vbar;
+            ComputeCollapse(Qs[vidx0] + Qs[vidx1], vertices[vidx0],
+                            vertices[vidx1], vbar);
+
+            // Avoid flip of triangle normals.
+            bool is_flipped = false;
+            for (int vidx : {vidx0, vidx1}) {
+                for (int64_t i = offsets[vidx];
+                     i < offsets[vidx + 1] && !is_flipped; ++i) {
+                    const Eigen::Vector3i& tria = triangles[adjacency[i]];
+                    bool has_vidx0 = vidx0 == tria(0) || vidx0 == tria(1) ||
+                                     vidx0 == tria(2);
+                    bool has_vidx1 = vidx1 == tria(0) || vidx1 == tria(1) ||
+                                     vidx1 == tria(2);
+                    if (has_vidx0 && has_vidx1) {
+                        continue;
+                    }
+                    Eigen::Vector3d vert[3];
+                    for (int k = 0; k < 3; ++k) {
+                        vert[k] = tria(k) == vidx ? vbar : vertices[tria(k)];
+                    }
+                    const Eigen::Vector3d& vert0 = vertices[tria(0)];
+                    const Eigen::Vector3d& vert1 = vertices[tria(1)];
+                    const Eigen::Vector3d& vert2 = vertices[tria(2)];
+                    Eigen::Vector3d norm_before =
+                            (vert1 - vert0).cross(vert2 - vert0);
+                    Eigen::Vector3d norm_after =
+                            (vert[1] - vert[0]).cross(vert[2] - vert[0]);
+                    is_flipped = norm_before.dot(norm_after) < 0;
+                }
+            }
+            if (is_flipped) {
+                // Reused as blocked by the next round.
+                edge_costs[eidx] = std::numeric_limits<float>::infinity();
+                ++n_flipped;
+                continue;
+            }
+
+            for (int64_t i = offsets[vidx1]; i < offsets[vidx1 + 1]; ++i) {
+                int tidx = adjacency[i];
+                Eigen::Vector3i& tria = triangles[tidx];
+                if (vidx0 == tria(0) || vidx0 == tria(1) || vidx0 == tria(2)) {
+                    triangles_deleted[tidx] = 1;
+                    ++n_removed;
+                    continue;
+                }
+                for (int k = 0; k < 3; ++k) {
+                    if (tria(k) == vidx1) {
+                        tria(k) = vidx0;
+                    }
+                }
+            }
+            vertices[vidx0] = vbar;
+            Qs[vidx0] += Qs[vidx1];
+            merged_into[vidx1] = vidx0;
+            moved_round[vidx0] = round;
+        }
+        for (size_t s = 0; s < n_selected; ++s) {
+            const int64_t eidx = int64_t(uint32_t(selected[s].first));
+            if (edge_costs[eidx] == std::numeric_limits<float>::infinity()) {
+                blocked_edges[EdgePairKey(selected[s].second,
+                                          edge_ends[eidx])] = round;
+            }
+        }
+        n_triangles -= n_removed;
+        utility::LogDebug(
+                "[QuadricDecimationParallel] Round {:d}: {:d} collapses, {:d} "
+                "triangles left.",
+                round, int64_t(n_selected) - n_flipped, n_triangles);
+    }
+
+    // Apply changes to the triangle mesh.
+    std::vector<int> new_index(num_vertices, -1);
+    int next_free = 0;
+    for (int64_t vidx = 0; vidx < num_vertices; ++vidx) {
+        if (merged_into[vidx] == vidx) {
+            new_index[vidx] = next_free;
+            vertices[next_free] = vertices[vidx];
+            ++next_free;
+        }
+    }
+    vertices.resize(next_free);
+    vertex_map.resize(num_vertices);
+    for (int64_t vidx = 0; vidx < num_vertices; ++vidx) {
+        int root = int(vidx);
+        while (merged_into[root] != root) {
+            root = merged_into[root];
+        }
+        vertex_map[vidx] = new_index[root];
+    }
+
+    triangle_map.clear();
+    next_free = 0;
+    for (int64_t tidx = 0; tidx < num_triangles; ++tidx) {
+        if (!triangles_deleted[tidx]) {
+            const Eigen::Vector3i tria = triangles[tidx];
+            triangles[next_free] = Eigen::Vector3i(
+                    new_index[tria(0)], new_index[tria(1)], new_index[tria(2)]);
+            triangle_map.push_back(int(tidx));
+            ++next_free;
+        }
+    }
+    triangles.resize(next_free);
+}
+
+std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimationParallel(
+        int target_number_of_triangles,
+        double maximum_error /* = inf */,
+        double boundary_weight /* = 1.0 */) const {
+    if (HasTriangleUvs()) {
+        utility::LogWarning(
+                "[SimplifyQuadricDecimationParallel] This mesh contains "
+                "triangle uvs that are not handled in this function");
+    }
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = vertices_;
+    mesh->triangles_ = triangles_;
+    std::vector<int> vertex_map, triangle_map;
+    QuadricDecimationParallel(mesh->vertices_, mesh->triangles_, vertex_map,
+                              triangle_map, target_number_of_triangles,
+                              maximum_error, boundary_weight);
+
+    // Merged vertices average their normals and colors.
+    auto Average = [&](const std::vector<Eigen::Vector3d>& values) {
+        std::vector<Eigen::Vector3d> averaged(mesh->vertices_.size(),
+                                              Eigen::Vector3d::Zero());
+        std::vector<int> counts(mesh->vertices_.size(), 0);
+        for (size_t vidx = 0; vidx < values.size(); ++vidx) {
+            averaged[vertex_map[vidx]] += values[vidx];
+            counts[vertex_map[vidx]]++;
+        }
+        for (size_t vidx = 0; vidx < averaged.size(); ++vidx) {
+            averaged[vidx] /= double(counts[vidx]);
+        }
+        return averaged;
+    };
+    if (HasVertexNormals()) {
+        mesh->vertex_normals_ = Average(vertex_normals_);
+    }
+    if (HasVertexColors()) {
+        mesh->vertex_colors_ = Average(vertex_colors_);
+    }
+    if (HasTriangleNormals()) {
+        mesh->ComputeTriangleNormals();
+    }
+    return mesh;
+}
+
 }  // namespace geometry
 }  // namespace open3d
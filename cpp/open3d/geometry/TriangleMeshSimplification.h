@@ -0,0 +1,62 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+/// \brief Quadric error edge collapse on plain vertex and triangle arrays.
+///
+/// Edges are collapsed in parallel rounds. In each round the cheapest edges
+/// are candidates, and a candidate is collapsed only if its hashed priority
+/// beats every other candidate around the triangles it touches, so the
+/// collapses of a round never share a triangle and can be applied
+/// concurrently. The working set is linear in the size of the mesh.
+///
+/// \param vertices Vertex positions, replaced by the decimated positions.
+/// \param triangles Triangles, replaced by the decimated triangles.
+/// \param vertex_map Set to the output vertex each input vertex was merged
+/// into.
+/// \param triangle_map Set to the input triangle of each output triangle.
+/// \param target_number_of_triangles Collapsing stops once the mesh has at
+/// most this many triangles.
+/// \param maximum_error Edges with a larger quadric error are not collapsed.
+/// \param boundary_weight Weight of the quadrics that preserve boundaries.
+void QuadricDecimationParallel(std::vector<Eigen::Vector3d> &vertices,
+                               std::vector<Eigen::Vector3i> &triangles,
+                               std::vector<int> &vertex_map,
+                               std::vector<int> &triangle_map,
+                               int64_t target_number_of_triangles,
+                               double maximum_error,
+                               double boundary_weight);
+
+}  // namespace geometry
+}  // namespace open3d
@@ -28,6 +28,7 @@
 
 #include <string>
 
+#include "open3d/geometry/LinearOctree.h"
 #include "open3d/geometry/Octree.h"
 
 namespace open3d {
@@ -57,5 +58,20 @@ bool ReadOctreeFromJson(const std::string &filename, geometry::Octree &octree);
 bool WriteOctreeToJson(const std::string &filename,
                        const geometry::Octree &octree);
 
+/// Reads an Octree from the binary format of WriteOctreeToBIN.
+bool ReadOctreeFromBIN(const std::string &filename, geometry::Octree &octree);
+
+/// Writes an Octree in a compact binary format. The octree is stored as a
+/// LinearOctree: sorted leaf codes, leaf colors and, if the leaves hold
+/// points, their point indices.
+bool WriteOctreeToBIN(const std::string &filename,
+                      const geometry::Octree &octree);
+
+bool ReadLinearOctreeFromBIN(const std::string &filename,
+                             geometry::LinearOctree &octree);
+
+bool WriteLinearOctreeToBIN(const std::string &filename,
+                            const geometry::LinearOctree &octree);
+
 }  // namespace io
 }  // namespace open3d
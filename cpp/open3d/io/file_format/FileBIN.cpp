@@ -24,10 +24,15 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cstdint>
 #include <cstdio>
+#include <exception>
 #include <memory>
 
+#include "open3d/geometry/LinearOctree.h"
 #include "open3d/io/FeatureIO.h"
+#include "open3d/io/OctreeIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
 
@@ -72,6 +77,178 @@ bool WriteMatrixXdToBINFile(FILE *file, const Eigen::MatrixXd &mat) {
     return true;
 }
 
+// "O3OT" in little endian.
+constexpr uint32_t kOctreeBINMagic = 0x544f334f;
+constexpr uint32_t kOctreeBINVersion = 1;
+
+template <typename T>
+bool ReadArrayFromBINFile(FILE *file, T *data, size_t count) {
+    if (fread(data, sizeof(T), count, file) < count) {
+        utility::LogWarning("Read BIN failed: unexpected EOF.");
+        return false;
+    }
+    return true;
+}
+
+/// 64-bit ftell. ftell returns a long, which has 32 bits on Windows.
+int64_t Tell64(FILE *file) {
+#ifdef _WIN32
+    return _ftelli64(file);
+#else
+    return ftello(file);
+#endif
+}
+
+/// 64-bit fseek.
+int Seek64(FILE *file, int64_t offset, int origin) {
+#ifdef _WIN32
+    return _fseeki64(file, offset, origin);
+#else
+    return fseeko(file, offset, origin);
+#endif
+}
+
+/// Returns the number of bytes between the current position and the end of
+/// \p file, or 0 if it cannot be determined.
+uint64_t GetRemainingBytes(FILE *file) {
+    const int64_t pos = Tell64(file);
+    if (pos < 0 || Seek64(file, 0, SEEK_END) != 0) {
+        return 0;
+    }
+    const int64_t end = Tell64(file);
+    if (Seek64(file, pos, SEEK_SET) != 0 || end < pos) {
+        return 0;
+    }
+    return uint64_t(end - pos);
+}
+
+template <typename T>
+bool WriteArrayToBINFile(FILE *file, const T *data, size_t count) {
+    if (fwrite(data, sizeof(T), count, file) < count) {
+        utility::LogWarning("Write BIN failed: unexpected error.");
+        return false;
+    }
+    return true;
+}
+
+// Layout: magic, version, origin, size, max_depth, has_point_indices,
+// num_leaves, leaf codes, leaf colors and, if has_point_indices,
+// num_point_indices, leaf point splits and point indices.
+bool ReadLinearOctreeFromBINFile(FILE *file, geometry::LinearOctree &octree) {
+    uint32_t header[2];
+    if (!ReadArrayFromBINFile(file, header, 2)) {
+        return false;
+    }
+    if (header[0] != kOctreeBINMagic || header[1] != kOctreeBINVersion) {
+        utility::LogWarning("Read BIN failed: not an octree file.");
+        return false;
+    }
+    double bounds[4];
+    uint32_t depth_and_flags[2];
+    uint64_t num_leaves;
+    if (!ReadArrayFromBINFile(file, bounds, 4) ||
+        !ReadArrayFromBINFile(file, depth_and_flags, 2) ||
+        !ReadArrayFromBINFile(file, &num_leaves, 1)) {
+        return false;
+    }
+    octree.Clear();
+    octree.origin_ = Eigen::Vector3d(bounds[0], bounds[1], bounds[2]);
+    octree.size_ = bounds[3];
+    octree.max_depth_ = depth_and_flags[0];
+    if (octree.max_depth_ > geometry::LinearOctree::kMaxDepth) {
+        utility::LogWarning("Read BIN failed: invalid max_depth {}.",
+                            octree.max_depth_);
+        return false;
+    }
+    // Check the counts against the file size before allocating, so that a
+    // corrupted count cannot request an arbitrary amount of memory.
+    if (num_leaves >
+        GetRemainingBytes(file) / (sizeof(uint64_t) + 3 * sizeof(double))) {
+        utility::LogWarning("Read BIN failed: {} leaves exceed the file size.",
+                            num_leaves);
+        return false;
+    }
+    octree.leaf_codes_.resize(num_leaves);
+    octree.leaf_colors_.resize(num_leaves);
+    if (!ReadArrayFromBINFile(file, octree.leaf_codes_.data(), num_leaves) ||
+        !ReadArrayFromBINFile(
+                file, reinterpret_cast<double *>(octree.leaf_colors_.data()),
+                num_leaves * 3)) {
+        return false;
+    }
+    uint64_t code_end = uint64_t(1) << (3 * octree.max_depth_);
+    for (uint64_t i = 0; i < num_leaves; ++i) {
+        if (octree.leaf_codes_[i] >= code_end ||
+            (i > 0 && octree.leaf_codes_[i] <= octree.leaf_codes_[i - 1])) {
+            utility::LogWarning("Read BIN failed: invalid leaf codes.");
+            return false;
+        }
+    }
+    if (depth_and_flags[1] == 0) {
+        return true;
+    }
+
+    uint64_t num_point_indices;
+    if (!ReadArrayFromBINFile(file, &num_point_indices, 1)) {
+        return false;
+    }
+    const uint64_t remaining = GetRemainingBytes(file) / sizeof(uint64_t);
+    if (remaining < num_leaves + 1 ||
+        remaining - (num_leaves + 1) < num_point_indices) {
+        utility::LogWarning(
+                "Read BIN failed: {} point indices exceed the file size.",
+                num_point_indices);
+        return false;
+    }
+    std::vector<uint64_t> splits(num_leaves + 1);
+    std::vector<uint64_t> indices(num_point_indices);
+    if (!ReadArrayFromBINFile(file, splits.data(), splits.size()) ||
+        !ReadArrayFromBINFile(file, indices.data(), indices.size())) {
+        return false;
+    }
+    if (splits.front() != 0 || splits.back() != num_point_indices ||
+        !std::is_sorted(splits.begin(), splits.end())) {
+        utility::LogWarning("Read BIN failed: invalid leaf point splits.");
+        return false;
+    }
+    octree.leaf_point_splits_.assign(splits.begin(), splits.end());
+    octree.point_indices_.assign(indices.begin(), indices.end());
+    return true;
+}
+
+bool WriteLinearOctreeToBINFile(FILE *file,
+                                const geometry::LinearOctree &octree) {
+    const uint32_t header[2] = {kOctreeBINMagic, kOctreeBINVersion};
+    const double bounds[4] = {octree.origin_(0), octree.origin_(1),
+                              octree.origin_(2), octree.size_};
+    const uint32_t depth_and_flags[2] = {uint32_t(octree.max_depth_),
+                                         octree.HasPointIndices() ? 1u : 0u};
+    const uint64_t num_leaves = octree.leaf_codes_.size();
+    if (!WriteArrayToBINFile(file, header, 2) ||
+        !WriteArrayToBINFile(file, bounds, 4) ||
+        !WriteArrayToBINFile(file, depth_and_flags, 2) ||
+        !WriteArrayToBINFile(file, &num_leaves, 1) ||
+        !WriteArrayToBINFile(file, octree.leaf_codes_.data(), num_leaves) ||
+        !WriteArrayToBINFile(file,
+                             reinterpret_cast<const double *>(
+                                     octree.leaf_colors_.data()),
+                             num_leaves * 3)) {
+        return false;
+    }
+    if (!octree.HasPointIndices()) {
+        return true;
+    }
+
+    const uint64_t num_point_indices = octree.point_indices_.size();
+    std::vector<uint64_t> splits(octree.leaf_point_splits_.begin(),
+                                 octree.leaf_point_splits_.end());
+    std::vector<uint64_t> indices(octree.point_indices_.begin(),
+                                  octree.point_indices_.end());
+    return WriteArrayToBINFile(file, &num_point_indices, 1) &&
+           WriteArrayToBINFile(file, splits.data(), splits.size()) &&
+           WriteArrayToBINFile(file, indices.data(), indices.size());
+}
+
 }  // unnamed namespace
 
 namespace io {
@@ -102,5 +279,56 @@ bool WriteFeatureToBIN(const std::string &filename,
     return success;
 }
 
+bool ReadLinearOctreeFromBIN(const std::string &filename,
+                             geometry::LinearOctree &octree) {
+    FILE *fid = utility::filesystem::FOpen(filename, "rb");
+    if (fid == NULL) {
+        utility::LogWarning("Read BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success = ReadLinearOctreeFromBINFile(fid, octree);
+    fclose(fid);
+    return success;
+}
+
+bool WriteLinearOctreeToBIN(const std::string &filename,
+                            const geometry::LinearOctree &octree) {
+    FILE *fid = utility::filesystem::FOpen(filename, "wb");
+    if (fid == NULL) {
+        utility::LogWarning("Write BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success = WriteLinearOctreeToBINFile(fid, octree);
+    fclose(fid);
+    return success;
+}
+
+bool ReadOctreeFromBIN(const std::string &filename, geometry::Octree &octree) {
+    geometry::LinearOctree linear_octree;
+    if (!ReadLinearOctreeFromBIN(filename, linear_octree)) {
+        return false;
+    }
+    auto converted = linear_octree.ToOctree();
+    octree.origin_ = converted->origin_;
+    octree.size_ = converted->size_;
+    octree.max_depth_ = converted->max_depth_;
+    octree.root_node_ = converted->root_node_;
+    return true;
+}
+
+bool WriteOctreeToBIN(const std::string &filename,
+                      const geometry::Octree &octree) {
+    geometry::LinearOctree linear_octree;
+    try {
+        linear_octree.CreateFromOctree(octree);
+    } catch (const std::exception &e) {
+        utility::LogWarning("Write BIN failed: {}", e.what());
+        return false;
+    }
+    return WriteLinearOctreeToBIN(filename, linear_octree);
+}
+
 }  // namespace io
 }  // namespace open3d
@@ -28,6 +28,8 @@
 
 #include <Eigen/Dense>
 
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/HnswIndex.h"
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/utility/Logging.h"
@@ -77,33 +79,36 @@ static std::shared_ptr<Feature> ComputeSPFHFeature(
         const geometry::KDTreeSearchParam &search_param) {
     auto feature = std::make_shared<Feature>();
     feature->Resize(33, (int)input.points_.size());
-#pragma omp parallel for schedule(static) \
-        num_threads(utility::EstimateMaxThreads())
-    for (int i = 0; i < (int)input.points_.size(); i++) {
-        const auto &point = input.points_[i];
-        const auto &normal = input.normals_[i];
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+    {
         std::vector<int> indices;
         std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
-            // only compute SPFH feature when a point has neighbors
-            double hist_incr = 100.0 / (double)(indices.size() - 1);
-            for (size_t k = 1; k < indices.size(); k++) {
-                // skip the point itself, compute histogram
-                auto pf = ComputePairFeatures(point, normal,
-                                              input.points_[indices[k]],
-                                              input.normals_[indices[k]]);
-                int h_index = (int)(floor(11 * (pf(0) + M_PI) / (2.0 * M_PI)));
-                if (h_index < 0) h_index = 0;
-                if (h_index >= 11) h_index = 10;
-                feature->data_(h_index, i) += hist_incr;
-                h_index = (int)(floor(11 * (pf(1) + 1.0) * 0.5));
-                if (h_index < 0) h_index = 0;
-                if (h_index >= 11) h_index = 10;
-                feature->data_(h_index + 11, i) += hist_incr;
-                h_index = (int)(floor(11 * (pf(2) + 1.0) * 0.5));
-                if (h_index < 0) h_index = 0;
-                if (h_index >= 11) h_index = 10;
-                feature->data_(h_index + 22, i) += hist_incr;
+#pragma omp for schedule(static)
+        for (int i = 0; i < (int)input.points_.size(); i++) {
+            const auto &point = input.points_[i];
+            const auto &normal = input.normals_[i];
+            if (kdtree.Search(point, search_param, indices, distance2) > 1) {
+                // only compute SPFH feature when a point has neighbors
+                double hist_incr = 100.0 / (double)(indices.size() - 1);
+                for (size_t k = 1; k < indices.size(); k++) {
+                    // skip the point itself, compute histogram
+                    auto pf = ComputePairFeatures(point, normal,
+                                                  input.points_[indices[k]],
+                                                  input.normals_[indices[k]]);
+                    int h_index =
+                            (int)(floor(11 * (pf(0) + M_PI) / (2.0 * M_PI)));
+                    if (h_index < 0) h_index = 0;
+                    if (h_index >= 11) h_index = 10;
+                    feature->data_(h_index, i) += hist_incr;
+                    h_index = (int)(floor(11 * (pf(1) + 1.0) * 0.5));
+                    if (h_index < 0) h_index = 0;
+                    if (h_index >= 11) h_index = 10;
+                    feature->data_(h_index + 11, i) += hist_incr;
+                    h_index = (int)(floor(11 * (pf(2) + 1.0) * 0.5));
+                    if (h_index < 0) h_index = 0;
+                    if (h_index >= 11) h_index = 10;
+                    feature->data_(h_index + 22, i) += hist_incr;
+                }
             }
         }
     }
@@ -126,40 +131,113 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
     if (spfh == nullptr) {
         utility::LogError("Internal error: SPFH feature is nullptr.");
     }
-#pragma omp parallel for schedule(static) \
-        num_threads(utility::EstimateMaxThreads())
-    for (int i = 0; i < (int)input.points_.size(); i++) {
-        const auto &point = input.points_[i];
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+    {
         std::vector<int> indices;
         std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
-            double sum[3] = {0.0, 0.0, 0.0};
-            for (size_t k = 1; k < indices.size(); k++) {
-                // skip the point itself
-                double dist = distance2[k];
-                if (dist == 0.0) continue;
+#pragma omp for schedule(static)
+        for (int i = 0; i < (int)input.points_.size(); i++) {
+            const auto &point = input.points_[i];
+            if (kdtree.Search(point, search_param, indices, distance2) > 1) {
+                double sum[3] = {0.0, 0.0, 0.0};
+                for (size_t k = 1; k < indices.size(); k++) {
+                    // skip the point itself
+                    double dist = distance2[k];
+                    if (dist == 0.0) continue;
+                    for (int j = 0; j < 33; j++) {
+                        double val = spfh->data_(j, indices[k]) / dist;
+                        sum[j / 11] += val;
+                        feature->data_(j, i) += val;
+                    }
+                }
+                for (int j = 0; j < 3; j++)
+                    if (sum[j] != 0.0) sum[j] = 100.0 / sum[j];
                 for (int j = 0; j < 33; j++) {
-                    double val = spfh->data_(j, indices[k]) / dist;
-                    sum[j / 11] += val;
-                    feature->data_(j, i) += val;
+                    feature->data_(j, i) *= sum[j / 11];
+                    // The commented line is the fpfh function in the paper.
+                    // But according to PCL implementation, it is skipped.
+                    // Our initial test shows that the full fpfh function in
+                    // the paper seems to be better than PCL implementation.
+                    // Further test required.
+                    feature->data_(j, i) += spfh->data_(j, i);
                 }
             }
-            for (int j = 0; j < 3; j++)
-                if (sum[j] != 0.0) sum[j] = 100.0 / sum[j];
-            for (int j = 0; j < 33; j++) {
-                feature->data_(j, i) *= sum[j / 11];
-                // The commented line is the fpfh function in the paper.
-                // But according to PCL implementation, it is skipped.
-                // Our initial test shows that the full fpfh function in the
-                // paper seems to be better than PCL implementation. Further
-                // test required.
-                feature->data_(j, i) += spfh->data_(j, i);
-            }
         }
     }
     return feature;
 }
 
+/// Returns the index of the nearest target feature for every query feature,
+/// or -1 if the search failed.
+static std::vector<int> MatchFeatures(const Feature &query_features,
+                                      const Feature &target_features,
+                                      int ef_search) {
+    const int64_t num_queries = query_features.Num();
+    std::vector<int> nearest(num_queries, -1);
+    if (num_queries == 0 || target_features.Num() == 0) {
+        return nearest;
+    }
+
+    if (ef_search > 0) {
+        // The column-major feature matrices are row-major {n, dim} tensors.
+        auto as_tensor = [](const Feature &feature) {
+            return core::Tensor(const_cast<double *>(feature.data_.data()),
+                                core::Float64,
+                                {static_cast<int64_t>(feature.Num()),
+                                 static_cast<int64_t>(feature.Dimension())});
+        };
+        core::nns::HnswIndex index(as_tensor(target_features));
+        core::Tensor indices =
+                index.SearchKnn(as_tensor(query_features), 1, ef_search).first;
+        const int32_t *indices_ptr = indices.GetDataPtr<int32_t>();
+        std::copy(indices_ptr, indices_ptr + num_queries, nearest.begin());
+    } else {
+        geometry::KDTreeFlann kdtree(target_features);
+        std::vector<int> indices;
+        std::vector<double> distance2;
+        std::vector<int64_t> row_splits;
+        kdtree.SearchKNN(query_features.data_, 1, indices, distance2,
+                         row_splits);
+        for (int64_t i = 0; i + 1 < static_cast<int64_t>(row_splits.size());
+             ++i) {
+            if (row_splits[i + 1] > row_splits[i]) {
+                nearest[i] = indices[row_splits[i]];
+            }
+        }
+    }
+    return nearest;
+}
+
+CorrespondenceSet CorrespondencesFromFeatures(const Feature &source_features,
+                                              const Feature &target_features,
+                                              bool mutual_filter,
+                                              int ef_search) {
+    if (source_features.Dimension() != target_features.Dimension()) {
+        utility::LogError(
+                "Source and target features have different dimensions {} and "
+                "{}.",
+                source_features.Dimension(), target_features.Dimension());
+    }
+
+    const std::vector<int> source_to_target =
+            MatchFeatures(source_features, target_features, ef_search);
+    std::vector<int> target_to_source;
+    if (mutual_filter) {
+        target_to_source =
+                MatchFeatures(target_features, source_features, ef_search);
+    }
+
+    CorrespondenceSet corres;
+    for (int i = 0; i < static_cast<int>(source_to_target.size()); ++i) {
+        const int j = source_to_target[i];
+        if (j < 0 || (mutual_filter && target_to_source[j] != i)) {
+            continue;
+        }
+        corres.emplace_back(i, j);
+    }
+    return corres;
+}
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
@@ -31,6 +31,7 @@
 #include <vector>
 
 #include "open3d/geometry/KDTreeSearchParam.h"
+#include "open3d/pipelines/registration/TransformationEstimation.h"
 
 namespace open3d {
 
@@ -73,6 +74,25 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
         const geometry::KDTreeSearchParam &search_param =
                 geometry::KDTreeSearchParamKNN());
 
+/// \brief Function to find correspondences by nearest neighbor search in
+/// feature space.
+///
+/// The result can be passed to RegistrationRANSACBasedOnCorrespondence() or
+/// FastGlobalRegistrationBasedOnCorrespondence().
+///
+/// \param source_features Source point cloud feature.
+/// \param target_features Target point cloud feature.
+/// \param mutual_filter Keep only pairs whose points are the nearest
+/// neighbors of each other.
+/// \param ef_search If positive, an approximate HNSW graph is searched with
+/// a candidate list of this size instead of an exact KDTree. This is much
+/// faster for high dimensional features such as FPFH. Larger values raise the
+/// recall at the cost of speed.
+CorrespondenceSet CorrespondencesFromFeatures(const Feature &source_features,
+                                              const Feature &target_features,
+                                              bool mutual_filter = false,
+                                              int ef_search = 0);
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
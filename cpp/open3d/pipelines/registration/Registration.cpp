@@ -31,7 +31,7 @@
 #include "open3d/pipelines/registration/Feature.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
-#include "open3d/utility/Parallel.h"
+#include "open3d/utility/RANSAC.h"
 
 namespace open3d {
 namespace pipelines {
@@ -54,10 +54,10 @@ static RegistrationResult GetRegistrationResultAndCorrespondences(
     {
         double error2_private = 0.0;
         CorrespondenceSet correspondence_set_private;
+        std::vector<int> indices(1);
+        std::vector<double> dists(1);
 #pragma omp for nowait
         for (int i = 0; i < (int)source.points_.size(); i++) {
-            std::vector<int> indices(1);
-            std::vector<double> dists(1);
             const auto &point = source.points_[i];
             if (target_kdtree.SearchHybrid(point, max_correspondence_distance,
                                            1, indices, dists) > 0) {
@@ -204,98 +204,62 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
         return RegistrationResult();
     }
 
-    RegistrationResult best_result;
     geometry::KDTreeFlann kdtree(target);
-    int est_k_global = criteria.max_iteration_;
-    int total_validation = 0;
 
-#pragma omp parallel
-    {
-        CorrespondenceSet ransac_corres(ransac_n);
-        RegistrationResult best_result_local;
-        int est_k_local = criteria.max_iteration_;
-        unsigned int seed_val =
-                seed.has_value() ? seed.value() : std::random_device{}();
-        utility::UniformRandIntGenerator rand_gen(0, corres.size() - 1,
-                                                  seed_val);
-
-#pragma omp for nowait
-        for (int itr = 0; itr < criteria.max_iteration_; itr++) {
-            if (itr < est_k_global) {
-                for (int j = 0; j < ransac_n; j++) {
-                    ransac_corres[j] = corres[rand_gen()];
-                }
-
-                Eigen::Matrix4d transformation =
-                        estimation.ComputeTransformation(source, target,
-                                                         ransac_corres);
-
-                // Check transformation: inexpensive
-                bool check = true;
-                for (const auto &checker : checkers) {
-                    if (!checker.get().Check(source, target, ransac_corres,
-                                             transformation)) {
-                        check = false;
-                        break;
-                    }
-                }
-                if (!check) continue;
-
-                // Expensive validation
-                geometry::PointCloud pcd = source;
-                pcd.Transform(transformation);
-                auto result = GetRegistrationResultAndCorrespondences(
-                        pcd, target, kdtree, max_correspondence_distance,
-                        transformation);
-
-                if (result.IsBetterRANSACThan(best_result_local)) {
-                    best_result_local = result;
-
-                    double corres_inlier_ratio =
-                            EvaluateInlierCorrespondenceRatio(
-                                    pcd, target, corres,
-                                    max_correspondence_distance,
-                                    transformation);
-
-                    // Update exit condition if necessary.
-                    // If confidence is 1.0, then it is safely inf, we always
-                    // consume all the iterations.
-                    double est_k_local_d =
-                            std::log(1.0 - criteria.confidence_) /
-                            std::log(1.0 -
-                                     std::pow(corres_inlier_ratio, ransac_n));
-                    est_k_local =
-                            est_k_local_d < est_k_global
-                                    ? static_cast<int>(std::ceil(est_k_local_d))
-                                    : est_k_local;
-                    utility::LogDebug(
-                            "Thread {:06d}: registration fitness={:.3f}, "
-                            "corres inlier ratio={:.3f}, "
-                            "Est. max k = {}",
-                            itr, result.fitness_, corres_inlier_ratio,
-                            est_k_local_d);
-                }
-#pragma omp critical
-                {
-                    total_validation += 1;
-                    if (est_k_local < est_k_global) {
-                        est_k_global = est_k_local;
-                    }
-                }
-            }  // if
-        }      // for loop
-
-#pragma omp critical(RegistrationRANSACBasedOnCorrespondence)
-        {
-            if (best_result_local.IsBetterRANSACThan(best_result)) {
-                best_result = best_result_local;
+    auto fit = [&](const std::vector<size_t> &sample,
+                   Eigen::Matrix4d &transformation) {
+        CorrespondenceSet ransac_corres(sample.size());
+        for (size_t j = 0; j < sample.size(); j++) {
+            ransac_corres[j] = corres[sample[j]];
+        }
+        transformation =
+                estimation.ComputeTransformation(source, target, ransac_corres);
+
+        // Check transformation: inexpensive
+        for (const auto &checker : checkers) {
+            if (!checker.get().Check(source, target, ransac_corres,
+                                     transformation)) {
+                return false;
             }
         }
-    }
+        return true;
+    };
+    auto is_inlier = [](const Eigen::Matrix4d &, size_t) { return true; };
+    // Expensive validation
+    auto score = [&](const Eigen::Matrix4d &transformation) {
+        geometry::PointCloud pcd = source;
+        pcd.Transform(transformation);
+        return GetRegistrationResultAndCorrespondences(
+                pcd, target, kdtree, max_correspondence_distance,
+                transformation);
+    };
+    // The iteration bound uses the inlier ratio of the putative
+    // correspondences, from which the samples are drawn.
+    auto inlier_ratio = [&](const Eigen::Matrix4d &transformation,
+                            const RegistrationResult &result) {
+        geometry::PointCloud pcd = source;
+        pcd.Transform(transformation);
+        double corres_inlier_ratio = EvaluateInlierCorrespondenceRatio(
+                pcd, target, corres, max_correspondence_distance,
+                transformation);
+        utility::LogDebug(
+                "Registration fitness={:.3f}, corres inlier ratio={:.3f}",
+                result.fitness_, corres_inlier_ratio);
+        return corres_inlier_ratio;
+    };
+
+    utility::RANSACEngine engine(ransac_n, criteria.max_iteration_,
+                                 criteria.confidence_);
+    auto ransac = engine.Run<Eigen::Matrix4d, RegistrationResult>(
+            corres.size(), fit, is_inlier, score, inlier_ratio, seed);
+    RegistrationResult best_result =
+            ransac.found_ ? ransac.score_ : RegistrationResult();
+
     utility::LogDebug(
             "RANSAC exits after {:d} validations. Best inlier ratio {:e}, "
             "RMSE {:e}",
-            total_validation, best_result.fitness_, best_result.inlier_rmse_);
+            ransac.num_validations_, best_result.fitness_,
+            best_result.inlier_rmse_);
     return best_result;
 }
 
@@ -324,15 +288,17 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
     geometry::KDTreeFlann kdtree_target(target_feature);
     pipelines::registration::CorrespondenceSet corres_ij(num_src_pts);
 
-#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    // Every feature has exactly one nearest neighbor, so the batched search
+    // returns one index per query.
+    std::vector<int> corres_tmp;
+    std::vector<double> dist_tmp;
+    std::vector<int64_t> row_splits;
+    if (kdtree_target.SearchKNN(source_feature.data_, 1, corres_tmp, dist_tmp,
+                                row_splits) < num_src_pts) {
+        return RegistrationResult();
+    }
     for (int i = 0; i < num_src_pts; i++) {
-        std::vector<int> corres_tmp(1);
-        std::vector<double> dist_tmp(1);
-
-        kdtree_target.SearchKNN(Eigen::VectorXd(source_feature.data_.col(i)), 1,
-                                corres_tmp, dist_tmp);
-        int j = corres_tmp[0];
-        corres_ij[i] = Eigen::Vector2i(i, j);
+        corres_ij[i] = Eigen::Vector2i(i, corres_tmp[i]);
     }
 
     // Do reverse check if mutual_filter is enabled
@@ -340,15 +306,12 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         geometry::KDTreeFlann kdtree_source(source_feature);
         pipelines::registration::CorrespondenceSet corres_ji(num_tgt_pts);
 
-#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+        if (kdtree_source.SearchKNN(target_feature.data_, 1, corres_tmp,
+                                    dist_tmp, row_splits) < num_tgt_pts) {
+            return RegistrationResult();
+        }
         for (int j = 0; j < num_tgt_pts; ++j) {
-            std::vector<int> corres_tmp(1);
-            std::vector<double> dist_tmp(1);
-            kdtree_source.SearchKNN(
-                    Eigen::VectorXd(target_feature.data_.col(j)), 1, corres_tmp,
-                    dist_tmp);
-            int i = corres_tmp[0];
-            corres_ji[j] = Eigen::Vector2i(i, j);
+            corres_ji[j] = Eigen::Vector2i(corres_tmp[j], j);
         }
 
         pipelines::registration::CorrespondenceSet corres_mutual;
@@ -241,6 +241,19 @@ PointCloud PointCloud::VoxelDownSample(
     return pcd_down;
 }
 
+core::Tensor PointCloud::ClusterDBSCAN(double eps,
+                                       size_t min_points,
+                                       bool print_progress) const {
+    // Only the positions are needed, so skip the full legacy conversion.
+    open3d::geometry::PointCloud pcd_legacy;
+    pcd_legacy.points_ = core::eigen_converter::TensorToEigenVector3dVector(
+            GetPointPositions());
+    std::vector<int> labels =
+            pcd_legacy.ClusterDBSCAN(eps, min_points, print_progress);
+    return core::Tensor(labels, {int64_t(labels.size())}, core::Int32)
+            .To(GetDevice());
+}
+
 void PointCloud::EstimateNormals(
         const int max_knn /* = 30*/,
         const utility::optional<double> radius /*= utility::nullopt*/) {
@@ -34,6 +34,7 @@
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorCheck.h"
+#include "open3d/geometry/TriangleMeshSimplification.h"
 #include "open3d/t/geometry/kernel/PointCloud.h"
 #include "open3d/t/geometry/kernel/Transform.h"
 
@@ -164,6 +165,103 @@ TriangleMesh &TriangleMesh::Rotate(const core::Tensor &R,
     return *this;
 }
 
+/// Averages the rows of \p attr that are merged into the same output row by
+/// \p vertex_map. Integer attributes are rounded.
+static core::Tensor AverageVertexAttr(const core::Tensor &attr,
+                                      const std::vector<int> &vertex_map,
+                                      int64_t num_vertices) {
+    const core::Dtype dtype = attr.GetDtype();
+    core::Tensor attr_f64 =
+            attr.To(core::Device("CPU:0"), core::Float64).Contiguous();
+    const int64_t stride =
+            attr.GetLength() > 0 ? attr.NumElements() / attr.GetLength() : 0;
+    const double *attr_ptr = attr_f64.GetDataPtr<double>();
+
+    std::vector<double> sums(num_vertices * stride, 0);
+    std::vector<int> counts(num_vertices, 0);
+    for (size_t vidx = 0; vidx < vertex_map.size(); ++vidx) {
+        const int out = vertex_map[vidx];
+        for (int64_t i = 0; i < stride; ++i) {
+            sums[out * stride + i] += attr_ptr[vidx * stride + i];
+        }
+        counts[out]++;
+    }
+    for (int64_t out = 0; out < num_vertices; ++out) {
+        for (int64_t i = 0; i < stride; ++i) {
+            sums[out * stride + i] /= double(counts[out]);
+        }
+    }
+
+    core::SizeVector shape = attr.GetShape();
+    shape[0] = num_vertices;
+    core::Tensor averaged(sums, shape, core::Float64);
+    if (dtype != core::Float32 && dtype != core::Float64) {
+        averaged = averaged.Round();
+    }
+    return averaged.To(attr.GetDevice(), dtype);
+}
+
+TriangleMesh TriangleMesh::SimplifyQuadricDecimation(
+        int64_t target_number_of_triangles,
+        double maximum_error /* = inf */,
+        double boundary_weight /* = 1.0 */) const {
+    core::AssertTensorDtypes(GetVertexPositions(),
+                             {core::Float32, core::Float64});
+    core::AssertTensorDtypes(GetTriangleIndices(), {core::Int32, core::Int64});
+
+    std::vector<Eigen::Vector3d> vertices =
+            core::eigen_converter::TensorToEigenVector3dVector(
+                    GetVertexPositions());
+    std::vector<Eigen::Vector3i> triangles =
+            core::eigen_converter::TensorToEigenVector3iVector(
+                    GetTriangleIndices());
+    std::vector<int> vertex_map, triangle_map;
+    open3d::geometry::QuadricDecimationParallel(
+            vertices, triangles, vertex_map, triangle_map,
+            target_number_of_triangles, maximum_error, boundary_weight);
+
+    TriangleMesh mesh(device_);
+    for (const auto &kv : vertex_attr_) {
+        if (kv.first == "positions") {
+            mesh.SetVertexPositions(
+                    core::eigen_converter::EigenVector3dVectorToTensor(
+                            vertices, kv.second.GetDtype(), device_));
+        } else {
+            mesh.SetVertexAttr(kv.first,
+                               AverageVertexAttr(kv.second, vertex_map,
+                                                 int64_t(vertices.size())));
+        }
+    }
+
+    core::Tensor triangle_map_t =
+            core::Tensor(triangle_map, {int64_t(triangle_map.size())},
+                         core::Int32, device_)
+                    .To(core::Int64);
+    for (const auto &kv : triangle_attr_) {
+        if (kv.first == "indices") {
+            mesh.SetTriangleIndices(
+                    core::eigen_converter::EigenVector3iVectorToTensor(
+                            triangles, kv.second.GetDtype(), device_));
+        } else if (kv.first == "normals") {
+            std::vector<Eigen::Vector3d> normals(triangles.size());
+            for (size_t tidx = 0; tidx < triangles.size(); ++tidx) {
+                const Eigen::Vector3i &tria = triangles[tidx];
+                normals[tidx] = (vertices[tria(1)] - vertices[tria(0)])
+                                        .cross(vertices[tria(2)] -
+                                               vertices[tria(0)])
+                                        .normalized();
+            }
+            mesh.SetTriangleNormals(
+                    core::eigen_converter::EigenVector3dVectorToTensor(
+                            normals, kv.second.GetDtype(), device_));
+        } else {
+            mesh.SetTriangleAttr(kv.first,
+                                 kv.second.IndexGet({triangle_map_t}));
+        }
+    }
+    return mesh;
+}
+
 geometry::TriangleMesh TriangleMesh::FromLegacy(
         const open3d::geometry::TriangleMesh &mesh_legacy,
         core::Dtype float_dtype,
@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <limits>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorCheck.h"
 #include "open3d/geometry/TriangleMesh.h"
@@ -428,6 +430,26 @@ public:
     /// \return Rotated TriangleMesh
     TriangleMesh &Rotate(const core::Tensor &R, const core::Tensor &center);
 
+    /// \brief Function to simplify mesh using Quadric Error Metric Decimation
+    /// by Garland and Heckbert.
+    ///
+    /// The mesh is decimated on the host, with the edge collapses spread over
+    /// threads, see open3d::geometry::QuadricDecimationParallel. Merged
+    /// vertices average their attributes, triangle normals are recomputed and
+    /// other triangle attributes are kept.
+    /// \param target_number_of_triangles The number of triangles that the
+    /// simplified mesh should have. It is not guaranteed that this number will
+    /// be reached.
+    /// \param maximum_error The maximum error where a vertex is allowed to be
+    /// merged.
+    /// \param boundary_weight A weight applied to edge vertices used to
+    /// preserve boundaries.
+    /// \return Simplified TriangleMesh on the same device.
+    TriangleMesh SimplifyQuadricDecimation(
+            int64_t target_number_of_triangles,
+            double maximum_error = std::numeric_limits<double>::infinity(),
+            double boundary_weight = 1.0) const;
+
     core::Device GetDevice() const { return device_; }
 
     /// Create a TriangleMesh from a legacy Open3D TriangleMesh.
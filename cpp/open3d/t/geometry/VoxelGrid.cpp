@@ -0,0 +1,385 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/VoxelGrid.h"
+
+#include <limits>
+#include <vector>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/t/geometry/kernel/VoxelGrid.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+// Offsets to the 26 neighbours of a voxel, in z-y-x order.
+static core::Tensor NeighborOffsets(const core::Device &device) {
+    std::vector<int> offsets;
+    for (int dz = -1; dz <= 1; ++dz) {
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                if (dx == 0 && dy == 0 && dz == 0) continue;
+                offsets.insert(offsets.end(), {dx, dy, dz});
+            }
+        }
+    }
+    return core::Tensor(offsets, {26, 3}, core::Int32, device);
+}
+
+VoxelGrid::VoxelGrid(double voxel_size,
+                     const core::Tensor &origin,
+                     const core::Device &device,
+                     const core::HashBackendType &backend)
+    : Geometry(Geometry::GeometryType::VoxelGrid, 3),
+      voxel_size_(voxel_size),
+      device_(device),
+      backend_(backend) {
+    if (voxel_size <= 0) {
+        utility::LogError("voxel size must be positive, but got {}",
+                          voxel_size);
+    }
+    if (origin.NumElements() == 0) {
+        origin_ = core::Tensor::Zeros({3}, core::Float64, device);
+    } else {
+        core::AssertTensorShape(origin, {3});
+        origin_ = origin.To(device, core::Float64);
+    }
+    hashmap_ = std::make_shared<core::HashMap>(
+            1, core::Int32, core::SizeVector{3}, core::Float32,
+            core::SizeVector{3}, device, backend);
+}
+
+VoxelGrid &VoxelGrid::Clear() {
+    hashmap_->Clear();
+    return *this;
+}
+
+core::Tensor VoxelGrid::GetVoxelCoordinates() const {
+    core::Tensor buf_indices = hashmap_->GetActiveIndices().To(core::Int64);
+    return hashmap_->GetKeyTensor().IndexGet({buf_indices});
+}
+
+core::Tensor VoxelGrid::GetVoxelColors() const {
+    core::Tensor buf_indices = hashmap_->GetActiveIndices().To(core::Int64);
+    return hashmap_->GetValueTensor().IndexGet({buf_indices});
+}
+
+core::Tensor VoxelGrid::GetVoxelCenters() const {
+    return (GetVoxelCoordinates().To(core::Float64) + 0.5) * voxel_size_ +
+           origin_.Reshape({1, 3});
+}
+
+core::Tensor VoxelGrid::ComputeVoxelCoordinates(
+        const core::Tensor &points) const {
+    core::AssertTensorShape(points, {utility::nullopt, 3});
+    core::AssertTensorDevice(points, device_);
+    core::Tensor coordinates =
+            (points.To(core::Float64) - origin_.Reshape({1, 3})) /
+            voxel_size_;
+    return coordinates.Floor().To(core::Int32);
+}
+
+core::Tensor VoxelGrid::CheckIfIncluded(const core::Tensor &points) const {
+    core::Tensor buf_indices, masks;
+    hashmap_->Find(ComputeVoxelCoordinates(points), buf_indices, masks);
+    return masks;
+}
+
+VoxelGrid VoxelGrid::To(const core::Device &device, bool copy) const {
+    if (!copy && GetDevice() == device) {
+        return *this;
+    }
+    VoxelGrid voxel_grid(voxel_size_, origin_, device, backend_);
+    voxel_grid.hashmap_ =
+            std::make_shared<core::HashMap>(hashmap_->To(device, copy));
+    return voxel_grid;
+}
+
+VoxelGrid VoxelGrid::Clone() const { return To(GetDevice(), /*copy=*/true); }
+
+VoxelGrid &VoxelGrid::AddVoxels(const core::Tensor &coordinates,
+                                const core::Tensor &colors) {
+    core::AssertTensorShape(coordinates, {utility::nullopt, 3});
+    core::AssertTensorDtype(coordinates, core::Int32);
+    core::AssertTensorDevice(coordinates, device_);
+    if (coordinates.GetLength() == 0) {
+        return *this;
+    }
+
+    core::Tensor voxel_colors;
+    if (colors.NumElements() == 0) {
+        voxel_colors = core::Tensor::Zeros(coordinates.GetShape(),
+                                           core::Float32, device_);
+    } else {
+        core::AssertTensorShape(colors, coordinates.GetShape());
+        core::AssertTensorDevice(colors, device_);
+        voxel_colors = colors.To(core::Float32);
+    }
+
+    core::Tensor buf_indices, masks;
+    hashmap_->Insert(coordinates, voxel_colors, buf_indices, masks);
+    return *this;
+}
+
+VoxelGrid &VoxelGrid::RemoveVoxels(const core::Tensor &coordinates) {
+    core::AssertTensorShape(coordinates, {utility::nullopt, 3});
+    core::AssertTensorDtype(coordinates, core::Int32);
+    core::AssertTensorDevice(coordinates, device_);
+    if (coordinates.GetLength() == 0) {
+        return *this;
+    }
+
+    core::Tensor masks;
+    hashmap_->Erase(coordinates, masks);
+    return *this;
+}
+
+VoxelGrid &VoxelGrid::AddPoints(const core::Tensor &points,
+                                const core::Tensor &colors) {
+    core::Tensor coordinates = ComputeVoxelCoordinates(points);
+    if (coordinates.GetLength() == 0) {
+        return *this;
+    }
+
+    core::Tensor point_colors;
+    if (colors.NumElements() == 0) {
+        point_colors = core::Tensor::Zeros(coordinates.GetShape(),
+                                           core::Float32, device_);
+    } else {
+        core::AssertTensorShape(colors, coordinates.GetShape());
+        core::AssertTensorDevice(colors, device_);
+        point_colors = colors.To(core::Float32);
+    }
+
+    // Sum the colors and count the points of each voxel in a single pass.
+    // InsertReduce is only supported by the CPU backends, so the points of
+    // other devices are reduced on the host.
+    const core::Device host("CPU:0");
+    const core::HashBackendType host_backend =
+            device_ == host ? backend_ : core::HashBackendType::Default;
+    core::HashMap accumulator(coordinates.GetLength(), core::Int32, {3},
+                              {core::Float32, core::Float32}, {{3}, {1}}, host,
+                              host_backend);
+    core::Tensor buf_indices, masks;
+    accumulator.InsertReduce(coordinates.To(host),
+                             {point_colors.To(host), core::Tensor()},
+                             {core::HashReduceOp::Sum,
+                              core::HashReduceOp::Count},
+                             buf_indices, masks);
+
+    buf_indices = accumulator.GetActiveIndices().To(core::Int64);
+    core::Tensor sums = accumulator.GetValueTensor(0).IndexGet({buf_indices});
+    core::Tensor counts =
+            accumulator.GetValueTensor(1).IndexGet({buf_indices});
+    hashmap_->Insert(
+            accumulator.GetKeyTensor().IndexGet({buf_indices}).To(device_),
+            (sums / counts).To(device_), buf_indices, masks);
+    return *this;
+}
+
+void VoxelGrid::AssertCompatible(const VoxelGrid &other) const {
+    if (other.GetDevice() != device_) {
+        utility::LogError("Voxel grids are on different devices {} and {}.",
+                          device_.ToString(), other.GetDevice().ToString());
+    }
+    if (other.voxel_size_ != voxel_size_ ||
+        !other.origin_.AllClose(origin_, 0, 0)) {
+        utility::LogError(
+                "Voxel grids must have the same voxel size and origin.");
+    }
+}
+
+VoxelGrid VoxelGrid::Union(const VoxelGrid &other) const {
+    AssertCompatible(other);
+    VoxelGrid voxel_grid = Clone();
+    voxel_grid.AddVoxels(other.GetVoxelCoordinates(), other.GetVoxelColors());
+    return voxel_grid;
+}
+
+VoxelGrid VoxelGrid::Intersection(const VoxelGrid &other) const {
+    AssertCompatible(other);
+    core::Tensor coordinates = GetVoxelCoordinates();
+    core::Tensor buf_indices, masks;
+    other.hashmap_->Find(coordinates, buf_indices, masks);
+
+    VoxelGrid voxel_grid(voxel_size_, origin_, device_, backend_);
+    voxel_grid.AddVoxels(coordinates.IndexGet({masks}),
+                         GetVoxelColors().IndexGet({masks}));
+    return voxel_grid;
+}
+
+VoxelGrid VoxelGrid::Difference(const VoxelGrid &other) const {
+    AssertCompatible(other);
+    core::Tensor coordinates = GetVoxelCoordinates();
+    core::Tensor buf_indices, masks;
+    other.hashmap_->Find(coordinates, buf_indices, masks);
+    masks = masks.LogicalNot();
+
+    VoxelGrid voxel_grid(voxel_size_, origin_, device_, backend_);
+    voxel_grid.AddVoxels(coordinates.IndexGet({masks}),
+                         GetVoxelColors().IndexGet({masks}));
+    return voxel_grid;
+}
+
+VoxelGrid &VoxelGrid::Dilate(int iterations) {
+    core::Tensor offsets = NeighborOffsets(device_);
+    for (int it = 0; it < iterations && !IsEmpty(); ++it) {
+        core::Tensor coordinates = GetVoxelCoordinates();
+        core::Tensor colors = GetVoxelColors();
+        // One offset per batch, so that keys are unique within a batch and
+        // new voxels take their color deterministically.
+        for (int64_t i = 0; i < offsets.GetLength(); ++i) {
+            AddVoxels(coordinates + offsets[i], colors);
+        }
+    }
+    return *this;
+}
+
+VoxelGrid &VoxelGrid::Erode(int iterations) {
+    core::Tensor offsets = NeighborOffsets(device_);
+    for (int it = 0; it < iterations && !IsEmpty(); ++it) {
+        core::Tensor coordinates = GetVoxelCoordinates();
+        int64_t n = coordinates.GetLength();
+        core::Tensor neighbors =
+                (offsets.Reshape({26, 1, 3}) + coordinates.Reshape({1, n, 3}))
+                        .Reshape({26 * n, 3});
+
+        core::Tensor buf_indices, masks;
+        hashmap_->Find(neighbors, buf_indices, masks);
+        core::Tensor num_neighbors =
+                masks.Reshape({26, n}).To(core::Int64).Sum({0});
+        RemoveVoxels(coordinates.IndexGet({num_neighbors.Lt(26)}));
+    }
+    return *this;
+}
+
+VoxelGrid &VoxelGrid::CarveDepthMap(const Image &depth,
+                                    const core::Tensor &intrinsics,
+                                    const core::Tensor &extrinsics,
+                                    double depth_scale,
+                                    bool keep_voxels_outside_image) {
+    core::AssertTensorDtypes(depth.AsTensor(), {core::UInt16, core::Float32});
+    core::Tensor coordinates = GetVoxelCoordinates();
+    core::Tensor keep_masks;
+    kernel::voxel_grid::Carve(coordinates, depth.AsTensor(), intrinsics,
+                              extrinsics, origin_, voxel_size_, depth_scale,
+                              /*is_silhouette=*/false,
+                              keep_voxels_outside_image, keep_masks);
+    return RemoveVoxels(coordinates.IndexGet({keep_masks.LogicalNot()}));
+}
+
+VoxelGrid &VoxelGrid::CarveSilhouette(const Image &silhouette_mask,
+                                      const core::Tensor &intrinsics,
+                                      const core::Tensor &extrinsics,
+                                      bool keep_voxels_outside_image) {
+    core::Tensor coordinates = GetVoxelCoordinates();
+    core::Tensor keep_masks;
+    kernel::voxel_grid::Carve(coordinates, silhouette_mask.AsTensor(),
+                              intrinsics, extrinsics, origin_, voxel_size_,
+                              /*depth_scale=*/1.0, /*is_silhouette=*/true,
+                              keep_voxels_outside_image, keep_masks);
+    return RemoveVoxels(coordinates.IndexGet({keep_masks.LogicalNot()}));
+}
+
+VoxelGrid VoxelGrid::CreateFromPointCloud(
+        const PointCloud &pcd,
+        double voxel_size,
+        const core::HashBackendType &backend) {
+    if (voxel_size <= 0) {
+        utility::LogError("voxel size must be positive, but got {}",
+                          voxel_size);
+    }
+    core::Device device = pcd.GetDevice();
+    if (pcd.IsEmpty()) {
+        return VoxelGrid(voxel_size, core::Tensor(), device, backend);
+    }
+
+    core::Tensor min_bound = pcd.GetMinBound().To(core::Float64);
+    core::Tensor max_bound = pcd.GetMaxBound().To(core::Float64);
+    if (voxel_size * std::numeric_limits<int>::max() <
+        (max_bound - min_bound).Max({0}).Item<double>() + voxel_size) {
+        utility::LogError("voxel size {} is too small.", voxel_size);
+    }
+
+    VoxelGrid voxel_grid(voxel_size, min_bound - voxel_size * 0.5, device,
+                         backend);
+    voxel_grid.AddPoints(pcd.GetPointPositions(),
+                         pcd.HasPointColors() ? pcd.GetPointColors()
+                                              : core::Tensor());
+    return voxel_grid;
+}
+
+VoxelGrid VoxelGrid::FromLegacy(
+        const open3d::geometry::VoxelGrid &voxel_grid_legacy,
+        const core::Device &device) {
+    VoxelGrid voxel_grid(
+            voxel_grid_legacy.voxel_size_,
+            core::eigen_converter::EigenMatrixToTensor(
+                    voxel_grid_legacy.origin_)
+                    .Reshape({3}),
+            device);
+
+    std::vector<Eigen::Vector3i> coordinates;
+    std::vector<Eigen::Vector3d> colors;
+    coordinates.reserve(voxel_grid_legacy.voxels_.size());
+    colors.reserve(voxel_grid_legacy.voxels_.size());
+    for (const auto &kv : voxel_grid_legacy.voxels_) {
+        coordinates.push_back(kv.second.grid_index_);
+        colors.push_back(kv.second.color_);
+    }
+    voxel_grid.AddVoxels(core::eigen_converter::EigenVector3iVectorToTensor(
+                                 coordinates, core::Int32, device),
+                         core::eigen_converter::EigenVector3dVectorToTensor(
+                                 colors, core::Float32, device));
+    return voxel_grid;
+}
+
+open3d::geometry::VoxelGrid VoxelGrid::ToLegacy() const {
+    open3d::geometry::VoxelGrid voxel_grid_legacy;
+    voxel_grid_legacy.voxel_size_ = voxel_size_;
+    voxel_grid_legacy.origin_ = core::eigen_converter::TensorToEigenMatrixXd(
+            origin_.Reshape({3, 1}));
+
+    std::vector<Eigen::Vector3i> coordinates =
+            core::eigen_converter::TensorToEigenVector3iVector(
+                    GetVoxelCoordinates());
+    std::vector<Eigen::Vector3d> colors =
+            core::eigen_converter::TensorToEigenVector3dVector(
+                    GetVoxelColors());
+    for (size_t i = 0; i < coordinates.size(); ++i) {
+        voxel_grid_legacy.AddVoxel(
+                open3d::geometry::Voxel(coordinates[i], colors[i]));
+    }
+    return voxel_grid_legacy;
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
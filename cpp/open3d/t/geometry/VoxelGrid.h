@@ -0,0 +1,250 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/HashMap.h"
+#include "open3d/geometry/VoxelGrid.h"
+#include "open3d/t/geometry/Geometry.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// \class VoxelGrid
+///
+/// \brief A sparse voxel grid with one color per voxel.
+///
+/// The voxels are stored in a core::HashMap from Int32 voxel coordinates of
+/// shape {3} to Float32 colors of shape {3}. Voxel (i, j, k) covers
+/// [origin + (i, j, k) * voxel_size, origin + (i + 1, j + 1, k + 1) *
+/// voxel_size). All operations are applied to the whole grid at once with
+/// tensor and hash map operations, on CPU and CUDA.
+class VoxelGrid : public Geometry {
+public:
+    /// \brief Construct an empty voxel grid on the provided device.
+    ///
+    /// \param voxel_size Edge length of the voxels.
+    /// \param origin Float64 tensor of shape {3}, the min bound of voxel
+    /// (0, 0, 0). Zero if undefined.
+    /// \param device The device of the voxel grid.
+    /// \param backend The backend of the underlying hash map.
+    VoxelGrid(double voxel_size = 0.01,
+              const core::Tensor &origin = core::Tensor(),
+              const core::Device &device = core::Device("CPU:0"),
+              const core::HashBackendType &backend =
+                      core::HashBackendType::Default);
+
+    virtual ~VoxelGrid() override {}
+
+public:
+    /// Remove all voxels, keeping the voxel size and the origin.
+    VoxelGrid &Clear() override;
+
+    /// Returns true if the voxel grid has no voxels.
+    bool IsEmpty() const override { return GetNumVoxels() == 0; }
+
+    /// Returns the device of the voxel grid.
+    core::Device GetDevice() const { return device_; }
+
+    /// Returns the edge length of the voxels.
+    double GetVoxelSize() const { return voxel_size_; }
+
+    /// Returns the Float64 origin of shape {3}.
+    core::Tensor GetOrigin() const { return origin_; }
+
+    /// Get the underlying hash map from voxel coordinates to colors.
+    core::HashMap GetHashMap() const { return *hashmap_; }
+
+    /// Returns the number of voxels.
+    int64_t GetNumVoxels() const { return hashmap_->Size(); }
+
+    /// Returns the Int32 coordinates of shape {N, 3} of all voxels, in the
+    /// order of the hash map buffer.
+    core::Tensor GetVoxelCoordinates() const;
+
+    /// Returns the Float32 colors of shape {N, 3} of all voxels, in the same
+    /// order as GetVoxelCoordinates().
+    core::Tensor GetVoxelColors() const;
+
+    /// Returns the Float64 centers of shape {N, 3} of all voxels, in the same
+    /// order as GetVoxelCoordinates().
+    core::Tensor GetVoxelCenters() const;
+
+    /// Returns the Int32 coordinates of shape {N, 3} of the voxels containing
+    /// \p points of shape {N, 3}. The voxels need not exist.
+    core::Tensor ComputeVoxelCoordinates(const core::Tensor &points) const;
+
+    /// Returns a Bool mask of shape {N} telling if the voxel containing each
+    /// of \p points of shape {N, 3} exists.
+    core::Tensor CheckIfIncluded(const core::Tensor &points) const;
+
+    /// Transfer the voxel grid to a specified device.
+    /// \param device The targeted device to convert to.
+    /// \param copy If true, a new voxel grid is always created; if false, the
+    /// copy is avoided when the original voxel grid is already on the
+    /// targeted device.
+    VoxelGrid To(const core::Device &device, bool copy = false) const;
+
+    /// Returns copy of the voxel grid on the same device.
+    VoxelGrid Clone() const;
+
+    /// \brief Add voxels, keeping the color of the voxels that already exist.
+    ///
+    /// \param coordinates Int32 voxel coordinates of shape {N, 3}.
+    /// \param colors Float32 colors of shape {N, 3}. Black if undefined.
+    VoxelGrid &AddVoxels(const core::Tensor &coordinates,
+                         const core::Tensor &colors = core::Tensor());
+
+    /// \brief Remove voxels.
+    ///
+    /// \param coordinates Int32 voxel coordinates of shape {N, 3}. Voxels
+    /// that do not exist are ignored.
+    VoxelGrid &RemoveVoxels(const core::Tensor &coordinates);
+
+    /// \brief Add the voxels containing \p points, keeping the color of the
+    /// voxels that already exist.
+    ///
+    /// The color of a new voxel is the average color of its points, reduced
+    /// in a hash map while inserting. Hash map reductions are CPU only, so
+    /// points on other devices are reduced on the host.
+    ///
+    /// \param points Points of shape {N, 3}.
+    /// \param colors Colors of shape {N, 3}. Black if undefined.
+    VoxelGrid &AddPoints(const core::Tensor &points,
+                         const core::Tensor &colors = core::Tensor());
+
+    /// \brief Returns a voxel grid with the voxels of both grids.
+    ///
+    /// Voxels of both grids keep the color of this grid. The grids must have
+    /// the same voxel size, origin and device.
+    VoxelGrid Union(const VoxelGrid &other) const;
+
+    /// \brief Returns a voxel grid with the voxels of this grid that are also
+    /// in \p other, with the colors of this grid.
+    VoxelGrid Intersection(const VoxelGrid &other) const;
+
+    /// \brief Returns a voxel grid with the voxels of this grid that are not
+    /// in \p other, with the colors of this grid.
+    VoxelGrid Difference(const VoxelGrid &other) const;
+
+    /// \brief Morphological dilation with the 3x3x3 cube.
+    ///
+    /// Each iteration adds the 26 neighbours of every voxel. A new voxel
+    /// takes the color of the first of its neighbours in a fixed offset
+    /// order.
+    ///
+    /// \param iterations Number of dilations.
+    VoxelGrid &Dilate(int iterations = 1);
+
+    /// \brief Morphological erosion with the 3x3x3 cube.
+    ///
+    /// Each iteration removes the voxels that miss any of their 26
+    /// neighbours.
+    ///
+    /// \param iterations Number of erosions.
+    VoxelGrid &Erode(int iterations = 1);
+
+    /// \brief Remove all voxels in front of the surface of a depth map.
+    ///
+    /// Same as open3d::geometry::VoxelGrid::CarveDepthMap: a voxel is kept if
+    /// any of its 8 corners projects to a valid pixel with a positive depth
+    /// that is not behind the corner, or projects outside the image and
+    /// \p keep_voxels_outside_image is true. Depths are bilinearly
+    /// interpolated.
+    ///
+    /// \param depth UInt16 or Float32 depth image.
+    /// \param intrinsics Intrinsic matrix of shape {3, 3}.
+    /// \param extrinsics Extrinsic matrix of shape {4, 4}.
+    /// \param depth_scale The depth is divided by \p depth_scale.
+    /// \param keep_voxels_outside_image Keep the voxels that project outside
+    /// the image.
+    VoxelGrid &CarveDepthMap(const Image &depth,
+                             const core::Tensor &intrinsics,
+                             const core::Tensor &extrinsics,
+                             double depth_scale = 1000.0,
+                             bool keep_voxels_outside_image = false);
+
+    /// \brief Remove all voxels outside of a silhouette mask.
+    ///
+    /// Same as open3d::geometry::VoxelGrid::CarveSilhouette: a voxel is kept
+    /// if any of its 8 corners projects to a pixel of the mask that is set
+    /// (> 0), or projects outside the image and \p keep_voxels_outside_image
+    /// is true.
+    ///
+    /// \param silhouette_mask Single channel mask image.
+    /// \param intrinsics Intrinsic matrix of shape {3, 3}.
+    /// \param extrinsics Extrinsic matrix of shape {4, 4}.
+    /// \param keep_voxels_outside_image Keep the voxels that project outside
+    /// the image.
+    VoxelGrid &CarveSilhouette(const Image &silhouette_mask,
+                               const core::Tensor &intrinsics,
+                               const core::Tensor &extrinsics,
+                               bool keep_voxels_outside_image = false);
+
+    /// \brief Create a voxel grid from the points of a point cloud.
+    ///
+    /// Same as open3d::geometry::VoxelGrid::CreateFromPointCloud: the origin
+    /// is half a voxel below the min bound of the points.
+    ///
+    /// \param pcd Input point cloud. The point colors are averaged per
+    /// voxel.
+    /// \param voxel_size Edge length of the voxels.
+    /// \param backend The backend of the underlying hash map.
+    static VoxelGrid CreateFromPointCloud(
+            const PointCloud &pcd,
+            double voxel_size,
+            const core::HashBackendType &backend =
+                    core::HashBackendType::Default);
+
+    /// Create a voxel grid from a legacy voxel grid.
+    static VoxelGrid FromLegacy(
+            const open3d::geometry::VoxelGrid &voxel_grid_legacy,
+            const core::Device &device = core::Device("CPU:0"));
+
+    /// Convert to a legacy voxel grid.
+    open3d::geometry::VoxelGrid ToLegacy() const;
+
+private:
+    void AssertCompatible(const VoxelGrid &other) const;
+
+    double voxel_size_;
+    core::Tensor origin_;
+    core::Device device_;
+    core::HashBackendType backend_;
+
+    // Voxel coordinates -> colors.
+    std::shared_ptr<core::HashMap> hashmap_;
+};
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
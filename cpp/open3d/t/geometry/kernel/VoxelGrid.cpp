@@ -0,0 +1,92 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/kernel/VoxelGrid.h"
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/TensorCheck.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace voxel_grid {
+
+void Carve(const core::Tensor& voxel_coords,
+           const core::Tensor& image,
+           const core::Tensor& intrinsics,
+           const core::Tensor& extrinsics,
+           const core::Tensor& origin,
+           double voxel_size,
+           double depth_scale,
+           bool is_silhouette,
+           bool keep_voxels_outside_image,
+           core::Tensor& keep_masks) {
+    core::AssertTensorShape(voxel_coords, {utility::nullopt, 3});
+    core::AssertTensorDtype(voxel_coords, core::Int32);
+    core::AssertTensorShape(image, {utility::nullopt, utility::nullopt, 1});
+    core::AssertTensorShape(intrinsics, {3, 3});
+    core::AssertTensorShape(extrinsics, {4, 4});
+    core::AssertTensorShape(origin, {3});
+    if (image.GetShape(0) < 2 || image.GetShape(1) < 2) {
+        utility::LogError("Image must be at least 2x2, but got {}x{}.",
+                          image.GetShape(1), image.GetShape(0));
+    }
+
+    core::Device device = voxel_coords.GetDevice();
+    core::Tensor voxel_coords_contiguous = voxel_coords.Contiguous();
+    core::Tensor image_contiguous =
+            image.To(device, core::Float32).Contiguous();
+    core::Tensor intrinsics_contiguous =
+            intrinsics.To(device, core::Float64).Contiguous();
+    core::Tensor extrinsics_contiguous =
+            extrinsics.To(device, core::Float64).Contiguous();
+    core::Tensor origin_contiguous =
+            origin.To(device, core::Float64).Contiguous();
+    keep_masks =
+            core::Tensor::Empty({voxel_coords.GetLength()}, core::Bool, device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        CarveCPU(voxel_coords_contiguous, image_contiguous,
+                 intrinsics_contiguous, extrinsics_contiguous,
+                 origin_contiguous, voxel_size, depth_scale, is_silhouette,
+                 keep_voxels_outside_image, keep_masks);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(CarveCUDA, voxel_coords_contiguous, image_contiguous,
+                  intrinsics_contiguous, extrinsics_contiguous,
+                  origin_contiguous, voxel_size, depth_scale, is_silhouette,
+                  keep_voxels_outside_image, keep_masks);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+}  // namespace voxel_grid
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
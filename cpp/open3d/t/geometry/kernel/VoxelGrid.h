@@ -0,0 +1,82 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace voxel_grid {
+
+/// Computes which voxels survive carving with a depth map or a silhouette
+/// mask. A voxel is kept if any of its 8 corners projects to a pixel that
+/// keeps it, or projects outside the image and \p keep_voxels_outside_image
+/// is true. For a depth map the bilinearly interpolated depth must be
+/// positive and not behind the corner, for a silhouette the interpolated
+/// mask value must be positive.
+void Carve(const core::Tensor& voxel_coords,
+           const core::Tensor& image,
+           const core::Tensor& intrinsics,
+           const core::Tensor& extrinsics,
+           const core::Tensor& origin,
+           double voxel_size,
+           double depth_scale,
+           bool is_silhouette,
+           bool keep_voxels_outside_image,
+           core::Tensor& keep_masks);
+
+void CarveCPU(const core::Tensor& voxel_coords,
+              const core::Tensor& image,
+              const core::Tensor& intrinsics,
+              const core::Tensor& extrinsics,
+              const core::Tensor& origin,
+              double voxel_size,
+              double depth_scale,
+              bool is_silhouette,
+              bool keep_voxels_outside_image,
+              core::Tensor& keep_masks);
+
+#ifdef BUILD_CUDA_MODULE
+void CarveCUDA(const core::Tensor& voxel_coords,
+               const core::Tensor& image,
+               const core::Tensor& intrinsics,
+               const core::Tensor& extrinsics,
+               const core::Tensor& origin,
+               double voxel_size,
+               double depth_scale,
+               bool is_silhouette,
+               bool keep_voxels_outside_image,
+               core::Tensor& keep_masks);
+#endif
+
+}  // namespace voxel_grid
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
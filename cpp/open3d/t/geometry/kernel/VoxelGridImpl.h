@@ -0,0 +1,124 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/kernel/VoxelGrid.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace voxel_grid {
+
+#ifdef __CUDACC__
+void CarveCUDA
+#else
+void CarveCPU
+#endif
+        (const core::Tensor& voxel_coords,
+         const core::Tensor& image,
+         const core::Tensor& intrinsics,
+         const core::Tensor& extrinsics,
+         const core::Tensor& origin,
+         double voxel_size,
+         double depth_scale,
+         bool is_silhouette,
+         bool keep_voxels_outside_image,
+         core::Tensor& keep_masks) {
+    const int* voxel_coords_ptr = voxel_coords.GetDataPtr<int>();
+    const float* image_ptr = image.GetDataPtr<float>();
+    const double* K = intrinsics.GetDataPtr<double>();
+    const double* T = extrinsics.GetDataPtr<double>();
+    const double* origin_ptr = origin.GetDataPtr<double>();
+    bool* keep_masks_ptr = keep_masks.GetDataPtr<bool>();
+    const int64_t rows = image.GetShape(0);
+    const int64_t cols = image.GetShape(1);
+
+    core::ParallelFor(
+            voxel_coords.GetDevice(), voxel_coords.GetLength(),
+            [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const int* coord = voxel_coords_ptr + 3 * workload_idx;
+                // Same corners as geometry::VoxelGrid::GetVoxelBoundingPoints.
+                const double r = voxel_size / 2.0;
+                double center[3];
+                for (int i = 0; i < 3; ++i) {
+                    center[i] = (coord[i] + 0.5) * voxel_size + origin_ptr[i];
+                }
+
+                bool keep = false;
+                for (int corner = 0; corner < 8 && !keep; ++corner) {
+                    double x[3] = {center[0] + (corner & 2 ? r : -r),
+                                   center[1] + (corner & 4 ? r : -r),
+                                   center[2] + (corner & 1 ? r : -r)};
+                    double xc[3];
+                    for (int i = 0; i < 3; ++i) {
+                        xc[i] = T[4 * i + 0] * x[0] + T[4 * i + 1] * x[1] +
+                                T[4 * i + 2] * x[2] + T[4 * i + 3];
+                    }
+                    double uvz[3];
+                    for (int i = 0; i < 3; ++i) {
+                        uvz[i] = K[3 * i + 0] * xc[0] + K[3 * i + 1] * xc[1] +
+                                 K[3 * i + 2] * xc[2];
+                    }
+                    double z = uvz[2];
+                    double u = uvz[0] / z;
+                    double v = uvz[1] / z;
+
+                    // Same bilinear interpolation as
+                    // geometry::Image::FloatValueAt.
+                    if (u < 0.0 || u > double(cols - 1) || v < 0.0 ||
+                        v > double(rows - 1)) {
+                        keep = keep_voxels_outside_image;
+                        continue;
+                    }
+                    int64_t ui = int64_t(u) < cols - 2 ? int64_t(u) : cols - 2;
+                    int64_t vi = int64_t(v) < rows - 2 ? int64_t(v) : rows - 2;
+                    ui = ui > 0 ? ui : 0;
+                    vi = vi > 0 ? vi : 0;
+                    double pu = u - ui;
+                    double pv = v - vi;
+                    const float* p = image_ptr + vi * cols + ui;
+                    double value = (p[0] * (1 - pv) + p[cols] * pv) * (1 - pu) +
+                                   (p[1] * (1 - pv) + p[cols + 1] * pv) * pu;
+
+                    if (is_silhouette) {
+                        keep = value > 0;
+                    } else {
+                        double d = value / depth_scale;
+                        keep = d > 0 && z >= d;
+                    }
+                }
+                keep_masks_ptr[workload_idx] = keep;
+            });
+}
+
+}  // namespace voxel_grid
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -26,12 +26,17 @@
 
 #include "open3d/t/io/HashMapIO.h"
 
+#include "open3d/core/hashmap/DeviceHashBackend.h"
 #include "open3d/t/io/NumpyIO.h"
 #include "open3d/utility/FileSystem.h"
 namespace open3d {
 namespace t {
 namespace io {
 
+// Version of the hash table layout stored by WriteHashMap. Files with another
+// version are loaded by reinserting the keys.
+static constexpr int64_t kHashTableFormat = 1;
+
 void WriteHashMap(const std::string& file_name, const core::HashMap& hashmap) {
     core::Tensor keys = hashmap.GetKeyTensor();
     std::vector<core::Tensor> values = hashmap.GetValueTensors();
@@ -43,18 +48,58 @@ void WriteHashMap(const std::string& file_name, const core::HashMap& hashmap) {
     core::Tensor active_indices = active_buf_indices_i32.To(core::Int64);
 
     core::Tensor active_keys = keys.IndexGet({active_indices}).To(host);
+    std::vector<core::Tensor> active_values;
+    std::vector<core::Dtype> dtypes_value;
+    std::vector<core::SizeVector> element_shapes_value;
+    for (const auto& value : values) {
+        active_values.push_back(value.IndexGet({active_indices}).To(host));
+        dtypes_value.push_back(value.GetDtype());
+        core::SizeVector element_shape = value.GetShape();
+        element_shape.erase(element_shape.begin());
+        element_shapes_value.push_back(element_shape);
+    }
 
     std::unordered_map<std::string, core::Tensor> output;
-    output.emplace("key", active_keys);
     output.emplace(
             "n_values",
             core::Tensor(
                     std::vector<int64_t>{static_cast<int64_t>(values.size())},
                     {1}, core::Int64, host));
-    for (size_t i = 0; i < values.size(); ++i) {
-        core::Tensor active_value_i =
-                values[i].IndexGet({active_indices}).To(host);
-        output.emplace(fmt::format("value_{:03d}", i), active_value_i);
+
+    const int64_t count = active_keys.GetLength();
+    if (count == 0) {
+        output.emplace("key", active_keys);
+        for (size_t i = 0; i < values.size(); ++i) {
+            output.emplace(fmt::format("value_{:03d}", i), active_values[i]);
+        }
+    } else {
+        // Build a flat table that exactly fits the active entries. Its buffers
+        // hold the active keys and values, and are stored together with the
+        // heap and the table so that ReadHashMap can map them without
+        // rehashing.
+        core::SizeVector key_element_shape = active_keys.GetShape();
+        key_element_shape.erase(key_element_shape.begin());
+        core::HashMap table_hashmap(count, active_keys.GetDtype(),
+                                    key_element_shape, dtypes_value,
+                                    element_shapes_value, host,
+                                    core::HashBackendType::OpenAddressing);
+        core::Tensor buf_indices, masks;
+        table_hashmap.Insert(active_keys, active_values, buf_indices, masks);
+
+        auto backend = table_hashmap.GetDeviceHashBackend();
+        core::Tensor ctrl, slot_buf_indices;
+        backend->GetTable(ctrl, slot_buf_indices);
+
+        output.emplace("key", table_hashmap.GetKeyTensor());
+        for (size_t i = 0; i < values.size(); ++i) {
+            output.emplace(fmt::format("value_{:03d}", i),
+                           table_hashmap.GetValueTensor(i));
+        }
+        output.emplace("heap", backend->buffer_->GetIndexHeap());
+        output.emplace("table_ctrl", ctrl);
+        output.emplace("table_buf_indices", slot_buf_indices);
+        output.emplace("table_format",
+                       core::Tensor::Init<int64_t>({kHashTableFormat}, host));
     }
 
     std::string ext =
@@ -63,9 +108,9 @@ void WriteHashMap(const std::string& file_name, const core::HashMap& hashmap) {
     WriteNpz(file_name + postfix, output);
 }
 
-core::HashMap ReadHashMap(const std::string& file_name) {
+core::HashMap ReadHashMap(const std::string& file_name, MmapMode mmap_mode) {
     std::unordered_map<std::string, core::Tensor> tensor_map =
-            t::io::ReadNpz(file_name);
+            t::io::ReadNpz(file_name, mmap_mode);
 
     // Key
     core::Tensor keys = tensor_map.at("key");
@@ -98,6 +143,22 @@ core::HashMap ReadHashMap(const std::string& file_name) {
         element_shapes_value.push_back(value_element_shape_i);
     }
 
+    // Adopt the stored buffers and table as they are.
+    if (mmap_mode != MmapMode::None && tensor_map.count("table_format") &&
+        tensor_map.at("table_format")[0].Item<int64_t>() == kHashTableFormat) {
+        auto hashmap = core::HashMap(1, key_dtype, key_element_shape,
+                                     dtypes_value, element_shapes_value,
+                                     core::Device("CPU:0"),
+                                     core::HashBackendType::OpenAddressing);
+        auto buffer = std::make_shared<core::HashBackendBuffer>(
+                tensor_map.at("heap"), static_cast<int>(init_capacity), keys,
+                arr_input_values);
+        hashmap.GetDeviceHashBackend()->SetTable(
+                buffer, tensor_map.at("table_ctrl"),
+                tensor_map.at("table_buf_indices"));
+        return hashmap;
+    }
+
     auto hashmap =
             core::HashMap(init_capacity, key_dtype, key_element_shape,
                           dtypes_value, element_shapes_value, core::Device());
@@ -30,6 +30,7 @@
 
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/HashMap.h"
+#include "open3d/t/io/NumpyIO.h"
 
 namespace open3d {
 namespace t {
@@ -39,9 +40,18 @@ namespace io {
 /// Return a hash map on CPU.
 ///
 /// \param filename The npz file name to read from.
-core::HashMap ReadHashMap(const std::string& filename);
+/// \param mmap_mode If not MmapMode::None and the file stores a hash table,
+/// the hash map uses the OpenAddressing backend and directly views a memory
+/// mapping of the file's buffers and table, without rehashing. Only the pages
+/// touched by queries are read. Otherwise, the keys are reinserted into a hash
+/// map with the default backend.
+core::HashMap ReadHashMap(const std::string& filename,
+                          MmapMode mmap_mode = MmapMode::None);
 
 /// Save a hash map's keys and values to a npz file at 'key' and 'value'.
+/// The active entries are also laid out in a flat hash table that exactly
+/// fits them, stored at 'heap', 'table_ctrl' and 'table_buf_indices', so that
+/// the file can be memory-mapped by ReadHashMap.
 ///
 /// \param filename The npz file name to write to.
 /// \param hashmap HashMap to save.
@@ -52,11 +52,14 @@
 
 #include <zlib.h>
 
+#include <cstdint>
+#include <cstring>
 #include <memory>
 #include <numeric>
 #include <regex>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "open3d/core/Blob.h"
@@ -158,6 +161,8 @@ static char DtypeToChar(const core::Dtype& dtype) {
     // 'c': std::complex<float>, std::complex<double>),
     //      std::complex<long double>)
     // '?': object
+    // BFloat16 has no NumPy equivalent and is not supported.
+    if (dtype == core::Float16) return 'f';
     if (dtype == core::Float32) return 'f';
     if (dtype == core::Float64) return 'f';
     if (dtype == core::Int8) return 'i';
@@ -431,6 +436,16 @@ static void WriteNpzOneTensor(const std::string& file_name,
     // The ".npy" suffix will be removed when npz is read.
     std::string var_name = tensor_name + ".npy";
 
+    // Pad the local header with an extra field so that the array data is
+    // aligned to 64 bytes and can be viewed in place when memory-mapped. An
+    // extra field record takes at least 4 bytes.
+    const size_t data_offset =
+            global_header_offset + 30 + var_name.size() + npy_header.Size();
+    size_t padding = (64 - data_offset % 64) % 64;
+    if (padding > 0 && padding < 4) {
+        padding += 64;
+    }
+
     // Build the local header.
     CharVector local_header;
     local_header.Append("PK");                       // First part of sig
@@ -444,14 +459,21 @@ static void WriteNpzOneTensor(const std::string& file_name,
     local_header.Append<uint32_t>(nbytes);           // Compressed size
     local_header.Append<uint32_t>(nbytes);           // Uncompressed size
     local_header.Append<uint16_t>(var_name.size());  // Varaible's name length
-    local_header.Append<uint16_t>(0);                // Extra field length
+    local_header.Append<uint16_t>(padding);          // Extra field length
     local_header.Append(var_name);
+    if (padding > 0) {
+        // Alignment padding record, with the header ID used by zipalign.
+        local_header.Append<uint16_t>(0xd935);
+        local_header.Append<uint16_t>(padding - 4);
+        local_header.Append(padding - 4, '\0');
+    }
 
     // Build global header.
     global_header.Append("PK");              // First part of sig
     global_header.Append<uint16_t>(0x0201);  // Second part of sig
     global_header.Append<uint16_t>(20);      // Version made by
-    global_header.Append(local_header.Begin() + 4, local_header.Begin() + 30);
+    global_header.Append(local_header.Begin() + 4, local_header.Begin() + 28);
+    global_header.Append<uint16_t>(0);  // Extra field length
     global_header.Append<uint16_t>(0);  // File comment length
     global_header.Append<uint16_t>(0);  // Disk number where file starts
     global_header.Append<uint16_t>(0);  // Internal file attributes
@@ -532,6 +554,17 @@ public:
         blob_ = std::make_shared<core::Blob>(NumBytes(), core::Device("CPU:0"));
     }
 
+    NumpyArray(const core::SizeVector& shape,
+               char type,
+               int64_t word_size,
+               bool fortran_order,
+               const std::shared_ptr<core::Blob>& blob)
+        : blob_(blob),
+          shape_(shape),
+          type_(type),
+          word_size_(word_size),
+          fortran_order_(fortran_order) {}
+
     template <typename T>
     T* GetDataPtr() {
         return reinterpret_cast<T*>(blob_->GetDataPtr());
@@ -543,6 +576,7 @@ public:
     }
 
     core::Dtype GetDtype() const {
+        if (type_ == 'f' && word_size_ == 2) return core::Float16;
         if (type_ == 'f' && word_size_ == 4) return core::Float32;
         if (type_ == 'f' && word_size_ == 8) return core::Float64;
         if (type_ == 'i' && word_size_ == 1) return core::Int8;
@@ -628,16 +662,11 @@ static NumpyArray CreateNumpyArrayFromFile(FILE* fp) {
     return arr;
 }
 
-static NumpyArray CreateNumpyArrayFromCompressedFile(
-        FILE* fp,
+static NumpyArray CreateNumpyArrayFromCompressedBuffer(
+        const char* buffer_compressed,
         uint32_t num_compressed_bytes,
         uint32_t num_uncompressed_bytes) {
-    CharVector buffer_compressed(num_compressed_bytes);
     CharVector buffer_uncompressed(num_uncompressed_bytes);
-    size_t nread = fread(buffer_compressed.Data(), 1, num_compressed_bytes, fp);
-    if (nread != num_compressed_bytes) {
-        utility::LogError("Failed to read compressed data.");
-    }
 
     int err;
     z_stream d_stream;
@@ -650,8 +679,8 @@ static NumpyArray CreateNumpyArrayFromCompressedFile(
     err = inflateInit2(&d_stream, -MAX_WBITS);
 
     d_stream.avail_in = num_compressed_bytes;
-    d_stream.next_in =
-            reinterpret_cast<unsigned char*>(buffer_compressed.Data());
+    d_stream.next_in = reinterpret_cast<unsigned char*>(
+            const_cast<char*>(buffer_compressed));
     d_stream.avail_out = num_uncompressed_bytes;
     d_stream.next_out =
             reinterpret_cast<unsigned char*>(buffer_uncompressed.Data());
@@ -678,7 +707,86 @@ static NumpyArray CreateNumpyArrayFromCompressedFile(
     return array;
 }
 
-core::Tensor ReadNpy(const std::string& file_name) {
+static NumpyArray CreateNumpyArrayFromCompressedFile(
+        FILE* fp,
+        uint32_t num_compressed_bytes,
+        uint32_t num_uncompressed_bytes) {
+    CharVector buffer_compressed(num_compressed_bytes);
+    size_t nread = fread(buffer_compressed.Data(), 1, num_compressed_bytes, fp);
+    if (nread != num_compressed_bytes) {
+        utility::LogError("Failed to read compressed data.");
+    }
+    return CreateNumpyArrayFromCompressedBuffer(
+            buffer_compressed.Data(), num_compressed_bytes,
+            num_uncompressed_bytes);
+}
+
+static std::shared_ptr<utility::filesystem::MappedFile> MapFile(
+        const std::string& file_name, MmapMode mmap_mode) {
+    auto mapped_file = std::make_shared<utility::filesystem::MappedFile>();
+    if (!mapped_file->Open(file_name,
+                           mmap_mode == MmapMode::ReadOnly
+                                   ? utility::filesystem::MappedFile::Mode::
+                                             ReadOnly
+                                   : utility::filesystem::MappedFile::Mode::
+                                             CopyOnWrite)) {
+        utility::LogError("Failed to map file {}, error: {}.", file_name,
+                          mapped_file->GetError());
+    }
+    return mapped_file;
+}
+
+// Creates an array viewing the .npy data at \p offset of \p mapped_file,
+// without reading the data. Arrays whose data is not aligned to their word size
+// are copied instead. Returns the array and the number of bytes of the .npy
+// data, including its header.
+static std::pair<NumpyArray, int64_t> CreateNumpyArrayFromMappedFile(
+        const std::shared_ptr<utility::filesystem::MappedFile>& mapped_file,
+        int64_t offset) {
+    const int64_t max_num_bytes = mapped_file->GetFileSize() - offset;
+    const char* buffer = mapped_file->GetData() + offset;
+    const int64_t preamble_len = 10;  // Version 1.0 assumed.
+    if (max_num_bytes < preamble_len) {
+        utility::LogError("Header preamble cannot be read.");
+    }
+    const int64_t header_len =
+            static_cast<int64_t>(ParseNpyPreamble(buffer)) + preamble_len;
+    if (max_num_bytes < header_len) {
+        utility::LogError("Failed to read header dictionary.");
+    }
+
+    core::SizeVector shape;
+    char type;
+    int64_t word_size;
+    bool fortran_order;
+    std::tie(shape, type, word_size, fortran_order) =
+            ParseNpyHeaderFromBuffer(buffer);
+
+    const int64_t num_bytes = shape.NumElements() * word_size;
+    if (max_num_bytes - header_len < num_bytes) {
+        utility::LogError("Failed to read array data.");
+    }
+    char* data = mapped_file->GetData() + offset + header_len;
+    if (word_size > 0 && reinterpret_cast<uintptr_t>(data) % word_size != 0) {
+        NumpyArray array(shape, type, word_size, fortran_order);
+        memcpy(array.GetDataPtr<char>(), data, num_bytes);
+        return std::make_pair(array, header_len + num_bytes);
+    }
+
+    // The blob keeps the file mapped as long as any tensor views it.
+    auto blob = std::make_shared<core::Blob>(core::Device("CPU:0"), data,
+                                             [mapped_file](void*) {});
+    return std::make_pair(
+            NumpyArray(shape, type, word_size, fortran_order, blob),
+            header_len + num_bytes);
+}
+
+core::Tensor ReadNpy(const std::string& file_name, MmapMode mmap_mode) {
+    if (mmap_mode != MmapMode::None) {
+        return CreateNumpyArrayFromMappedFile(MapFile(file_name, mmap_mode), 0)
+                .first.ToTensor();
+    }
+
     utility::filesystem::CFile cfile;
     if (!cfile.Open(file_name, "rb")) {
         utility::LogError("Failed to open file {}, error: {}.", file_name,
@@ -691,8 +799,79 @@ void WriteNpy(const std::string& file_name, const core::Tensor& tensor) {
     NumpyArray(tensor).Save(file_name);
 }
 
+// Same as ReadNpz, but parses the zip file from a memory mapping. Tensors
+// stored without compression view the mapping.
+static std::unordered_map<std::string, core::Tensor> ReadNpzFromMappedFile(
+        const std::string& file_name, MmapMode mmap_mode) {
+    std::shared_ptr<utility::filesystem::MappedFile> mapped_file =
+            MapFile(file_name, mmap_mode);
+    const char* data = mapped_file->GetData();
+    const int64_t file_size = mapped_file->GetFileSize();
+
+    std::unordered_map<std::string, core::Tensor> tensor_map;
+    int64_t offset = 0;
+    while (true) {
+        if (file_size - offset < 4) {
+            utility::LogError("Failed to read local header in npz.");
+        }
+        const char* local_header = data + offset;
+
+        // If we've reached the global header or the footer, stop reading.
+        if (local_header[0] != 'P' || local_header[1] != 'K' ||
+            local_header[2] != 0x03 || local_header[3] != 0x04) {
+            break;
+        }
+        if (file_size - offset < 30) {
+            utility::LogError("Failed to read local header in npz.");
+        }
+
+        uint16_t tensor_name_len =
+                *reinterpret_cast<const uint16_t*>(&local_header[26]);
+        uint16_t extra_field_len =
+                *reinterpret_cast<const uint16_t*>(&local_header[28]);
+        uint16_t compressed_method =
+                *reinterpret_cast<const uint16_t*>(&local_header[8]);
+        uint32_t num_compressed_bytes =
+                *reinterpret_cast<const uint32_t*>(&local_header[18]);
+        uint32_t num_uncompressed_bytes =
+                *reinterpret_cast<const uint32_t*>(&local_header[22]);
+        offset += 30;
+
+        // Read tensor name and erase the trailing ".npy".
+        if (file_size - offset < tensor_name_len + extra_field_len ||
+            tensor_name_len < 4) {
+            utility::LogError("Failed to read tensor name in npz.");
+        }
+        std::string tensor_name(data + offset, tensor_name_len - 4);
+        offset += tensor_name_len + extra_field_len;
+
+        if (compressed_method == 0) {
+            std::pair<NumpyArray, int64_t> array_and_size =
+                    CreateNumpyArrayFromMappedFile(mapped_file, offset);
+            tensor_map[tensor_name] = array_and_size.first.ToTensor();
+            offset += array_and_size.second;
+        } else {
+            if (file_size - offset < num_compressed_bytes) {
+                utility::LogError("Failed to read compressed data.");
+            }
+            tensor_map[tensor_name] =
+                    CreateNumpyArrayFromCompressedBuffer(data + offset,
+                                                         num_compressed_bytes,
+                                                         num_uncompressed_bytes)
+                            .ToTensor();
+            offset += num_compressed_bytes;
+        }
+    }
+
+    return tensor_map;
+}
+
 std::unordered_map<std::string, core::Tensor> ReadNpz(
-        const std::string& file_name) {
+        const std::string& file_name, MmapMode mmap_mode) {
+    if (mmap_mode != MmapMode::None) {
+        return ReadNpzFromMappedFile(file_name, mmap_mode);
+    }
+
     utility::filesystem::CFile cfile;
     if (!cfile.Open(file_name, "rb")) {
         utility::LogError("Failed to open file {}, error: {}.", file_name,
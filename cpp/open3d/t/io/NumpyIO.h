@@ -35,10 +35,26 @@ namespace open3d {
 namespace t {
 namespace io {
 
+/// Memory mapping mode for reading Numpy files, similar to the mmap_mode of
+/// numpy.load.
+enum class MmapMode {
+    /// Read the data into newly allocated memory.
+    None,
+    /// Map the data read-only. Writing to the tensor is a segmentation fault.
+    ReadOnly,
+    /// Map the data copy-on-write. Writes are private to the process and are
+    /// not saved to the file.
+    CopyOnWrite,
+};
+
 /// Read Numpy .npy file to a tensor.
 ///
 /// \param file_name The file name to read from.
-core::Tensor ReadNpy(const std::string& file_name);
+/// \param mmap_mode If not MmapMode::None, the returned CPU tensor directly
+/// views a memory mapping of the file. No data is read until it is accessed,
+/// and the mapping is kept alive until all tensors viewing it are destroyed.
+core::Tensor ReadNpy(const std::string& file_name,
+                     MmapMode mmap_mode = MmapMode::None);
 
 /// Save a tensor to a Numpy .npy file.
 ///
@@ -49,8 +65,12 @@ void WriteNpy(const std::string& file_name, const core::Tensor& tensor);
 /// Read Numpy .npz file to an unordered_map from string to tensor.
 ///
 /// \param file_name The file name to read from.
+/// \param mmap_mode If not MmapMode::None, tensors stored without compression
+/// directly view a memory mapping of the file, see ReadNpy. Compressed tensors
+/// and tensors whose data is not aligned to their dtype in the file are read
+/// into memory.
 std::unordered_map<std::string, core::Tensor> ReadNpz(
-        const std::string& file_name);
+        const std::string& file_name, MmapMode mmap_mode = MmapMode::None);
 
 /// Save a string to tensor map as Numpy .npz file.
 ///
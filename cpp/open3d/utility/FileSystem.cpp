@@ -43,6 +43,7 @@
 #else
 #include <dirent.h>
 #include <limits.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #endif
@@ -620,6 +621,100 @@ size_t CFile::ReadData(void *data, size_t elem_size, size_t num_elems) {
     return elems;
 }
 
+MappedFile::~MappedFile() {
+    if (!Unmap()) {
+        utility::LogWarning("Failed to unmap file: {}", GetError());
+    }
+}
+
+bool MappedFile::Open(const std::string &filename, Mode mode) {
+    Close();
+    CFile cfile;
+    if (!cfile.Open(filename, "rb")) {
+        error_code_ = errno;
+        return false;
+    }
+    size_ = cfile.GetFileSize();
+    if (size_ > 0) {
+#ifdef WIN32
+        HANDLE file_handle = reinterpret_cast<HANDLE>(
+                _get_osfhandle(_fileno(cfile.GetFILE())));
+        HANDLE mapping_handle = CreateFileMapping(
+                file_handle, nullptr,
+                mode == Mode::ReadOnly ? PAGE_READONLY : PAGE_WRITECOPY, 0, 0,
+                nullptr);
+        if (mapping_handle != nullptr) {
+            // The view keeps the file mapping alive.
+            data_ = static_cast<char *>(MapViewOfFile(
+                    mapping_handle,
+                    mode == Mode::ReadOnly ? FILE_MAP_READ : FILE_MAP_COPY, 0,
+                    0, 0));
+            CloseHandle(mapping_handle);
+        }
+        if (data_ == nullptr) {
+            error_code_ = EIO;
+            return false;
+        }
+#else
+        const int prot = mode == Mode::ReadOnly ? PROT_READ
+                                                : (PROT_READ | PROT_WRITE);
+        void *data = mmap(nullptr, static_cast<size_t>(size_), prot,
+                          MAP_PRIVATE, fileno(cfile.GetFILE()), 0);
+        if (data == MAP_FAILED) {
+            error_code_ = errno;
+            return false;
+        }
+        data_ = static_cast<char *>(data);
+#endif
+    }
+    // The mapping stays valid after the file is closed.
+    is_open_ = true;
+    return true;
+}
+
+std::string MappedFile::GetError() { return GetIOErrorString(error_code_); }
+
+void MappedFile::Close() {
+    if (!Unmap()) {
+        utility::LogError("Failed to unmap file: {}", GetError());
+    }
+}
+
+bool MappedFile::Unmap() {
+    bool success = true;
+    if (is_open_ && data_ != nullptr) {
+#ifdef WIN32
+        if (!UnmapViewOfFile(data_)) {
+            error_code_ = EIO;
+            success = false;
+        }
+#else
+        if (munmap(data_, static_cast<size_t>(size_)) != 0) {
+            error_code_ = errno;
+            success = false;
+        }
+#endif
+    }
+    is_open_ = false;
+    data_ = nullptr;
+    size_ = 0;
+    return success;
+}
+
+int64_t MappedFile::GetFileSize() {
+    if (!is_open_) {
+        utility::LogError("MappedFile::GetFileSize() called on a closed file");
+    }
+    return size_;
+}
+
+char *MappedFile::GetData() {
+    if (!is_open_) {
+        utility::LogError("MappedFile::GetData() called on a closed file");
+    }
+    return data_;
+}
+
 }  // namespace filesystem
 }  // namespace utility
 }  // namespace open3d
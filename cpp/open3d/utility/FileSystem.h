@@ -167,6 +167,54 @@ private:
     std::vector<char> line_buffer_;
 };
 
+/// RAII wrapper for a memory mapping of a whole file.
+///
+/// The operating system loads pages lazily on first access, and processes
+/// mapping the same file share its page cache. Throws exceptions for using an
+/// unopened MappedFile and for errors in Close(). The destructor only warns.
+class MappedFile {
+public:
+    enum class Mode {
+        /// Pages are read-only. Writing to them is a segmentation fault.
+        ReadOnly,
+        /// Pages can be written. Written pages are private to this mapping
+        /// and never written back to the file.
+        CopyOnWrite,
+    };
+
+    MappedFile() = default;
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /// The destructor unmaps the file automatically.
+    ~MappedFile();
+
+    /// Map a file.
+    bool Open(const std::string &filename, Mode mode);
+
+    /// Returns the last encountered error for this file.
+    std::string GetError();
+
+    /// Unmap the file.
+    void Close();
+
+    /// Returns the file size in bytes.
+    int64_t GetFileSize();
+
+    /// Returns the address of the first byte of the file. Returns nullptr for
+    /// empty files.
+    char *GetData();
+
+private:
+    /// Unmap the file. Returns false and sets the error code on failure.
+    bool Unmap();
+
+    bool is_open_ = false;
+    char *data_ = nullptr;
+    int64_t size_ = 0;
+    int error_code_ = 0;
+};
+
 }  // namespace filesystem
 }  // namespace utility
 }  // namespace open3d
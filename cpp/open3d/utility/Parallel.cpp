@@ -30,6 +30,13 @@
 #include <omp.h>
 #endif
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
 #include <cstdlib>
 #include <string>
 
@@ -47,7 +54,40 @@ static std::string GetEnvVar(const std::string& name) {
     }
 }
 
+static ParallelBackend GetDefaultParallelBackend() {
+    std::string backend = GetEnvVar("OPEN3D_PARALLEL_BACKEND");
+    std::transform(backend.begin(), backend.end(), backend.begin(), ::toupper);
+    if (backend == "TBB") {
+        return ParallelBackend::TBB;
+    } else if (backend == "OPENMP") {
+        return ParallelBackend::OpenMP;
+    } else if (!backend.empty()) {
+        utility::LogWarning(
+                "Unknown OPEN3D_PARALLEL_BACKEND {}, expected TBB or OPENMP.",
+                backend);
+    }
+#ifdef _OPENMP
+    return ParallelBackend::OpenMP;
+#else
+    return ParallelBackend::TBB;
+#endif
+}
+
+static std::atomic<ParallelBackend>& GetParallelBackendStorage() {
+    static std::atomic<ParallelBackend> backend(GetDefaultParallelBackend());
+    return backend;
+}
+
+void SetParallelBackend(ParallelBackend backend) {
+    GetParallelBackendStorage() = backend;
+}
+
+ParallelBackend GetParallelBackend() { return GetParallelBackendStorage(); }
+
 int EstimateMaxThreads() {
+    if (GetParallelBackend() == ParallelBackend::TBB) {
+        return tbb::this_task_arena::max_concurrency();
+    }
 #ifdef _OPENMP
     if (!GetEnvVar("OMP_NUM_THREADS").empty() ||
         !GetEnvVar("OMP_DYNAMIC").empty()) {
@@ -59,13 +99,11 @@ int EstimateMaxThreads() {
         return utility::CPUInfo::GetInstance().NumCores();
     }
 #else
-    (void)GetEnvVar;  // Avoids compiler warning.
     return 1;
 #endif
 }
 
 bool InParallel() {
-    // TODO: when we add TBB/Parallel STL support to ParallelFor, update this.
 #ifdef _OPENMP
     return omp_in_parallel();
 #else
@@ -73,5 +111,15 @@ bool InParallel() {
 #endif
 }
 
+void ParallelForTBB(int64_t n,
+                    int64_t grain_size,
+                    const std::function<void(int64_t, int64_t)>& func) {
+    const tbb::blocked_range<int64_t> range(0, n,
+                                            std::max<int64_t>(grain_size, 1));
+    tbb::parallel_for(range, [&func](const tbb::blocked_range<int64_t>& r) {
+        func(r.begin(), r.end());
+    });
+}
+
 }  // namespace utility
 }  // namespace open3d
@@ -26,14 +26,45 @@
 
 #pragma once
 
+#include <cstdint>
+#include <functional>
+
 namespace open3d {
 namespace utility {
 
+/// Threading backend for CPU parallel loops, e.g. core::ParallelFor.
+enum class ParallelBackend {
+    /// Static OpenMP schedule. Nested parallel regions run serially.
+    OpenMP,
+    /// TBB work-stealing scheduler. Nested parallel loops share the threads
+    /// of the enclosing task arena instead of spawning new ones.
+    TBB,
+};
+
+/// Sets the threading backend for CPU parallel loops. The default is OpenMP
+/// (TBB if Open3D is built without OpenMP) and can be overridden with the
+/// environment variable OPEN3D_PARALLEL_BACKEND=TBB or OPENMP.
+void SetParallelBackend(ParallelBackend backend);
+
+/// Returns the threading backend for CPU parallel loops.
+ParallelBackend GetParallelBackend();
+
 /// Estimate the maximum number of threads to be used in a parallel region.
 int EstimateMaxThreads();
 
-/// Returns true if in an parallel section.
+/// Returns true if in an OpenMP parallel section. Kernels use this to pick
+/// their serial path, since nested OpenMP regions would run serially anyway.
+/// Loop bodies run by ParallelForTBB are not counted: nested TBB loops and
+/// reductions submit their work to the same task arena, where work stealing
+/// balances it across the threads.
 bool InParallel();
 
+/// Runs \p func(start, end) on disjoint ranges covering [0, n) with the TBB
+/// work-stealing scheduler. Ranges with at most \p grain_size elements are not
+/// split further.
+void ParallelForTBB(int64_t n,
+                    int64_t grain_size,
+                    const std::function<void(int64_t, int64_t)>& func);
+
 }  // namespace utility
 }  // namespace open3d
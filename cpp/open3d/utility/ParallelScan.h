@@ -79,6 +79,45 @@ public:
     void reverse_join(ScanSumBody& a) { sum = a.sum + sum; }
     void assign(ScanSumBody& b) { sum = b.sum; }
 };
+
+template <class Tin, class Tout, class BinaryOp>
+class ScanBody {
+    Tout sum;
+    bool has_sum;
+    const Tin* in;
+    Tout* const out;
+    BinaryOp op;
+
+public:
+    ScanBody(Tout* out_, const Tin* in_, BinaryOp op_)
+        : sum(), has_sum(false), in(in_), out(out_), op(op_) {}
+
+    template <class Tag>
+    void operator()(const tbb::blocked_range<size_t>& r, Tag) {
+        Tout temp = sum;
+        bool has_temp = has_sum;
+        for (size_t i = r.begin(); i < r.end(); ++i) {
+            temp = has_temp ? op(temp, static_cast<Tout>(in[i]))
+                            : static_cast<Tout>(in[i]);
+            has_temp = true;
+            if (Tag::is_final_scan()) out[i] = temp;
+        }
+        sum = temp;
+        has_sum = has_temp;
+    }
+    ScanBody(ScanBody& b, tbb::split)
+        : sum(), has_sum(false), in(b.in), out(b.out), op(b.op) {}
+    void reverse_join(ScanBody& a) {
+        if (a.has_sum) {
+            sum = has_sum ? op(a.sum, sum) : a.sum;
+            has_sum = true;
+        }
+    }
+    void assign(ScanBody& b) {
+        sum = b.sum;
+        has_sum = b.has_sum;
+    }
+};
 }  // namespace
 
 template <class Tin, class Tout>
@@ -93,5 +132,17 @@ void InclusivePrefixSum(const Tin* first, const Tin* last, Tout* out) {
 #endif
 }
 
+/// Computes out[i] = op(...op(op(in[0], in[1]), in[2])..., in[i]) in
+/// parallel. \p op must be associative, but does not need an identity.
+template <class Tin, class Tout, class BinaryOp>
+void InclusivePrefixScan(const Tin* first,
+                         const Tin* last,
+                         Tout* out,
+                         BinaryOp op) {
+    ScanBody<Tin, Tout, BinaryOp> body(out, first, op);
+    size_t n = std::distance(first, last);
+    tbb::parallel_scan(tbb::blocked_range<size_t>(0, n), body);
+}
+
 }  // namespace utility
 }  // namespace open3d
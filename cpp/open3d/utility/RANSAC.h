@@ -0,0 +1,304 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "open3d/utility/Optional.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace utility {
+
+/// \brief Returns the number of RANSAC iterations after which an all-inlier
+/// sample has been drawn with probability \p confidence.
+///
+/// This is k = log(1 - confidence) / log(1 - inlier_ratio^sample_size). The
+/// result is infinite if \p confidence is 1 or no inlier is known.
+inline double RANSACIterationBound(double inlier_ratio,
+                                   int sample_size,
+                                   double confidence) {
+    if (inlier_ratio >= 1.0) {
+        return 0.0;
+    }
+    const double log_denominator =
+            std::log1p(-std::pow(inlier_ratio, sample_size));
+    if (confidence >= 1.0 || !(log_denominator < 0.0)) {
+        return std::numeric_limits<double>::infinity();
+    }
+    return std::log1p(-confidence) / log_denominator;
+}
+
+/// \class RANSACEngine
+///
+/// \brief Parallel hypothesize-and-verify loop shared by the RANSAC based
+/// estimators.
+///
+/// Each iteration draws \p sample_size distinct data indices, fits a model to
+/// them and scores the model. Iterations run concurrently on OpenMP threads.
+/// Whenever a better model is found, the number of iterations is lowered to
+/// RANSACIterationBound() of its inlier ratio, so that easy problems stop
+/// long before max_iteration.
+///
+/// With num_pre_verify d > 0, a model is first checked on d random data
+/// points (the T(d,d) test of Chum and Matas). Only if all of them are
+/// inliers, the model is scored on all data. This rejects most bad models at
+/// a fraction of the cost. The iteration bound accounts for the good models
+/// rejected by the test by using the exponent sample_size + d.
+///
+/// The samples of iteration i are drawn from a generator seeded with
+/// seed + i. Among equally good models, the one of the lowest iteration wins.
+/// With a fixed seed, the iterations run in blocks of kSeededBlockSize and
+/// the iteration bound is only lowered between blocks, so that the same
+/// iterations run and the result is reproducible. Without a seed, the bound
+/// is lowered as soon as any thread finds a better model.
+class RANSACEngine {
+public:
+    /// Number of iterations between two updates of the iteration bound in
+    /// seeded runs.
+    static constexpr int kSeededBlockSize = 32;
+
+    /// \brief Result of RANSACEngine::Run().
+    template <class Model, class Score>
+    struct Result {
+        /// True if any model passed the verification.
+        bool found_ = false;
+        /// Best model.
+        Model model_;
+        /// Score of the best model.
+        Score score_;
+        /// Number of hypotheses that were generated.
+        int num_iterations_ = 0;
+        /// Number of hypotheses that were scored on all data.
+        int num_validations_ = 0;
+    };
+
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param sample_size Number of data points per hypothesis.
+    /// \param max_iteration Maximum number of hypotheses.
+    /// \param confidence Desired probability of drawing an all-inlier sample.
+    /// Use 1.0 to avoid early termination.
+    /// \param num_pre_verify Number of random data points that must be
+    /// inliers before a model is scored on all data. 0 disables the test.
+    RANSACEngine(int sample_size,
+                 int max_iteration,
+                 double confidence,
+                 int num_pre_verify = 0)
+        : sample_size_(sample_size),
+          max_iteration_(max_iteration),
+          confidence_(std::max(std::min(confidence, 1.0), 0.0)),
+          num_pre_verify_(num_pre_verify) {}
+
+    /// \brief Runs RANSAC on \p num_data data points.
+    ///
+    /// The callbacks are called concurrently and must be thread-safe.
+    ///
+    /// \param fit bool(const std::vector<size_t>& sample, Model& model). Fits
+    /// a model to the sample. Returns false for degenerate samples.
+    /// \param is_inlier bool(const Model& model, size_t index). Only used for
+    /// the pre-verification.
+    /// \param score Score(const Model& model). Scores a model on all data.
+    /// Score must provide IsBetterRANSACThan(const Score&).
+    /// \param inlier_ratio double(const Model& model, const Score& score).
+    /// Inlier ratio used for the iteration bound. Only called for models that
+    /// improve on the best model of their thread, or on the best model so far
+    /// at the end of a block of a seeded run.
+    /// \param seed Seed of the random samples. Set to nullopt to use a random
+    /// seed and a non-reproducible early termination.
+    template <class Model,
+              class Score,
+              class FitFunc,
+              class InlierFunc,
+              class ScoreFunc,
+              class RatioFunc>
+    Result<Model, Score> Run(size_t num_data,
+                             FitFunc fit,
+                             InlierFunc is_inlier,
+                             ScoreFunc score,
+                             RatioFunc inlier_ratio,
+                             utility::optional<unsigned int> seed) const {
+        Result<Model, Score> result;
+        if (sample_size_ <= 0 || num_data < size_t(sample_size_)) {
+            return result;
+        }
+
+        const bool reproducible = seed.has_value();
+        const unsigned int base_seed =
+                reproducible ? seed.value() : std::random_device{}();
+        const int block_size =
+                reproducible ? kSeededBlockSize : std::max(max_iteration_, 1);
+        const int bound_exponent = sample_size_ + num_pre_verify_;
+        std::atomic<int> est_k_global(max_iteration_);
+        int best_itr = -1;
+
+        // Lowers the iteration bound to that of a model with score s.
+        auto lower_est_k = [&](const Model& model, const Score& s) {
+            const double est_k = RANSACIterationBound(inlier_ratio(model, s),
+                                                      bound_exponent,
+                                                      confidence_);
+            if (est_k < max_iteration_) {
+                const int est_k_local = int(std::ceil(est_k));
+                int est_k_current = est_k_global.load();
+                while (est_k_local < est_k_current &&
+                       !est_k_global.compare_exchange_weak(est_k_current,
+                                                           est_k_local)) {
+                }
+            }
+        };
+
+        for (int begin = 0; begin < est_k_global.load();) {
+            const int end =
+                    begin + std::min(block_size, max_iteration_ - begin);
+            RunBlock(begin, end, num_data, fit, is_inlier, score, reproducible,
+                     base_seed, est_k_global, lower_est_k, result, best_itr);
+            if (reproducible && result.found_) {
+                lower_est_k(result.model_, result.score_);
+            }
+            begin = end;
+        }
+        return result;
+    }
+
+private:
+    /// Runs the iterations [begin, end) that are below the iteration bound
+    /// and merges their best model into \p result. In reproducible runs, the
+    /// bound is read once at the start of the block.
+    template <class Model,
+              class Score,
+              class FitFunc,
+              class InlierFunc,
+              class ScoreFunc,
+              class BoundFunc>
+    void RunBlock(int begin,
+                  int end,
+                  size_t num_data,
+                  FitFunc& fit,
+                  InlierFunc& is_inlier,
+                  ScoreFunc& score,
+                  bool reproducible,
+                  unsigned int seed,
+                  std::atomic<int>& est_k_global,
+                  BoundFunc& lower_est_k,
+                  Result<Model, Score>& result,
+                  int& best_itr) const {
+        const int est_k_block = est_k_global.load();
+
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+        {
+            Result<Model, Score> result_local;
+            int best_itr_local = -1;
+            std::vector<size_t> sample(sample_size_);
+            std::mt19937 rng;
+            std::uniform_int_distribution<size_t> uniform(0, num_data - 1);
+            Model model;
+
+            // Dynamic scheduling hands out the iterations in order, so that
+            // an early termination stops all threads at about the same time.
+            // Each thread also sees its iterations in increasing order.
+#pragma omp for schedule(dynamic, 1) nowait
+            for (int itr = begin; itr < end; ++itr) {
+                const int est_k =
+                        reproducible ? est_k_block
+                                     : est_k_global.load(
+                                               std::memory_order_relaxed);
+                if (itr >= est_k) {
+                    continue;
+                }
+                ++result_local.num_iterations_;
+
+                rng.seed(seed + itr);
+                for (int i = 0; i < sample_size_; ++i) {
+                    do {
+                        sample[i] = uniform(rng);
+                    } while (std::find(sample.begin(), sample.begin() + i,
+                                       sample[i]) != sample.begin() + i);
+                }
+                if (!fit(sample, model)) {
+                    continue;
+                }
+
+                bool pre_verified = true;
+                for (int i = 0; i < num_pre_verify_ && pre_verified; ++i) {
+                    pre_verified = is_inlier(model, uniform(rng));
+                }
+                if (!pre_verified) {
+                    continue;
+                }
+
+                ++result_local.num_validations_;
+                const Score this_score = score(model);
+                if (!result_local.found_ ||
+                    this_score.IsBetterRANSACThan(result_local.score_)) {
+                    result_local.found_ = true;
+                    result_local.model_ = model;
+                    result_local.score_ = this_score;
+                    best_itr_local = itr;
+                    if (!reproducible) {
+                        lower_est_k(model, this_score);
+                    }
+                }
+            }
+
+#pragma omp critical(RANSACEngine)
+            {
+                result.num_iterations_ += result_local.num_iterations_;
+                result.num_validations_ += result_local.num_validations_;
+                // Ties go to the lower iteration, independent of the order in
+                // which the threads get here.
+                if (result_local.found_ &&
+                    (!result.found_ ||
+                     result_local.score_.IsBetterRANSACThan(result.score_) ||
+                     (!result.score_.IsBetterRANSACThan(result_local.score_) &&
+                      best_itr_local < best_itr))) {
+                    result.found_ = true;
+                    result.model_ = result_local.model_;
+                    result.score_ = result_local.score_;
+                    best_itr = best_itr_local;
+                }
+            }
+        }
+    }
+
+public:
+    /// Number of data points per hypothesis.
+    int sample_size_;
+    /// Maximum number of hypotheses.
+    int max_iteration_;
+    /// Desired probability of drawing an all-inlier sample.
+    double confidence_;
+    /// Number of data points of the T(d,d) pre-verification.
+    int num_pre_verify_;
+};
+
+}  // namespace utility
+}  // namespace open3d
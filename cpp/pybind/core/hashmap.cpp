@@ -66,6 +66,9 @@ const std::unordered_map<std::string, std::string> argument_docs = {
          "List of input values stored in tensors of corresponding shapes."},
         {"capacity", "New capacity for rehashing."},
         {"file_name", "File name of the corresponding .npz file."},
+        {"memory_map",
+         "If true, memory-map the file copy-on-write and use the stored hash "
+         "table without rehashing."},
         {"values_buffer_id", "Index of the value buffer tensor."},
         {"device_id", "Target CUDA device ID."}};
 
@@ -109,6 +112,31 @@ void pybind_core_hashmap(py::module& m) {
             "keys"_a, "list_values"_a);
     docstring::ClassMethodDocInject(m, "HashMap", "insert", argument_docs);
 
+    hashmap.def(
+            "build_from",
+            [](HashMap& h, const Tensor& keys, const Tensor& values) {
+                Tensor buf_indices, inverse_indices;
+                h.BuildFrom(keys, values, buf_indices, inverse_indices);
+                return py::make_tuple(buf_indices, inverse_indices);
+            },
+            "Clear the hash map and bulk build it from an array of keys that "
+            "may contain duplicates and an array of values. Returns the buffer "
+            "indices of the unique keys and the inverse indices of the input "
+            "keys into them.",
+            "keys"_a, "values"_a);
+    hashmap.def(
+            "build_from",
+            [](HashMap& h, const Tensor& keys,
+               const std::vector<Tensor>& values) {
+                Tensor buf_indices, inverse_indices;
+                h.BuildFrom(keys, values, buf_indices, inverse_indices);
+                return py::make_tuple(buf_indices, inverse_indices);
+            },
+            "Clear the hash map and bulk build it from an array of keys that "
+            "may contain duplicates and a list of value arrays.",
+            "keys"_a, "list_values"_a);
+    docstring::ClassMethodDocInject(m, "HashMap", "build_from", argument_docs);
+
     hashmap.def(
             "activate",
             [](HashMap& h, const Tensor& keys) {
@@ -156,7 +184,8 @@ void pybind_core_hashmap(py::module& m) {
     docstring::ClassMethodDocInject(m, "HashMap", "save", argument_docs);
 
     hashmap.def_static("load", &HashMap::Load,
-                       "Load a hash map from a .npz file.", "file_name"_a);
+                       "Load a hash map from a .npz file.", "file_name"_a,
+                       "memory_map"_a = false);
     docstring::ClassMethodDocInject(m, "HashMap", "load", argument_docs);
 
     hashmap.def("reserve", &HashMap::Reserve,
@@ -229,6 +258,19 @@ void pybind_core_hashset(py::module& m) {
             "Insert an array of keys stored in Tensors.", "keys"_a);
     docstring::ClassMethodDocInject(m, "HashSet", "insert", argument_docs);
 
+    hashset.def(
+            "build_from",
+            [](HashSet& h, const Tensor& keys) {
+                Tensor buf_indices, inverse_indices;
+                h.BuildFrom(keys, buf_indices, inverse_indices);
+                return py::make_tuple(buf_indices, inverse_indices);
+            },
+            "Clear the hash set and bulk build it from an array of keys that "
+            "may contain duplicates. Returns the buffer indices of the unique "
+            "keys and the inverse indices of the input keys into them.",
+            "keys"_a);
+    docstring::ClassMethodDocInject(m, "HashSet", "build_from", argument_docs);
+
     hashset.def(
             "find",
             [](HashSet& h, const Tensor& keys) {
@@ -264,7 +306,8 @@ void pybind_core_hashset(py::module& m) {
     docstring::ClassMethodDocInject(m, "HashSet", "save", argument_docs);
 
     hashset.def_static("load", &HashSet::Load,
-                       "Load a hash set from a .npz file.", "file_name"_a);
+                       "Load a hash set from a .npz file.", "file_name"_a,
+                       "memory_map"_a = false);
     docstring::ClassMethodDocInject(m, "HashSet", "load", argument_docs);
 
     hashset.def("reserve", &HashSet::Reserve,
@@ -47,7 +47,10 @@ void pybind_core_nns(py::module &m_nns) {
                     {"radius", "Radius value for radius search."},
                     {"max_knn",
                      "Maximum number of neighbors to search per query point."},
-                    {"knn", "Number of neighbors to search per query point."}};
+                    {"knn", "Number of neighbors to search per query point."},
+                    {"ef_search",
+                     "Size of the candidate list per query point. Larger "
+                     "values raise the recall at the cost of speed."}};
 
     py::class_<NearestNeighborSearch, std::shared_ptr<NearestNeighborSearch>>
             nns(m_nns, "NearestNeighborSearch",
@@ -83,10 +86,22 @@ void pybind_core_nns(py::module &m_nns) {
                 }
             },
             py::arg("radius") = py::none());
+    nns.def("approximate_knn_index",
+            &NearestNeighborSearch::ApproximateKnnIndex, "max_degree"_a = 16,
+            "ef_construction"_a = 200,
+            "Set index for approximate knn search with an HNSW graph. "
+            "max_degree is the number of links per point and "
+            "ef_construction the size of the candidate list while building "
+            "the graph.");
 
     // Search functions.
     nns.def("knn_search", &NearestNeighborSearch::KnnSearch, "query_points"_a,
             "knn"_a, "Perform knn search.");
+    nns.def("approximate_knn_search",
+            &NearestNeighborSearch::ApproximateKnnSearch, "query_points"_a,
+            "knn"_a, "ef_search"_a = 64,
+            "Perform approximate knn search. Indices are -1 if fewer than "
+            "knn points were reached.");
     nns.def(
             "fixed_radius_search",
             [](NearestNeighborSearch &self, Tensor query_points, double radius,
@@ -112,6 +127,9 @@ void pybind_core_nns(py::module &m_nns) {
     docstring::ClassMethodDocInject(m_nns, "NearestNeighborSearch",
                                     "knn_search",
                                     map_nearest_neighbor_search_method_docs);
+    docstring::ClassMethodDocInject(m_nns, "NearestNeighborSearch",
+                                    "approximate_knn_search",
+                                    map_nearest_neighbor_search_method_docs);
     docstring::ClassMethodDocInject(m_nns, "NearestNeighborSearch",
                                     "multi_radius_search",
                                     map_nearest_neighbor_search_method_docs);
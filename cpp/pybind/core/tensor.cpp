@@ -525,7 +525,8 @@ Example:
     tensor.def("save", &Tensor::Save, "Save tensor to Numpy's npy format.",
                "file_name"_a);
     tensor.def_static("load", &Tensor::Load,
-                      "Load tensor from Numpy's npy format.", "file_name"_a);
+                      "Load tensor from Numpy's npy format.", "file_name"_a,
+                      "memory_map"_a = false);
 
     /// Linalg operations.
     tensor.def("det", &Tensor::Det,
@@ -686,6 +687,12 @@ Ref:
                "underlying memory will be used.");
     tensor.def("is_contiguous", &Tensor::IsContiguous,
                "Returns True if the underlying memory buffer is contiguous.");
+    tensor.def("pin_memory", &Tensor::PinMemory,
+               "Returns a copy of the CPU tensor in pinned (page-locked) host "
+               "memory. If the tensor is already pinned, it is returned "
+               "directly.");
+    tensor.def("is_pinned", &Tensor::IsPinned,
+               "Returns True if the tensor is in pinned host memory.");
     tensor.def(
             "flatten", &Tensor::Flatten,
             R"(Flattens input by reshaping it into a one-dimensional tensor. If
@@ -943,6 +950,10 @@ Returns:
             "item",
             [](const Tensor& tensor) -> py::object {
                 Dtype dtype = tensor.GetDtype();
+                if (dtype == core::Float16)
+                    return py::float_(tensor.Item<core::float16_t>());
+                if (dtype == core::BFloat16)
+                    return py::float_(tensor.Item<core::bfloat16_t>());
                 if (dtype == core::Float32)
                     return py::float_(tensor.Item<float>());
                 if (dtype == core::Float64)
@@ -115,21 +115,39 @@ void pybind_kdtreeflann(py::module &m) {
                      "At maximum, ``max_nn`` neighbors will be searched."},
                     {"knn", "``knn`` neighbors will be searched."},
                     {"feature", "Feature data."},
-                    {"data", "Matrix data."}};
+                    {"data", "Matrix data."},
+                    {"precision", "Precision of the KDTree."}};
     py::class_<KDTreeFlann, std::shared_ptr<KDTreeFlann>> kdtreeflann(
             m, "KDTreeFlann", "KDTree with FLANN for nearest neighbor search.");
+    py::enum_<KDTreeFlann::Precision> kdtreeflann_precision(
+            kdtreeflann, "Precision", py::arithmetic(),
+            "Floating point precision of the points stored in the KDTree.");
+    kdtreeflann_precision
+            .value("Float64", KDTreeFlann::Precision::Float64,
+                   "Points are stored as double.")
+            .value("Float32", KDTreeFlann::Precision::Float32,
+                   "Points are stored as float. Uses less memory and is "
+                   "faster, at the cost of accuracy.")
+            .export_values();
     kdtreeflann.def(py::init<>())
-            .def(py::init<const Eigen::MatrixXd &>(), "data"_a)
+            .def(py::init<const Eigen::MatrixXd &, KDTreeFlann::Precision>(),
+                 "data"_a, "precision"_a = KDTreeFlann::Precision::Float64)
             .def("set_matrix_data", &KDTreeFlann::SetMatrixData,
-                 "Sets the data for the KDTree from a matrix.", "data"_a)
-            .def(py::init<const Geometry &>(), "geometry"_a)
+                 "Sets the data for the KDTree from a matrix.", "data"_a,
+                 "precision"_a = KDTreeFlann::Precision::Float64)
+            .def(py::init<const Geometry &, KDTreeFlann::Precision>(),
+                 "geometry"_a, "precision"_a = KDTreeFlann::Precision::Float64)
             .def("set_geometry", &KDTreeFlann::SetGeometry,
-                 "Sets the data for the KDTree from geometry.", "geometry"_a)
-            .def(py::init<const pipelines::registration::Feature &>(),
-                 "feature"_a)
+                 "Sets the data for the KDTree from geometry.", "geometry"_a,
+                 "precision"_a = KDTreeFlann::Precision::Float64)
+            .def(py::init<const pipelines::registration::Feature &,
+                          KDTreeFlann::Precision>(),
+                 "feature"_a, "precision"_a = KDTreeFlann::Precision::Float64)
             .def("set_feature", &KDTreeFlann::SetFeature,
                  "Sets the data for the KDTree from the feature data.",
-                 "feature"_a)
+                 "feature"_a, "precision"_a = KDTreeFlann::Precision::Float64)
+            .def_property_readonly("precision", &KDTreeFlann::GetPrecision,
+                                   "Precision of the KDTree.")
             // Although these C++ style functions are fast by orders of
             // magnitudes when similar queries are performed for a large number
             // of times and memory management is involved, we prefer not to
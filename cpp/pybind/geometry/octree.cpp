@@ -29,6 +29,7 @@
 #include <sstream>
 #include <unordered_map>
 
+#include "open3d/geometry/LinearOctree.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/VoxelGrid.h"
 #include "pybind/docstring.h"
@@ -361,6 +362,99 @@ void pybind_octree(py::module &m) {
     docstring::ClassMethodDocInject(
             m, "Octree", "create_from_voxel_grid",
             {{"voxel_grid", "geometry.VoxelGrid: The source voxel grid."}});
+
+    // LinearOctree
+    py::class_<LinearOctree, std::shared_ptr<LinearOctree>> linear_octree(
+            m, "LinearOctree",
+            "Pointer-free octree storing its leaves as flat arrays sorted by "
+            "Morton code.");
+    py::detail::bind_default_constructor<LinearOctree>(linear_octree);
+    py::detail::bind_copy_functions<LinearOctree>(linear_octree);
+    linear_octree
+            .def(py::init([](size_t max_depth) {
+                     return new LinearOctree(max_depth);
+                 }),
+                 "max_depth"_a)
+            .def(py::init([](size_t max_depth, const Eigen::Vector3d &origin,
+                             double size) {
+                     return new LinearOctree(max_depth, origin, size);
+                 }),
+                 "max_depth"_a, "origin"_a, "size"_a)
+            .def("__repr__",
+                 [](const LinearOctree &octree) {
+                     std::ostringstream repr;
+                     repr << "LinearOctree with ";
+                     repr << "origin: [" << octree.origin_(0) << ", "
+                          << octree.origin_(1) << ", " << octree.origin_(2)
+                          << "]";
+                     repr << ", size: " << octree.size_;
+                     repr << ", max_depth: " << octree.max_depth_;
+                     repr << ", " << octree.NumLeaves() << " leaves";
+                     return repr.str();
+                 })
+            .def("clear", &LinearOctree::Clear, "Removes all leaves.")
+            .def("is_empty", &LinearOctree::IsEmpty,
+                 "Returns True if the octree has no leaves.")
+            .def("has_point_indices", &LinearOctree::HasPointIndices,
+                 "Returns True if the leaves store the indices of their "
+                 "points.")
+            .def("traverse", &LinearOctree::Traverse, "f"_a,
+                 "DFS traversal of the octree from the root, with a "
+                 "callback function f(node_info, begin, end) being called for "
+                 "each node, where [begin, end) is the range of leaves below "
+                 "the node.")
+            .def("locate_leaf_node", &LinearOctree::LocateLeafNode, "point"_a,
+                 "Returns the index of the leaf where the query point should "
+                 "reside, or -1, and its OctreeNodeInfo.")
+            .def("get_leaf_node_info", &LinearOctree::GetLeafNodeInfo,
+                 "leaf_index"_a, "Returns the OctreeNodeInfo of a leaf.")
+            .def("convert_from_point_cloud",
+                 &LinearOctree::ConvertFromPointCloud, "point_cloud"_a,
+                 "size_expand"_a = 0.01, "Convert octree from point cloud.")
+            .def("to_voxel_grid", &LinearOctree::ToVoxelGrid,
+                 "Convert to VoxelGrid.")
+            .def("create_from_voxel_grid", &LinearOctree::CreateFromVoxelGrid,
+                 "voxel_grid"_a, "Convert from VoxelGrid.")
+            .def("to_octree", &LinearOctree::ToOctree, "Convert to Octree.")
+            .def("create_from_octree", &LinearOctree::CreateFromOctree,
+                 "octree"_a, "Convert from Octree.")
+            .def_readwrite("origin", &LinearOctree::origin_,
+                           "(3, 1) float numpy array: Global min bound "
+                           "(include). A point is within bound iff origin <= "
+                           "point < origin + size.")
+            .def_readwrite("size", &LinearOctree::size_,
+                           "float: Outer bounding box edge size for the whole "
+                           "octree. A point is within bound iff origin <= "
+                           "point < origin + size.")
+            .def_readwrite("max_depth", &LinearOctree::max_depth_,
+                           "int: Maximum depth of the octree. All leaves are "
+                           "at this depth.")
+            .def_readwrite("leaf_codes", &LinearOctree::leaf_codes_,
+                           "List of int: Sorted Morton codes of the leaf "
+                           "cells.")
+            .def_readwrite("leaf_colors", &LinearOctree::leaf_colors_,
+                           "``float64`` array of shape ``(num_leaves, 3)``: "
+                           "Color of each leaf.")
+            .def_readwrite("leaf_point_splits",
+                           &LinearOctree::leaf_point_splits_,
+                           "List of int: Leaf i holds "
+                           "point_indices[leaf_point_splits[i]:"
+                           "leaf_point_splits[i + 1]].")
+            .def_readwrite("point_indices", &LinearOctree::point_indices_,
+                           "List of int: Point indices grouped by leaf.");
+
+    docstring::ClassMethodDocInject(m, "LinearOctree", "__init__");
+    docstring::ClassMethodDocInject(m, "LinearOctree", "locate_leaf_node",
+                                    map_octree_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "LinearOctree",
+                                    "convert_from_point_cloud",
+                                    map_octree_argument_docstrings);
+    docstring::ClassMethodDocInject(
+            m, "LinearOctree", "create_from_voxel_grid",
+            {{"voxel_grid", "geometry.VoxelGrid: The source voxel grid."}});
+    docstring::ClassMethodDocInject(
+            m, "LinearOctree", "create_from_octree",
+            {{"octree", "geometry.Octree: The source octree."}});
 }
 
 void pybind_octree_methods(py::module &m) {}
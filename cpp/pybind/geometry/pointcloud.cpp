@@ -202,7 +202,7 @@ Returns:
                  "Segments a plane in the point cloud using the RANSAC "
                  "algorithm.",
                  "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a,
-                 "seed"_a = py::none())
+                 "seed"_a = py::none(), "probability"_a = 0.99999999)
             .def_static(
                     "create_from_depth_image",
                     &PointCloud::CreateFromDepthImage,
@@ -352,10 +352,15 @@ camera. Given depth value d at (u, v) image coordinate, the corresponding 3d poi
              {"ransac_n",
               "Number of initial points to be considered inliers in each "
               "iteration."},
-             {"num_iterations", "Number of iterations."},
+             {"num_iterations", "Maximum number of iterations."},
              {"seed",
               "Seed value used in the random generator, set to None to use a "
-              "random seed value with each function call."}});
+              "random seed value with each function call. Results are "
+              "reproducible for a fixed seed."},
+             {"probability",
+              "Expected probability of finding the optimal plane. The search "
+              "stops early once this probability is reached. Use 1.0 to run "
+              "all iterations."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "create_from_depth_image",
             {{"depth",
@@ -273,6 +273,14 @@ void pybind_trianglemesh(py::module &m) {
                  "target_number_of_triangles"_a,
                  "maximum_error"_a = std::numeric_limits<double>::infinity(),
                  "boundary_weight"_a = 1.0)
+            .def("simplify_quadric_decimation_parallel",
+                 &TriangleMesh::SimplifyQuadricDecimationParallel,
+                 "Function to simplify mesh using Quadric Error Metric "
+                 "Decimation by Garland and Heckbert, with the edge collapses "
+                 "spread over threads.",
+                 "target_number_of_triangles"_a,
+                 "maximum_error"_a = std::numeric_limits<double>::infinity(),
+                 "boundary_weight"_a = 1.0)
             .def("compute_convex_hull", &TriangleMesh::ComputeConvexHull,
                  "Computes the convex hull of the triangle mesh.")
             .def("cluster_connected_triangles",
@@ -618,6 +626,16 @@ void pybind_trianglemesh(py::module &m) {
              {"boundary_weight",
               "A weight applied to edge vertices used to preserve "
               "boundaries"}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "simplify_quadric_decimation_parallel",
+            {{"target_number_of_triangles",
+              "The number of triangles that the simplified mesh should have. "
+              "It is not guaranteed that this number will be reached."},
+             {"maximum_error",
+              "The maximum error where a vertex is allowed to be merged"},
+             {"boundary_weight",
+              "A weight applied to edge vertices used to preserve "
+              "boundaries"}});
     docstring::ClassMethodDocInject(m, "TriangleMesh", "compute_convex_hull");
     docstring::ClassMethodDocInject(m, "TriangleMesh",
                                     "cluster_connected_triangles");
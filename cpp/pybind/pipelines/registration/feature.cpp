@@ -72,6 +72,22 @@ void pybind_feature_methods(py::module &m) {
             m, "compute_fpfh_feature",
             {{"input", "The Input point cloud."},
              {"search_param", "KDTree KNN search parameter."}});
+
+    m.def("correspondences_from_features", &CorrespondencesFromFeatures,
+          "Function to find nearest neighbor correspondences from features",
+          "source_features"_a, "target_features"_a, "mutual_filter"_a = false,
+          "ef_search"_a = 0);
+    docstring::FunctionDocInject(
+            m, "correspondences_from_features",
+            {{"source_features", "The source features."},
+             {"target_features", "The target features."},
+             {"mutual_filter",
+              "Keep only pairs whose points are the nearest neighbors of each "
+              "other."},
+             {"ef_search",
+              "If positive, search an approximate HNSW graph with a candidate "
+              "list of this size instead of an exact KDTree. Larger values "
+              "raise the recall at the cost of speed."}});
 }
 
 }  // namespace registration
@@ -41,6 +41,8 @@ core::Dtype ArrayFormatToDtype(const std::string& format, size_t byte_size) {
     //
     // However, some integer dtypes have aliases. E.g. "l" can be 4 bytes or 8
     // bytes depending on the OS. To be safe, we always check the byte size.
+    // NumPy's float16 uses the struct module's half-precision format "e".
+    if (format == "e" && byte_size == 2) return core::Float16;
     if (format == py::format_descriptor<float>::format() && byte_size == 4)
         return core::Float32;
     if (format == py::format_descriptor<double>::format() && byte_size == 8)
@@ -79,6 +81,7 @@ core::Dtype ArrayFormatToDtype(const std::string& format, size_t byte_size) {
 }
 
 std::string DtypeToArrayFormat(const core::Dtype& dtype) {
+    if (dtype == core::Float16) return "e";
     if (dtype == core::Float32) return py::format_descriptor<float>::format();
     if (dtype == core::Float64) return py::format_descriptor<double>::format();
     if (dtype == core::Int8) return py::format_descriptor<int8_t>::format();
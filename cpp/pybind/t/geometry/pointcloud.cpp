@@ -190,6 +190,13 @@ The attributes of the point cloud have different levels::
             "Downsamples a point cloud with a specified voxel size.",
             "voxel_size"_a);
 
+    pointcloud.def("cluster_dbscan", &PointCloud::ClusterDBSCAN,
+                   py::call_guard<py::gil_scoped_release>(), "eps"_a,
+                   "min_points"_a, "print_progress"_a = false,
+                   "Cluster PointCloud using the DBSCAN algorithm  Ester et "
+                   "al., 'A Density-Based Algorithm for Discovering Clusters "
+                   "in Large Spatial Databases with Noise', 1996. Returns an "
+                   "Int32 tensor of point labels, -1 indicates noise.");
     pointcloud.def("estimate_normals", &PointCloud::EstimateNormals,
                    py::call_guard<py::gil_scoped_release>(),
                    py::arg("max_nn") = 30, py::arg("radius") = py::none(),
@@ -250,6 +257,13 @@ The attributes of the point cloud have different levels::
     pointcloud.def("to_legacy", &PointCloud::ToLegacy,
                    "Convert to a legacy Open3D PointCloud.");
 
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "cluster_dbscan",
+            {{"eps",
+              "Density parameter that is used to find neighbouring points."},
+             {"min_points", "Minimum number of points to form a cluster."},
+             {"print_progress",
+              "If true the progress is visualized in the console."}});
     docstring::ClassMethodDocInject(m, "PointCloud", "estimate_normals",
                                     map_shared_argument_docstrings);
     docstring::ClassMethodDocInject(m, "PointCloud", "create_from_depth_image",
@@ -155,6 +155,15 @@ The attributes of the triangle mesh have different levels::
                       "Scale points.");
     triangle_mesh.def("rotate", &TriangleMesh::Rotate, "R"_a, "center"_a,
                       "Rotate points and normals (if exist).");
+    triangle_mesh.def(
+            "simplify_quadric_decimation",
+            &TriangleMesh::SimplifyQuadricDecimation,
+            py::call_guard<py::gil_scoped_release>(),
+            "target_number_of_triangles"_a,
+            "maximum_error"_a = std::numeric_limits<double>::infinity(),
+            "boundary_weight"_a = 1.0,
+            "Function to simplify mesh using Quadric Error Metric Decimation "
+            "by Garland and Heckbert. Edge collapses are spread over threads.");
 
     triangle_mesh.def_static(
             "from_legacy", &TriangleMesh::FromLegacy, "mesh_legacy"_a,
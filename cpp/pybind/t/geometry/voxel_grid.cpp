@@ -0,0 +1,172 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/VoxelGrid.h"
+
+#include "pybind/docstring.h"
+#include "pybind/t/geometry/geometry.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+void pybind_voxel_grid(py::module& m) {
+    py::class_<VoxelGrid, PyGeometry<VoxelGrid>, std::shared_ptr<VoxelGrid>,
+               Geometry>
+            voxel_grid(m, "VoxelGrid", R"(
+A sparse voxel grid with one color per voxel, stored in a hash map from Int32
+voxel coordinates to Float32 colors. Voxel (i, j, k) covers
+[origin + (i, j, k) * voxel_size, origin + (i + 1, j + 1, k + 1) * voxel_size).
+)");
+
+    voxel_grid.def(py::init([](double voxel_size, const core::Tensor& origin,
+                               const core::Device& device) {
+                       return VoxelGrid(voxel_size, origin, device);
+                   }),
+                   "voxel_size"_a = 0.01, "origin"_a = core::Tensor(),
+                   "device"_a = core::Device("CPU:0"));
+
+    voxel_grid.def("__repr__", [](const VoxelGrid& voxel_grid) {
+        return fmt::format("VoxelGrid on {} with {} voxels of size {}.",
+                           voxel_grid.GetDevice().ToString(),
+                           voxel_grid.GetNumVoxels(),
+                           voxel_grid.GetVoxelSize());
+    });
+
+    // Device transfers.
+    voxel_grid.def("to", &VoxelGrid::To,
+                   "Transfer the voxel grid to a specified device.",
+                   "device"_a, "copy"_a = false);
+    voxel_grid.def("clone", &VoxelGrid::Clone,
+                   "Returns copy of the voxel grid on the same device.");
+
+    // Properties.
+    voxel_grid.def_property_readonly("device", &VoxelGrid::GetDevice);
+    voxel_grid.def_property_readonly("voxel_size", &VoxelGrid::GetVoxelSize);
+    voxel_grid.def_property_readonly("origin", &VoxelGrid::GetOrigin);
+    voxel_grid.def("hashmap", &VoxelGrid::GetHashMap,
+                   "Get the underlying hash map from voxel coordinates to "
+                   "colors.");
+    voxel_grid.def("num_voxels", &VoxelGrid::GetNumVoxels,
+                   "Returns the number of voxels.");
+    voxel_grid.def("voxel_coordinates", &VoxelGrid::GetVoxelCoordinates,
+                   "Returns the (N, 3) Int32 coordinates of all voxels.");
+    voxel_grid.def("voxel_colors", &VoxelGrid::GetVoxelColors,
+                   "Returns the (N, 3) Float32 colors of all voxels, in the "
+                   "order of voxel_coordinates.");
+    voxel_grid.def("voxel_centers", &VoxelGrid::GetVoxelCenters,
+                   "Returns the (N, 3) Float64 centers of all voxels, in the "
+                   "order of voxel_coordinates.");
+    voxel_grid.def("compute_voxel_coordinates",
+                   &VoxelGrid::ComputeVoxelCoordinates,
+                   "Returns the Int32 coordinates of the voxels containing "
+                   "the points.",
+                   "points"_a);
+    voxel_grid.def("check_if_included", &VoxelGrid::CheckIfIncluded,
+                   "Returns a Bool mask telling if the voxel containing each "
+                   "point exists.",
+                   "points"_a);
+
+    // Editing.
+    voxel_grid.def("add_voxels", &VoxelGrid::AddVoxels,
+                   "Add voxels, keeping the color of the voxels that already "
+                   "exist.",
+                   "coordinates"_a, "colors"_a = core::Tensor());
+    voxel_grid.def("remove_voxels", &VoxelGrid::RemoveVoxels,
+                   "Remove voxels.", "coordinates"_a);
+    voxel_grid.def("add_points", &VoxelGrid::AddPoints,
+                   "Add the voxels containing the points, keeping the color "
+                   "of the voxels that already exist. The color of a new "
+                   "voxel is the average color of its points.",
+                   "points"_a, "colors"_a = core::Tensor());
+
+    // Set operations and morphology.
+    voxel_grid.def("union", &VoxelGrid::Union,
+                   "Returns a voxel grid with the voxels of both grids.",
+                   "other"_a);
+    voxel_grid.def("intersection", &VoxelGrid::Intersection,
+                   "Returns a voxel grid with the voxels of this grid that "
+                   "are also in the other grid.",
+                   "other"_a);
+    voxel_grid.def("difference", &VoxelGrid::Difference,
+                   "Returns a voxel grid with the voxels of this grid that "
+                   "are not in the other grid.",
+                   "other"_a);
+    voxel_grid.def("dilate", &VoxelGrid::Dilate,
+                   "Morphological dilation with the 3x3x3 cube.",
+                   "iterations"_a = 1);
+    voxel_grid.def("erode", &VoxelGrid::Erode,
+                   "Morphological erosion with the 3x3x3 cube.",
+                   "iterations"_a = 1);
+
+    // Carving.
+    voxel_grid.def("carve_depth_map", &VoxelGrid::CarveDepthMap,
+                   "Remove all voxels in front of the surface of a depth "
+                   "map.",
+                   "depth"_a, "intrinsics"_a, "extrinsics"_a,
+                   "depth_scale"_a = 1000.0,
+                   "keep_voxels_outside_image"_a = false);
+    voxel_grid.def("carve_silhouette", &VoxelGrid::CarveSilhouette,
+                   "Remove all voxels outside of a silhouette mask.",
+                   "silhouette_mask"_a, "intrinsics"_a, "extrinsics"_a,
+                   "keep_voxels_outside_image"_a = false);
+    docstring::ClassMethodDocInject(
+            m, "VoxelGrid", "carve_depth_map",
+            {{"depth", "UInt16 or Float32 depth image."},
+             {"intrinsics", "Intrinsic matrix [Tensor of shape (3,3)]."},
+             {"extrinsics", "Extrinsic matrix [Tensor of shape (4,4)]."},
+             {"depth_scale", "The depth is divided by depth_scale."},
+             {"keep_voxels_outside_image",
+              "Keep the voxels that project outside the image."}});
+    docstring::ClassMethodDocInject(
+            m, "VoxelGrid", "carve_silhouette",
+            {{"silhouette_mask", "Single channel mask image."},
+             {"intrinsics", "Intrinsic matrix [Tensor of shape (3,3)]."},
+             {"extrinsics", "Extrinsic matrix [Tensor of shape (4,4)]."},
+             {"keep_voxels_outside_image",
+              "Keep the voxels that project outside the image."}});
+
+    // Conversions.
+    voxel_grid.def_static(
+            "create_from_point_cloud",
+            [](const PointCloud& pcd, double voxel_size) {
+                return VoxelGrid::CreateFromPointCloud(
+                        pcd, voxel_size, core::HashBackendType::Default);
+            },
+            "Create a voxel grid from the points of a point cloud, averaging "
+            "the point colors per voxel.",
+            "pcd"_a, "voxel_size"_a);
+    voxel_grid.def_static("from_legacy", &VoxelGrid::FromLegacy,
+                          "voxel_grid_legacy"_a,
+                          "device"_a = core::Device("CPU:0"),
+                          "Create a VoxelGrid from a legacy Open3D VoxelGrid.");
+    voxel_grid.def("to_legacy", &VoxelGrid::ToLegacy,
+                   "Convert to a legacy Open3D VoxelGrid.");
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -28,6 +28,7 @@
 
 #include <cmath>
 #include <limits>
+#include <random>
 
 #include "core/CoreTest.h"
 #include "open3d/core/Device.h"
@@ -77,9 +78,14 @@ void ApplyPermutation(T* vec, const std::vector<size_t> p) {
     }
 }
 
-TEST(FixedRadiusIndex, SearchRadius) {
+class FixedRadiusIndexPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(FixedRadiusIndex,
+                         FixedRadiusIndexPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(FixedRadiusIndexPermuteDevices, SearchRadius) {
     // Define test data.
-    core::Device device = core::Device("CUDA:0");
+    core::Device device = GetParam();
     core::Tensor dataset_points = core::Tensor::Init<float>({{0.0, 0.0, 0.0},
                                                              {0.0, 0.0, 0.1},
                                                              {0.0, 0.0, 0.2},
@@ -117,9 +123,9 @@ TEST(FixedRadiusIndex, SearchRadius) {
     EXPECT_TRUE(neighbors_row_splits.AllClose(gt_neighbors_row_splits));
 }
 
-TEST(FixedRadiusIndex, SearchRadiusBatch) {
+TEST_P(FixedRadiusIndexPermuteDevices, SearchRadiusBatch) {
     // Define test data.
-    core::Device device = core::Device("CUDA:0");
+    core::Device device = GetParam();
     core::Tensor dataset_points = core::Tensor::Init<float>(
             {{0.719, 0.128, 0.431}, {0.764, 0.970, 0.678},
              {0.692, 0.786, 0.211}, {0.692, 0.969, 0.942},
@@ -228,9 +234,9 @@ TEST(FixedRadiusIndex, SearchRadiusBatch) {
              gt_neighbors_row_splits);
 }
 
-TEST(FixedRadiusIndex, SearchHybrid) {
+TEST_P(FixedRadiusIndexPermuteDevices, SearchHybrid) {
     // Define test data.
-    core::Device device = core::Device("CUDA:0");
+    core::Device device = GetParam();
     core::Tensor dataset_points = core::Tensor::Init<float>({{0.0, 0.0, 0.0},
                                                              {0.0, 0.0, 0.1},
                                                              {0.0, 0.0, 0.2},
@@ -273,9 +279,9 @@ TEST(FixedRadiusIndex, SearchHybrid) {
     EXPECT_TRUE(counts.AllClose(gt_counts));
 }
 
-TEST(FixedRadiusIndex, SearchHybridBatch) {
+TEST_P(FixedRadiusIndexPermuteDevices, SearchHybridBatch) {
     // Define test data.
-    core::Device device = core::Device("CUDA:0");
+    core::Device device = GetParam();
     core::Tensor dataset_points = core::Tensor::Init<float>(
             {{0.719, 0.128, 0.431}, {0.764, 0.970, 0.678},
              {0.692, 0.786, 0.211}, {0.692, 0.969, 0.942},
@@ -329,5 +335,59 @@ TEST(FixedRadiusIndex, SearchHybridBatch) {
     ExpectEQ(indices.ToFlatVector<int32_t>(), gt_indices);
     ExpectEQ(indices.GetShape(), shape);
 }
+
+TEST_P(FixedRadiusIndexPermuteDevices, MortonOrder) {
+    core::Device device = GetParam();
+    const int64_t n = 2000;
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> uniform(0, 1);
+    std::vector<float> points_vec(3 * n);
+    for (float &v : points_vec) {
+        v = uniform(rng);
+    }
+    core::Tensor dataset_points(points_vec, {n, 3}, core::Float32, device);
+    core::Tensor query_points = dataset_points.Slice(0, 0, n, 3);
+    const int64_t m = query_points.GetLength();
+    core::Tensor dataset_points_row_splits =
+            core::Tensor::Init<int64_t>({0, n / 2, n});
+    core::Tensor query_points_row_splits =
+            core::Tensor::Init<int64_t>({0, m / 2, m});
+
+    float radius = 0.05;
+    int max_knn = 8;
+    core::nns::FixedRadiusIndex index;
+    index.SetTensorData(dataset_points, dataset_points_row_splits, radius);
+
+    core::Tensor gt_indices, gt_distances, gt_row_splits;
+    std::tie(gt_indices, gt_distances, gt_row_splits) = index.SearchRadius(
+            query_points, query_points_row_splits, radius, /*sort*/ true);
+    core::Tensor gt_hybrid_indices, gt_hybrid_distances, gt_hybrid_counts;
+    std::tie(gt_hybrid_indices, gt_hybrid_distances, gt_hybrid_counts) =
+            index.SearchHybrid(query_points, query_points_row_splits, radius,
+                               max_knn);
+
+    // Reordering only changes the memory layout, not the results.
+    for (core::nns::MortonOrder order :
+         {core::nns::MortonOrder::Points,
+          core::nns::MortonOrder::PointsAndQueries}) {
+        core::nns::FixedRadiusIndex morton_index(order);
+        morton_index.SetTensorData(dataset_points, dataset_points_row_splits,
+                                   radius);
+
+        core::Tensor indices, distances, row_splits;
+        std::tie(indices, distances, row_splits) = morton_index.SearchRadius(
+                query_points, query_points_row_splits, radius, /*sort*/ true);
+        EXPECT_TRUE(row_splits.AllEqual(gt_row_splits));
+        EXPECT_TRUE(indices.AllEqual(gt_indices));
+        EXPECT_TRUE(distances.AllClose(gt_distances));
+
+        core::Tensor counts;
+        std::tie(indices, distances, counts) = morton_index.SearchHybrid(
+                query_points, query_points_row_splits, radius, max_knn);
+        EXPECT_TRUE(counts.AllEqual(gt_hybrid_counts));
+        EXPECT_TRUE(indices.AllEqual(gt_hybrid_indices));
+        EXPECT_TRUE(distances.AllClose(gt_hybrid_distances));
+    }
+}
 }  // namespace tests
 }  // namespace open3d
@@ -82,6 +82,7 @@ TEST_P(HashMapPermuteDevices, SimpleInit) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     for (auto backend : backends) {
@@ -112,6 +113,7 @@ TEST_P(HashMapPermuteDevices, Find) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -156,6 +158,7 @@ TEST_P(HashMapPermuteDevices, Insert) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -209,6 +212,7 @@ TEST_P(HashMapPermuteDevices, Erase) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -272,6 +276,7 @@ TEST_P(HashMapPermuteDevices, Reserve) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -326,6 +331,7 @@ TEST_P(HashMapPermuteDevices, Clear) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -404,6 +410,7 @@ TEST_P(HashMapPermuteDevices, InsertComplexKeys) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -463,6 +470,7 @@ TEST_P(HashMapPermuteDevices, MultivalueInsertion) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -528,6 +536,150 @@ TEST_P(HashMapPermuteDevices, MultivalueInsertion) {
     }
 }
 
+TEST_P(HashMapPermuteDevices, BuildFrom) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends;
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        backends.push_back(core::HashBackendType::Slab);
+        backends.push_back(core::HashBackendType::StdGPU);
+    } else {
+        backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
+    }
+
+    core::Tensor keys = core::Tensor::Init<int>(
+            {{1, 2, 3}, {0, 0, 1}, {1, 2, 3}, {-4, 5, 6}, {0, 0, 1}, {1, 2, 3}},
+            device);
+    core::Tensor values =
+            core::Tensor::Init<float>({0, 1, 2, 3, 4, 5}, device);
+
+    for (auto backend : backends) {
+        // Small initial capacity to exercise the reserve path.
+        core::HashMap hashmap(1, core::Int32, {3}, core::Float32, {1}, device,
+                              backend);
+        core::Tensor buf_indices, masks;
+        hashmap.Insert(core::Tensor::Init<int>({{7, 7, 7}}, device),
+                       core::Tensor::Init<float>({7}, device), buf_indices,
+                       masks);
+
+        core::Tensor inverse_indices;
+        hashmap.BuildFrom(keys, values, buf_indices, inverse_indices);
+        EXPECT_EQ(hashmap.Size(), 3);
+        EXPECT_EQ(buf_indices.GetShape(), core::SizeVector({3}));
+        EXPECT_EQ(inverse_indices.GetShape(), core::SizeVector({6}));
+        EXPECT_EQ(inverse_indices.GetDtype(), core::Int64);
+
+        // Indexing the unique entries with the inverse indices gives back the
+        // input keys.
+        core::Tensor input_buf_indices =
+                buf_indices.To(core::Int64).IndexGet({inverse_indices});
+        EXPECT_TRUE(hashmap.GetKeyTensor()
+                            .IndexGet({input_buf_indices})
+                            .AllEqual(keys));
+
+        hashmap.Find(keys, buf_indices, masks);
+        EXPECT_TRUE(masks.All());
+        EXPECT_TRUE(buf_indices.To(core::Int64).AllEqual(input_buf_indices));
+        hashmap.Find(core::Tensor::Init<int>({{7, 7, 7}}, device), buf_indices,
+                     masks);
+        EXPECT_FALSE(masks.Any());
+
+        // On CPU, the unique keys are sorted and keep their first values.
+        if (device.GetType() == core::Device::DeviceType::CPU) {
+            EXPECT_EQ(inverse_indices.ToFlatVector<int64_t>(),
+                      std::vector<int64_t>({2, 1, 2, 0, 1, 2}));
+            EXPECT_TRUE(hashmap.GetValueTensor()
+                                .IndexGet({input_buf_indices})
+                                .AllEqual(core::Tensor::Init<float>(
+                                        {{0}, {1}, {0}, {3}, {1}, {0}},
+                                        device)));
+        }
+
+        // An empty batch clears the hash map.
+        hashmap.BuildFrom(core::Tensor({0, 3}, core::Int32, device),
+                          core::Tensor({0}, core::Float32, device),
+                          buf_indices, inverse_indices);
+        EXPECT_EQ(hashmap.Size(), 0);
+        EXPECT_EQ(buf_indices.GetShape(), core::SizeVector({0}));
+        EXPECT_EQ(inverse_indices.GetShape(), core::SizeVector({0}));
+        EXPECT_EQ(inverse_indices.GetDtype(), core::Int64);
+    }
+}
+
+TEST(HashMap, InsertReduce) {
+    const core::Device device("CPU:0");
+    std::vector<core::HashBackendType> backends = {
+            core::HashBackendType::TBB, core::HashBackendType::OpenAddressing};
+
+    // Voxel coordinates of 8 points falling in 3 voxels, with per-point colors
+    // to be averaged and scalar weights to be bounded.
+    core::Tensor keys = core::Tensor::Init<int>({{0, 0, 0},
+                                                 {1, 0, 0},
+                                                 {0, 0, 0},
+                                                 {0, 2, 0},
+                                                 {1, 0, 0},
+                                                 {0, 0, 0},
+                                                 {0, 2, 0},
+                                                 {0, 0, 0}},
+                                                device);
+    core::Tensor colors = core::Tensor::Init<float>({{1, 0, 0},
+                                                     {0, 1, 0},
+                                                     {3, 0, 0},
+                                                     {0, 0, 1},
+                                                     {0, 3, 0},
+                                                     {0, 4, 0},
+                                                     {0, 0, 3},
+                                                     {0, 0, 4}},
+                                                    device);
+    core::Tensor weights =
+            core::Tensor::Init<int64_t>({5, 2, 7, 1, 9, 3, 4, 6}, device);
+
+    for (auto backend : backends) {
+        core::HashMap hashmap(
+                1, core::Int32, {3}, {core::Float32, core::Int64, core::Int64},
+                {{3}, {1}, {1}}, device, backend);
+
+        core::Tensor buf_indices, masks;
+        hashmap.InsertReduce(keys, {colors, weights, weights},
+                             {core::HashReduceOp::Sum, core::HashReduceOp::Min,
+                              core::HashReduceOp::Max},
+                             buf_indices, masks);
+        EXPECT_EQ(hashmap.Size(), 3);
+        EXPECT_EQ(masks.To(core::Int64).Sum({0}).Item<int64_t>(), 3);
+
+        // Every input key reports the entry it was reduced into.
+        core::Tensor found_buf_indices, found_masks;
+        hashmap.Find(keys, found_buf_indices, found_masks);
+        EXPECT_TRUE(found_masks.All());
+        EXPECT_TRUE(found_buf_indices.AllEqual(buf_indices));
+
+        core::Tensor query = core::Tensor::Init<int>(
+                {{0, 0, 0}, {1, 0, 0}, {0, 2, 0}}, device);
+        hashmap.Find(query, found_buf_indices, found_masks);
+        std::vector<core::Tensor> ai({found_buf_indices.To(core::Int64)});
+        EXPECT_TRUE(hashmap.GetValueTensor(0).IndexGet(ai).AllClose(
+                core::Tensor::Init<float>(
+                        {{4, 4, 4}, {0, 4, 0}, {0, 0, 4}}, device)));
+        EXPECT_TRUE(hashmap.GetValueTensor(1).IndexGet(ai).AllEqual(
+                core::Tensor::Init<int64_t>({{3}, {2}, {1}}, device)));
+        EXPECT_TRUE(hashmap.GetValueTensor(2).IndexGet(ai).AllEqual(
+                core::Tensor::Init<int64_t>({{7}, {9}, {4}}, device)));
+
+        // Reductions accumulate into entries inserted by earlier calls.
+        core::HashMap counter(1, core::Int32, {3}, core::Int32, {1}, device,
+                              backend);
+        counter.InsertReduce(keys, core::Tensor(), core::HashReduceOp::Count,
+                             buf_indices, masks);
+        counter.InsertReduce(query, core::Tensor(), core::HashReduceOp::Count,
+                             buf_indices, masks);
+        EXPECT_FALSE(masks.Any());
+        EXPECT_TRUE(counter.GetValueTensor()
+                            .IndexGet({buf_indices.To(core::Int64)})
+                            .AllEqual(core::Tensor::Init<int>({{5}, {3}, {3}},
+                                                              device)));
+    }
+}
+
 TEST_P(HashMapPermuteDevices, HashSet) {
     core::Device device = GetParam();
     std::vector<core::HashBackendType> backends;
@@ -536,6 +688,7 @@ TEST_P(HashMapPermuteDevices, HashSet) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -562,6 +715,80 @@ TEST_P(HashMapPermuteDevices, HashSet) {
     }
 }
 
+TEST_P(HashMapPermuteDevices, HashSetBuildFrom) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends;
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        backends.push_back(core::HashBackendType::Slab);
+        backends.push_back(core::HashBackendType::StdGPU);
+    } else {
+        backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
+    }
+
+    core::Tensor keys = core::Tensor::Init<int>(
+            {{1, 2, 3}, {0, 0, 1}, {1, 2, 3}, {-4, 5, 6}, {0, 0, 1}}, device);
+
+    for (auto backend : backends) {
+        core::HashSet hashset(1, core::Int32, {3}, device, backend);
+
+        core::Tensor buf_indices, inverse_indices;
+        std::tie(buf_indices, inverse_indices) = hashset.BuildFrom(keys);
+        EXPECT_EQ(hashset.Size(), 3);
+        EXPECT_EQ(buf_indices.GetShape(), core::SizeVector({3}));
+        EXPECT_EQ(inverse_indices.GetShape(), core::SizeVector({5}));
+
+        core::Tensor input_buf_indices =
+                buf_indices.To(core::Int64).IndexGet({inverse_indices});
+        EXPECT_TRUE(hashset.GetKeyTensor()
+                            .IndexGet({input_buf_indices})
+                            .AllEqual(keys));
+
+        std::tie(buf_indices, inverse_indices) =
+                hashset.BuildFrom(core::Tensor({0, 3}, core::Int32, device));
+        EXPECT_EQ(hashset.Size(), 0);
+        EXPECT_EQ(buf_indices.GetShape(), core::SizeVector({0}));
+        EXPECT_EQ(inverse_indices.GetShape(), core::SizeVector({0}));
+    }
+}
+
+TEST_P(HashMapPermuteDevices, HalfValues) {
+    const core::Device &device = GetParam();
+    const std::string file_name_noext = "hashmap_half";
+    const std::string file_name_ext = "hashmap_half.npz";
+    core::Device host("CPU:0");
+
+    // Value buffers are dtype-agnostic, so Float16 values are stored as-is.
+    const int n = 1000;
+    core::Tensor keys = core::Tensor::Arange(0, n, 1, core::Int32, device);
+    core::Tensor values = core::Tensor::Arange(0, n, 1, core::Float32, host)
+                                  .Mul(0.5)
+                                  .To(core::Float16)
+                                  .To(device);
+
+    core::HashMap hashmap(n, core::Int32, {1}, core::Float16, {1}, device);
+    core::Tensor buf_indices, masks;
+    hashmap.Insert(keys.View({n, 1}), values.View({n, 1}), buf_indices, masks);
+    EXPECT_EQ(hashmap.Size(), n);
+
+    hashmap.Find(keys.View({n, 1}), buf_indices, masks);
+    EXPECT_TRUE(masks.All());
+    std::vector<core::Tensor> ai({buf_indices.To(host, core::Int64)});
+    core::Tensor found = hashmap.GetValueTensor().To(host).IndexGet(ai);
+    EXPECT_EQ(found.GetDtype(), core::Float16);
+    EXPECT_TRUE(found.View({n}).AllEqual(values.To(host)));
+
+    hashmap.Save(file_name_noext);
+    core::HashMap hashmap_loaded = core::HashMap::Load(file_name_ext);
+    EXPECT_EQ(hashmap_loaded.GetValueTensor().GetDtype(), core::Float16);
+    hashmap_loaded.Find(keys.View({n, 1}), buf_indices, masks);
+    EXPECT_TRUE(masks.All());
+    ai = {buf_indices.To(host, core::Int64)};
+    found = hashmap_loaded.GetValueTensor().To(host).IndexGet(ai);
+    EXPECT_TRUE(found.View({n}).AllEqual(values.To(host)));
+    utility::filesystem::RemoveFile(file_name_ext);
+}
+
 TEST_P(HashMapPermuteDevices, HashMapIO) {
     const core::Device &device = GetParam();
     const std::string file_name_noext = "hashmap";
@@ -602,5 +829,105 @@ TEST_P(HashMapPermuteDevices, HashMapIO) {
     utility::filesystem::RemoveFile(file_name_ext);
 }
 
+TEST_P(HashMapPermuteDevices, HashMapIOMemoryMap) {
+    const core::Device &device = GetParam();
+    const std::string file_name = "hashmap_mmap.npz";
+
+    const int n = 10000;
+    const int slots = 1023;
+    HashData<int3, int> data(n, slots);
+
+    std::vector<int> keys_int3;
+    keys_int3.assign(reinterpret_cast<int *>(data.keys_.data()),
+                     reinterpret_cast<int *>(data.keys_.data()) + 3 * n);
+    core::Tensor keys(keys_int3, {n, 3}, core::Int32, device);
+    core::Tensor values(data.vals_, {n}, core::Int32, device);
+
+    core::HashMap hashmap(n, core::Int32, {3}, core::Int32, {1}, device);
+    core::Tensor buf_indices, masks;
+    hashmap.Insert(keys, values, buf_indices, masks);
+    hashmap.Save(file_name);
+
+    // The mapped hash map answers queries from the stored table.
+    core::HashMap hashmap_loaded =
+            core::HashMap::Load(file_name, /*memory_map=*/true);
+    EXPECT_EQ(hashmap_loaded.Size(), slots);
+    EXPECT_EQ(hashmap_loaded.GetCapacity(), slots);
+    EXPECT_EQ(hashmap_loaded.GetActiveIndices().GetLength(), slots);
+
+    core::Tensor keys_host = keys.To(core::Device("CPU:0"));
+    hashmap_loaded.Find(keys_host, buf_indices, masks);
+    EXPECT_TRUE(masks.All());
+    std::vector<core::Tensor> ai({buf_indices.To(core::Int64)});
+    core::Tensor found_keys = hashmap_loaded.GetKeyTensor().IndexGet(ai);
+    core::Tensor found_values = hashmap_loaded.GetValueTensor().IndexGet(ai);
+    EXPECT_TRUE(found_keys.AllEqual(keys_host));
+    EXPECT_TRUE(found_keys.T()[0].AllEqual(found_values.T()[0] *
+                                           data.k_factor_));
+
+    hashmap_loaded.Find(core::Tensor::Init<int>({{-1, -1, -1}}), buf_indices,
+                        masks);
+    EXPECT_FALSE(masks.Any());
+
+    // Modifications grow the hash map in memory and leave the file intact.
+    hashmap_loaded.Insert(core::Tensor::Init<int>({{-1, -1, -1}}),
+                          core::Tensor::Init<int>({{7}}), buf_indices, masks);
+    EXPECT_TRUE(masks.All());
+    EXPECT_EQ(hashmap_loaded.Size(), slots + 1);
+    hashmap_loaded.Erase(keys_host, masks);
+    EXPECT_EQ(hashmap_loaded.Size(), 1);
+    EXPECT_EQ(core::HashMap::Load(file_name, /*memory_map=*/true).Size(),
+              slots);
+    EXPECT_EQ(core::HashMap::Load(file_name).Size(), slots);
+
+    utility::filesystem::RemoveFile(file_name);
+}
+
+TEST(HashMap, OpenAddressingEraseReinsert) {
+    const core::Device device("CPU:0");
+    // Fill the table to its maximum load factor so that erasing from full
+    // slot groups leaves tombstones, which accumulate over the rounds until
+    // the table is rehashed.
+    const int n = 1536;
+    core::HashMap hashmap(n, core::Int32, {1}, core::Int32, {1}, device,
+                          core::HashBackendType::OpenAddressing);
+    for (int round = 0; round < 20; ++round) {
+        core::Tensor keys = core::Tensor::Arange(round * n, (round + 1) * n, 1,
+                                                 core::Int32, device);
+        core::Tensor values = keys * 2;
+
+        core::Tensor buf_indices, masks;
+        hashmap.Insert(keys, values, buf_indices, masks);
+        EXPECT_TRUE(masks.All());
+        EXPECT_EQ(hashmap.Size(), n);
+
+        // Keep the odd keys, erase the even ones.
+        core::Tensor keys_even = core::Tensor::Arange(
+                round * n, (round + 1) * n, 2, core::Int32, device);
+        hashmap.Erase(keys_even, masks);
+        EXPECT_TRUE(masks.All());
+        EXPECT_EQ(hashmap.Size(), n / 2);
+
+        hashmap.Find(keys, buf_indices, masks);
+        std::vector<bool> masks_vec = masks.ToFlatVector<bool>();
+        for (int i = 0; i < n; ++i) {
+            EXPECT_EQ(masks_vec[i], i % 2 == 1);
+        }
+        core::Tensor keys_odd = core::Tensor::Arange(
+                round * n + 1, (round + 1) * n, 2, core::Int32, device);
+        hashmap.Find(keys_odd, buf_indices, masks);
+        EXPECT_TRUE(masks.All());
+        std::vector<core::Tensor> ai({buf_indices.To(core::Int64)});
+        EXPECT_TRUE(hashmap.GetValueTensor()
+                            .IndexGet(ai)
+                            .View({n / 2})
+                            .AllEqual(keys_odd * 2));
+
+        hashmap.Erase(keys_odd, masks);
+        EXPECT_TRUE(masks.All());
+        EXPECT_EQ(hashmap.Size(), 0);
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
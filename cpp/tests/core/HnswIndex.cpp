@@ -0,0 +1,128 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/HnswIndex.h"
+
+#include <random>
+#include <set>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/KnnIndex.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(HnswIndex, SearchKnn) {
+    core::Device device = core::Device("CPU:0");
+    core::Tensor dataset_points = core::Tensor::Init<double>({{0.0, 0.0, 0.0},
+                                                              {0.0, 0.0, 0.1},
+                                                              {0.0, 0.0, 0.2},
+                                                              {0.0, 0.1, 0.0},
+                                                              {0.0, 0.1, 0.1},
+                                                              {0.0, 0.1, 0.2},
+                                                              {0.0, 0.2, 0.0},
+                                                              {0.0, 0.2, 0.1},
+                                                              {0.0, 0.2, 0.2},
+                                                              {0.1, 0.0, 0.0}},
+                                                             device);
+    core::Tensor query_points = core::Tensor::Init<double>(
+            {{0.064705, 0.043921, 0.087843}}, device);
+
+    core::nns::HnswIndex index(dataset_points);
+
+    EXPECT_THROW(index.SearchKnn(query_points, 0), std::runtime_error);
+    EXPECT_THROW(index.SearchKnn(query_points, 3, 0), std::runtime_error);
+    EXPECT_THROW(index.SetTensorData(dataset_points, 0.1), std::runtime_error);
+
+    // All points are within reach of the candidate list, so the search is
+    // exact.
+    core::Tensor indices, distances;
+    std::tie(indices, distances) = index.SearchKnn(query_points, 3);
+    EXPECT_EQ(indices.GetShape(), core::SizeVector({1, 3}));
+    EXPECT_TRUE(indices.AllClose(
+            core::Tensor::Init<int32_t>({{1, 4, 9}}, device)));
+    EXPECT_TRUE(distances.AllClose(core::Tensor::Init<double>(
+            {{0.00626358, 0.00747938, 0.0108912}}, device)));
+
+    // knn is limited by the dataset size.
+    std::tie(indices, distances) = index.SearchKnn(query_points, 12);
+    EXPECT_EQ(indices.GetShape(), core::SizeVector({1, 10}));
+    EXPECT_TRUE(indices.AllClose(core::Tensor::Init<int32_t>(
+            {{1, 4, 9, 0, 3, 2, 5, 7, 6, 8}}, device)));
+}
+
+TEST(HnswIndex, Recall) {
+    core::Device device = core::Device("CPU:0");
+    const int64_t num_points = 5000;
+    const int64_t num_queries = 200;
+    const int64_t dimension = 33;
+    const int knn = 10;
+
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    std::vector<float> values((num_points + num_queries) * dimension);
+    for (float &v : values) {
+        v = dist(gen);
+    }
+    core::Tensor all_points(values, {num_points + num_queries, dimension},
+                            core::Float32, device);
+    core::Tensor dataset_points = all_points.Slice(0, 0, num_points);
+    core::Tensor query_points =
+            all_points.Slice(0, num_points, num_points + num_queries);
+
+    core::nns::KnnIndex gt_index(dataset_points);
+    core::Tensor gt_indices = gt_index.SearchKnn(query_points, knn).first;
+    core::nns::HnswIndex index(dataset_points);
+
+    auto recall = [&](int ef_search) {
+        core::Tensor indices, distances;
+        std::tie(indices, distances) =
+                index.SearchKnn(query_points, knn, ef_search);
+        EXPECT_EQ(indices.GetShape(), core::SizeVector({num_queries, knn}));
+        int64_t num_found = 0;
+        for (int64_t i = 0; i < num_queries; ++i) {
+            std::set<int32_t> gt;
+            for (int j = 0; j < knn; ++j) {
+                gt.insert(gt_indices[i][j].Item<int32_t>());
+            }
+            for (int j = 0; j < knn; ++j) {
+                num_found += gt.count(indices[i][j].Item<int32_t>());
+            }
+        }
+        return double(num_found) / (num_queries * knn);
+    };
+    const double low_recall = recall(knn);
+    const double high_recall = recall(256);
+    EXPECT_GT(high_recall, 0.95);
+    EXPECT_GE(high_recall, low_recall);
+}
+
+}  // namespace tests
+}  // namespace open3d
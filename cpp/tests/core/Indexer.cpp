@@ -274,5 +274,72 @@ TEST_P(IndexerPermuteDevices, IsContiguous) {
     EXPECT_TRUE(output.IsContiguous());
 }
 
+TEST(Indexer, ForEachInnerLoop) {
+    core::Device device("CPU:0");
+
+    core::Tensor input0_full({3, 4, 5}, core::Float32, device);
+    core::Tensor input0 = input0_full.Slice(1, 0, 4, 2);  // Shape {3, 2, 5}.
+    core::Tensor input1({2, 1}, core::Float32, device);
+    core::Tensor input2({5}, core::Float32, device);
+    core::Tensor output({3, 2, 5}, core::Float32, device);
+
+    std::vector<core::Indexer> indexers = {
+            core::Indexer({input0, input1, input2}, output),
+            core::Indexer({output, input2}, output),
+            core::Indexer({output, output}, output),
+            core::Indexer({input0.Transpose(0, 2), input2.Reshape({5, 1, 1})},
+                          output.Transpose(0, 2)),
+            core::Indexer({core::Tensor({}, core::Float32, device)},
+                          core::Tensor({}, core::Float32, device))};
+
+    for (const core::Indexer& indexer : indexers) {
+        const int64_t num_workloads = indexer.NumWorkloads();
+        const int64_t num_inputs = indexer.NumInputs();
+        for (int64_t start = 0; start <= num_workloads; ++start) {
+            for (int64_t end = start; end <= num_workloads; ++end) {
+                int64_t workload_idx = start;
+                indexer.ForEachInnerLoop(
+                        start, end,
+                        [&](char* const* ptrs, const int64_t* byte_strides,
+                            int64_t n) {
+                            EXPECT_GT(n, 0);
+                            for (int64_t i = 0; i < n; ++i, ++workload_idx) {
+                                for (int64_t k = 0; k < num_inputs; ++k) {
+                                    EXPECT_EQ(ptrs[k] + i * byte_strides[k],
+                                              indexer.GetInputPtr(
+                                                      k, workload_idx));
+                                }
+                                EXPECT_EQ(ptrs[num_inputs] +
+                                                  i * byte_strides[num_inputs],
+                                          indexer.GetOutputPtr(workload_idx));
+                            }
+                        });
+                EXPECT_EQ(workload_idx, end);
+            }
+        }
+    }
+
+    // Contiguous trailing dimensions are iterated in a single run.
+    core::Indexer indexer({output, input2}, output);
+    int64_t num_runs = 0;
+    indexer.ForEachInnerLoop(
+            0, indexer.NumWorkloads(),
+            [&](char* const*, const int64_t*, int64_t n) {
+                EXPECT_EQ(n, 5);
+                ++num_runs;
+            });
+    EXPECT_EQ(num_runs, 6);
+
+    core::Indexer contiguous_indexer({output, output}, output);
+    num_runs = 0;
+    contiguous_indexer.ForEachInnerLoop(
+            0, contiguous_indexer.NumWorkloads(),
+            [&](char* const*, const int64_t*, int64_t n) {
+                EXPECT_EQ(n, 30);
+                ++num_runs;
+            });
+    EXPECT_EQ(num_runs, 1);
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -27,12 +27,14 @@
 
 #include <cmath>
 #include <limits>
+#include <random>
 
 #include "core/CoreTest.h"
 #include "open3d/core/Device.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NanoFlannIndex.h"
 #include "open3d/utility/Helper.h"
 #include "tests/Tests.h"
 #include "tests/core/CoreTest.h"
@@ -43,9 +45,14 @@ using namespace std;
 namespace open3d {
 namespace tests {
 
-TEST(KnnIndex, KnnSearch) {
+class KnnIndexPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(KnnIndex,
+                         KnnIndexPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(KnnIndexPermuteDevices, KnnSearch) {
     // Define test data.
-    core::Device device = core::Device("CUDA:0");
+    core::Device device = GetParam();
     core::Tensor dataset_points = core::Tensor::Init<float>({{0.0, 0.0, 0.0},
                                                              {0.0, 0.0, 0.1},
                                                              {0.0, 0.0, 0.2},
@@ -113,9 +120,9 @@ TEST(KnnIndex, KnnSearch) {
     EXPECT_TRUE(distances.AllClose(gt_distances));
 }
 
-TEST(KnnIndex, KnnSearchHighdim) {
+TEST_P(KnnIndexPermuteDevices, KnnSearchHighdim) {
     // Define test data.
-    core::Device device = core::Device("CUDA:0");
+    core::Device device = GetParam();
     core::Tensor dataset_points = core::Tensor::Init<float>({{0.0, 0.0, 0.0},
                                                              {0.0, 0.0, 0.1},
                                                              {0.0, 0.0, 0.2},
@@ -177,9 +184,9 @@ TEST(KnnIndex, KnnSearchHighdim) {
     EXPECT_TRUE(distances.AllClose(gt_distances));
 }
 
-TEST(KnnIndex, KnnSearchBatch) {
+TEST_P(KnnIndexPermuteDevices, KnnSearchBatch) {
     // Define test data.
-    core::Device device = core::Device("CUDA:0");
+    core::Device device = GetParam();
     core::Tensor dataset_points = core::Tensor::Init<float>(
             {{0.719, 0.128, 0.431}, {0.764, 0.970, 0.678},
              {0.692, 0.786, 0.211}, {0.692, 0.969, 0.942},
@@ -252,5 +259,35 @@ TEST(KnnIndex, KnnSearchBatch) {
     EXPECT_TRUE(distances.AllClose(gt_distances, 1e-5, 1e-3));
 }
 
+TEST(KnnIndex, KnnSearchCPUMatchesNanoFlann) {
+    // 33-dimensional descriptors, like FPFH features. Large enough to span
+    // several query blocks and point tiles.
+    const int64_t num_points = 1000;
+    const int64_t num_queries = 150;
+    const int64_t dim = 33;
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> uniform(0.f, 1.f);
+    std::vector<float> points_data(num_points * dim);
+    std::vector<float> queries_data(num_queries * dim);
+    for (float& v : points_data) v = uniform(rng);
+    for (float& v : queries_data) v = uniform(rng);
+    core::Tensor dataset_points(points_data, {num_points, dim},
+                                core::Float32);
+    core::Tensor query_points(queries_data, {num_queries, dim},
+                              core::Float32);
+
+    core::nns::KnnIndex knn_index(dataset_points);
+    core::nns::NanoFlannIndex nanoflann_index(dataset_points);
+    for (int knn : {1, 7, 40}) {
+        core::Tensor indices, distances, gt_indices, gt_distances;
+        std::tie(indices, distances) = knn_index.SearchKnn(query_points, knn);
+        std::tie(gt_indices, gt_distances) =
+                nanoflann_index.SearchKnn(query_points, knn);
+        EXPECT_EQ(indices.GetShape(), core::SizeVector({num_queries, knn}));
+        EXPECT_TRUE(indices.AllClose(gt_indices));
+        EXPECT_TRUE(distances.AllClose(gt_distances, 1e-5, 1e-4));
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
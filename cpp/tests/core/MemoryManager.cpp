@@ -26,9 +26,15 @@
 
 #include "open3d/core/MemoryManager.h"
 
+#include <condition_variable>
+#include <cstring>
 #include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "open3d/core/Device.h"
+#include "open3d/core/MemoryManagerStatistic.h"
 #include "tests/Tests.h"
 #include "tests/core/CoreTest.h"
 
@@ -540,6 +546,143 @@ TEST(MemoryManagerPermuteDevices, CachedTooLargeAutoReleaseAll) {
     ExpectStatistic(dummy_mm, 3, 3, 0);
 }
 
+TEST(MemoryManagerPermuteDevices, PooledAlignment) {
+    core::Device device("CPU:0");
+    core::PooledCPUMemoryManager pooled_mm;
+
+    for (size_t byte_size : {0, 1, 63, 64, 100, 5000, 1 << 20, 32 << 20}) {
+        void* ptr = pooled_mm.Malloc(byte_size, device);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 64, 0);
+        std::memset(ptr, 0, byte_size);
+        pooled_mm.Free(ptr, device);
+    }
+}
+
+TEST(MemoryManagerPermuteDevices, PooledReuse) {
+    core::Device device("CPU:0");
+    core::PooledCPUMemoryManager pooled_mm;
+    core::MemoryManagerStatistic& statistic =
+            core::MemoryManagerStatistic::GetInstance();
+    statistic.SetCountCacheAccesses(true);
+
+    core::PooledCPUMemoryManager::ReleaseCache();
+    EXPECT_EQ(core::PooledCPUMemoryManager::GetCachedByteSize(), 0);
+
+    int64_t hits = statistic.GetCacheHits(device);
+    int64_t misses = statistic.GetCacheMisses(device);
+    void* ptr = pooled_mm.Malloc(1000, device);
+    EXPECT_EQ(statistic.GetCacheMisses(device), misses + 1);
+    pooled_mm.Free(ptr, device);
+    EXPECT_GE(core::PooledCPUMemoryManager::GetCachedByteSize(), 1000);
+
+    // Same size class.
+    void* ptr_reused = pooled_mm.Malloc(900, device);
+    EXPECT_EQ(ptr_reused, ptr);
+    EXPECT_EQ(statistic.GetCacheHits(device), hits + 1);
+    EXPECT_EQ(core::PooledCPUMemoryManager::GetCachedByteSize(), 0);
+
+    // Different size class.
+    void* ptr_new = pooled_mm.Malloc(4000, device);
+    EXPECT_NE(ptr_new, ptr);
+    EXPECT_EQ(statistic.GetCacheMisses(device), misses + 2);
+
+    pooled_mm.Free(ptr_reused, device);
+    pooled_mm.Free(ptr_new, device);
+    core::PooledCPUMemoryManager::ReleaseCache();
+    EXPECT_EQ(core::PooledCPUMemoryManager::GetCachedByteSize(), 0);
+
+    // Cache accesses are not counted once disabled.
+    statistic.SetCountCacheAccesses(false);
+    ptr = pooled_mm.Malloc(1000, device);
+    pooled_mm.Free(ptr, device);
+    EXPECT_EQ(statistic.GetCacheMisses(device), misses + 2);
+    core::PooledCPUMemoryManager::ReleaseCache();
+}
+
+TEST(MemoryManagerPermuteDevices, PooledTooLarge) {
+    core::Device device("CPU:0");
+    core::PooledCPUMemoryManager pooled_mm;
+
+    core::PooledCPUMemoryManager::ReleaseCache();
+    void* ptr = pooled_mm.Malloc(64 << 20, device);
+    pooled_mm.Free(ptr, device);
+    EXPECT_EQ(core::PooledCPUMemoryManager::GetCachedByteSize(), 0);
+}
+
+TEST(MemoryManagerPermuteDevices, PooledMultipleThreads) {
+    core::Device device("CPU:0");
+    core::PooledCPUMemoryManager pooled_mm;
+
+    core::MemoryManagerStatistic& statistic =
+            core::MemoryManagerStatistic::GetInstance();
+    statistic.SetCountCacheAccesses(true);
+    const int64_t accesses =
+            statistic.GetCacheHits(device) + statistic.GetCacheMisses(device);
+
+    core::PooledCPUMemoryManager::ReleaseCache();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&pooled_mm, &device, t]() {
+            for (int i = 0; i < 1000; ++i) {
+                size_t byte_size = 16 * (1 + (i * 7 + t) % 512);
+                uint8_t* ptr = static_cast<uint8_t*>(
+                        pooled_mm.Malloc(byte_size, device));
+                std::memset(ptr, t, byte_size);
+                EXPECT_EQ(ptr[byte_size - 1], t);
+                pooled_mm.Free(ptr, device);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(statistic.GetCacheHits(device) + statistic.GetCacheMisses(device),
+              accesses + 4000);
+    statistic.SetCountCacheAccesses(false);
+
+    // Exited threads return their caches to the shared pool.
+    EXPECT_GT(core::PooledCPUMemoryManager::GetCachedByteSize(), 0);
+    core::PooledCPUMemoryManager::ReleaseCache();
+    EXPECT_EQ(core::PooledCPUMemoryManager::GetCachedByteSize(), 0);
+}
+
+TEST(MemoryManagerPermuteDevices, PooledReleaseOtherThreads) {
+    core::Device device("CPU:0");
+    core::PooledCPUMemoryManager pooled_mm;
+    core::PooledCPUMemoryManager::ReleaseCache();
+
+    // The worker keeps its cache filled until the main thread has released
+    // it.
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool cached = false;
+    bool released = false;
+    std::thread worker([&]() {
+        void* ptr = pooled_mm.Malloc(1000, device);
+        pooled_mm.Free(ptr, device);
+        std::unique_lock<std::mutex> lock(mutex);
+        cached = true;
+        cv.notify_all();
+        cv.wait(lock, [&]() { return released; });
+    });
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&]() { return cached; });
+    }
+
+    EXPECT_GE(core::PooledCPUMemoryManager::GetCachedByteSize(), 1000);
+    core::PooledCPUMemoryManager::ReleaseCache();
+    EXPECT_EQ(core::PooledCPUMemoryManager::GetCachedByteSize(), 0);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        released = true;
+    }
+    cv.notify_all();
+    worker.join();
+    EXPECT_EQ(core::PooledCPUMemoryManager::GetCachedByteSize(), 0);
+}
+
 // This must be the last test for core::CachedMemoryManager.
 TEST(MemoryManagerPermuteDevices, CachedFreeOnProgramEnd) {
     core::Device device = MakeDummyDevice();
@@ -558,5 +701,28 @@ TEST(MemoryManagerPermuteDevices, CachedFreeOnProgramEnd) {
     // No cache release to test free on program end.
 }
 
+TEST(MemoryManagerPermuteDevices, Pinned) {
+    core::Device device("CPU:0");
+    core::PinnedCPUMemoryManager pinned_mm;
+
+    for (size_t byte_size : {0, 1, 4096, 1 << 20}) {
+        char* ptr = static_cast<char*>(pinned_mm.Malloc(byte_size, device));
+        EXPECT_NE(ptr, nullptr);
+        EXPECT_TRUE(core::PinnedCPUMemoryManager::IsPinned(ptr));
+        if (byte_size > 1) {
+            char* end = ptr + byte_size;
+            EXPECT_TRUE(core::PinnedCPUMemoryManager::IsPinned(end - 1));
+            EXPECT_FALSE(core::PinnedCPUMemoryManager::IsPinned(end));
+        }
+        std::memset(ptr, 0, byte_size);
+        pinned_mm.Free(ptr, device);
+        EXPECT_FALSE(core::PinnedCPUMemoryManager::IsPinned(ptr));
+    }
+
+    void* ptr = core::MemoryManager::Malloc(100, device);
+    EXPECT_FALSE(core::PinnedCPUMemoryManager::IsPinned(ptr));
+    core::MemoryManager::Free(ptr, device);
+}
+
 }  // namespace tests
 }  // namespace open3d
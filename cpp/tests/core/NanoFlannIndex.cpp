@@ -28,6 +28,7 @@
 
 #include <cmath>
 #include <limits>
+#include <random>
 
 #include "core/CoreTest.h"
 #include "open3d/core/Device.h"
@@ -143,5 +144,135 @@ TEST(NanoFlannIndex, SearchRadius) {
     EXPECT_TRUE(neighbors_row_splits.AllClose(gt_neighbors_row_splits));
 }
 
+TEST(NanoFlannIndex, AddRemovePoints) {
+    core::Device device = core::Device("CPU:0");
+    const int64_t num_points = 600;
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    std::vector<double> values(num_points * 3);
+    for (double &v : values) {
+        v = dist(gen);
+    }
+    core::Tensor dataset_points(values, {num_points, 3}, core::Float64, device);
+    core::Tensor query_points = dataset_points.Slice(0, 0, 40) + 0.01;
+
+    // Build the dynamic index from batches of different sizes.
+    core::nns::NanoFlannIndex index(dataset_points.Slice(0, 0, 100));
+    int64_t offset = 100;
+    for (int64_t batch_size = 1; offset < num_points; batch_size += 7) {
+        const int64_t end = std::min(offset + batch_size, num_points);
+        index.AddPoints(dataset_points.Slice(0, offset, end));
+        offset = end;
+    }
+    EXPECT_EQ(index.GetDatasetSize(), static_cast<size_t>(num_points));
+
+    // Remove every 7th point and compare with a static index over the rest.
+    std::vector<int64_t> removed_indices;
+    std::vector<int64_t> kept_indices;
+    for (int64_t i = 0; i < num_points; ++i) {
+        (i % 7 == 0 ? removed_indices : kept_indices).push_back(i);
+    }
+    core::Tensor removed(removed_indices,
+                         {static_cast<int64_t>(removed_indices.size())},
+                         core::Int64, device);
+    core::Tensor kept(kept_indices, {static_cast<int64_t>(kept_indices.size())},
+                      core::Int64, device);
+    index.RemovePoints(removed);
+    index.RemovePoints(removed.Slice(0, 0, 10));
+    EXPECT_EQ(index.GetNumActivePoints(),
+              static_cast<int64_t>(kept_indices.size()));
+    EXPECT_THROW(index.RemovePoints(core::Tensor::Init<int64_t>({num_points})),
+                 std::runtime_error);
+
+    core::nns::NanoFlannIndex gt_index(dataset_points.IndexGet({kept}));
+    auto to_dataset_indices = [&](const core::Tensor &indices) {
+        return kept.IndexGet({indices.To(core::Int64)}).To(core::Int32);
+    };
+
+    core::Tensor indices, distances, gt_indices, gt_distances;
+    std::tie(indices, distances) = index.SearchKnn(query_points, 8);
+    std::tie(gt_indices, gt_distances) = gt_index.SearchKnn(query_points, 8);
+    EXPECT_EQ(indices.GetShape(), core::SizeVector({40, 8}));
+    EXPECT_TRUE(indices.AllEqual(to_dataset_indices(gt_indices)));
+    EXPECT_TRUE(distances.AllClose(gt_distances));
+
+    core::Tensor splits, gt_splits;
+    std::tie(indices, distances, splits) =
+            index.SearchRadius(query_points, 0.15);
+    std::tie(gt_indices, gt_distances, gt_splits) =
+            gt_index.SearchRadius(query_points, 0.15);
+    EXPECT_TRUE(splits.AllEqual(gt_splits));
+    EXPECT_TRUE(indices.AllEqual(to_dataset_indices(gt_indices)));
+    EXPECT_TRUE(distances.AllClose(gt_distances));
+
+    core::Tensor counts, gt_counts;
+    std::tie(indices, distances, counts) =
+            index.SearchHybrid(query_points, 0.1, 5);
+    std::tie(gt_indices, gt_distances, gt_counts) =
+            gt_index.SearchHybrid(query_points, 0.1, 5);
+    EXPECT_TRUE(counts.AllEqual(gt_counts));
+    EXPECT_TRUE(distances.AllClose(gt_distances));
+    core::Tensor valid = gt_indices.Ge(0);
+    EXPECT_TRUE(indices.Lt(0).AllEqual(valid.LogicalNot()));
+    EXPECT_TRUE(indices.IndexGet({valid}).AllEqual(
+            to_dataset_indices(gt_indices.IndexGet({valid}))));
+}
+
+TEST(NanoFlannIndex, RemovePointsPurgesSubTrees) {
+    core::Device device = core::Device("CPU:0");
+    const int64_t num_points = 200;
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    std::vector<double> values(num_points * 3);
+    for (double &v : values) {
+        v = dist(gen);
+    }
+    core::Tensor dataset_points(values, {num_points, 3}, core::Float64, device);
+    core::Tensor query_points = dataset_points.Slice(0, 0, 20) + 0.01;
+
+    // Both halves are merged into a single tree.
+    core::nns::NanoFlannIndex index(dataset_points.Slice(0, 0, 100));
+    index.AddPoints(dataset_points.Slice(0, 100, num_points));
+    EXPECT_EQ(index.GetNumIndexedPoints(), num_points);
+
+    // Keep every 5th point. Removed points stay in the tree until they are
+    // more than half of it.
+    std::vector<int64_t> removed_indices;
+    std::vector<int64_t> kept_indices;
+    for (int64_t i = 0; i < num_points; ++i) {
+        (i % 5 == 0 ? kept_indices : removed_indices).push_back(i);
+    }
+    core::Tensor removed(removed_indices,
+                         {static_cast<int64_t>(removed_indices.size())},
+                         core::Int64, device);
+    core::Tensor kept(kept_indices, {static_cast<int64_t>(kept_indices.size())},
+                      core::Int64, device);
+    index.RemovePoints(removed.Slice(0, 0, 80));
+    EXPECT_EQ(index.GetNumIndexedPoints(), num_points);
+    index.RemovePoints(removed.Slice(0, 80, removed.GetShape(0)));
+    EXPECT_EQ(index.GetNumIndexedPoints(),
+              static_cast<int64_t>(kept_indices.size()));
+    EXPECT_EQ(index.GetDatasetSize(), static_cast<size_t>(num_points));
+
+    // Searches keep returning dataset indices.
+    core::nns::NanoFlannIndex gt_index(dataset_points.IndexGet({kept}));
+    core::Tensor indices, distances, gt_indices, gt_distances;
+    std::tie(indices, distances) = index.SearchKnn(query_points, 4);
+    std::tie(gt_indices, gt_distances) = gt_index.SearchKnn(query_points, 4);
+    EXPECT_TRUE(indices.AllEqual(
+            kept.IndexGet({gt_indices.To(core::Int64)}).To(core::Int32)));
+    EXPECT_TRUE(distances.AllClose(gt_distances));
+
+    // New points are merged into the purged tree. The first of them are the
+    // query points.
+    index.AddPoints(dataset_points.Slice(0, 0, 100) + 0.01);
+    EXPECT_EQ(index.GetNumIndexedPoints(),
+              static_cast<int64_t>(kept_indices.size()) + 100);
+    std::tie(indices, distances) = index.SearchKnn(query_points, 1);
+    EXPECT_TRUE(indices.AllEqual(
+            core::Tensor::Arange(num_points, num_points + 20, 1, core::Int32)
+                    .View({20, 1})));
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -26,12 +26,17 @@
 
 #include "open3d/core/ParallelFor.h"
 
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #include "open3d/Macro.h"
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/utility/Parallel.h"
 #include "tests/Tests.h"
 #include "tests/core/CoreTest.h"
 
@@ -56,6 +61,154 @@ TEST(ParallelFor, LambdaCPU) {
     }
 }
 
+TEST(ParallelFor, GrainSizeCPU) {
+    const core::Device device("CPU:0");
+    const utility::ParallelBackend backend = utility::GetParallelBackend();
+    for (utility::ParallelBackend b :
+         {utility::ParallelBackend::OpenMP, utility::ParallelBackend::TBB}) {
+        utility::SetParallelBackend(b);
+        for (int64_t grain_size : {1, 7, 1000, 1000000}) {
+            const int64_t n = 100003;
+            std::vector<int64_t> v(n, -1);
+
+            // Runs of consecutive workloads on the same thread. Both backends
+            // hand out contiguous ranges, so each run covers one or more
+            // dispatched chunks.
+            std::mutex mutex;
+            std::map<std::thread::id, int64_t> last_idx;
+            std::map<std::thread::id, int64_t> run_start;
+            std::vector<int64_t> run_lengths;
+            core::ParallelForWithGrainSize(
+                    device, n, grain_size, [&](int64_t idx) {
+                        v[idx] = idx;
+                        std::lock_guard<std::mutex> lock(mutex);
+                        const std::thread::id tid = std::this_thread::get_id();
+                        auto it = last_idx.find(tid);
+                        if (it != last_idx.end() && it->second + 1 != idx) {
+                            run_lengths.push_back(it->second + 1 -
+                                                  run_start[tid]);
+                        }
+                        if (it == last_idx.end() || it->second + 1 != idx) {
+                            run_start[tid] = idx;
+                        }
+                        last_idx[tid] = idx;
+                    });
+            for (const auto& kv : last_idx) {
+                run_lengths.push_back(kv.second + 1 - run_start[kv.first]);
+            }
+            for (int64_t i = 0; i < n; ++i) {
+                ASSERT_EQ(v[i], i);
+            }
+
+            // No chunk is split below half the grain size, so there are at
+            // most 2 * n / grain_size chunks and a single one if
+            // grain_size >= n.
+            if (grain_size >= n) {
+                EXPECT_EQ(run_lengths.size(), 1u);
+            }
+            EXPECT_LE(static_cast<int64_t>(run_lengths.size()),
+                      2 * n / grain_size + 1);
+            for (int64_t length : run_lengths) {
+                EXPECT_GE(length, std::min(n, grain_size / 2));
+            }
+        }
+    }
+    utility::SetParallelBackend(backend);
+}
+
+TEST(ParallelFor, RangeCPU) {
+    const core::Device device("CPU:0");
+    const utility::ParallelBackend backend = utility::GetParallelBackend();
+    for (utility::ParallelBackend b :
+         {utility::ParallelBackend::OpenMP, utility::ParallelBackend::TBB}) {
+        utility::SetParallelBackend(b);
+        for (int64_t grain_size : {1, 7, 1000, 1000000}) {
+            std::vector<int64_t> v(100003, -1);
+            std::mutex mutex;
+            std::vector<int64_t> range_lengths;
+            core::ParallelForRange(device, v.size(), grain_size,
+                                   [&](int64_t start, int64_t end) {
+                                       EXPECT_LT(start, end);
+                                       for (int64_t i = start; i < end; ++i) {
+                                           v[i] = i;
+                                       }
+                                       std::lock_guard<std::mutex> lock(mutex);
+                                       range_lengths.push_back(end - start);
+                                   });
+            for (int64_t i = 0; i < static_cast<int64_t>(v.size()); ++i) {
+                ASSERT_EQ(v[i], i);
+            }
+
+            // Ranges are split down to half the grain size at most.
+            const int64_t n = static_cast<int64_t>(v.size());
+            if (grain_size >= n) {
+                EXPECT_EQ(range_lengths.size(), 1u);
+            }
+            EXPECT_LE(static_cast<int64_t>(range_lengths.size()),
+                      2 * n / grain_size + 1);
+            for (int64_t length : range_lengths) {
+                EXPECT_GE(length, std::min(n, grain_size / 2));
+            }
+        }
+    }
+    utility::SetParallelBackend(backend);
+}
+
+TEST(ParallelFor, NestedTBB) {
+    const core::Device device("CPU:0");
+    const utility::ParallelBackend backend = utility::GetParallelBackend();
+    utility::SetParallelBackend(utility::ParallelBackend::TBB);
+
+    // Nested loops share the threads of the enclosing loop.
+    const int64_t num_outer = 16;
+    const int64_t num_inner = 10000;
+    std::vector<int64_t> v(num_outer * num_inner, -1);
+    core::ParallelFor(device, num_outer, [&](int64_t o) {
+        // TBB loop bodies do not count as nested parallel regions.
+        EXPECT_FALSE(utility::InParallel());
+        core::ParallelFor(device, num_inner, [&](int64_t i) {
+            v[o * num_inner + i] = o * num_inner + i;
+        });
+    });
+    for (int64_t i = 0; i < static_cast<int64_t>(v.size()); ++i) {
+        ASSERT_EQ(v[i], i);
+    }
+
+    // Reductions run on the TBB backend and inside TBB tasks.
+    core::Tensor t = core::Tensor::Arange(0, 100000, 1, core::Int64, device)
+                             .Reshape({100, 1000});
+    core::Tensor row_sums = t.Sum({1});
+    std::vector<int64_t> sums(100);
+    core::ParallelFor(device, 100, [&](int64_t i) {
+        sums[i] = t[i].Sum({0}).Item<int64_t>();
+    });
+    EXPECT_EQ(row_sums.ToFlatVector<int64_t>(), sums);
+    EXPECT_EQ(t.T().Sum({0, 1}).Item<int64_t>(), 4999950000);
+
+    // A nested reduction takes the parallel two-pass path, not the serial
+    // one. In float, the serial sum 1e8 + 1 + 1 + ... stays at 1e8, while the
+    // partial sums of the other chunks add up exactly before they are merged.
+    const int64_t n = 1 << 20;
+    std::vector<float> values(n, 1.f);
+    values[0] = 1e8f;
+    core::Tensor f(values, {n}, core::Float32, device);
+    float serial_sum = 0.f;
+    for (float x : values) {
+        serial_sum += x;
+    }
+    const float sum = f.Sum({0}).Item<float>();
+    float nested_sum = 0.f;
+    core::ParallelFor(device, 1, [&](int64_t) {
+        nested_sum = f.Sum({0}).Item<float>();
+    });
+    EXPECT_EQ(nested_sum, sum);
+    if (utility::EstimateMaxThreads() > 1) {
+        EXPECT_NE(nested_sum, serial_sum);
+    }
+
+    utility::SetParallelBackend(backend);
+}
+
 TEST(ParallelFor, VectorizedLambda1) {
     const size_t N = 10000000;
     std::vector<int64_t> v(N);
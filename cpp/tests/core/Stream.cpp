@@ -0,0 +1,155 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/Stream.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "tests/Tests.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class StreamPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Stream,
+                         StreamPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST(Stream, Order) {
+    core::Stream stream;
+    std::vector<int> order;
+    for (int i = 0; i < 100; ++i) {
+        stream.Enqueue([&order, i]() { order.push_back(i); });
+    }
+    stream.Synchronize();
+
+    ASSERT_EQ(order.size(), 100);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(order[i], i);
+    }
+}
+
+TEST(Stream, Event) {
+    core::Stream stream;
+    EXPECT_TRUE(core::Event().IsDone());
+
+    std::atomic<bool> release(false);
+    stream.Enqueue([&release]() {
+        while (!release) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+    core::Event event = stream.Record();
+    EXPECT_FALSE(event.IsDone());
+
+    release = true;
+    event.Synchronize();
+    EXPECT_TRUE(event.IsDone());
+}
+
+TEST(Stream, WaitEvent) {
+    core::Stream producer;
+    core::Stream consumer;
+
+    std::atomic<bool> release(false);
+    int value = 0;
+    producer.Enqueue([&release, &value]() {
+        while (!release) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        value = 1;
+    });
+    consumer.WaitEvent(producer.Record());
+    int observed = -1;
+    consumer.Enqueue([&value, &observed]() { observed = value; });
+
+    release = true;
+    consumer.Synchronize();
+    EXPECT_EQ(observed, 1);
+}
+
+TEST(Stream, Exception) {
+    core::Stream stream;
+    int value = 0;
+    stream.Enqueue([]() { throw std::runtime_error("Task failed."); });
+    stream.Enqueue([&value]() { value = 1; });
+    EXPECT_THROW(stream.Synchronize(), std::runtime_error);
+    EXPECT_EQ(value, 1);
+
+    // The error is only reported once.
+    EXPECT_NO_THROW(stream.Synchronize());
+}
+
+TEST(Stream, ScopedStream) {
+    core::Stream stream;
+    EXPECT_EQ(&core::Stream::GetCurrent(), &core::Stream::GetDefault());
+    {
+        core::ScopedStream scoped_stream(stream);
+        EXPECT_EQ(&core::Stream::GetCurrent(), &stream);
+    }
+    EXPECT_EQ(&core::Stream::GetCurrent(), &core::Stream::GetDefault());
+}
+
+TEST_P(StreamPermuteDevices, NonBlockingTo) {
+    core::Device device = GetParam();
+    core::Device host("CPU:0");
+    core::Stream stream;
+
+    core::Tensor src = core::Tensor::Arange(0, 1000, 1, core::Float32, host)
+                               .PinMemory();
+    EXPECT_TRUE(src.IsPinned());
+
+    core::Tensor dst;
+    {
+        core::ScopedStream scoped_stream(stream);
+        dst = src.To(device, /*copy=*/true, /*non_blocking=*/true);
+    }
+    EXPECT_EQ(dst.GetDevice(), device);
+    EXPECT_EQ(dst.GetShape(), src.GetShape());
+
+    core::Event event = stream.Record();
+    event.Synchronize();
+    EXPECT_TRUE(dst.To(host).AllClose(src));
+
+    // Copy back.
+    core::Tensor back;
+    {
+        core::ScopedStream scoped_stream(stream);
+        back = dst.Slice(0, 0, 1000, 2).To(host, /*copy=*/true,
+                                           /*non_blocking=*/true);
+    }
+    stream.Synchronize();
+    EXPECT_TRUE(back.AllClose(src.Slice(0, 0, 1000, 2)));
+}
+
+}  // namespace tests
+}  // namespace open3d
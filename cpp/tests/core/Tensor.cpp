@@ -1586,6 +1586,41 @@ TEST_P(TensorPermuteDevices, Add_) {
               std::vector<float>({10, 12, 14, 16, 18, 20}));
 }
 
+TEST_P(TensorPermuteDevices, Add_BroadcastStrided) {
+    core::Device device = GetParam();
+    core::Tensor points =
+            core::Tensor::Arange(0, 3000, 1, core::Float32, device)
+                    .Reshape({1000, 3});
+    core::Tensor offset = core::Tensor::Init<float>({{1, 2, 3}}, device);
+    core::Tensor scale = core::Tensor::Arange(0, 1000, 1, core::Float32, device)
+                                 .Reshape({1000, 1});
+
+    // (N, 3) op (1, 3) and (N, 3) op (N, 1) against explicitly tiled
+    // operands.
+    core::Tensor offset_tiled = offset.Expand({1000, 3}).Contiguous();
+    core::Tensor scale_tiled = scale.Expand({1000, 3}).Contiguous();
+    EXPECT_TRUE((points + offset).AllClose(points + offset_tiled));
+    EXPECT_TRUE((offset - points).AllClose(offset_tiled - points));
+    EXPECT_TRUE((points * scale).AllClose(points * scale_tiled));
+    EXPECT_TRUE((scale / (points + 1)).AllClose(scale_tiled / (points + 1)));
+
+    // In-place ops on strided views.
+    core::Tensor expected = points.Clone();
+    expected.Slice(0, 0, 1000, 2) += offset_tiled.Slice(0, 0, 1000, 2);
+    core::Tensor actual = points.Clone();
+    actual.Slice(0, 0, 1000, 2) += offset;
+    EXPECT_TRUE(actual.AllClose(expected));
+
+    core::Tensor transposed = points.Clone().T();
+    transposed += offset.T();
+    EXPECT_TRUE(transposed.T().AllClose(points + offset));
+
+    // Copy from a broadcast scalar column.
+    core::Tensor dst = core::Tensor::Zeros({1000, 3}, core::Float32, device);
+    dst.AsRvalue() = scale;
+    EXPECT_TRUE(dst.AllClose(scale_tiled));
+}
+
 TEST_P(TensorPermuteDevices, Add_BroadcastException) {
     // A.shape = (   3, 4)
     // B.shape = (2, 3, 4)
@@ -2257,6 +2292,60 @@ TEST_P(TensorPermuteDevices, ReduceArgMax) {
               std::vector<int64_t>({1, 2, 2, 1, 3, 2}));
 }
 
+TEST(Tensor, ReduceContiguous) {
+    // Contiguous reductions over adjacent dims take a blocked fast path.
+    // Compare it against the generic path on a non-contiguous copy. The shape
+    // crosses the reduction block boundaries in every dim.
+    core::Device device("CPU:0");
+    const core::SizeVector shape{3, 20001, 5};
+    std::vector<int64_t> vals(shape.NumElements());
+    for (size_t i = 0; i < vals.size(); ++i) {
+        vals[i] = static_cast<int64_t>((i * 7919) % 10007) - 5000;
+    }
+    core::Tensor src(vals, shape, core::Int64, device);
+    core::Tensor src_strided =
+            src.Permute({2, 1, 0}).Contiguous().Permute({2, 1, 0});
+    EXPECT_TRUE(src.IsContiguous());
+    EXPECT_FALSE(src_strided.IsContiguous());
+
+    for (const core::SizeVector& dims : std::vector<core::SizeVector>{
+                 {0}, {1}, {2}, {0, 1}, {1, 2}, {0, 1, 2}, {-1}}) {
+        for (bool keepdim : {true, false}) {
+            EXPECT_TRUE(src.Sum(dims, keepdim).AllEqual(
+                    src_strided.Sum(dims, keepdim)));
+            EXPECT_TRUE(src.Min(dims, keepdim).AllEqual(
+                    src_strided.Min(dims, keepdim)));
+            EXPECT_TRUE(src.Max(dims, keepdim).AllEqual(
+                    src_strided.Max(dims, keepdim)));
+        }
+    }
+    for (int64_t dim : {0, 1, 2}) {
+        EXPECT_TRUE(src.ArgMin({dim}).AllEqual(src_strided.ArgMin({dim})));
+        EXPECT_TRUE(src.ArgMax({dim}).AllEqual(src_strided.ArgMax({dim})));
+    }
+
+    // ArgMin and ArgMax return the first occurrence.
+    core::Tensor ones = core::Tensor::Ones({40000}, core::Float32, device);
+    ones[30000] = 0.f;
+    ones[35000] = 0.f;
+    EXPECT_EQ(ones.ArgMin({0}).Item<int64_t>(), 30000);
+    EXPECT_EQ(ones.ArgMax({0}).Item<int64_t>(), 0);
+
+    // Any and All.
+    core::Tensor mask = core::Tensor::Zeros({4, 20000}, core::Bool, device);
+    EXPECT_FALSE(mask.Any());
+    mask[2][19999] = true;
+    EXPECT_TRUE(mask.Any());
+    EXPECT_FALSE(mask.All());
+    mask.Fill(true);
+    EXPECT_TRUE(mask.All());
+
+    // Float sums are accurate and do not depend on the number of threads.
+    core::Tensor floats =
+            core::Tensor::Full({1000000}, 0.1, core::Float32, device);
+    EXPECT_NEAR(floats.Sum({0}).Item<float>(), 100000.f, 1.f);
+}
+
 TEST_P(TensorPermuteDevices, Sqrt) {
     core::Device device = GetParam();
     core::Tensor src =
@@ -2761,6 +2850,322 @@ TEST_P(TensorPermuteDevices, NonZeroNumpy) {
     EXPECT_EQ(results[1].GetShape(), core::SizeVector{3});
 }
 
+// Sort, TopK and Unique are only implemented on CPU.
+TEST(Tensor, Sort) {
+    core::Device device("CPU:0");
+
+    core::Tensor a = core::Tensor::Init<float>(
+            {{3, 1, 2, 1}, {0, -1, 5, 4}, {2, 2, 2, 2}}, device);
+    EXPECT_TRUE(a.Sort().AllEqual(core::Tensor::Init<float>(
+            {{1, 1, 2, 3}, {-1, 0, 4, 5}, {2, 2, 2, 2}}, device)));
+    EXPECT_TRUE(a.ArgSort().AllEqual(core::Tensor::Init<int64_t>(
+            {{1, 3, 2, 0}, {1, 0, 3, 2}, {0, 1, 2, 3}}, device)));
+    EXPECT_TRUE(a.Sort(0).AllEqual(core::Tensor::Init<float>(
+            {{0, -1, 2, 1}, {2, 1, 2, 2}, {3, 2, 5, 4}}, device)));
+    EXPECT_TRUE(a.ArgSort(0, /*descending=*/true)
+                        .AllEqual(core::Tensor::Init<int64_t>(
+                                {{0, 2, 1, 1}, {2, 0, 0, 2}, {1, 1, 2, 0}},
+                                device)));
+
+    // Non-contiguous input.
+    EXPECT_TRUE(a.T().Sort(1).AllEqual(a.Sort(0).T()));
+
+    // Empty and 0-D.
+    core::Tensor empty = core::Tensor::Empty({3, 0}, core::Int32, device);
+    EXPECT_EQ(empty.Sort().GetShape(), core::SizeVector({3, 0}));
+    EXPECT_ANY_THROW(core::Tensor::Init<float>(1, device).Sort());
+
+    // Long rows are sorted in parallel.
+    const int64_t n = 100000;
+    std::vector<int64_t> b_vals(n);
+    for (int64_t i = 0; i < n; ++i) {
+        b_vals[i] = (i * 7919) % n;
+    }
+    core::Tensor b(b_vals, {n}, core::Int64, device);
+    core::Tensor b_sorted = b.Sort(0, /*descending=*/true);
+    EXPECT_TRUE(b_sorted.AllEqual(
+            core::Tensor::Arange(n - 1, -1, -1, core::Int64, device)));
+    EXPECT_TRUE(b.IndexGet({b.ArgSort()}).AllEqual(b.Sort()));
+}
+
+TEST(Tensor, TopK) {
+    core::Device device("CPU:0");
+
+    core::Tensor a = core::Tensor::Init<int32_t>(
+            {{3, 1, 2, 1}, {0, -1, 5, 4}}, device);
+    core::Tensor values, indices;
+    std::tie(values, indices) = a.TopK(2);
+    EXPECT_TRUE(values.AllEqual(
+            core::Tensor::Init<int32_t>({{3, 2}, {5, 4}}, device)));
+    EXPECT_TRUE(indices.AllEqual(
+            core::Tensor::Init<int64_t>({{0, 2}, {2, 3}}, device)));
+
+    // Ties are broken by the lower index.
+    std::tie(values, indices) = a.TopK(3, -1, /*largest=*/false);
+    EXPECT_TRUE(values.AllEqual(
+            core::Tensor::Init<int32_t>({{1, 1, 2}, {-1, 0, 4}}, device)));
+    EXPECT_TRUE(indices.AllEqual(
+            core::Tensor::Init<int64_t>({{1, 3, 2}, {1, 0, 3}}, device)));
+
+    std::tie(values, indices) = a.TopK(1, 0);
+    EXPECT_TRUE(values.AllEqual(
+            core::Tensor::Init<int32_t>({{3, 1, 5, 4}}, device)));
+    EXPECT_TRUE(indices.AllEqual(
+            core::Tensor::Init<int64_t>({{0, 0, 1, 1}}, device)));
+
+    std::tie(values, indices) = a.TopK(0);
+    EXPECT_EQ(values.GetShape(), core::SizeVector({2, 0}));
+    EXPECT_ANY_THROW(a.TopK(5));
+
+    // Long rows are selected in parallel.
+    const int64_t n = 100000;
+    std::vector<int64_t> b_vals(n);
+    for (int64_t i = 0; i < n; ++i) {
+        b_vals[i] = (i * 7919) % n;
+    }
+    core::Tensor b(b_vals, {n}, core::Int64, device);
+    std::tie(values, indices) = b.TopK(5);
+    EXPECT_TRUE(values.AllEqual(core::Tensor::Init<int64_t>(
+            {n - 1, n - 2, n - 3, n - 4, n - 5}, device)));
+    EXPECT_TRUE(b.IndexGet({indices}).AllEqual(values));
+}
+
+TEST(Tensor, Unique) {
+    core::Device device("CPU:0");
+
+    core::Tensor values, inverse_indices, counts;
+    core::Tensor a =
+            core::Tensor::Init<int32_t>({{3, 1, 3}, {1, 7, 3}}, device);
+    std::tie(values, inverse_indices, counts) = a.Unique();
+    EXPECT_TRUE(
+            values.AllEqual(core::Tensor::Init<int32_t>({1, 3, 7}, device)));
+    EXPECT_TRUE(inverse_indices.AllEqual(
+            core::Tensor::Init<int64_t>({1, 0, 1, 0, 2, 1}, device)));
+    EXPECT_TRUE(
+            counts.AllEqual(core::Tensor::Init<int64_t>({2, 3, 1}, device)));
+    EXPECT_TRUE(values.IndexGet({inverse_indices})
+                        .AllEqual(a.Reshape({a.NumElements()})));
+
+    // Unique rows, e.g. voxel keys.
+    core::Tensor keys = core::Tensor::Init<int32_t>(
+            {{1, 2, 0}, {0, 5, 1}, {1, 2, 0}, {0, 5, 0}, {1, 2, 0}}, device);
+    std::tie(values, inverse_indices, counts) = keys.Unique(0);
+    EXPECT_TRUE(values.AllEqual(core::Tensor::Init<int32_t>(
+            {{0, 5, 0}, {0, 5, 1}, {1, 2, 0}}, device)));
+    EXPECT_TRUE(inverse_indices.AllEqual(
+            core::Tensor::Init<int64_t>({2, 1, 2, 0, 2}, device)));
+    EXPECT_TRUE(
+            counts.AllEqual(core::Tensor::Init<int64_t>({1, 1, 3}, device)));
+
+    // Unique columns.
+    std::tie(values, inverse_indices, counts) = keys.T().Unique(1);
+    EXPECT_TRUE(values.AllEqual(core::Tensor::Init<int32_t>(
+                                        {{0, 5, 0}, {0, 5, 1}, {1, 2, 0}},
+                                        device)
+                                        .T()));
+    EXPECT_TRUE(inverse_indices.AllEqual(
+            core::Tensor::Init<int64_t>({2, 1, 2, 0, 2}, device)));
+
+    // Many elements take the parallel path.
+    const int64_t n = 100000;
+    std::vector<int64_t> b_vals(n);
+    for (int64_t i = 0; i < n; ++i) {
+        b_vals[i] = i % 10;
+    }
+    core::Tensor b(b_vals, {n}, core::Int64, device);
+    std::tie(values, inverse_indices, counts) = b.Unique();
+    EXPECT_TRUE(values.AllEqual(
+            core::Tensor::Arange(0, 10, 1, core::Int64, device)));
+    EXPECT_TRUE(inverse_indices.AllEqual(b));
+    EXPECT_TRUE(counts.AllEqual(
+            core::Tensor::Full({10}, n / 10, core::Int64, device)));
+}
+
+TEST(Tensor, SortTopKUniqueNaN) {
+    core::Device device("CPU:0");
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+
+    // NaN is placed after all other values in both orders.
+    core::Tensor a = core::Tensor::Init<float>({2, nan, -1, nan, 3, 0}, device);
+    EXPECT_TRUE(a.ArgSort().AllEqual(
+            core::Tensor::Init<int64_t>({2, 5, 0, 4, 1, 3}, device)));
+    EXPECT_TRUE(a.ArgSort(-1, /*descending=*/true)
+                        .AllEqual(core::Tensor::Init<int64_t>(
+                                {4, 0, 5, 2, 1, 3}, device)));
+    core::Tensor sorted = a.Sort();
+    EXPECT_TRUE(sorted.Slice(0, 0, 4).AllEqual(
+            core::Tensor::Init<float>({-1, 0, 2, 3}, device)));
+    EXPECT_TRUE(sorted.Slice(0, 4, 6).IsNan().All());
+
+    // NaN is never selected before other values.
+    core::Tensor values, indices;
+    std::tie(values, indices) = a.TopK(3);
+    EXPECT_TRUE(indices.AllEqual(
+            core::Tensor::Init<int64_t>({4, 0, 5}, device)));
+    std::tie(values, indices) = a.TopK(5, -1, /*largest=*/false);
+    EXPECT_TRUE(indices.AllEqual(
+            core::Tensor::Init<int64_t>({2, 5, 0, 4, 1}, device)));
+
+    // NaNs are collapsed into one unique value.
+    core::Tensor inverse_indices, counts;
+    std::tie(values, inverse_indices, counts) = a.Unique();
+    EXPECT_EQ(values.GetShape(), core::SizeVector({5}));
+    EXPECT_TRUE(values.Slice(0, 0, 4).AllEqual(
+            core::Tensor::Init<float>({-1, 0, 2, 3}, device)));
+    EXPECT_TRUE(values[4].IsNan().Item<bool>());
+    EXPECT_TRUE(inverse_indices.AllEqual(
+            core::Tensor::Init<int64_t>({2, 4, 0, 4, 3, 1}, device)));
+    EXPECT_TRUE(counts.AllEqual(
+            core::Tensor::Init<int64_t>({1, 1, 1, 1, 2}, device)));
+
+    // Long rows with NaN take the parallel path.
+    const int64_t n = 100000;
+    std::vector<double> b_vals(n);
+    for (int64_t i = 0; i < n; ++i) {
+        b_vals[i] = i % 3 == 0 ? std::numeric_limits<double>::quiet_NaN()
+                               : static_cast<double>((i * 7919) % n);
+    }
+    core::Tensor b(b_vals, {n}, core::Float64, device);
+    const int64_t num_nan = (n + 2) / 3;
+    core::Tensor b_sorted = b.Sort();
+    core::Tensor b_finite = b_sorted.Slice(0, 0, n - num_nan);
+    EXPECT_FALSE(b_finite.IsNan().Any());
+    EXPECT_TRUE(b_sorted.Slice(0, n - num_nan, n).IsNan().All());
+    EXPECT_TRUE(b_finite.Slice(0, 1, n - num_nan)
+                        .Ge(b_finite.Slice(0, 0, n - num_nan - 1))
+                        .All());
+}
+
+// CumSum, CumProd and CumMax are only implemented on CPU.
+TEST(Tensor, CumSum) {
+    core::Device device("CPU:0");
+
+    core::Tensor a = core::Tensor::Init<int32_t>(
+            {{1, 2, 3, 4}, {5, 6, 7, 8}, {9, 10, 11, 12}}, device);
+    EXPECT_TRUE(a.CumSum(0).AllEqual(core::Tensor::Init<int32_t>(
+            {{1, 2, 3, 4}, {6, 8, 10, 12}, {15, 18, 21, 24}}, device)));
+    EXPECT_TRUE(a.CumSum(-1).AllEqual(core::Tensor::Init<int32_t>(
+            {{1, 3, 6, 10}, {5, 11, 18, 26}, {9, 19, 30, 42}}, device)));
+    EXPECT_TRUE(a.T().CumSum(0).AllEqual(a.CumSum(1).T()));
+    EXPECT_ANY_THROW(a.CumSum(2));
+
+    // 0-D and empty.
+    EXPECT_TRUE(core::Tensor::Init<float>(3, device).CumSum(0).AllEqual(
+            core::Tensor::Init<float>(3, device)));
+    EXPECT_EQ(core::Tensor::Empty({0, 3}, core::Float32, device)
+                      .CumSum(0)
+                      .GetShape(),
+              core::SizeVector({0, 3}));
+
+    // Long lines are scanned in parallel.
+    const int64_t n = 200000;
+    core::Tensor ones = core::Tensor::Ones({n}, core::Int64, device);
+    EXPECT_TRUE(ones.CumSum(0).AllEqual(
+            core::Tensor::Arange(1, n + 1, 1, core::Int64, device)));
+    core::Tensor ones_strided =
+            core::Tensor::Ones({2, n}, core::Int64, device).T();
+    EXPECT_TRUE(ones_strided.CumSum(0).AllEqual(
+            core::Tensor::Arange(1, n + 1, 1, core::Int64, device)
+                    .Reshape({n, 1})
+                    .Expand({n, 2})));
+}
+
+TEST(Tensor, CumProd) {
+    core::Device device("CPU:0");
+
+    core::Tensor a =
+            core::Tensor::Init<float>({{1, 2, 3}, {0.5, 2, -1}}, device);
+    EXPECT_TRUE(a.CumProd(0).AllClose(
+            core::Tensor::Init<float>({{1, 2, 3}, {0.5, 4, -3}}, device)));
+    EXPECT_TRUE(a.CumProd(1).AllClose(
+            core::Tensor::Init<float>({{1, 2, 6}, {0.5, 1, -1}}, device)));
+}
+
+TEST(Tensor, CumMax) {
+    core::Device device("CPU:0");
+
+    core::Tensor a = core::Tensor::Init<double>(
+            {{1, -2, 3, 0}, {5, 6, -7, 8}}, device);
+    EXPECT_TRUE(a.CumMax(0).AllClose(core::Tensor::Init<double>(
+            {{1, -2, 3, 0}, {5, 6, 3, 8}}, device)));
+    EXPECT_TRUE(a.CumMax(1).AllClose(core::Tensor::Init<double>(
+            {{1, 1, 3, 3}, {5, 6, 6, 8}}, device)));
+
+    const int64_t n = 200000;
+    core::Tensor b = core::Tensor::Arange(n, 0, -1, core::Float32, device);
+    EXPECT_TRUE(b.CumMax(0).AllClose(
+            core::Tensor::Full({n}, n, core::Float32, device)));
+}
+
+// Float16 and BFloat16 kernels are only implemented on CPU.
+TEST(Tensor, Float16) {
+    core::Device device("CPU:0");
+
+    // Round-to-nearest-even conversion.
+    EXPECT_EQ(core::float16_t(1.0f).bits_, 0x3c00);
+    EXPECT_EQ(core::float16_t(-2.0f).bits_, 0xc000);
+    EXPECT_EQ(core::float16_t(65504.0f).bits_, 0x7bff);
+    EXPECT_EQ(core::float16_t(65520.0f).bits_, 0x7c00);
+    EXPECT_EQ(core::float16_t(1.0f + 1.0f / 2048).bits_, 0x3c00);
+    EXPECT_EQ(core::float16_t(1.0f + 3.0f / 2048).bits_, 0x3c02);
+    EXPECT_EQ(core::float16_t(5.9604645e-8f).bits_, 0x0001);
+    EXPECT_TRUE(std::isnan(static_cast<float>(core::float16_t(NAN))));
+    EXPECT_EQ(static_cast<float>(core::float16_t::FromBits(0x0001)),
+              5.9604645e-8f);
+    EXPECT_EQ(static_cast<float>(core::float16_t::FromBits(0x3555)),
+              0.333251953125f);
+    EXPECT_EQ(core::bfloat16_t(1.0f).bits_, 0x3f80);
+    EXPECT_EQ(core::bfloat16_t(1.0f + 1.0f / 256).bits_, 0x3f80);
+    EXPECT_EQ(core::bfloat16_t(1.0f + 3.0f / 256).bits_, 0x3f82);
+
+    for (const core::Dtype& dtype : {core::Float16, core::BFloat16}) {
+        EXPECT_EQ(dtype.ByteSize(), 2);
+        core::Tensor a = core::Tensor::Init<float>(
+                {{0.5, -1, 2}, {4, 0.25, -8}}, device);
+        core::Tensor a_half = a.To(dtype);
+        EXPECT_EQ(a_half.GetDtype(), dtype);
+        EXPECT_TRUE(a_half.To(core::Float32).AllEqual(a));
+        EXPECT_TRUE(a_half.T().To(core::Float64).AllEqual(
+                a.T().To(core::Float64)));
+        EXPECT_EQ(a_half.ToString(false), a.ToString(false));
+
+        // Element-wise ops compute in float.
+        EXPECT_TRUE((a_half + a_half).To(core::Float32).AllEqual(a * 2));
+        EXPECT_TRUE((a_half * 2).To(core::Float32).AllEqual(a * 2));
+        EXPECT_TRUE((a_half / a_half).To(core::Float32).AllEqual(
+                core::Tensor::Ones({2, 3}, core::Float32, device)));
+        EXPECT_TRUE(a_half.Abs().To(core::Float32).AllEqual(a.Abs()));
+        EXPECT_TRUE(a_half.Neg().To(core::Float32).AllEqual(a.Neg()));
+        EXPECT_TRUE(a_half.Gt(1).AllEqual(a.Gt(1)));
+        EXPECT_TRUE(a_half.Clip(-1, 1).To(core::Float32).AllEqual(
+                a.Clip(-1, 1)));
+        EXPECT_FALSE(a_half.IsNan().Any());
+
+        // Reductions.
+        EXPECT_EQ(a_half.Sum({0, 1}).GetDtype(), dtype);
+        EXPECT_EQ(a_half.Sum({0, 1}).To(core::Float32).Item<float>(),
+                  -2.25f);
+        EXPECT_TRUE(a_half.Max({1}).To(core::Float32).AllEqual(a.Max({1})));
+        EXPECT_TRUE(a_half.Min({0}).To(core::Float32).AllEqual(a.Min({0})));
+        EXPECT_TRUE(a_half.ArgMax({1}).AllEqual(a.ArgMax({1})));
+        EXPECT_TRUE(a_half.ArgMin({0}).AllEqual(a.ArgMin({0})));
+    }
+
+    // Sums are accumulated in float. Accumulating 4096 ones in Float16 would
+    // stall at 2048.
+    const int64_t n = 4096;
+    core::Tensor ones = core::Tensor::Ones({n}, core::Float16, device);
+    EXPECT_EQ(ones.Sum({0}).To(core::Float32).Item<float>(), 4096.0f);
+    core::Tensor ones_2d = core::Tensor::Ones({2, n}, core::Float16, device);
+    EXPECT_TRUE(ones_2d.Sum({1}).To(core::Float32).AllEqual(
+            core::Tensor::Full({2}, n, core::Float32, device)));
+
+    // The mean of values whose sum overflows Float16.
+    core::Tensor large = core::Tensor::Full({8}, 60000, core::Float16, device);
+    EXPECT_EQ(large.Mean({0}).GetDtype(), core::Float16);
+    EXPECT_EQ(large.Mean({0}).To(core::Float32).Item<float>(), 60000.0f);
+}
+
 TEST_P(TensorPermuteDevices, CreationEmpty) {
     core::Device device = GetParam();
 
@@ -3451,5 +3856,22 @@ TEST_P(TensorPermuteDevices, ConstIterator) {
     }
 }
 
+TEST(Tensor, PinMemory) {
+    core::Device device("CPU:0");
+    core::Tensor t = core::Tensor::Init<float>({{0, 1, 2}, {3, 4, 5}}, device);
+    EXPECT_FALSE(t.IsPinned());
+
+    // Non-contiguous tensors are pinned as contiguous tensors.
+    core::Tensor t_pinned = t.T().PinMemory();
+    EXPECT_TRUE(t_pinned.IsPinned());
+    EXPECT_TRUE(t_pinned.IsContiguous());
+    EXPECT_TRUE(t_pinned.AllClose(t.T()));
+
+    // Already pinned tensors and their views are not copied.
+    EXPECT_EQ(t_pinned.PinMemory().GetDataPtr(), t_pinned.GetDataPtr());
+    EXPECT_TRUE(t_pinned[1].IsPinned());
+    EXPECT_FALSE(t_pinned.Clone().IsPinned());
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,162 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/TensorExpr.h"
+
+#include "tests/Tests.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class TensorExprPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(TensorExpr,
+                         TensorExprPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+class TensorExprPermuteDevicePairs : public PermuteDevicePairs {};
+INSTANTIATE_TEST_SUITE_P(
+        TensorExpr,
+        TensorExprPermuteDevicePairs,
+        testing::ValuesIn(TensorExprPermuteDevicePairs::TestCases()));
+
+TEST_P(TensorExprPermuteDevices, BinaryChain) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<float>({{0, 1, 2}, {3, 4, 5}}, device);
+    core::Tensor b = core::Tensor::Init<float>({{1, 1, 1}, {2, 2, 2}}, device);
+    core::Tensor c = core::Tensor::Init<float>({2, 4, 8}, device);
+
+    core::Tensor expected = (a + b) * c - a / c;
+    core::Tensor output =
+            ((core::TensorExpr(a) + b) * c - core::TensorExpr(a) / c).Eval();
+    EXPECT_EQ(output.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_TRUE(output.AllClose(expected));
+
+    // Scalar operands.
+    expected = (a * 2 + 1) / 4 - 0.5;
+    output = ((core::TensorExpr(a) * 2 + 1) / 4 - 0.5).Eval();
+    EXPECT_TRUE(output.AllClose(expected));
+
+    // Mismatched shape and dtype.
+    EXPECT_ANY_THROW(core::TensorExpr(a) +
+                     core::Tensor::Ones({4}, core::Float32, device));
+    EXPECT_ANY_THROW(core::TensorExpr(a) +
+                     core::Tensor::Ones({3}, core::Float64, device));
+}
+
+TEST_P(TensorExprPermuteDevicePairs, MismatchedDevice) {
+    core::Device a_device;
+    core::Device b_device;
+    std::tie(a_device, b_device) = GetParam();
+
+    core::Tensor a = core::Tensor::Ones({2, 3}, core::Float32, a_device);
+    core::Tensor b = core::Tensor::Ones({2, 3}, core::Float32, b_device);
+    if (a_device == b_device) {
+        EXPECT_TRUE((core::TensorExpr(a) + b)
+                            .Eval()
+                            .AllClose(core::Tensor::Full({2, 3}, 2,
+                                                         core::Float32,
+                                                         a_device)));
+    } else {
+        EXPECT_ANY_THROW(core::TensorExpr(a) + b);
+        EXPECT_ANY_THROW(core::TensorExpr(a) + core::TensorExpr(b));
+    }
+}
+
+TEST_P(TensorExprPermuteDevices, UnaryChain) {
+    core::Device device = GetParam();
+
+    core::Tensor a =
+            core::Tensor::Init<double>({-2.5, -1.2, 0, 0.7, 1.5, 3.9}, device);
+    core::Tensor expected = (a.Abs() + 1).Sqrt().Sin().Exp().Clip(1.0, 2.0);
+    core::Tensor output = (core::TensorExpr(a).Abs() + 1)
+                                  .Sqrt()
+                                  .Sin()
+                                  .Exp()
+                                  .Clip(1.0, 2.0)
+                                  .Eval();
+    EXPECT_TRUE(output.AllClose(expected));
+
+    expected = a.Floor() + a.Ceil() + a.Round() + a.Trunc() - a.Cos().Neg();
+    core::TensorExpr e(a);
+    output = (e.Floor() + e.Ceil() + e.Round() + e.Trunc() - (-e.Cos())).Eval();
+    EXPECT_TRUE(output.AllClose(expected));
+
+    // Sqrt, Sin, Cos and Exp only support floating point dtypes.
+    core::Tensor i = core::Tensor::Init<int32_t>({-3, 4}, device);
+    EXPECT_ANY_THROW(core::TensorExpr(i).Sqrt());
+    output = (core::TensorExpr(i).Abs() * 3 - 1).Eval();
+    EXPECT_TRUE(output.AllEqual(core::Tensor::Init<int32_t>({8, 11}, device)));
+}
+
+TEST_P(TensorExprPermuteDevices, NonContiguous) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Arange(0, 2000, 1, core::Float32, device)
+                             .Reshape({40, 50});
+    core::Tensor a_t = a.T();
+    core::Tensor b = core::Tensor::Arange(0, 40, 1, core::Float32, device);
+    core::Tensor expected = (a_t * b + 1).Sqrt();
+    core::Tensor output = ((core::TensorExpr(a_t) * b + 1).Sqrt()).Eval();
+    EXPECT_TRUE(output.IsContiguous());
+    EXPECT_TRUE(output.AllClose(expected));
+
+    // Evaluate into a strided destination.
+    core::Tensor dst = core::Tensor::Zeros({40, 50}, core::Float32, device).T();
+    (core::TensorExpr(a_t) * b + 1).Sqrt().EvalInto(dst);
+    EXPECT_TRUE(dst.AllClose(expected));
+    EXPECT_ANY_THROW(
+            core::TensorExpr(a).Sqrt().EvalInto(dst));  // Shape mismatch.
+}
+
+TEST_P(TensorExprPermuteDevices, EvalIntoInPlace) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Arange(0, 1000, 1, core::Int64, device);
+    core::Tensor expected = a * a + a - 3;
+    core::TensorExpr e(a);
+    (e * e + e - 3).EvalInto(a);
+    EXPECT_TRUE(a.AllEqual(expected));
+}
+
+TEST_P(TensorExprPermuteDevices, ManyInputs) {
+    core::Device device = GetParam();
+
+    // More distinct tensors than the Indexer supports falls back to eager
+    // evaluation.
+    core::Tensor expected = core::Tensor::Zeros({5}, core::Float32, device);
+    core::TensorExpr e(expected);
+    for (int i = 0; i < 12; ++i) {
+        core::Tensor t = core::Tensor::Full({5}, i, core::Float32, device);
+        expected = expected + t;
+        e = e + t;
+    }
+    EXPECT_TRUE(e.Eval().AllClose(expected));
+}
+
+}  // namespace tests
+}  // namespace open3d
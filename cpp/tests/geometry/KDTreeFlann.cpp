@@ -144,5 +144,111 @@ TEST(KDTreeFlann, SearchHybrid) {
     ExpectEQ(ref_distance2, distance2);
 }
 
+TEST(KDTreeFlann, SearchKNNFloat32) {
+    std::vector<int> ref_indices = {27, 48, 4,  77, 90, 7,  54, 17, 76, 38,
+                                    39, 60, 15, 84, 11, 57, 3,  32, 99, 36,
+                                    52, 40, 26, 59, 22, 97, 20, 42, 73, 24};
+
+    std::vector<double> ref_distance2 = {
+            0.000000,  4.684353,  4.996539,  9.191849,  10.034604, 10.466745,
+            10.649751, 11.434066, 12.089195, 13.345638, 13.696270, 14.016148,
+            16.851978, 17.073435, 18.254518, 20.019994, 21.496347, 23.077277,
+            23.692427, 23.809303, 24.104578, 25.005770, 26.952710, 27.487888,
+            27.998463, 28.262975, 28.581313, 28.816608, 31.603230, 31.610916};
+
+    int size = 100;
+
+    geometry::PointCloud pc;
+
+    Eigen::Vector3d vmin(0.0, 0.0, 0.0);
+    Eigen::Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+
+    geometry::KDTreeFlann kdtree(pc, geometry::KDTreeFlann::Precision::Float32);
+    EXPECT_EQ(kdtree.GetPrecision(),
+              geometry::KDTreeFlann::Precision::Float32);
+
+    Eigen::Vector3d query = {1.647059, 4.392157, 8.784314};
+    int knn = 30;
+    std::vector<int> indices;
+    std::vector<double> distance2;
+
+    int result = kdtree.SearchKNN(query, knn, indices, distance2);
+
+    EXPECT_EQ(result, 30);
+
+    ExpectEQ(ref_indices, indices);
+    for (int i = 0; i < result; i++) {
+        EXPECT_NEAR(ref_distance2[i], distance2[i], 1e-4);
+    }
+}
+
+TEST(KDTreeFlann, SearchBatch) {
+    int size = 100;
+
+    geometry::PointCloud pc;
+
+    Eigen::Vector3d vmin(0.0, 0.0, 0.0);
+    Eigen::Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+
+    geometry::KDTreeFlann kdtree(pc);
+
+    // Query every 3rd point of the cloud, one query per column.
+    std::vector<Eigen::Vector3d> query_points;
+    for (int i = 0; i < size; i += 3) {
+        query_points.push_back(pc.points_[i]);
+    }
+    int num_queries = int(query_points.size());
+    Eigen::Map<const Eigen::MatrixXd> queries(
+            (const double *)query_points.data(), 3, num_queries);
+
+    std::vector<geometry::KDTreeSearchParam *> params;
+    geometry::KDTreeSearchParamKNN param_knn(7);
+    geometry::KDTreeSearchParamRadius param_radius(2.0);
+    geometry::KDTreeSearchParamHybrid param_hybrid(2.0, 5);
+    params.push_back(&param_knn);
+    params.push_back(&param_radius);
+    params.push_back(&param_hybrid);
+
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    std::vector<int64_t> row_splits;
+    for (const geometry::KDTreeSearchParam *param : params) {
+        int64_t result = kdtree.Search(queries, *param, indices, distance2,
+                                       row_splits);
+
+        EXPECT_EQ(int(row_splits.size()), num_queries + 1);
+        EXPECT_EQ(row_splits[0], 0);
+        EXPECT_EQ(row_splits[num_queries], result);
+        EXPECT_EQ(int64_t(indices.size()), result);
+        EXPECT_EQ(int64_t(distance2.size()), result);
+
+        std::vector<int> ref_indices;
+        std::vector<double> ref_distance2;
+        for (int i = 0; i < num_queries; i++) {
+            int k = kdtree.Search(query_points[i], *param, ref_indices,
+                                  ref_distance2);
+            EXPECT_EQ(row_splits[i + 1] - row_splits[i], k);
+            ExpectEQ(ref_indices,
+                     std::vector<int>(indices.begin() + row_splits[i],
+                                      indices.begin() + row_splits[i + 1]));
+            ExpectEQ(ref_distance2,
+                     std::vector<double>(
+                             distance2.begin() + row_splits[i],
+                             distance2.begin() + row_splits[i + 1]));
+        }
+    }
+
+    // Query dimension does not match the KDTree.
+    EXPECT_EQ(kdtree.SearchKNN(Eigen::MatrixXd::Zero(2, 4), 1, indices,
+                               distance2, row_splits),
+              -1);
+}
+
 }  // namespace tests
 }  // namespace open3d
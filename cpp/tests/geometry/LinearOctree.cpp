@@ -0,0 +1,181 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/LinearOctree.h"
+
+#include <memory>
+
+#include "open3d/data/Dataset.h"
+#include "open3d/geometry/Octree.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/VoxelGrid.h"
+#include "open3d/io/PointCloudIO.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(LinearOctree, EightCubes) {
+    std::vector<Eigen::Vector3d> points{
+            Eigen::Vector3d(0.5, 0.5, 0.5), Eigen::Vector3d(1.5, 0.5, 0.5),
+            Eigen::Vector3d(0.5, 1.5, 0.5), Eigen::Vector3d(1.5, 1.5, 0.5),
+            Eigen::Vector3d(0.5, 0.5, 1.5), Eigen::Vector3d(1.5, 0.5, 1.5),
+            Eigen::Vector3d(0.5, 1.5, 1.5), Eigen::Vector3d(1.5, 1.5, 1.5),
+    };
+    std::vector<Eigen::Vector3d> colors{
+            Eigen::Vector3d(0.0, 0.0, 0.0), Eigen::Vector3d(0.1, 0.0, 0.0),
+            Eigen::Vector3d(0.0, 0.1, 0.0), Eigen::Vector3d(0.1, 0.1, 0.0),
+            Eigen::Vector3d(0.0, 0.0, 0.1), Eigen::Vector3d(0.1, 0.0, 0.1),
+            Eigen::Vector3d(0.0, 0.1, 0.1), Eigen::Vector3d(0.1, 0.1, 0.1),
+    };
+    geometry::Octree octree(1, Eigen::Vector3d(0, 0, 0), 2);
+    for (size_t i = 0; i < points.size(); ++i) {
+        octree.InsertPoint(
+                points[i], geometry::OctreeColorLeafNode::GetInitFunction(),
+                geometry::OctreeColorLeafNode::GetUpdateFunction(colors[i]));
+    }
+
+    geometry::LinearOctree linear_octree;
+    linear_octree.CreateFromOctree(octree);
+    EXPECT_EQ(linear_octree.max_depth_, 1u);
+    EXPECT_FALSE(linear_octree.HasPointIndices());
+    EXPECT_EQ(linear_octree.leaf_codes_,
+              std::vector<uint64_t>({0, 1, 2, 3, 4, 5, 6, 7}));
+    ExpectEQ(linear_octree.leaf_colors_, colors);
+    for (size_t i = 0; i < points.size(); ++i) {
+        int64_t leaf_index;
+        geometry::OctreeNodeInfo node_info;
+        std::tie(leaf_index, node_info) =
+                linear_octree.LocateLeafNode(points[i]);
+        EXPECT_EQ(leaf_index, int64_t(i));
+        EXPECT_EQ(node_info.child_index_, i);
+        ExpectEQ(node_info.origin_,
+                 Eigen::Vector3d(points[i].array() - 0.5));
+    }
+    EXPECT_EQ(linear_octree.LocateLeafNode(Eigen::Vector3d(2.5, 0.5, 0.5))
+                      .first,
+              -1);
+
+    EXPECT_TRUE(*linear_octree.ToOctree() == octree);
+}
+
+TEST(LinearOctree, FragmentPLYConvertFromPointCloud) {
+    geometry::PointCloud pcd;
+    data::PLYPointCloud pointcloud_ply;
+    io::ReadPointCloud(pointcloud_ply.GetPath(), pcd);
+    size_t max_depth = 6;
+    geometry::Octree octree(max_depth);
+    octree.ConvertFromPointCloud(pcd, 0.01);
+    geometry::LinearOctree linear_octree(max_depth);
+    linear_octree.ConvertFromPointCloud(pcd, 0.01);
+
+    ExpectEQ(linear_octree.origin_, octree.origin_);
+    EXPECT_EQ(linear_octree.size_, octree.size_);
+    EXPECT_TRUE(linear_octree.HasPointIndices());
+    EXPECT_EQ(linear_octree.point_indices_.size(), pcd.points_.size());
+    EXPECT_TRUE(std::is_sorted(linear_octree.leaf_codes_.begin(),
+                               linear_octree.leaf_codes_.end()));
+    EXPECT_TRUE(*linear_octree.ToOctree() == octree);
+
+    geometry::LinearOctree converted;
+    converted.CreateFromOctree(octree);
+    EXPECT_EQ(converted.leaf_codes_, linear_octree.leaf_codes_);
+    EXPECT_EQ(converted.leaf_point_splits_, linear_octree.leaf_point_splits_);
+    EXPECT_EQ(converted.point_indices_, linear_octree.point_indices_);
+
+    // Both trees are traversed in the same order.
+    std::vector<std::shared_ptr<geometry::OctreeNodeInfo>> node_infos;
+    octree.Traverse(
+            [&node_infos](const std::shared_ptr<geometry::OctreeNode>&,
+                          const std::shared_ptr<geometry::OctreeNodeInfo>&
+                                  node_info) -> bool {
+                node_infos.push_back(node_info);
+                return false;
+            });
+    size_t num_nodes = 0;
+    linear_octree.Traverse([&](const geometry::OctreeNodeInfo& node_info,
+                               size_t begin, size_t end) -> bool {
+        EXPECT_LT(begin, end);
+        if (num_nodes < node_infos.size()) {
+            ExpectEQ(node_info.origin_, node_infos[num_nodes]->origin_);
+            EXPECT_EQ(node_info.size_, node_infos[num_nodes]->size_);
+            EXPECT_EQ(node_info.depth_, node_infos[num_nodes]->depth_);
+            EXPECT_EQ(node_info.child_index_,
+                      node_infos[num_nodes]->child_index_);
+        }
+        ++num_nodes;
+        return false;
+    });
+    EXPECT_EQ(num_nodes, node_infos.size());
+
+    for (size_t idx = 0; idx < pcd.points_.size(); idx += 200) {
+        const Eigen::Vector3d& point = pcd.points_[idx];
+        int64_t leaf_index;
+        geometry::OctreeNodeInfo node_info;
+        std::tie(leaf_index, node_info) = linear_octree.LocateLeafNode(point);
+        ASSERT_GE(leaf_index, 0);
+        EXPECT_TRUE(geometry::Octree::IsPointInBound(point, node_info.origin_,
+                                                     node_info.size_));
+        EXPECT_EQ(node_info.depth_, max_depth);
+        auto begin = linear_octree.point_indices_.begin() +
+                     linear_octree.leaf_point_splits_[leaf_index];
+        auto end = linear_octree.point_indices_.begin() +
+                   linear_octree.leaf_point_splits_[leaf_index + 1];
+        EXPECT_NE(std::find(begin, end, idx), end);
+    }
+}
+
+TEST(LinearOctree, VoxelGrid) {
+    geometry::VoxelGrid voxel_grid;
+    voxel_grid.voxel_size_ = 0.5;
+    voxel_grid.origin_ = Eigen::Vector3d(-1, 0, 1);
+    voxel_grid.AddVoxel(geometry::Voxel(Eigen::Vector3i(0, 0, 0),
+                                        Eigen::Vector3d(0.1, 0.2, 0.3)));
+    voxel_grid.AddVoxel(geometry::Voxel(Eigen::Vector3i(3, 1, 2),
+                                        Eigen::Vector3d(0.4, 0.5, 0.6)));
+    voxel_grid.AddVoxel(geometry::Voxel(Eigen::Vector3i(1, 3, 3),
+                                        Eigen::Vector3d(0.7, 0.8, 0.9)));
+
+    geometry::Octree octree(2);
+    octree.CreateFromVoxelGrid(voxel_grid);
+    geometry::LinearOctree linear_octree(2);
+    linear_octree.CreateFromVoxelGrid(voxel_grid);
+    EXPECT_EQ(linear_octree.NumLeaves(), 3u);
+    EXPECT_TRUE(*linear_octree.ToOctree() == octree);
+
+    auto dst_voxel_grid = linear_octree.ToVoxelGrid();
+    ExpectEQ(dst_voxel_grid->origin_, voxel_grid.origin_);
+    EXPECT_EQ(dst_voxel_grid->voxel_size_, voxel_grid.voxel_size_);
+    EXPECT_EQ(dst_voxel_grid->voxels_.size(), voxel_grid.voxels_.size());
+    for (const auto& it : voxel_grid.voxels_) {
+        ASSERT_EQ(dst_voxel_grid->voxels_.count(it.first), 1u);
+        ExpectEQ(dst_voxel_grid->voxels_.at(it.first).color_,
+                 it.second.color_);
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -27,6 +27,7 @@
 #include "open3d/geometry/PointCloud.h"
 
 #include <algorithm>
+#include <random>
 
 #include "open3d/camera/PinholeCameraIntrinsic.h"
 #include "open3d/data/Dataset.h"
@@ -1254,6 +1255,72 @@ TEST(PointCloud, SegmentPlaneKnownPlane) {
     ExpectEQ(pcd.SelectByIndex(inliers)->points_, ref);
 }
 
+// Half of the points lie close to the plane z = 0, the rest is uniform
+// clutter in the unit cube.
+static geometry::PointCloud CreateNoisyPlaneCloud() {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::uniform_real_distribution<double> noise(-0.003, 0.003);
+    geometry::PointCloud pcd;
+    for (int i = 0; i < 2000; ++i) {
+        pcd.points_.emplace_back(uniform(rng), uniform(rng), noise(rng));
+    }
+    for (int i = 0; i < 2000; ++i) {
+        pcd.points_.emplace_back(uniform(rng), uniform(rng), uniform(rng));
+    }
+    return pcd;
+}
+
+TEST(PointCloud, SegmentPlaneSeeded) {
+    const geometry::PointCloud pcd = CreateNoisyPlaneCloud();
+
+    // A fixed seed gives the same plane with and without early termination.
+    for (double probability : {0.99, 1.0}) {
+        Eigen::Vector4d plane_model0, plane_model1;
+        std::vector<size_t> inliers0, inliers1;
+        std::tie(plane_model0, inliers0) =
+                pcd.SegmentPlane(0.01, 3, 1000, 42, probability);
+        std::tie(plane_model1, inliers1) =
+                pcd.SegmentPlane(0.01, 3, 1000, 42, probability);
+        ExpectEQ(plane_model0, plane_model1);
+        EXPECT_EQ(inliers0, inliers1);
+        EXPECT_NEAR(std::abs(plane_model0(2)), 1.0, 1e-3);
+        EXPECT_GE(inliers0.size(), 1900u);
+    }
+}
+
+TEST(PointCloud, SegmentPlaneEarlyTermination) {
+    const geometry::PointCloud pcd = CreateNoisyPlaneCloud();
+
+    // With 50% inliers, 99% confidence takes about 70 iterations. The seeded
+    // run stops at the end of a block of iterations and returns the best plane
+    // of the iterations before it, i.e. the plane that the same number of
+    // iterations without early termination finds.
+    Eigen::Vector4d plane_model;
+    std::vector<size_t> inliers;
+    std::tie(plane_model, inliers) = pcd.SegmentPlane(0.01, 3, 100000, 7, 0.99);
+    bool found = false;
+    for (int num_iterations = 32; num_iterations <= 320 && !found;
+         num_iterations += 32) {
+        Eigen::Vector4d plane_model_all;
+        std::vector<size_t> inliers_all;
+        std::tie(plane_model_all, inliers_all) =
+                pcd.SegmentPlane(0.01, 3, num_iterations, 7, 1.0);
+        found = plane_model_all == plane_model && inliers_all == inliers;
+    }
+    EXPECT_TRUE(found);
+
+    // Running all iterations cannot find a worse plane.
+    Eigen::Vector4d plane_model_all;
+    std::vector<size_t> inliers_all;
+    std::tie(plane_model_all, inliers_all) =
+            pcd.SegmentPlane(0.01, 3, 1000, 7, 1.0);
+    EXPECT_GE(inliers_all.size(), inliers.size());
+
+    EXPECT_ANY_THROW(pcd.SegmentPlane(0.01, 3, 100, 7, 0.0));
+    EXPECT_ANY_THROW(pcd.SegmentPlane(0.01, 3, 100, 7, 1.5));
+}
+
 TEST(PointCloud, CreateFromDepthImage) {
     data::SampleRedwoodRGBDImages redwood_data;
     const std::string trajectory_path = redwood_data.GetTrajectoryLogPath();
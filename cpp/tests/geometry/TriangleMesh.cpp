@@ -781,6 +781,33 @@ TEST(TriangleMesh, FilterSharpen) {
     ExpectEQ(mesh->vertices_, ref2);
 }
 
+TEST(TriangleMesh, SimplifyQuadricDecimationParallel) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 40);
+    sphere->ComputeTriangleNormals();
+    sphere->vertex_colors_.assign(sphere->vertices_.size(),
+                                  Eigen::Vector3d(0.2, 0.4, 0.6));
+    int target = int(sphere->triangles_.size() / 4);
+
+    auto mesh = sphere->SimplifyQuadricDecimationParallel(target);
+    EXPECT_LE(int(mesh->triangles_.size()), target);
+    EXPECT_GT(int(mesh->triangles_.size()), target / 2);
+    EXPECT_EQ(mesh->vertex_colors_.size(), mesh->vertices_.size());
+    EXPECT_TRUE(mesh->HasTriangleNormals());
+    for (const auto &triangle : mesh->triangles_) {
+        EXPECT_NE(triangle(0), triangle(1));
+        EXPECT_NE(triangle(1), triangle(2));
+        EXPECT_NE(triangle(2), triangle(0));
+    }
+    for (size_t i = 0; i < mesh->vertices_.size(); ++i) {
+        EXPECT_NEAR(mesh->vertices_[i].norm(), 1.0, 0.05);
+        ExpectEQ(mesh->vertex_colors_[i], Eigen::Vector3d(0.2, 0.4, 0.6));
+    }
+
+    // No edge of a sphere is free, so a zero error bound keeps the mesh.
+    mesh = sphere->SimplifyQuadricDecimationParallel(target, 0.0);
+    EXPECT_EQ(mesh->triangles_.size(), sphere->triangles_.size());
+}
+
 TEST(TriangleMesh, FilterSmoothSimple) {
     auto mesh = std::make_shared<geometry::TriangleMesh>();
     mesh->vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {-1, 0, 0}, {0, -1, 0}};
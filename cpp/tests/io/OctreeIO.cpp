@@ -31,6 +31,7 @@
 #include <cstdio>
 
 #include "open3d/data/Dataset.h"
+#include "open3d/geometry/LinearOctree.h"
 #include "open3d/geometry/Octree.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/io/PointCloudIO.h"
@@ -41,9 +42,11 @@ namespace open3d {
 namespace tests {
 
 void WriteReadAndAssertEqual(const geometry::Octree& src_octree,
-                             bool delete_temp = true) {
+                             bool delete_temp = true,
+                             const std::string& extension = "json") {
     // Write to file
-    std::string file_name = utility::GetDataPathCommon("temp_octree.json");
+    std::string file_name =
+            utility::GetDataPathCommon("temp_octree." + extension);
     EXPECT_TRUE(io::WriteOctree(file_name, src_octree));
 
     // Read from file
@@ -107,5 +110,72 @@ TEST(OctreeIO, JsonFileIOSevenCubes) {
     WriteReadAndAssertEqual(octree);
 }
 
+TEST(OctreeIO, BinFileIO) {
+    geometry::Octree empty_octree(10);
+    WriteReadAndAssertEqual(empty_octree, true, "bin");
+
+    geometry::Octree zero_depth_octree(0, Eigen::Vector3d(-1, -1, -1), 2);
+    zero_depth_octree.InsertPoint(
+            Eigen::Vector3d(0, 0, 0),
+            geometry::OctreeColorLeafNode::GetInitFunction(),
+            geometry::OctreeColorLeafNode::GetUpdateFunction(
+                    Eigen::Vector3d(0, 0.1, 0.2)));
+    WriteReadAndAssertEqual(zero_depth_octree, true, "bin");
+
+    geometry::PointCloud pcd;
+    data::PLYPointCloud pointcloud_ply;
+    io::ReadPointCloud(pointcloud_ply.GetPath(), pcd);
+    geometry::Octree octree(6);
+    octree.ConvertFromPointCloud(pcd, 0.01);
+    WriteReadAndAssertEqual(octree, true, "bin");
+}
+
+TEST(OctreeIO, BinFileIOLinearOctree) {
+    geometry::PointCloud pcd;
+    data::PLYPointCloud pointcloud_ply;
+    io::ReadPointCloud(pointcloud_ply.GetPath(), pcd);
+    geometry::LinearOctree src_octree(6);
+    src_octree.ConvertFromPointCloud(pcd, 0.01);
+
+    std::string file_name = utility::GetDataPathCommon("temp_octree.bin");
+    EXPECT_TRUE(io::WriteLinearOctreeToBIN(file_name, src_octree));
+    geometry::LinearOctree dst_octree;
+    EXPECT_TRUE(io::ReadLinearOctreeFromBIN(file_name, dst_octree));
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+
+    ExpectEQ(dst_octree.origin_, src_octree.origin_);
+    EXPECT_EQ(dst_octree.size_, src_octree.size_);
+    EXPECT_EQ(dst_octree.max_depth_, src_octree.max_depth_);
+    EXPECT_EQ(dst_octree.leaf_codes_, src_octree.leaf_codes_);
+    ExpectEQ(dst_octree.leaf_colors_, src_octree.leaf_colors_);
+    EXPECT_EQ(dst_octree.leaf_point_splits_, src_octree.leaf_point_splits_);
+    EXPECT_EQ(dst_octree.point_indices_, src_octree.point_indices_);
+}
+
+TEST(OctreeIO, BinFileIOInvalid) {
+    geometry::PointCloud pcd(
+            {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {1, 1, 1}});
+    geometry::LinearOctree src_octree(3);
+    src_octree.ConvertFromPointCloud(pcd, 0.01);
+    std::string file_name = utility::GetDataPathCommon("temp_octree.bin");
+    EXPECT_TRUE(io::WriteLinearOctreeToBIN(file_name, src_octree));
+
+    // Overwrite the number of leaves, which follows the magic, version,
+    // bounds, max_depth and flags, with a count larger than the file.
+    FILE* file = fopen(file_name.c_str(), "r+b");
+    ASSERT_NE(file, nullptr);
+    const uint64_t num_leaves = uint64_t(1) << 60;
+    EXPECT_EQ(fseek(file, 48, SEEK_SET), 0);
+    EXPECT_EQ(fwrite(&num_leaves, sizeof(uint64_t), 1, file), 1u);
+    fclose(file);
+    geometry::LinearOctree dst_octree;
+    EXPECT_FALSE(io::ReadLinearOctreeFromBIN(file_name, dst_octree));
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+
+    // Octrees deeper than a linear octree supports are not written.
+    geometry::Octree deep_octree(geometry::LinearOctree::kMaxDepth + 1);
+    EXPECT_FALSE(io::WriteOctree(file_name, deep_octree));
+}
+
 }  // namespace tests
 }  // namespace open3d
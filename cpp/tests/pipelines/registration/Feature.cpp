@@ -24,6 +24,12 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/Feature.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -39,5 +45,47 @@ TEST(Feature, DISABLED_ComputeFPFHFeature) { NotImplemented(); }
 
 TEST(Feature, DISABLED_KDTreeSearchParamKNN) { NotImplemented(); }
 
+TEST(Feature, CorrespondencesFromFeatures) {
+    // Target features are shuffled and slightly perturbed source features.
+    const int num_points = 500;
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<double> dist(0.0, 100.0);
+    pipelines::registration::Feature source, target;
+    source.Resize(33, num_points);
+    for (int i = 0; i < num_points; ++i) {
+        for (int k = 0; k < 33; ++k) {
+            source.data_(k, i) = dist(gen);
+        }
+    }
+    std::vector<int> permutation(num_points);
+    std::iota(permutation.begin(), permutation.end(), 0);
+    std::shuffle(permutation.begin(), permutation.end(), gen);
+    target.Resize(33, num_points);
+    for (int i = 0; i < num_points; ++i) {
+        target.data_.col(permutation[i]) =
+                source.data_.col(i).array() + 0.01;
+    }
+
+    for (int ef_search : {0, 64}) {
+        for (bool mutual_filter : {false, true}) {
+            pipelines::registration::CorrespondenceSet corres =
+                    pipelines::registration::CorrespondencesFromFeatures(
+                            source, target, mutual_filter, ef_search);
+            EXPECT_GE(corres.size(), size_t(0.95 * num_points));
+            int num_correct = 0;
+            for (const Eigen::Vector2i &c : corres) {
+                num_correct += permutation[c(0)] == c(1);
+            }
+            EXPECT_GE(num_correct, 0.95 * num_points);
+        }
+    }
+
+    pipelines::registration::Feature other;
+    other.Resize(3, num_points);
+    EXPECT_THROW(pipelines::registration::CorrespondencesFromFeatures(source,
+                                                                      other),
+                 std::runtime_error);
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -28,7 +28,11 @@
 
 #include <gmock/gmock.h>
 
+#include <deque>
+#include <random>
+
 #include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/data/Dataset.h"
 #include "open3d/geometry/PointCloud.h"
@@ -695,5 +699,98 @@ TEST_P(PointCloudPermuteDevices, VoxelDownSample) {
             core::Tensor::Init<float>({{0, 0, 0}}, device)));
 }
 
+/// Brute-force copy of the breadth-first DBSCAN that ClusterDBSCAN used to
+/// run. Clusters are grown from the lowest unvisited core point and border
+/// points join the first cluster that reaches them.
+static std::vector<int> ClusterDBSCANReference(
+        const std::vector<Eigen::Vector3d> &points,
+        double eps,
+        size_t min_points) {
+    const int num_points = int(points.size());
+    std::vector<std::vector<int>> nbs(num_points);
+    for (int i = 0; i < num_points; ++i) {
+        for (int j = 0; j < num_points; ++j) {
+            if ((points[i] - points[j]).squaredNorm() < eps * eps) {
+                nbs[i].push_back(j);
+            }
+        }
+    }
+
+    // -2 is unvisited, -1 is noise.
+    std::vector<int> labels(num_points, -2);
+    int cluster_label = 0;
+    for (int idx = 0; idx < num_points; ++idx) {
+        if (labels[idx] != -2) {
+            continue;
+        }
+        if (nbs[idx].size() < min_points) {
+            labels[idx] = -1;
+            continue;
+        }
+        std::deque<int> queue(nbs[idx].begin(), nbs[idx].end());
+        labels[idx] = cluster_label;
+        while (!queue.empty()) {
+            const int nb = queue.front();
+            queue.pop_front();
+            if (labels[nb] == -1) {
+                labels[nb] = cluster_label;
+            }
+            if (labels[nb] != -2) {
+                continue;
+            }
+            labels[nb] = cluster_label;
+            if (nbs[nb].size() >= min_points) {
+                queue.insert(queue.end(), nbs[nb].begin(), nbs[nb].end());
+            }
+        }
+        ++cluster_label;
+    }
+    return labels;
+}
+
+TEST_P(PointCloudPermuteDevices, ClusterDBSCAN) {
+    core::Device device = GetParam();
+
+    // Two clusters and one noise point. Clusters are numbered in the order
+    // of their first point.
+    t::geometry::PointCloud pcd(core::Tensor::Init<float>({{5.0, 5.0, 5.0},
+                                                           {0.0, 0.0, 0.0},
+                                                           {5.1, 5.0, 5.0},
+                                                           {10.0, 10.0, 10.0},
+                                                           {0.1, 0.0, 0.0},
+                                                           {5.2, 5.0, 5.0},
+                                                           {0.2, 0.0, 0.0}},
+                                                          device));
+    core::Tensor labels = pcd.ClusterDBSCAN(0.15, 2);
+    EXPECT_EQ(labels.GetDevice(), device);
+    EXPECT_TRUE(labels.AllEqual(
+            core::Tensor::Init<int>({0, 1, 0, -1, 1, 0, 1}, device)));
+
+    // Random clouds with a mix of core, border and noise points give the same
+    // labels as the breadth-first search.
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    for (size_t min_points : {2, 4, 8}) {
+        std::vector<Eigen::Vector3d> points(1000);
+        for (Eigen::Vector3d &p : points) {
+            p = Eigen::Vector3d(dist(gen), dist(gen), dist(gen));
+        }
+        std::vector<int> labels_ref =
+                ClusterDBSCANReference(points, 0.08, min_points);
+
+        std::vector<int> labels_legacy =
+                geometry::PointCloud(points).ClusterDBSCAN(0.08, min_points);
+        EXPECT_EQ(labels_legacy, labels_ref);
+
+        t::geometry::PointCloud pcd_random(
+                core::eigen_converter::EigenVector3dVectorToTensor(
+                        points, core::Float64, device));
+        EXPECT_TRUE(pcd_random.ClusterDBSCAN(0.08, min_points)
+                            .AllEqual(core::Tensor(
+                                    labels_ref, {int64_t(labels_ref.size())},
+                                    core::Int32, device)));
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
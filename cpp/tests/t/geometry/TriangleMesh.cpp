@@ -407,6 +407,44 @@ TEST_P(TriangleMeshPermuteDevices, FromLegacy) {
                                           .Reshape({-1, 3, 2})));
 }
 
+TEST_P(TriangleMeshPermuteDevices, SimplifyQuadricDecimation) {
+    core::Device device = GetParam();
+    auto legacy_sphere = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    legacy_sphere->ComputeTriangleNormals();
+    legacy_sphere->vertex_colors_.assign(legacy_sphere->vertices_.size(),
+                                         Eigen::Vector3d(0.2, 0.4, 0.6));
+    t::geometry::TriangleMesh sphere = t::geometry::TriangleMesh::FromLegacy(
+            *legacy_sphere, core::Float32, core::Int32, device);
+    int64_t num_triangles = sphere.GetTriangleIndices().GetLength();
+    sphere.SetTriangleAttr(
+            "labels", core::Tensor::Ones({num_triangles}, core::Int64, device));
+
+    t::geometry::TriangleMesh mesh =
+            sphere.SimplifyQuadricDecimation(num_triangles / 4);
+    int64_t num_vertices = mesh.GetVertexPositions().GetLength();
+    num_triangles = mesh.GetTriangleIndices().GetLength();
+    EXPECT_LE(num_triangles, sphere.GetTriangleIndices().GetLength() / 4);
+    EXPECT_GT(num_triangles, 0);
+    EXPECT_EQ(mesh.GetDevice(), device);
+    EXPECT_EQ(mesh.GetVertexPositions().GetDtype(), core::Float32);
+    EXPECT_EQ(mesh.GetTriangleIndices().GetDtype(), core::Int32);
+
+    core::Tensor norms = mesh.GetVertexPositions()
+                                 .Mul(mesh.GetVertexPositions())
+                                 .Sum({1})
+                                 .Sqrt();
+    EXPECT_TRUE(norms.AllClose(
+            core::Tensor::Ones({num_vertices}, core::Float32, device), 0,
+            0.05));
+    EXPECT_TRUE(mesh.GetVertexColors().AllClose(
+            core::Tensor::Init<float>({0.2, 0.4, 0.6}, device)
+                    .Reshape({1, 3})
+                    .Expand({num_vertices, 3})));
+    EXPECT_TRUE(mesh.GetTriangleAttr("labels").AllEqual(
+            core::Tensor::Ones({num_triangles}, core::Int64, device)));
+    EXPECT_EQ(mesh.GetTriangleNormals().GetLength(), num_triangles);
+}
+
 TEST_P(TriangleMeshPermuteDevices, ToLegacy) {
     using ::testing::ElementsAreArray;
     using ::testing::FloatEq;
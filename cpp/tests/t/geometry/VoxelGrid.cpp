@@ -0,0 +1,316 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/VoxelGrid.h"
+
+#include "core/CoreTest.h"
+#include "open3d/camera/PinholeCameraParameters.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/geometry/Image.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/VoxelGrid.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+class VoxelGridPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(VoxelGrid,
+                         VoxelGridPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+// Returns true if both voxel grids have the same voxels.
+static bool SameVoxels(const t::geometry::VoxelGrid &a,
+                       const t::geometry::VoxelGrid &b) {
+    return a.GetNumVoxels() == b.GetNumVoxels() && a.Difference(b).IsEmpty();
+}
+
+// A 10x10x10 block of voxels in front of a 20x20 pinhole camera at the
+// origin looking along +z.
+static geometry::VoxelGrid CreateLegacyBlock() {
+    geometry::VoxelGrid voxel_grid;
+    voxel_grid.voxel_size_ = 0.1;
+    voxel_grid.origin_ = Eigen::Vector3d(-0.5, -0.5, 1.0);
+    for (int x = 0; x < 10; ++x) {
+        for (int y = 0; y < 10; ++y) {
+            for (int z = 0; z < 10; ++z) {
+                voxel_grid.AddVoxel(geometry::Voxel(
+                        Eigen::Vector3i(x, y, z),
+                        Eigen::Vector3d(x, y, z) / 10.0));
+            }
+        }
+    }
+    return voxel_grid;
+}
+
+static camera::PinholeCameraParameters CreateCamera() {
+    camera::PinholeCameraParameters camera;
+    camera.intrinsic_.SetIntrinsics(20, 20, 20, 20, 9.5, 9.5);
+    camera.extrinsic_ = Eigen::Matrix4d::Identity();
+    return camera;
+}
+
+TEST_P(VoxelGridPermuteDevices, Constructor) {
+    core::Device device = GetParam();
+
+    t::geometry::VoxelGrid voxel_grid(0.5, core::Tensor(), device);
+    EXPECT_EQ(voxel_grid.GetGeometryType(),
+              t::geometry::Geometry::GeometryType::VoxelGrid);
+    EXPECT_EQ(voxel_grid.GetDevice(), device);
+    EXPECT_EQ(voxel_grid.GetVoxelSize(), 0.5);
+    EXPECT_TRUE(voxel_grid.GetOrigin().AllClose(
+            core::Tensor::Zeros({3}, core::Float64, device)));
+    EXPECT_TRUE(voxel_grid.IsEmpty());
+
+    EXPECT_ANY_THROW(t::geometry::VoxelGrid(0, core::Tensor(), device));
+    EXPECT_ANY_THROW(t::geometry::VoxelGrid(
+            0.5, core::Tensor::Zeros({2}, core::Float64, device), device));
+}
+
+TEST_P(VoxelGridPermuteDevices, AddRemoveVoxels) {
+    core::Device device = GetParam();
+
+    t::geometry::VoxelGrid voxel_grid(0.5, core::Tensor(), device);
+    core::Tensor coordinates = core::Tensor::Init<int>(
+            {{0, 0, 0}, {1, 2, 3}, {-1, 0, 2}}, device);
+    core::Tensor colors = core::Tensor::Init<float>(
+            {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}}, device);
+    voxel_grid.AddVoxels(coordinates, colors);
+    EXPECT_EQ(voxel_grid.GetNumVoxels(), 3);
+
+    // Existing voxels keep their colors.
+    voxel_grid.AddVoxels(coordinates.Slice(0, 0, 1),
+                         core::Tensor::Ones({1, 3}, core::Float32, device));
+    EXPECT_EQ(voxel_grid.GetNumVoxels(), 3);
+
+    core::Tensor points = core::Tensor::Init<double>(
+            {{0.25, 0.25, 0.25}, {0.75, 1.25, 1.75}, {-0.25, 0.25, 1.25},
+             {0.75, 0.25, 0.25}},
+            device);
+    EXPECT_TRUE(voxel_grid.CheckIfIncluded(points).AllEqual(
+            core::Tensor::Init<bool>({true, true, true, false}, device)));
+
+    core::Tensor centers = voxel_grid.GetVoxelCenters();
+    core::Tensor found = voxel_grid.CheckIfIncluded(centers);
+    EXPECT_TRUE(found.All());
+    EXPECT_TRUE(voxel_grid.ComputeVoxelCoordinates(centers).AllEqual(
+            voxel_grid.GetVoxelCoordinates()));
+
+    voxel_grid.RemoveVoxels(coordinates.Slice(0, 1, 3));
+    EXPECT_EQ(voxel_grid.GetNumVoxels(), 1);
+    EXPECT_TRUE(voxel_grid.GetVoxelColors().AllClose(colors.Slice(0, 0, 1)));
+
+    t::geometry::VoxelGrid voxel_grid_clone = voxel_grid.Clone();
+    voxel_grid.Clear();
+    EXPECT_TRUE(voxel_grid.IsEmpty());
+    EXPECT_EQ(voxel_grid_clone.GetNumVoxels(), 1);
+}
+
+TEST_P(VoxelGridPermuteDevices, CreateFromPointCloud) {
+    core::Device device = GetParam();
+
+    geometry::PointCloud pcd_legacy;
+    for (int i = 0; i < 1000; ++i) {
+        double t = i * 0.01;
+        pcd_legacy.points_.emplace_back(std::sin(7 * t), std::cos(3 * t), t);
+        pcd_legacy.colors_.emplace_back(std::abs(std::sin(t)), 0.5,
+                                        std::abs(std::cos(5 * t)));
+    }
+    auto voxel_grid_legacy =
+            geometry::VoxelGrid::CreateFromPointCloud(pcd_legacy, 0.2);
+
+    t::geometry::PointCloud pcd = t::geometry::PointCloud::FromLegacy(
+            pcd_legacy, core::Float64, device);
+    t::geometry::VoxelGrid voxel_grid =
+            t::geometry::VoxelGrid::CreateFromPointCloud(pcd, 0.2);
+    EXPECT_TRUE(voxel_grid.GetOrigin().AllClose(
+            core::eigen_converter::EigenMatrixToTensor(
+                    voxel_grid_legacy->origin_)
+                    .Reshape({3})
+                    .To(device)));
+    EXPECT_TRUE(SameVoxels(
+            voxel_grid,
+            t::geometry::VoxelGrid::FromLegacy(*voxel_grid_legacy, device)));
+
+    // Colors are averaged on every device.
+    geometry::VoxelGrid voxel_grid_converted = voxel_grid.ToLegacy();
+    for (const auto &kv : voxel_grid_legacy->voxels_) {
+        ExpectEQ(voxel_grid_converted.voxels_.at(kv.first).color_,
+                 kv.second.color_, 1e-6);
+    }
+}
+
+TEST_P(VoxelGridPermuteDevices, SetOperations) {
+    core::Device device = GetParam();
+
+    t::geometry::VoxelGrid a(1.0, core::Tensor(), device);
+    a.AddVoxels(core::Tensor::Init<int>({{0, 0, 0}, {1, 0, 0}, {2, 0, 0}},
+                                        device),
+                core::Tensor::Ones({3, 3}, core::Float32, device));
+    t::geometry::VoxelGrid b(1.0, core::Tensor(), device);
+    b.AddVoxels(core::Tensor::Init<int>({{1, 0, 0}, {2, 0, 0}, {3, 0, 0}},
+                                        device));
+
+    t::geometry::VoxelGrid expected_union(1.0, core::Tensor(), device);
+    expected_union.AddVoxels(core::Tensor::Init<int>(
+            {{0, 0, 0}, {1, 0, 0}, {2, 0, 0}, {3, 0, 0}}, device));
+    t::geometry::VoxelGrid expected_intersection(1.0, core::Tensor(), device);
+    expected_intersection.AddVoxels(
+            core::Tensor::Init<int>({{1, 0, 0}, {2, 0, 0}}, device));
+    t::geometry::VoxelGrid expected_difference(1.0, core::Tensor(), device);
+    expected_difference.AddVoxels(
+            core::Tensor::Init<int>({{0, 0, 0}}, device));
+
+    EXPECT_TRUE(SameVoxels(a.Union(b), expected_union));
+    EXPECT_TRUE(SameVoxels(a.Intersection(b), expected_intersection));
+    EXPECT_TRUE(SameVoxels(a.Difference(b), expected_difference));
+    EXPECT_TRUE(b.Difference(a).Difference(b).IsEmpty());
+
+    // Voxels of both grids keep the colors of the left operand.
+    EXPECT_TRUE(a.Intersection(b).GetVoxelColors().AllClose(
+            core::Tensor::Ones({2, 3}, core::Float32, device)));
+    EXPECT_TRUE(b.Intersection(a).GetVoxelColors().AllClose(
+            core::Tensor::Zeros({2, 3}, core::Float32, device)));
+
+    t::geometry::VoxelGrid c(0.5, core::Tensor(), device);
+    EXPECT_ANY_THROW(a.Union(c));
+}
+
+TEST_P(VoxelGridPermuteDevices, DilateErode) {
+    core::Device device = GetParam();
+
+    t::geometry::VoxelGrid voxel_grid(1.0, core::Tensor(), device);
+    voxel_grid.AddVoxels(core::Tensor::Init<int>({{0, 0, 0}}, device));
+
+    voxel_grid.Dilate();
+    EXPECT_EQ(voxel_grid.GetNumVoxels(), 27);
+    voxel_grid.Dilate();
+    EXPECT_EQ(voxel_grid.GetNumVoxels(), 125);
+    EXPECT_TRUE(voxel_grid.GetVoxelCoordinates().Abs().Max({0}).AllEqual(
+            core::Tensor::Init<int>({2, 2, 2}, device)));
+
+    voxel_grid.Erode(2);
+    EXPECT_EQ(voxel_grid.GetNumVoxels(), 1);
+    EXPECT_TRUE(voxel_grid.GetVoxelCoordinates().AllEqual(
+            core::Tensor::Init<int>({{0, 0, 0}}, device)));
+
+    voxel_grid.Erode();
+    EXPECT_TRUE(voxel_grid.IsEmpty());
+}
+
+TEST_P(VoxelGridPermuteDevices, CarveDepthMap) {
+    core::Device device = GetParam();
+    camera::PinholeCameraParameters camera = CreateCamera();
+    core::Tensor intrinsics = core::eigen_converter::EigenMatrixToTensor(
+            camera.intrinsic_.intrinsic_matrix_);
+    core::Tensor extrinsics =
+            core::eigen_converter::EigenMatrixToTensor(camera.extrinsic_);
+
+    // A plane at depth 1.5 over the right half of the image.
+    geometry::Image depth_legacy;
+    depth_legacy.Prepare(20, 20, 1, 4);
+    for (int v = 0; v < 20; ++v) {
+        for (int u = 0; u < 20; ++u) {
+            *depth_legacy.PointerAt<float>(u, v) = u < 10 ? 0.0f : 1.5f;
+        }
+    }
+    t::geometry::Image depth =
+            t::geometry::Image::FromLegacy(depth_legacy, device);
+
+    for (bool keep_voxels_outside_image : {false, true}) {
+        geometry::VoxelGrid voxel_grid_legacy = CreateLegacyBlock();
+        voxel_grid_legacy.CarveDepthMap(depth_legacy, camera,
+                                        keep_voxels_outside_image);
+
+        t::geometry::VoxelGrid voxel_grid =
+                t::geometry::VoxelGrid::FromLegacy(CreateLegacyBlock(),
+                                                   device);
+        voxel_grid.CarveDepthMap(depth, intrinsics, extrinsics, 1.0,
+                                 keep_voxels_outside_image);
+        EXPECT_GT(voxel_grid.GetNumVoxels(), 0);
+        EXPECT_LT(voxel_grid.GetNumVoxels(), 1000);
+        EXPECT_TRUE(SameVoxels(voxel_grid, t::geometry::VoxelGrid::FromLegacy(
+                                                   voxel_grid_legacy, device)));
+    }
+}
+
+TEST_P(VoxelGridPermuteDevices, CarveSilhouette) {
+    core::Device device = GetParam();
+    camera::PinholeCameraParameters camera = CreateCamera();
+    core::Tensor intrinsics = core::eigen_converter::EigenMatrixToTensor(
+            camera.intrinsic_.intrinsic_matrix_);
+    core::Tensor extrinsics =
+            core::eigen_converter::EigenMatrixToTensor(camera.extrinsic_);
+
+    // A disk in the middle of the image.
+    geometry::Image mask_legacy;
+    mask_legacy.Prepare(20, 20, 1, 4);
+    for (int v = 0; v < 20; ++v) {
+        for (int u = 0; u < 20; ++u) {
+            double r2 = (u - 9.5) * (u - 9.5) + (v - 9.5) * (v - 9.5);
+            *mask_legacy.PointerAt<float>(u, v) = r2 < 25 ? 1.0f : 0.0f;
+        }
+    }
+    t::geometry::Image mask =
+            t::geometry::Image::FromLegacy(mask_legacy, device);
+
+    for (bool keep_voxels_outside_image : {false, true}) {
+        geometry::VoxelGrid voxel_grid_legacy = CreateLegacyBlock();
+        voxel_grid_legacy.CarveSilhouette(mask_legacy, camera,
+                                          keep_voxels_outside_image);
+
+        t::geometry::VoxelGrid voxel_grid =
+                t::geometry::VoxelGrid::FromLegacy(CreateLegacyBlock(),
+                                                   device);
+        voxel_grid.CarveSilhouette(mask, intrinsics, extrinsics,
+                                   keep_voxels_outside_image);
+        EXPECT_GT(voxel_grid.GetNumVoxels(), 0);
+        EXPECT_LT(voxel_grid.GetNumVoxels(), 1000);
+        EXPECT_TRUE(SameVoxels(voxel_grid, t::geometry::VoxelGrid::FromLegacy(
+                                                   voxel_grid_legacy, device)));
+    }
+}
+
+TEST_P(VoxelGridPermuteDevices, FromToLegacy) {
+    core::Device device = GetParam();
+
+    geometry::VoxelGrid voxel_grid_legacy = CreateLegacyBlock();
+    t::geometry::VoxelGrid voxel_grid =
+            t::geometry::VoxelGrid::FromLegacy(voxel_grid_legacy, device);
+    EXPECT_EQ(voxel_grid.GetNumVoxels(), 1000);
+    EXPECT_EQ(voxel_grid.GetVoxelSize(), 0.1);
+
+    geometry::VoxelGrid voxel_grid_converted = voxel_grid.ToLegacy();
+    ExpectEQ(voxel_grid_converted.origin_, voxel_grid_legacy.origin_);
+    EXPECT_EQ(voxel_grid_converted.voxels_.size(), 1000u);
+    for (const auto &kv : voxel_grid_legacy.voxels_) {
+        ExpectEQ(voxel_grid_converted.voxels_.at(kv.first).color_,
+                 kv.second.color_, 1e-6);
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
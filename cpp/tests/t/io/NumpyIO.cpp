@@ -99,6 +99,28 @@ TEST_P(NumpyIOPermuteDevices, NpyWriteRead) {
     utility::filesystem::RemoveFile(file_name);
 }
 
+TEST_P(NumpyIOPermuteDevices, NpyWriteReadHalf) {
+    const core::Device device = GetParam();
+    const std::string file_name = "tensor_half.npy";
+
+    // Float16 maps to NumPy's float16 ("<f2").
+    core::Tensor t = core::Tensor::Init<float>({{1, 2.5}, {-3, 0.125}})
+                             .To(core::Float16)
+                             .To(device);
+    t.Save(file_name);
+    core::Tensor t_load = core::Tensor::Load(file_name);
+    EXPECT_EQ(t_load.GetDtype(), core::Float16);
+    EXPECT_TRUE(t_load.AllEqual(t.To(core::Device("CPU:0"))));
+
+    // BFloat16 has no NumPy equivalent.
+    EXPECT_ANY_THROW(t.To(core::Device("CPU:0"))
+                             .To(core::BFloat16)
+                             .Save(file_name));
+
+    // Clean up.
+    utility::filesystem::RemoveFile(file_name);
+}
+
 TEST_P(NumpyIOPermuteDevices, NpzWriteRead) {
     const core::Device device = GetParam();
     const std::string file_name = "tensors.npz";
@@ -235,6 +257,86 @@ TEST_P(NumpyIOPermuteDevices, NpzReadCompressed) {
     core::Tensor t5_load = tensor_map.at("t5");
     EXPECT_TRUE(t5.AllClose(t5_load.To(device)));
     EXPECT_EQ(t5.GetDtype(), t5_load.GetDtype());
+
+    // Compressed tensors are decompressed from the mapped file.
+    tensor_map = t::io::ReadNpz(file_name, t::io::MmapMode::ReadOnly);
+    EXPECT_EQ(tensor_map.size(), 6);
+    EXPECT_TRUE(t0.AllClose(tensor_map.at("t0").To(device)));
+    EXPECT_TRUE(t1.AllClose(tensor_map.at("t1").To(device)));
+    EXPECT_TRUE(t5.AllClose(tensor_map.at("t5").To(device)));
+}
+
+TEST_P(NumpyIOPermuteDevices, NpyReadMmap) {
+    const core::Device device = GetParam();
+    const std::string file_name = "tensor_mmap.npy";
+
+    core::Tensor t = core::Tensor::Init<float>({{1, 2}, {3, 4}}, device);
+    t.Save(file_name);
+
+    // Read-only mapping.
+    core::Tensor t_load = t::io::ReadNpy(file_name, t::io::MmapMode::ReadOnly);
+    EXPECT_TRUE(t.AllClose(t_load.To(device)));
+    EXPECT_EQ(t.GetDtype(), t_load.GetDtype());
+
+    // Copy-on-write mapping, writes are not persisted to the file.
+    t_load = core::Tensor::Load(file_name, /*memory_map=*/true);
+    EXPECT_TRUE(t.AllClose(t_load.To(device)));
+    t_load.Fill(0);
+    EXPECT_EQ(t_load.ToFlatVector<float>(), std::vector<float>({0, 0, 0, 0}));
+    EXPECT_TRUE(t.AllClose(core::Tensor::Load(file_name).To(device)));
+
+    // The tensor keeps the mapping alive after the file is removed.
+    t_load = core::Tensor::Load(file_name, /*memory_map=*/true);
+    utility::filesystem::RemoveFile(file_name);
+    EXPECT_TRUE(t.AllClose(t_load.To(device)));
+
+    // Empty tensor.
+    t = core::Tensor::Ones({0, 1, 0}, core::Float32, device);
+    t.Save(file_name);
+    t_load = core::Tensor::Load(file_name, /*memory_map=*/true);
+    EXPECT_EQ(t_load.GetShape(), core::SizeVector({0, 1, 0}));
+
+    // Clean up.
+    utility::filesystem::RemoveFile(file_name);
+}
+
+TEST_P(NumpyIOPermuteDevices, NpzReadMmap) {
+    const core::Device device = GetParam();
+    const std::string file_name = "tensors_mmap.npz";
+
+    // Empty map.
+    t::io::WriteNpz(file_name, {});
+    EXPECT_EQ(t::io::ReadNpz(file_name, t::io::MmapMode::ReadOnly).size(), 0);
+
+    core::Tensor t0 = core::Tensor::Init<int32_t>({{1, 2}, {3, 4}}, device);
+    core::Tensor t1 = core::Tensor::Init<double>({1.5, 2.5, 3.5}, device);
+    core::Tensor t2 = core::Tensor::Init<uint8_t>({1, 2, 3}, device);
+    core::Tensor t3 = core::Tensor::Ones({0}, core::Float32, device);
+    t::io::WriteNpz(file_name,
+                    {{"t0", t0}, {"t1", t1}, {"t2", t2}, {"t3", t3}});
+
+    for (t::io::MmapMode mmap_mode :
+         {t::io::MmapMode::ReadOnly, t::io::MmapMode::CopyOnWrite}) {
+        std::unordered_map<std::string, core::Tensor> tensor_map =
+                t::io::ReadNpz(file_name, mmap_mode);
+        EXPECT_EQ(tensor_map.size(), 4);
+        EXPECT_TRUE(t0.AllClose(tensor_map.at("t0").To(device)));
+        EXPECT_TRUE(t1.AllClose(tensor_map.at("t1").To(device)));
+        EXPECT_TRUE(t2.AllClose(tensor_map.at("t2").To(device)));
+        EXPECT_TRUE(t3.AllClose(tensor_map.at("t3").To(device)));
+        EXPECT_EQ(t1.GetDtype(), tensor_map.at("t1").GetDtype());
+
+        // Written tensors are aligned so that they view the mapping in place.
+        for (const std::string name : {"t0", "t1", "t2"}) {
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(
+                              tensor_map.at(name).GetDataPtr()) %
+                              64,
+                      0u);
+        }
+    }
+
+    // Clean up.
+    utility::filesystem::RemoveFile(file_name);
 }
 
 }  // namespace tests
@@ -0,0 +1,147 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/RANSAC.h"
+
+#include <Eigen/Core>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+class LineScore {
+public:
+    bool IsBetterRANSACThan(const LineScore& other) const {
+        return fitness_ > other.fitness_;
+    }
+
+public:
+    double fitness_ = 0;
+};
+
+}  // namespace
+
+TEST(RANSAC, IterationBound) {
+    EXPECT_NEAR(utility::RANSACIterationBound(0.5, 3, 0.99),
+                std::log(0.01) / std::log(1 - 0.125), 1e-9);
+    EXPECT_EQ(utility::RANSACIterationBound(1.0, 3, 0.99), 0.0);
+    EXPECT_TRUE(std::isinf(utility::RANSACIterationBound(0.0, 3, 0.99)));
+    EXPECT_TRUE(std::isinf(utility::RANSACIterationBound(0.5, 3, 1.0)));
+    // Tiny inlier ratios must not terminate the search.
+    EXPECT_TRUE(std::isinf(utility::RANSACIterationBound(1e-200, 3, 0.99)));
+}
+
+TEST(RANSAC, FitLine) {
+    // 70% of the points lie on y = 2x + 1, the rest is uniform clutter.
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(-10, 10);
+    std::vector<Eigen::Vector2d> points;
+    for (int i = 0; i < 7000; ++i) {
+        const double x = uniform(rng);
+        points.emplace_back(x, 2 * x + 1);
+    }
+    for (int i = 0; i < 3000; ++i) {
+        points.emplace_back(uniform(rng), uniform(rng));
+    }
+
+    const double threshold = 1e-3;
+    auto fit = [&](const std::vector<size_t>& sample, Eigen::Vector2d& line) {
+        const Eigen::Vector2d& p = points[sample[0]];
+        const Eigen::Vector2d& q = points[sample[1]];
+        if (p.x() == q.x()) {
+            return false;
+        }
+        line(0) = (q.y() - p.y()) / (q.x() - p.x());
+        line(1) = p.y() - line(0) * p.x();
+        return true;
+    };
+    auto is_inlier = [&](const Eigen::Vector2d& line, size_t idx) {
+        const Eigen::Vector2d& p = points[idx];
+        return std::abs(line(0) * p.x() + line(1) - p.y()) < threshold;
+    };
+    auto score = [&](const Eigen::Vector2d& line) {
+        LineScore s;
+        for (size_t i = 0; i < points.size(); ++i) {
+            s.fitness_ += is_inlier(line, i);
+        }
+        s.fitness_ /= double(points.size());
+        return s;
+    };
+    auto inlier_ratio = [](const Eigen::Vector2d&, const LineScore& s) {
+        return s.fitness_;
+    };
+
+    const int max_iteration = 10000;
+    utility::RANSACEngine engine(2, max_iteration, 0.9999);
+    auto result = engine.Run<Eigen::Vector2d, LineScore>(
+            points.size(), fit, is_inlier, score, inlier_ratio, 0);
+    ASSERT_TRUE(result.found_);
+    EXPECT_NEAR(result.model_(0), 2.0, 1e-6);
+    EXPECT_NEAR(result.model_(1), 1.0, 1e-6);
+    EXPECT_NEAR(result.score_.fitness_, 0.7, 1e-3);
+    // Early termination kicks in long before max_iteration.
+    EXPECT_LT(result.num_iterations_, max_iteration / 10);
+    EXPECT_EQ(result.num_validations_, result.num_iterations_);
+
+    // The T(1,1) test skips the full scoring of most bad lines.
+    utility::RANSACEngine pre_verify_engine(2, max_iteration, 0.9999, 1);
+    result = pre_verify_engine.Run<Eigen::Vector2d, LineScore>(
+            points.size(), fit, is_inlier, score, inlier_ratio, 0);
+    ASSERT_TRUE(result.found_);
+    EXPECT_NEAR(result.model_(0), 2.0, 1e-6);
+    EXPECT_NEAR(result.model_(1), 1.0, 1e-6);
+    EXPECT_LT(result.num_validations_, result.num_iterations_);
+
+    // Too few data points for a sample.
+    result = engine.Run<Eigen::Vector2d, LineScore>(1, fit, is_inlier, score,
+                                                    inlier_ratio, 0);
+    EXPECT_FALSE(result.found_);
+
+    // Seeded runs stop at the end of a block and are reproducible. Unseeded
+    // runs may stop anywhere.
+    auto result0 = engine.Run<Eigen::Vector2d, LineScore>(
+            points.size(), fit, is_inlier, score, inlier_ratio, 5);
+    auto result1 = engine.Run<Eigen::Vector2d, LineScore>(
+            points.size(), fit, is_inlier, score, inlier_ratio, 5);
+    EXPECT_EQ(result0.num_iterations_ % utility::RANSACEngine::kSeededBlockSize,
+              0);
+    EXPECT_EQ(result0.num_iterations_, result1.num_iterations_);
+    EXPECT_EQ(result0.model_, result1.model_);
+    result = engine.Run<Eigen::Vector2d, LineScore>(
+            points.size(), fit, is_inlier, score, inlier_ratio,
+            utility::nullopt);
+    ASSERT_TRUE(result.found_);
+    EXPECT_NEAR(result.model_(0), 2.0, 1e-6);
+}
+
+}  // namespace tests
+}  // namespace open3d